@@ -3,6 +3,9 @@
 uniform sampler2D uImage;
 uniform ivec2 uInImageProp;  // x: encoding type, y: color primaries type
 uniform float uEV;
+uniform vec2 uOffset;       // Offset of aligned pixels in rows from top, see ImageAlignment.
+uniform vec3 uViewXform;    // Mosaic tile: xy is image offset in tile, z is image scale. Zero scale grades all image pixels.
+uniform bool uLinearFilter; // Interpolate zoomed-in pixels of mosaic tile.
 
 in  vec2 vUV;
 out vec4 oColor;
@@ -107,12 +110,80 @@ vec3 inputTransform(vec3 color, int type)
     return color;
 }
 
+vec4 gradeTexel(ivec2 pixel)
+{
+    ivec2 maxPixel = textureSize(uImage, 0) - ivec2(1);
+    vec4 color = texelFetch(uImage, clamp(pixel, ivec2(0), maxPixel), 0);
+    color.rgb = decode(color.rgb, uInImageProp.x);
+    color.rgb = inputTransform(color.rgb, uInImageProp.y);
+    return color;
+}
+
+// Unlike mix(), zero weight keeps NaN of the other value from spreading.
+vec4 lerp(vec4 a, vec4 b, float t)
+{
+    return t == 0.0 ? a : mix(a, b, t);
+}
+
+// Resample bilinearly after decoding, thus texels are blended in linear values.
+// @param pixel Coordinates in rows from top, texel centers are at half integers.
+vec4 gradeBilinear(vec2 pixel)
+{
+    pixel -= 0.5;
+    vec2 weight = fract(pixel);
+    ivec2 base = ivec2(floor(pixel));
+    vec4 row0 = lerp(gradeTexel(base), gradeTexel(base + ivec2(1, 0)), weight.x);
+    vec4 row1 = lerp(gradeTexel(base + ivec2(0, 1)), gradeTexel(base + ivec2(1, 1)), weight.x);
+    return lerp(row0, row1, weight.y);
+}
+
+// Grade pixel of mosaic tile, which covers the visible region of image at screen resolution.
+// Source textures have no mips, thus zoomed-out pixels average up to 4x4 texels over their
+// footprints instead, and the cost per tile pixel is bounded. Alpha is 0 outside image.
+vec4 gradeViewPixel()
+{
+    ivec2 size = textureSize(uImage, 0);
+    vec2 imageCoords = (gl_FragCoord.xy - uViewXform.xy) / uViewXform.z;
+    if (any(lessThan(imageCoords, vec2(0.0))) || any(greaterThanEqual(imageCoords, vec2(size)))) {
+        return vec4(0.0);
+    }
+
+    vec2 pixel = vec2(imageCoords.x, float(size.y) - imageCoords.y) + uOffset;
+    float footprint = 1.0 / uViewXform.z;
+    vec4 color;
+    if (footprint > 1.0) {
+        int tapNum = min(int(ceil(footprint)), 4);
+        color = vec4(0.0);
+        for (int j = 0; j < tapNum; ++j) {
+            for (int i = 0; i < tapNum; ++i) {
+                vec2 tap = pixel + ((vec2(i, j) + 0.5) / float(tapNum) - 0.5) * footprint;
+                color += gradeTexel(ivec2(floor(tap)));
+            }
+        }
+        color /= float(tapNum * tapNum);
+    } else if (uLinearFilter) {
+        color = gradeBilinear(pixel);
+    } else {
+        color = gradeTexel(ivec2(floor(pixel)));
+    }
+
+    return vec4(color.rgb, 1.0);
+}
+
 void main()
 {
-    vec2 uv = vUV;
-    uv.y = 1.0 - uv.y;  // Flip y-axis for imported image.
-    oColor = texture(uImage, uv);
-    oColor.rgb = decode(oColor.rgb, uInImageProp.x);
-    oColor.rgb = inputTransform(oColor.rgb, uInImageProp.y);
+    if (uViewXform.z > 0.0) {
+        oColor = gradeViewPixel();
+    } else if (uOffset == vec2(0.0)) {
+        vec2 uv = vUV;
+        uv.y = 1.0 - uv.y;  // Flip y-axis for imported image.
+        oColor = texture(uImage, uv);
+        oColor.rgb = decode(oColor.rgb, uInImageProp.x);
+        oColor.rgb = inputTransform(oColor.rgb, uInImageProp.y);
+    } else {
+        vec2 pixel = vec2(gl_FragCoord.x, float(textureSize(uImage, 0).y) - gl_FragCoord.y) + uOffset;
+        oColor = gradeBilinear(pixel);
+    }
+
     oColor.rgb *= pow(2.0, uEV);
 }
\ No newline at end of file
@@ -0,0 +1,334 @@
+// Color transform library shared by shaders of image presentation.
+//
+// This file has no #version directive, it is injected right after the version
+// line of the main shader source (see Shader::injectLibrary).
+
+//-----------------------------------------------------------------------------
+// Color Transfor Matrices
+//-----------------------------------------------------------------------------
+// The color space transformation defined in ACES CTL is row vector-times-matrix.
+// Therefore we define mul as y * x to both match CTL for better reference.
+// https://github.com/ampas/aces-dev/blob/master/transforms/ctl/README-MATRIX.md
+#define mul(x, y) (y * x)
+
+const mat3 AP1_2_XYZ_MAT = mat3(
+     0.6624541811, 0.1340042065, 0.1561876870,
+     0.2722287168, 0.6740817658, 0.0536895174,
+    -0.0055746495, 0.0040607335, 1.0103391003);
+
+const mat3 XYZ_2_AP1_MAT = mat3(
+     1.6410233797, -0.3248032942, -0.2364246952,
+    -0.6636628587,  1.6153315917,  0.0167563477,
+     0.0117218943, -0.0082844420,  0.9883948585);
+
+const mat3 AP1_2_BT709_MAT = mat3(
+    1.7050515, -0.6217907, -0.0832587,
+   -0.1302571,  1.1408029, -0.0105482,
+   -0.0240033, -0.1289688,  1.1529717);
+
+const mat3 AP1_2_P3D65_MAT = mat3(
+    1.3792145, -0.3088633, -0.0703498,
+   -0.0693355,  1.0822950, -0.0129618,
+   -0.0021590, -0.0454592,  1.0476177);
+
+const mat3 AP1_2_BT2020_MAT = mat3(
+    1.0258249, -0.0200529, -0.0057714,
+   -0.002235 ,  1.0045849, -0.0023520,
+   -0.0050133, -0.0252900,  1.0303028);
+
+const mat3 AP1_2_AP0_MAT = mat3(
+     0.6954522414, 0.1406786965, 0.1638690622,
+     0.0447945634, 0.8596711185, 0.0955343182,
+    -0.0055258826, 0.0040252103, 1.0015006723);
+
+const mat3 AP0_2_AP1_MAT = mat3(
+     1.4514393161, -0.2365107469, -0.2149285693,
+    -0.0765537734,  1.1762296998, -0.0996759264,
+     0.0083161484, -0.0060324498,  0.9977163014);
+
+//-----------------------------------------------------------------------------
+// Color Transform Functions
+//-----------------------------------------------------------------------------
+
+float labf(float v)
+{
+    const float c1 = 0.008856451679;    // pow(6.0/29.0, 3.0);
+    const float c2 = 7.787037037;       // pow(29.0/6.0, 2.0)/3;
+    const float c3 = 0.1379310345;      // 16.0/116.0
+    return mix(c2 * v + c3, pow(v, 1.0 / 3.0), v > c1);
+}
+
+vec3 XYZtoLab(vec3 xyz)
+{
+    const vec3 D65WhitePoint = vec3(0.95047, 1.000, 1.08883);
+    xyz /= D65WhitePoint;
+
+    vec3 v = vec3(labf(xyz.x), labf(xyz.y), labf(xyz.z));
+    return vec3((116.0 * v.y) - 16.0,
+                 500.0 * (v.x - v.y),
+                 200.0 * (v.y - v.z));
+}
+
+//-----------------------------------------------------------------------------
+// ACES Tone Mapping ported from: https://github.com/ampas/aces-dev/tree/master/transforms/ctl
+// https://github.com/ampas/aces-dev/blob/master/transforms/ctl/lib/ACESlib.Utilities_Color.ctl
+//-----------------------------------------------------------------------------
+#define HALF_MIN 5.96e-08
+#define HALF_MAX 65504.0
+#define PI 3.14159265359
+
+mediump float rgb_2_saturation(vec3 rgb)
+{
+    const mediump float TINY = HALF_MIN;
+    mediump float ma = max(rgb.r, max(rgb.g, rgb.b));
+    mediump float mi = min(rgb.r, min(rgb.g, rgb.b));
+    return (max(ma, TINY) - max(mi, TINY)) / max(ma, 1e-2);
+}
+
+mediump float rgb_2_yc(vec3 rgb)
+{
+    const mediump float ycRadiusWeight = 1.75;
+
+    // Converts RGB to a luminance proxy, here called YC
+    // YC is ~ Y + K * Chroma
+    // Constant YC is a cone-shaped surface in RGB space, with the tip on the
+    // neutral axis, towards white.
+    // YC is normalized: RGB 1 1 1 maps to YC = 1
+    //
+    // ycRadiusWeight defaults to 1.75, although can be overridden in function
+    // call to rgb_2_yc
+    // ycRadiusWeight = 1 -> YC for pure cyan, magenta, yellow == YC for neutral
+    // of same value
+    // ycRadiusWeight = 2 -> YC for pure red, green, blue  == YC for  neutral of
+    // same value.
+
+    mediump float r = rgb.x;
+    mediump float g = rgb.y;
+    mediump float b = rgb.z;
+    mediump float chroma = sqrt(b * (b - g) + g * (g - r) + r * (r - b));
+    return (b + g + r + ycRadiusWeight * chroma) / 3.0;
+}
+
+mediump float rgb_2_hue(vec3 rgb)
+{
+    // Returns a geometric hue angle in degrees (0-360) based on RGB values.
+    // For neutral colors, hue is undefined and the function will return a quiet NaN value.
+    mediump float hue;
+    if (rgb.x == rgb.y && rgb.y == rgb.z) {
+        hue = 0.0; // RGB triplets where RGB are equal have an undefined hue
+    } else {
+        hue = (180.0 / PI) * atan(sqrt(3.0) * (rgb.y - rgb.z), 2.0 * rgb.x - rgb.y - rgb.z);
+    }
+
+    if (hue < 0.0) hue = hue + 360.0;
+
+    return hue;
+}
+
+mediump float center_hue(mediump float hue, mediump float centerH)
+{
+    mediump float hueCentered = hue - centerH;
+    if (hueCentered < -180.0) hueCentered = hueCentered + 360.0;
+    else if (hueCentered > 180.0) hueCentered = hueCentered - 360.0;
+    return hueCentered;
+}
+
+mediump float sigmoid_shaper(mediump float x)
+{
+    // Sigmoid function in the range 0 to 1 spanning -2 to +2.
+
+    mediump float t = max(1.0 - abs(x / 2.0), 0.0);
+    mediump float y = 1.0 + sign(x) * (1.0 - t * t);
+
+    return y / 2.0;
+}
+
+mediump float glow_fwd(mediump float ycIn, mediump float glowGainIn, mediump float glowMid)
+{
+    mediump float glowGainOut;
+
+    if (ycIn <= 2.0 / 3.0 * glowMid) {
+        glowGainOut = glowGainIn;
+    } else if (ycIn >= 2.0 * glowMid) {
+        glowGainOut = 0.0;
+    } else {
+        glowGainOut = glowGainIn * (glowMid / ycIn - 1.0 / 2.0);
+    }
+
+    return glowGainOut;
+}
+
+vec3 XYZ_2_xyY(vec3 XYZ)
+{
+    mediump float divisor = max(dot(XYZ, vec3(1.0)), HALF_MIN);
+    return vec3(XYZ.xy / divisor, XYZ.y);
+}
+
+vec3 xyY_2_XYZ(vec3 xyY)
+{
+    mediump float m = xyY.z / max(xyY.y, HALF_MIN);
+    vec3 XYZ = vec3(xyY.xz, (1.0 - xyY.x - xyY.y));
+    XYZ.xz *= m;
+    return XYZ;
+}
+
+const mediump float DIM_SURROUND_GAMMA = 0.9811;
+const mediump float RRT_GLOW_GAIN = 0.05;
+const mediump float RRT_GLOW_MID = 0.08;
+const mediump float RRT_RED_SCALE = 0.82;
+const mediump float RRT_RED_PIVOT = 0.03;
+const mediump float RRT_RED_HUE = 0.0;
+const mediump float RRT_RED_WIDTH = 135.0;
+
+const mat3 RRT_SAT_MAT = mat3(
+    0.9708890, 0.0269633, 0.00214758,
+    0.0108892, 0.9869630, 0.00214758,
+    0.0108892, 0.0269633, 0.96214800);
+
+const mat3 ODT_SAT_MAT = mat3(
+    0.949056, 0.0471857, 0.00375827,
+    0.019056, 0.9771860, 0.00375827,
+    0.019056, 0.0471857, 0.93375800);
+
+
+vec3 darkSurround_to_dimSurround(vec3 linearCV)
+{
+    vec3 XYZ = mul(AP1_2_XYZ_MAT, linearCV);
+
+    vec3 xyY = XYZ_2_xyY(XYZ);
+    xyY.z = clamp(xyY.z, 0.0, HALF_MAX);
+    xyY.z = pow(xyY.z, DIM_SURROUND_GAMMA);
+    XYZ = xyY_2_XYZ(xyY);
+
+    return mul(XYZ_2_AP1_MAT, XYZ);
+}
+
+//! This is a numerical fitted version.
+//! @param aces Linear encoded color with AP0 color parmaries.
+//! @return Linear encoded color in AP1 color space.
+vec3 AcesToneMapping(vec3 aces)
+{
+    // --- Glow module --- //
+    float saturation = rgb_2_saturation(aces);
+    float ycIn = rgb_2_yc(aces);
+    float s = sigmoid_shaper((saturation - 0.4) / 0.2);
+    float addedGlow = 1.0 + glow_fwd(ycIn, RRT_GLOW_GAIN * s, RRT_GLOW_MID);
+    aces *= addedGlow;
+
+    // --- Red modifier --- //
+    float hue = rgb_2_hue(aces);
+    float centeredHue = center_hue(hue, RRT_RED_HUE);
+    float hueWeight;
+    {
+        //hueWeight = cubic_basis_shaper(centeredHue, RRT_RED_WIDTH);
+        hueWeight = smoothstep(0.0, 1.0, 1.0 - abs(2.0 * centeredHue / RRT_RED_WIDTH));
+        hueWeight *= hueWeight;
+    }
+
+    aces.r += hueWeight * saturation * (RRT_RED_PIVOT - aces.r) * (1.0 - RRT_RED_SCALE);
+
+    // --- ACES to RGB rendering space --- //
+    aces = max(vec3(0.0), aces);
+    vec3 rgbPre = mul(AP0_2_AP1_MAT, aces);
+    rgbPre = clamp(rgbPre, vec3(0.0), vec3(HALF_MAX));
+
+    // --- Global desaturation --- //
+    rgbPre = mul(RRT_SAT_MAT, rgbPre);
+
+    // Apply achromic curve that represents (post RRT + pre ODT).
+    // See the link below for the fitting process of curve coefficients
+    // https://github.com/shihchinw/numex/blob/master/notebooks/aces_color_transform.ipynb
+    const float a = 180.08877305;
+    const float b = 5.82507674;
+    const float c = 190.14106451;
+    const float d = 56.89654471;
+    const float e = 53.22517853;
+
+    vec3 rgbPost = (rgbPre * (a * rgbPre + b)) / (rgbPre * (c * rgbPre + d) + e);
+
+    // Apply gamma adjustment to compensate for dim surround
+    vec3 linearCV = darkSurround_to_dimSurround(rgbPost);
+
+    // Apply desaturation to compensate for luminance difference
+    return mul(ODT_SAT_MAT, linearCV);
+}
+
+//! Apply color filter.
+//! @param color Linear color in AP1 space.
+//! @param mode Present mode of channels, see presentModes@App::initToolbar.
+vec3 colorTransform(vec3 color, int mode, bool applyToneMapping)
+{
+    if (applyToneMapping) {
+        color = AcesToneMapping(mul(AP1_2_AP0_MAT, color)); // Output result is in AP1.
+    }
+
+    if (mode == 1) {
+        color = color.rrr;
+    } else if (mode == 2) {
+        color = color.ggg;
+    } else if (mode == 3) {
+        color = color.bbb;
+    } else if (mode == 4) {
+        color = mul(AP1_2_XYZ_MAT, color).yyy;
+    } else if (mode >= 5 && mode < 8) { // L*, a*, b*
+        const vec3 labMin = vec3(0, -128, -128);
+        const vec3 labMax = vec3(100, 128, 128);
+
+        vec3 lab = XYZtoLab(mul(AP1_2_XYZ_MAT, color));
+        color = ((lab - labMin) / (labMax - labMin));
+        color = vec3(color[mode - 5]);
+    }
+
+    return color;
+}
+
+// Transform color from AP1 to target color space.
+// This is ODT (Ouput Device Transform)
+vec3 outputTransform(vec3 color, int type, float gamma)
+{
+    if (type == 0) {
+        color = mul(AP1_2_BT709_MAT, color);
+    } else if (type == 1) {
+        color = mul(AP1_2_P3D65_MAT, color);
+    } else if (type == 2) {
+        color = mul(AP1_2_BT2020_MAT, color);
+    }
+
+    color = max(color, vec3(0.0));  // Color values for output device should be positive.
+    return pow(color, vec3(1.0 / gamma)); // Apply display gamma
+}
+
+// Return squared distance of two colors (linear AP1) in CIE Lab space.
+float getColorDistance(vec3 color1, vec3 color2)
+{
+    vec3 lab1 = XYZtoLab(mul(AP1_2_XYZ_MAT, color1));
+    vec3 lab2 = XYZtoLab(mul(AP1_2_XYZ_MAT, color2));
+    vec3 diff = lab1 - lab2;
+    return dot(diff, diff);
+}
+
+//-----------------------------------------------------------------------------
+// Shaper of baked tone mapping LUT
+//-----------------------------------------------------------------------------
+// The input of tone mapping is scene linear, thus LUT samples are distributed
+// with a power function to get dense samples near black. Values above
+// LUT_SHAPER_MAX_VALUE are clamped, where the tone curve is already saturated.
+const float LUT_SHAPER_EXPONENT = 3.0;
+const float LUT_SHAPER_MAX_VALUE = 64.0;
+
+vec3 lutShaper(vec3 color)
+{
+    vec3 value = clamp(color / LUT_SHAPER_MAX_VALUE, 0.0, 1.0);
+    return pow(value, vec3(1.0 / LUT_SHAPER_EXPONENT));
+}
+
+vec3 lutShaperInverse(vec3 value)
+{
+    return pow(value, vec3(LUT_SHAPER_EXPONENT)) * LUT_SHAPER_MAX_VALUE;
+}
+
+// Return texture coordinates of the texel centers of LUT with given size.
+vec3 getLutCoords(vec3 shapedValue, float lutSize)
+{
+    return shapedValue * ((lutSize - 1.0) / lutSize) + vec3(0.5 / lutSize);
+}
@@ -0,0 +1,22 @@
+#version 330
+
+// Difference of graded image pair. It's rebuilt only when any input of the pair
+// is changed, thus present.frag doesn't evaluate color distance every frame.
+// RGB: per-channel absolute differences, A: squared distance in CIE Lab space.
+
+uniform sampler2D uImage1;  // Top image, the output has the same size.
+uniform sampler2D uImage2;  // Compared image, it's sampled by UV as present.frag.
+
+in  vec2 vUV;
+out vec4 oColor;
+
+// The output is stored in half float, avoid overflowing to infinity.
+const float HALF_FLOAT_MAX = 65504.0;
+
+void main()
+{
+    vec3 color1 = texelFetch(uImage1, ivec2(gl_FragCoord.xy), 0).rgb;
+    vec3 color2 = texture(uImage2, vUV).rgb;
+    oColor.rgb = min(abs(color1 - color2), vec3(HALF_FLOAT_MAX));
+    oColor.a = min(getColorDistance(color1, color2), HALF_FLOAT_MAX);
+}
@@ -0,0 +1,54 @@
+#version 330
+
+// Bake ACES tone mapping into a 3D LUT. Each draw renders one slice of the LUT,
+// the input color of each texel is decoded from the shaper defined in
+// color_transform.glsl. Output transforms and display gamma are cheap to
+// evaluate, and they are kept analytic in present.frag for better accuracy.
+
+uniform sampler3D uToneMappingLut;  // Baked LUT to be verified.
+
+uniform int     uLutSize;
+uniform int     uSlice;
+uniform int     uOutTransformType;
+uniform float   uDisplayGamma;
+uniform bool    uVerify;
+
+in  vec2 vUV;
+out vec4 oColor;
+
+vec3 toneMapping(vec3 color)
+{
+    return AcesToneMapping(mul(AP1_2_AP0_MAT, color));
+}
+
+// Return display color of tone mapped color, this mirrors present.frag.
+vec3 getDisplayColor(vec3 color)
+{
+    color = clamp(color, vec3(0.0), vec3(1.0));
+    return outputTransform(color, uOutTransformType, uDisplayGamma);
+}
+
+void main()
+{
+    ivec2 xy = ivec2(gl_FragCoord.xy);
+    float gridSize = float(uLutSize - 1);
+
+    if (!uVerify) {
+        vec3 shapedValue = vec3(xy, uSlice) / gridSize;
+        oColor = vec4(toneMapping(lutShaperInverse(shapedValue)), 1.0);
+        return;
+    }
+
+    // In verification mode, each texel represents the center of one LUT cell
+    // where the interpolation error is usually the largest. The cells are
+    // arranged as (i + j * gridSize, k) in render target. Errors are measured
+    // after output transforms to reflect the difference on display.
+    int cellNum = uLutSize - 1;
+    vec3 cellCoords = vec3(xy.x % cellNum, xy.x / cellNum, xy.y) + vec3(0.5);
+    vec3 color = lutShaperInverse(cellCoords / gridSize);
+
+    vec3 expected = getDisplayColor(toneMapping(color));
+    vec3 lutColor = texture(uToneMappingLut, getLutCoords(lutShaper(color), float(uLutSize))).rgb;
+    vec3 error = abs(expected - getDisplayColor(lutColor));
+    oColor = vec4(error, max(error.r, max(error.g, error.b)));
+}
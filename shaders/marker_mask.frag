@@ -0,0 +1,53 @@
+#version 330
+
+// Flags of pixel markers of graded image, reduced to the first level of max
+// pyramid in half resolution as max_reduce.frag. Thus present.frag could still
+// mark pixels covered by one screen pixel when the image is zoomed out.
+// R: overflow, G: underflow, B: NaN, Inf or negative values.
+
+uniform sampler2D uImage;
+uniform sampler3D uToneMappingLut;  // Baked ACES tone mapping, see lut_bake.frag
+
+uniform int     uPresentMode;
+uniform bool    uApplyToneMapping;
+uniform bool    uUseToneMappingLut;
+
+out vec4 oColor;
+
+// The same as applyColorTransform@present.frag.
+vec3 applyColorTransform(vec3 color)
+{
+    if (uApplyToneMapping && uUseToneMappingLut) {
+        float lutSize = float(textureSize(uToneMappingLut, 0).x);
+        color = texture(uToneMappingLut, getLutCoords(lutShaper(color), lutSize)).rgb;
+        return colorTransform(color, uPresentMode, false);
+    }
+
+    return colorTransform(color, uPresentMode, uApplyToneMapping);
+}
+
+// Conditions are the same as overlayPixelMarker@present.frag.
+vec4 getMarkerFlags(vec3 linearColor)
+{
+    vec3 color = applyColorTransform(linearColor);
+    bool isOverflow = all(greaterThan(color, vec3(1.0)));
+    bool isUnderflow = all(lessThan(color, vec3(1e-5)));
+    bool isInvalid = any(isnan(linearColor)) || any(isinf(linearColor)) || any(lessThan(linearColor, vec3(0.0)));
+    return vec4(isOverflow, isUnderflow, isInvalid, 0.0);
+}
+
+void main()
+{
+    ivec2 srcSize = textureSize(uImage, 0);
+    ivec2 dstSize = max(srcSize / 2, ivec2(1));
+    ivec2 xy = ivec2(gl_FragCoord.xy);
+    ivec2 extent = ivec2(2) + ivec2(equal(xy, dstSize - 1)) * (srcSize & 1);
+
+    oColor = vec4(0.0);
+    for (int y = 0; y < extent.y; ++y) {
+        for (int x = 0; x < extent.x; ++x) {
+            vec3 color = texelFetch(uImage, min(xy * 2 + ivec2(x, y), srcSize - 1), 0).rgb;
+            oColor = max(oColor, getMarkerFlags(color));
+        }
+    }
+}
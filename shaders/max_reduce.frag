@@ -0,0 +1,24 @@
+#version 330
+
+// Conservative max reduction into the next level of pyramid. Sizes of levels
+// are rounded down, thus the last texel of odd-sized rows and columns is merged
+// into the last texel of the next level, and no value of the source is lost.
+
+uniform sampler2D uImage;   // Only the source level is accessible, see MipRenderTexture@texture.h
+
+out vec4 oColor;
+
+void main()
+{
+    ivec2 srcSize = textureSize(uImage, 0);
+    ivec2 dstSize = max(srcSize / 2, ivec2(1));
+    ivec2 xy = ivec2(gl_FragCoord.xy);
+    ivec2 extent = ivec2(2) + ivec2(equal(xy, dstSize - 1)) * (srcSize & 1);
+
+    oColor = vec4(0.0);
+    for (int y = 0; y < extent.y; ++y) {
+        for (int x = 0; x < extent.x; ++x) {
+            oColor = max(oColor, texelFetch(uImage, min(xy * 2 + ivec2(x, y), srcSize - 1), 0));
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#version 330
+
+// Glyphs of pixel values, they are blended over the presented image, see pixel_values.vert
+
+uniform sampler2D uFontImage;   // Font bit map for digit characters .0-9
+uniform int     uPresentMode;
+uniform bool    uApplyToneMapping;
+uniform float   uDisplayGamma;
+uniform float   uOpacity;
+
+in  vec2 vFontUV;
+flat in vec3 vColor;
+out vec4 oColor;
+
+void main()
+{
+    // Pick dark text over bright pixels and vice versa.
+    float luminance = mul(AP1_2_XYZ_MAT, colorTransform(vColor, uPresentMode, uApplyToneMapping)).y;
+    vec3 matteColor = mix(vec3(0.85), vec3(0.15), vec3(luminance > 0.5));
+    oColor = vec4(pow(matteColor, vec3(1.0 / uDisplayGamma)), uOpacity * texture(uFontImage, vFontUV).r);
+}
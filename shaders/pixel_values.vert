@@ -0,0 +1,90 @@
+#version 330
+
+// Numerical values of RGB components within pixel boxes. Each instance is one
+// visible image pixel, and its 90 vertices are quads of 5 glyphs in 3 rows,
+// i.e. B, G and R from bottom to top. Hidden glyphs are collapsed to a point.
+
+uniform sampler2D uImage;           // Graded image, see color_grading.frag
+uniform sampler2DArray uImageArray; // Graded tiles of mosaic view in tile resolution.
+uniform int     uImageLayer;        // Slice of uImageArray, or -1 to fetch uImage.
+uniform ivec4   uPixelRange;        // xy: first visible pixel, zw: numbers of visible columns and rows.
+uniform vec2    uImageSize;         // Number of pixels of the image grid.
+uniform vec2    uTileOrigin;        // Bottom-left corner of tile or column in window coordinates.
+uniform vec2    uOffset;            // Image position in tile coordinates.
+uniform float   uImageScale;
+uniform vec2    uWindowSize;
+uniform vec4    uCharUvRanges[11];
+uniform vec4    uCharUvXforms[11];
+
+out vec2 vFontUV;
+flat out vec3 vColor;
+
+const vec2 kCorners[6] = vec2[6](
+    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0),
+    vec2(0.0, 1.0), vec2(1.0, 0.0), vec2(1.0, 1.0));
+
+vec4 fetchColor(ivec2 pixel)
+{
+    if (uImageLayer < 0) {
+        // Compared images are stretched to the grid of top image.
+        vec2 texSize = vec2(textureSize(uImage, 0));
+        ivec2 xy = ivec2((vec2(pixel) + 0.5) / uImageSize * texSize);
+        return texelFetch(uImage, xy, 0);
+    }
+
+    // Tiles are graded with nearest filter, thus any texel of visible part of the pixel box has its value.
+    ivec2 tileSize = textureSize(uImageArray, 0).xy;
+    ivec2 xy = clamp(ivec2(floor(uOffset + (vec2(pixel) + 0.5) * uImageScale)), ivec2(0), tileSize - 1);
+    return texelFetch(uImageArray, ivec3(xy, uImageLayer), 0);
+}
+
+void main()
+{
+    // Layout of digits within the unit box of one pixel.
+    const vec2 padding = vec2(0.16, 0.04);
+    const float digitWidth = (1.0 - padding.x * 2.0) / 5;
+    const float digitHeight = 0.28;
+    const float rowSpace = (1.0 - padding.y * 2.0 - digitHeight * 3.0) * 0.5;
+
+    ivec2 pixel = uPixelRange.xy + ivec2(gl_InstanceID % uPixelRange.z, gl_InstanceID / uPixelRange.z);
+    int rowIdx = gl_VertexID / 30;
+    int colIdx = (gl_VertexID / 6) % 5;
+
+    vec4 color = fetchColor(pixel);
+    vColor = color.rgb;
+    float value = color[2 - rowIdx];
+    int exponent = int(max(0, log(value) / 2.302585));     // max log10
+
+    // If the value is in [1000.0, 10000.0), we print 4 digits only (hide the decimal point).
+    // Slices of images not uploaded yet are left transparent, and they have no values.
+    if ((exponent == 3 && colIdx == 4) || (uImageLayer >= 0 && color.a == 0.0)) {
+        vFontUV = vec2(0.0);
+        gl_Position = vec4(-2.0, -2.0, 0.0, 1.0);
+        return;
+    }
+
+    int digitIdx = 0;
+    for (int i = 0; i <= colIdx; ++i) {
+        int isFraction = int(i > exponent);
+        float y = pow(10.0, exponent - i + isFraction);
+        digitIdx = int(max(0, floor(value / y)));
+        value -= digitIdx * y;
+    }
+
+    digitIdx = colIdx == (exponent + 1) ? 10 : digitIdx;
+
+    // The glyph occupies [0, fuv] of char local uv, which is upside down and shifted by base line,
+    // thus we clip its quad to the bounding box of digit and map corners back to font texture.
+    vec4 xform = uCharUvXforms[digitIdx];
+    vec4 uvRange = uCharUvRanges[digitIdx];
+    vec2 quadMin = vec2(xform.z, 1.25 - xform.w - xform.y);
+    vec2 quadMax = vec2(xform.z + xform.x, 1.25 - xform.w);
+    vec2 st = clamp(mix(quadMin, quadMax, kCorners[gl_VertexID % 6]), 0.0, 1.0);
+    vec2 charUV = vec2(st.x - xform.z, 1.25 - xform.w - st.y) / xform.xy;
+    vFontUV = mix(uvRange.xy, uvRange.zw, charUV);
+
+    vec2 boxMin = vec2(padding.x + digitWidth * (float(colIdx) + 0.5 * float(exponent == 3)),
+        padding.y + (rowSpace + digitHeight) * float(rowIdx));
+    vec2 pos = uTileOrigin + uOffset + (vec2(pixel) + boxMin + st * vec2(digitWidth, digitHeight)) * uImageScale;
+    gl_Position = vec4(pos / uWindowSize * 2.0 - 1.0, 0.0, 1.0);
+}
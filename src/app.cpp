@@ -33,12 +33,16 @@
 
 #ifdef EMBED_SHADERS
 #include "shader_resources.h"
-#define INIT_SHADER(shader, name, vtxName, fragName)\
-shader.init(name, vtxName##_vert, fragName##_frag)
+#define INIT_SHADER(shader, name, vtxName, fragName, cache)\
+shader.init(name, vtxName##_vert, fragName##_frag, cache)
+#define INIT_SHADER_WITH_LIB(shader, name, vtxName, fragName, libName, cache)\
+shader.init(name, vtxName##_vert, Shader::injectLibrary(fragName##_frag, libName##_glsl), cache)
 #else
 #define STRING(s) #s
-#define INIT_SHADER(shader, name, vtxName, fragName)\
-shader.initFromFiles(name, "shaders/"##STRING(vtxName)##".vert", "shaders/"##STRING(fragName)##".frag")
+#define INIT_SHADER(shader, name, vtxName, fragName, cache)\
+shader.initFromFiles(name, "shaders/"##STRING(vtxName)##".vert", "shaders/"##STRING(fragName)##".frag", cache)
+#define INIT_SHADER_WITH_LIB(shader, name, vtxName, fragName, libName, cache)\
+shader.initFromFiles(name, "shaders/"##STRING(vtxName)##".vert", "shaders/"##STRING(fragName)##".frag", cache, "shaders/"##STRING(libName)##".glsl")
 #endif
 
 #ifndef _MSC_VER
@@ -141,6 +145,20 @@ bool Splitter(bool split_vertically, float thickness, float* size1, float* size2
     return SplitterBehavior(bb, id, split_vertically ? ImGuiAxis_X : ImGuiAxis_Y, size1, size2, min_size1, min_size2, 0.0f);
 }
 
+// Move value toward target exponentially, it's snapped to target when they are close enough.
+float smoothTowards(float value, float target, float deltaTime, float tolerance)
+{
+    const float kAdaptationTime = 0.3f;    // Seconds to cover 63% of the gap.
+    value += (target - value) * (1.0f - std::exp(-deltaTime / kAdaptationTime));
+    return std::abs(target - value) < tolerance ? target : value;
+}
+
+// Reduction parameters of auto exposure and heat range, values are clamped to
+// 2^-16 before log2 thus black pixels don't dominate the log-average.
+const baktsiu::Vec2f kReductionLogRange(-16.0f, 16.0f);
+const float kReductionMinValue = 1.0f / 65536.0f;
+const float kMiddleGray = 0.18f;
+
 }  // namespace anonymous
 
 namespace ImGui 
@@ -166,7 +184,10 @@ void PlotMultiHistograms(
     int values_count,
     float scale_min,
     float scale_max,
-    ImVec2 graph_size)
+    ImVec2 graph_size,
+    const char* level_format = "Level: %.0f",
+    float level_min = 0.0f,
+    float level_step = 1.0f)
 {
     const int values_offset = 0;
 
@@ -207,7 +228,7 @@ void PlotMultiHistograms(
         // std::string toolTip;
         ImGui::BeginTooltip();
         const int idx0 = (v_idx + values_offset) % values_count;
-        TextColored(ImColor(255, 255, 255, 255), "Level: %d", v_idx);
+        TextColored(ImColor(255, 255, 255, 255), level_format, level_min + v_idx * level_step);
 
         for (int dataIdx = 0; dataIdx < num_hists; ++dataIdx) {
             const int v0 = pixel_counts[dataIdx * values_count + idx0];
@@ -260,6 +281,12 @@ namespace baktsiu
 const char* App::kImagePropWindowName = "ImagePropWindow";
 const char* App::kImageRemoveDlgTitle = "Bak Tsiu##RemoveImage";
 const char* App::kClearImagesDlgTitle = "Bak Tsiu##ClearImageLayers";
+const GLuint App::kPresentParamBinding = 0;
+const int App::kToneMappingLutSize = 65;
+const int App::kStatisticsTileSize = 64;
+const int App::kReductionMaxSize = 1024;
+const int App::kScopeMaxSize = 1024;
+const int App::kMaxMosaicTileNum = 16;
 
 // Return UV BBox of given character in font texture.
 inline Vec4f getCharUvRange(const stbtt_bakedchar& ch, float mapWidth)
@@ -329,6 +356,7 @@ void App::initLogger()
 
 bool App::initialize(const char* title, int width, int height)
 {
+    mLaunchTime = std::chrono::steady_clock::now();
     initLogger();
 
     glfwSetErrorCallback([](int error, const char* description) {
@@ -359,6 +387,9 @@ bool App::initialize(const char* title, int width, int height)
     glfwWindowHint(GLFW_SRGB_CAPABLE, GL_FALSE);
 #endif
 
+    // Depth buffer is used to cull pixels under opaque windows, see App::occludeOpaqueWindows.
+    glfwWindowHint(GLFW_DEPTH_BITS, 24);
+
 #ifdef _DEBUG
     glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
 #endif
@@ -389,6 +420,9 @@ bool App::initialize(const char* title, int width, int height)
     }
 
     mSupportComputeShader = glfwExtensionSupported("GL_ARB_compute_shader");
+
+    // The CPU statistics engine reads decoded pixels instead of graded textures.
+    mTexturePool.setRetainPixels(!mSupportComputeShader);
     LOGI("Support compute shader: {}", mSupportComputeShader);
 
 #ifdef _DEBUG
@@ -456,12 +490,76 @@ bool App::initialize(const char* title, int width, int height)
     // Initialize bit map texture for shader to render pixel's RGB values.
     initDigitCharData((unsigned char*)robotomono_regular_ttf);
 
-    bool status = INIT_SHADER(mPresentShader, "present", quad, present);
+    // Linking the present shader dominates the startup time on some drivers,
+    // thus we reuse program binaries from previous launches when possible.
+    const auto shaderInitStartTime = std::chrono::steady_clock::now();
+    mProgramCache.initialize(ProgramCache::getDefaultCacheDir());
+    ProgramCache* programCache = mProgramCache.isEnabled() ? &mProgramCache : nullptr;
+
+    bool status = INIT_SHADER_WITH_LIB(mPresentShader, "present", quad, present, color_transform, programCache);
     CHECK_AND_RETURN_IT(status, "Failed to initialize present shader");
 
-    status = INIT_SHADER(mGradingShader, "color_grading", quad, color_grading);
+    // Parameters which are invariant across frames are only assigned once.
+    mPresentParamBuffer.initialize(sizeof(PresentParams));
+    mPresentShader.bindUniformBlock("PresentParams", kPresentParamBinding);
+    mPresentShader.bind();
+    mPresentShader.setUniform("uImage1", 0);
+    mPresentShader.setUniform("uImage2", 1);
+    mPresentShader.setUniform("uToneMappingLut", 3);
+    mPresentShader.setUniform("uDisplayLut1D", 4);
+    mPresentShader.setUniform("uDisplayLut3D", 5);
+    mPresentShader.setUniform("uDiffImage", 6);
+    mPresentShader.setUniform("uMarkerPyramid1", 7);
+    mPresentShader.setUniform("uMarkerPyramid2", 8);
+    mPresentShader.setUniform("uDiffPyramid", 9);
+    mPresentShader.setUniform("uMosaicImages", 10);
+    mPresentShader.setUniform("uPixelBorderHighlightColor", mPixelBorderHighlightColor);
+    glUseProgram(0);
+
+    status = INIT_SHADER_WITH_LIB(mPixelValueShader, "pixel_values", pixel_values, pixel_values, color_transform, programCache);
+    CHECK_AND_RETURN_IT(status, "Failed to initialize pixel value shader");
+    mPixelValueShader.bind();
+    mPixelValueShader.setUniform("uFontImage", 2);
+    mPixelValueShader.setUniform("uImageArray", 10);
+    mPixelValueShader.setUniform("uCharUvRanges", mCharUvRanges);
+    mPixelValueShader.setUniform("uCharUvXforms", mCharUvXforms);
+    glUseProgram(0);
+
+    status = INIT_SHADER(mGradingShader, "color_grading", quad, color_grading, programCache);
     CHECK_AND_RETURN_IT(status, "Failed to initialize color grading shader");
 
+    status = INIT_SHADER_WITH_LIB(mLutBakeShader, "lut_bake", quad, lut_bake, color_transform, programCache);
+    CHECK_AND_RETURN_IT(status, "Failed to initialize LUT baking shader");
+    mLutBakeShader.bind();
+    mLutBakeShader.setUniform("uToneMappingLut", 0);
+    mLutBakeShader.setUniform("uLutSize", kToneMappingLutSize);
+    bakeToneMappingLut();
+
+    status = INIT_SHADER_WITH_LIB(mDifferenceShader, "difference", quad, difference, color_transform, programCache);
+    CHECK_AND_RETURN_IT(status, "Failed to initialize difference shader");
+    mDifferenceShader.bind();
+    mDifferenceShader.setUniform("uImage1", 0);
+    mDifferenceShader.setUniform("uImage2", 1);
+
+    status = INIT_SHADER_WITH_LIB(mMarkerMaskShader, "marker_mask", quad, marker_mask, color_transform, programCache);
+    CHECK_AND_RETURN_IT(status, "Failed to initialize marker mask shader");
+    mMarkerMaskShader.bind();
+    mMarkerMaskShader.setUniform("uImage", 0);
+    mMarkerMaskShader.setUniform("uToneMappingLut", 1);
+
+    status = INIT_SHADER(mMaxReduceShader, "max_reduce", quad, max_reduce, programCache);
+    CHECK_AND_RETURN_IT(status, "Failed to initialize max reduction shader");
+    mMaxReduceShader.bind();
+    mMaxReduceShader.setUniform("uImage", 0);
+
+    mPresentTimer.initialize();
+    mPresentPixelCounter.initialize();
+    mPixelValueCounter.initialize();
+
+    mThreadPool.initialize();
+    mLutLibrary.initialize(&mThreadPool);
+    setDisplayLut(nullptr);
+
     if (mSupportComputeShader) {
         glGenTextures(1, &mTexHistogram);
         glBindTexture(GL_TEXTURE_2D, mTexHistogram);
@@ -469,9 +567,48 @@ bool App::initialize(const char* title, int width, int height)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32I, static_cast<GLint>(mHistogram.size()), 1);
-        status = mStatisticsShader.initCompute("statistics", statistics_comp);
+        mHistogramReadback.initialize(sizeof(mHistogram));
+        status = mStatisticsShader.initCompute("statistics", statistics_comp, programCache);
+        CHECK_AND_RETURN_IT(status, "Failed to initialize statistics shader");
+
+        glGenTextures(1, &mTexHdrHistogram);
+        glBindTexture(GL_TEXTURE_2D, mTexHdrHistogram);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32I, HdrStatistics::kPackedSize, 1);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        mHdrHistogramReadback.initialize(sizeof(int) * HdrStatistics::kPackedSize);
+        status = mHdrStatisticsShader.initCompute("hdr_statistics", hdr_statistics_comp, programCache);
+        CHECK_AND_RETURN_IT(status, "Failed to initialize HDR statistics shader");
+
+        // Each workgroup of the first reduction pass writes a partial result.
+        const int maxPartialNum = (kReductionMaxSize / kStatisticsTileSize) * (kReductionMaxSize / kStatisticsTileSize);
+        glGenTextures(1, &mTexReductionPartials);
+        glBindTexture(GL_TEXTURE_2D, mTexReductionPartials);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32F, maxPartialNum, 1);
+        glGenTextures(1, &mTexReductionResult);
+        glBindTexture(GL_TEXTURE_2D, mTexReductionResult);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32I, ReductionResult::kPackedSize, 1);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        mExposureReadback.initialize(sizeof(int) * ReductionResult::kPackedSize);
+        mHeatRangeReadback.initialize(sizeof(int) * ReductionResult::kPackedSize);
+        status = mReductionShader.initCompute("reduction", reduction_comp, programCache);
+        CHECK_AND_RETURN_IT(status, "Failed to initialize reduction shader");
+
+        glGenTextures(1, &mTexScopeDensity);
+        glBindTexture(GL_TEXTURE_2D, mTexScopeDensity);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32I, Scopes::kDensityWidth, Scopes::kSize);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        mScopeReadback.initialize(sizeof(int) * Scopes::kDensityWidth * Scopes::kSize);
+        status = mScopesShader.initCompute("scopes", Shader::injectLibrary(scopes_comp, color_transform_glsl), programCache);
+        CHECK_AND_RETURN_IT(status, "Failed to initialize scopes shader");
     }
 
+    mScopes.initialize();
+    mScopeDensity.assign(Scopes::kDensityWidth * Scopes::kSize, 0);
+
+    const std::chrono::duration<double, std::milli> shaderInitTime = std::chrono::steady_clock::now() - shaderInitStartTime;
+    LOGI("Initialize shaders in {:.1f} ms (program cache hit: {}, miss: {})",
+        shaderInitTime.count(), mProgramCache.hitCount(), mProgramCache.missCount());
+
     mPointSampler.initialize(GL_NEAREST, GL_NEAREST);
 
     return status;
@@ -521,7 +658,57 @@ void App::release()
     mPointSampler.release();
 
     mPresentShader.release();
+    mPixelValueShader.release();
     mGradingShader.release();
+    mLutBakeShader.release();
+    mDifferenceShader.release();
+    mMarkerMaskShader.release();
+    mMaxReduceShader.release();
+    mPresentParamBuffer.release();
+    mRenderTextures[0].release();
+    mRenderTextures[1].release();
+    mDiffTexture.release();
+    mMarkerPyramids[0].release();
+    mMarkerPyramids[1].release();
+    mDiffPyramid.release();
+    mMosaicTextures.release();
+    mToneMappingLut.release();
+    mPresentTimer.release();
+    mPresentPixelCounter.release();
+    mPixelValueCounter.release();
+    mHistogramReadback.release();
+    mHdrHistogramReadback.release();
+    mExposureReadback.release();
+    mHeatRangeReadback.release();
+    mScopeReadback.release();
+    mScopes.release();
+    mRegionReadback.release();
+    mRegionTable.clear();
+    mDiffReadback.release();
+    mDiffRegions.clear();
+    if (mCpuStatisticsFuture.valid()) {
+        mCpuStatisticsFuture.wait();
+    }
+    if (mMetricsFuture.valid()) {
+        mMetricsFuture.wait();
+    }
+    mMetricsReadbacks[0].release();
+    mMetricsReadbacks[1].release();
+    if (mAlignmentFuture.valid()) {
+        mAlignmentFuture.wait();
+    }
+    mAlignReadbacks[0].release();
+    mAlignReadbacks[1].release();
+    if (mLayerStatsFuture.valid()) {
+        mLayerStatsFuture.wait();
+    }
+    mLayerStatsReadback.release();
+    mLayerStatistics.clear();
+    mMetricMatrix.clear();
+    mMatrixReadback.release();
+    mDisplayLut.reset();
+    mLutLibrary.release();
+    mThreadPool.release();
 
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
@@ -555,7 +742,17 @@ void App::processTextureUploadTasks()
 
     // When we finish importing images, we switch top image to the latest one.
     if (!isUndo && mTexturePool.hasNoPendingTasks()) {
-        mTopImageIndex = static_cast<int>(mImageList.size()) - 1;
+        const int imageNum = static_cast<int>(mImageList.size());
+        mTopImageIndex = imageNum - 1;
+
+        if (mPendingImageSelection.x >= 0) {
+            mTopImageIndex = std::min(mPendingImageSelection.x, imageNum - 1);
+            if (mPendingImageSelection.y >= 0 && mPendingImageSelection.y < imageNum) {
+                mCmpImageIndex = mPendingImageSelection.y;
+            }
+            mPendingImageSelection = Vec2i(-1);
+        }
+
         resetImageTransform(getTopImage()->size());
 
         if (mCmpImageIndex == -1 && mTopImageIndex >= 1) {
@@ -569,6 +766,7 @@ void App::processTextureUploadTasks()
 void App::run(CompositeFlags initFlags)
 {
     bool shouldChangeComposition = true;
+    bool isFirstFrame = true;
 
     // Spawn worker threads to handle import images.
     const unsigned int workerNum = std::thread::hardware_concurrency();
@@ -578,6 +776,21 @@ void App::run(CompositeFlags initFlags)
         glfwPollEvents();
 
         processTextureUploadTasks();
+
+        // Fetch histogram computed in previous frames, it doesn't wait for GPU.
+        mHistogramReadback.tryGetResult(mHistogram.data());
+
+        std::array<int, HdrStatistics::kPackedSize> hdrHistogram;
+        if (mHdrHistogramReadback.tryGetResult(hdrHistogram.data()) && mPendingHdrStatisticsKey.grading.image) {
+            auto& entry = mHdrStatisticsCache[mPendingHdrStatisticsKey.grading.image];
+            entry.first = mPendingHdrStatisticsKey;
+            entry.second.initialize(hdrHistogram.data(), mPendingHdrStatisticsKey.logRange);
+        }
+
+        if (mScopeReadback.tryGetResult(mScopeDensity.data())) {
+            mScopes.updateTexture(mScopeDensity.data(), mScopeIntensity);
+        }
+
         if (shouldChangeComposition && mImageList.size() >= 2) {
             mCompositeFlags = initFlags;
             shouldChangeComposition = false;
@@ -610,6 +823,8 @@ void App::run(CompositeFlags initFlags)
             mColumnViews[1].resize(Vec2f(io.DisplaySize.x - leftColumnWidth, io.DisplaySize.y));
             mColumnViews[0].setImageSize(imageSize);
             mColumnViews[1].setImageSize(imageSize);
+        } else if (inMosaicMode()) {
+            updateMosaicLayout(io);
         } else {
             mView.resize(io.DisplaySize);
             mView.setImageSize(imageSize);
@@ -622,10 +837,31 @@ void App::run(CompositeFlags initFlags)
             showImageNameOverlays();
         }
 
+        if (inMosaicMode()) {
+            showMosaicLabels();
+        }
+
+        // Tiles of mosaic view are small, their invalid pixels are only marked by present shader.
+        if ((getPixelMarkerFlags() & static_cast<int>(PixelMarkerFlags::Invalid)) != 0 && !inMosaicMode()) {
+            showBadPixelMarkers();
+        }
+
+        if (enableCompareView && (getPixelMarkerFlags() & static_cast<int>(PixelMarkerFlags::DiffMask)) != 0) {
+            showDiffRegionMarker();
+        }
+
+        if (mHasRegionSelection && topImage) {
+            showRegionStatistics();
+        }
+
         if (enableCompareView && ((getPixelMarkerFlags() & 0x2) > 0)) {
             Vec2f heatbarPos(8.0f, io.DisplaySize.y - mFooterHeight - 8.0f - 20.0f);
             showHeatRangeOverlay(heatbarPos, 150.0f);
         }
+
+        if (mShowFrameStats) {
+            showFrameStatsOverlay(Vec2f(8.0f, mToolbarHeight + 48.0f));
+        }
         
         // Since GLFW doesn't support cursor of resize all, thus we use imgui to draw that cursor.
         // Caution: the cursor is hidden when using imgui's drawn cursor, when the root window is unfocused.
@@ -637,87 +873,211 @@ void App::run(CompositeFlags initFlags)
 
         if (topImage && topImage->texId() != 0) {
             gradingTexImage(*topImage, mTopImageRenderTexIdx);
-            if (mShowImagePropWindow && mSupportComputeShader) {
-                float valueScale = topImage->getColorEncodingType() == ColorEncodingType::Linear ? 1.0f : 255.0f;
-                computeImageStatistics(mRenderTextures[mTopImageRenderTexIdx], valueScale);
-            }
         }
 
+        if (inMosaicMode()) {
+            updateMosaicTiles();
+        }
+
+        bool useDiffImage = false;
         if (enableCompareView && mCmpImageIndex >= 0) {
             Image* cmpImage = mImageList[mCmpImageIndex].get();
             if (cmpImage->texId() != 0) {
-                gradingTexImage(*cmpImage, mTopImageRenderTexIdx ^ 1);
+                gradingTexImage(*cmpImage, mTopImageRenderTexIdx ^ 1, getAlignmentOffset(topImage, cmpImage));
+                updateImageAlignment();
+
+                if (topImage->texId() != 0 && (getPixelMarkerFlags() & static_cast<int>(PixelMarkerFlags::DiffMask)) != 0) {
+                    updateDifferenceTexture();
+                    updateDiffRegions();
+                    useDiffImage = true;
+                }
             }
         }
 
+        if (topImage && topImage->texId() != 0 && mShowImagePropWindow) {
+            updateImageStatistics(useDiffImage);
+        }
+
+        if (topImage && topImage->texId() != 0 && mShowImagePropWindow && (mShowWaveform || mShowVectorscope)) {
+            updateScopes();
+        }
+
+        if (topImage && topImage->texId() != 0 && mHasRegionSelection) {
+            updateRegionTable();
+        }
+
+        if (enableCompareView && mCmpImageIndex >= 0 && mShowImagePropWindow && mShowImageMetrics &&
+            topImage->texId() != 0 && mImageList[mCmpImageIndex]->texId() != 0) {
+            updateImageMetrics();
+        }
+
+        updateLayerStatistics();
+
+        if (mShowImagePropWindow && mShowMetricMatrix) {
+            updateMetricMatrix();
+        }
+
+        if (mSupportComputeShader && mEnableAutoExposure && topImage && topImage->texId() != 0) {
+            updateAutoExposure(io.DeltaTime);
+        }
+
+        if (mSupportComputeShader && mEnableAutoHeatRange && useDiffImage) {
+            updateAutoHeatRange(io.DeltaTime);
+        }
+
+        if (mShowFrameStats) {
+            verifyToneMappingLut();
+        }
+
+        int pyramidLevel = 0;
+        if (topImage && topImage->texId() != 0 && !inMosaicMode()) {
+            pyramidLevel = updateMaxPyramids((useColumnView ? mColumnViews[0] : mView).getImageScale(), useDiffImage);
+        }
+
         // We have to apply framebuffer scale for hidh DPI display.
         const Vec2f viewportSize = io.DisplaySize * io.DisplayFramebufferScale;
         glViewport(0, 0, static_cast<GLsizei>(viewportSize.x), static_cast<GLsizei>(viewportSize.y));
         glClearColor(0.45f, 0.55f, 0.6f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        glClearDepth(1.0);
+        glDepthMask(GL_TRUE);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (mCullPixelsUnderUI) {
+            occludeOpaqueWindows();
+        }
+
+        // Pixels under opaque windows fail the depth test before shading.
         glDepthMask(GL_FALSE);
-        glDisable(GL_DEPTH_TEST);
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GL_LESS);
 
         // Render image viewer display
-        // TODO: Use depth culling to avoid over-drawing.
         mPresentShader.bind();
         glActiveTexture(GL_TEXTURE0);
 
         // We have to forcely use nearest filter to properly show numerical values within a pixel.
-        const View& topView = useColumnView ? mColumnViews[0] : mView;
+        const View& topView = inMosaicMode() ? mMosaicView : (useColumnView ? mColumnViews[0] : mView);
         const View& bottomView = useColumnView ? mColumnViews[1] : mView;
         const float imageScale = topView.getImageScale();
         const bool forceNearestFilter = imageScale > 5.0f;
 
+        PresentParams& params = mPresentParams;
         if (topImage) {
             mRenderTextures[mTopImageRenderTexIdx].bindAsInput(mUseLinearFilter && !forceNearestFilter);
 
             Vec2f imageSize = topImage->size();
-            mPresentShader.setUniform("uImageSize", imageSize * imageScale);
-            mPresentShader.setUniform("uOffset", topView.getImageOffset());
-            mPresentShader.setUniform("uImage1", 0);
+            params.imageSize = imageSize * imageScale;
+            params.offset = topView.getImageOffset();
         } else {
-            mPresentShader.setUniform("uImageSize", Vec2f(0.0f));
-        }
-
-        mPresentShader.setUniform("uEnablePixelHighlight", !mIsMovingSplitter && !mIsScalingImage);
-        mPresentShader.setUniform("uCursorPos", Vec2f(io.MousePos.x, io.DisplaySize.y - io.MousePos.y) + Vec2f(0.5f));
-        mPresentShader.setUniform("uSideBySide", mCompositeFlags == CompositeFlags::SideBySide);
-        mPresentShader.setUniform("uPixelMarkerFlags", getPixelMarkerFlags());
-        mPresentShader.setUniform("uPresentMode", mCurrentPresentMode);
-        mPresentShader.setUniform("uOutTransformType", mOutTransformType);
-        mPresentShader.setUniform("uWindowSize", Vec2f(io.DisplaySize));
-        mPresentShader.setUniform("uImageScale", imageScale);
-        mPresentShader.setUniform("uSplitPos", enableCompareView ? mViewSplitPos : 1.0f);
-        mPresentShader.setUniform("uDisplayGamma", mDisplayGamma);
-        mPresentShader.setUniform("uApplyToneMapping", mEnableToneMapping);
-        mPresentShader.setUniform("uCharUvRanges", mCharUvRanges);
-        mPresentShader.setUniform("uCharUvXforms", mCharUvXforms);
-        mPresentShader.setUniform("uPixelBorderHighlightColor", mPixelBorderHighlightColor);
+            params.imageSize = Vec2f(0.0f);
+        }
+
+        params.enablePixelHighlight = !mIsMovingSplitter && !mIsScalingImage;
+        params.cursorPos = Vec2f(io.MousePos.x, io.DisplaySize.y - io.MousePos.y) + Vec2f(0.5f);
+        params.sideBySide = mCompositeFlags == CompositeFlags::SideBySide;
+        params.pixelMarkerFlags = getPixelMarkerFlags();
+        params.presentMode = mCurrentPresentMode;
+        params.outTransformType = mOutTransformType;
+        params.windowSize = Vec2f(io.DisplaySize);
+        params.imageScale = imageScale;
+        params.splitPos = enableCompareView ? mViewSplitPos : 1.0f;
+        params.displayGamma = mDisplayGamma;
+        params.applyToneMapping = mEnableToneMapping;
+        params.useToneMappingLut = mUseToneMappingLut;
+        params.useDiffImage = useDiffImage;
+        params.diffThreshold = mDiffThreshold * mDiffThreshold;
+        params.pyramidLevel = pyramidLevel;
+        params.heatRange = mEnableAutoHeatRange ? mHeatRange : Vec2f(0.0f, 1.0f);
+        params.mosaicTileNum = inMosaicMode() ? mMosaicTileNum : 0;
+
+        if (inMosaicMode()) {
+            params.mosaicOrigin = Vec2f(0.0f, io.DisplaySize.y - mToolbarHeight);
+            params.mosaicTileSize = mMosaicTileSize;
+            params.mosaicColumnNum = mMosaicGrid.x;
+            glActiveTexture(GL_TEXTURE10);
+            mMosaicTextures.bindAsInput();
+        }
 
         if (enableCompareView && mCmpImageIndex >= 0) {
             glActiveTexture(GL_TEXTURE1);
             mRenderTextures[mTopImageRenderTexIdx ^ 1].bindAsInput(mUseLinearFilter && !forceNearestFilter);
-            mPresentShader.setUniform("uImage2", 1);
-            mPresentShader.setUniform("uOffsetExtra", bottomView.getImageOffset());
-            mPresentShader.setUniform("uRelativeOffset", (bottomView.getLocalOffset() - topView.getLocalOffset()) * mImageScale);
+
+            if (useDiffImage) {
+                glActiveTexture(GL_TEXTURE6);
+                mDiffTexture.bindAsInput(mUseLinearFilter && !forceNearestFilter);
+                glActiveTexture(GL_TEXTURE9);
+                mDiffPyramid.bindAsInput();
+            }
+            params.offsetExtra = bottomView.getImageOffset();
+            params.relativeOffset = (bottomView.getLocalOffset() - topView.getLocalOffset()) * mImageScale;
         }
 
+        // Only upload parameters when any of them is changed.
+        mPresentParamBuffer.update(params);
+        mPresentParamBuffer.bind(kPresentParamBinding);
+
         glActiveTexture(GL_TEXTURE2);
         glBindTexture(GL_TEXTURE_2D, mFontTexture);
-        mPresentShader.setUniform("uFontImage", 2);
+        glActiveTexture(GL_TEXTURE3);
+        mToneMappingLut.bindAsInput();
+
+        if (const LutTextures* lutTextures = mLutLibrary.getTextures(mDisplayLut)) {
+            glActiveTexture(GL_TEXTURE4);
+            glBindTexture(GL_TEXTURE_2D, lutTextures->lut1D);
+            glActiveTexture(GL_TEXTURE5);
+            glBindTexture(GL_TEXTURE_3D, lutTextures->lut3D.id());
+        }
 
+        if (pyramidLevel > 0) {
+            glActiveTexture(GL_TEXTURE7);
+            mMarkerPyramids[mTopImageRenderTexIdx].bindAsInput();
+            glActiveTexture(GL_TEXTURE8);
+            mMarkerPyramids[mTopImageRenderTexIdx ^ 1].bindAsInput();
+        }
+
+        mPresentTimer.begin();
+        mPresentPixelCounter.begin();
         mPresentShader.drawTriangle();
+        mPresentPixelCounter.end();
+        mPixelValueCounter.begin();
+        renderPixelValues();
+        mPixelValueCounter.end();
+        mPresentTimer.end();
+        glDisable(GL_DEPTH_TEST);
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
         glfwSwapBuffers(mWindow);
+
+        if (isFirstFrame) {
+            glFinish();
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::steady_clock::now() - mLaunchTime;
+            LOGI("Time to first frame: {:.1f} ms", elapsedTime.count());
+            isFirstFrame = false;
+        }
     }
 
     mTexturePool.release();
 }
 
-void    App::gradingTexImage(Image& image, int renderTexIdx)
+GradingKey  App::getGradingKey(const Image& image, const Vec2f& offset) const
+{
+    GradingKey key;
+    key.image = &image;
+    key.contentId = image.contentId();
+    key.imageId = image.id();
+    key.encodingType = image.getColorEncodingType();
+    key.primaryType = image.getColorPrimaryType();
+    key.exposureValue = mExposureValue;
+    key.offset = offset;
+    return key;
+}
+
+bool    App::gradingTexImage(Image& image, int renderTexIdx, const Vec2f& offset)
 {
+    const GradingKey key = getGradingKey(image, offset);
+    if (key == mGradingKeys[renderTexIdx]) {
+        return false;
+    }
+
     const Vec2i size = image.size();
     mRenderTextures[renderTexIdx].bindAsOutput(size, GL_RGBA16F);
 
@@ -735,6 +1095,8 @@ void    App::gradingTexImage(Image& image, int renderTexIdx)
     mGradingShader.bind();
     mGradingShader.setUniform("uImage", textureUnit);
     mGradingShader.setUniform("uEV", mExposureValue);
+    mGradingShader.setUniform("uOffset", offset);
+    mGradingShader.setUniform("uViewXform", Vec3f(0.0f));
     mGradingShader.setUniform("uInImageProp", Vec2i(
         static_cast<int>(image.getColorEncodingType()),
         static_cast<int>(image.getColorPrimaryType())));
@@ -744,6 +1106,352 @@ void    App::gradingTexImage(Image& image, int renderTexIdx)
     image.getTexture()->unbind();
     mPointSampler.unbind(textureUnit);
     mRenderTextures[renderTexIdx].unbind();
+
+    mGradingKeys[renderTexIdx] = key;
+    return true;
+}
+
+void    App::updateMosaicTiles()
+{
+    const Vec2i tileSize(mMosaicTileSize);
+    if (!mMosaicTextures.initialize(tileSize, kMaxMosaicTileNum, GL_RGBA16F)) {
+        return;
+    }
+
+    mMosaicTileKeys.resize(kMaxMosaicTileNum);
+
+    // Nearest filter is forced at large scales as present, thus values of pixels are shown.
+    const Image* topImage = getTopImage();
+    const float imageScale = mMosaicView.getImageScale();
+    const bool useLinearFilter = mUseLinearFilter && imageScale <= 5.0f;
+    const int textureUnit = 0;
+    glDepthMask(GL_FALSE);
+    glDisable(GL_DEPTH_TEST);
+
+    for (int tile = 0; tile < mMosaicTileNum; ++tile) {
+        Image& image = *mImageList[mMosaicFirstLayer + tile];
+        MosaicTileKey key;
+        key.grading = getGradingKey(image, getAlignmentOffset(topImage, &image));
+        key.tileSize = tileSize;
+        key.imageOffset = mMosaicView.getImageOffset();
+        key.imageScale = imageScale;
+        key.useLinearFilter = useLinearFilter;
+        if (key == mMosaicTileKeys[tile]) {
+            continue;
+        }
+
+        // Slices of images not uploaded yet are left transparent.
+        mMosaicTileKeys[tile] = key;
+        mMosaicTextures.bindAsOutput(tile);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (key.grading.contentId == 0) {
+            continue;
+        }
+
+        glActiveTexture(GL_TEXTURE0);
+        image.getTexture()->bind();
+        mPointSampler.bind(textureUnit);
+
+        mGradingShader.bind();
+        mGradingShader.setUniform("uImage", textureUnit);
+        mGradingShader.setUniform("uEV", mExposureValue);
+        mGradingShader.setUniform("uOffset", key.grading.offset);
+        mGradingShader.setUniform("uViewXform", Vec3f(key.imageOffset, imageScale));
+        mGradingShader.setUniform("uLinearFilter", useLinearFilter);
+        mGradingShader.setUniform("uInImageProp", Vec2i(
+            static_cast<int>(image.getColorEncodingType()),
+            static_cast<int>(image.getColorPrimaryType())));
+
+        mGradingShader.drawTriangle();
+
+        image.getTexture()->unbind();
+        mPointSampler.unbind(textureUnit);
+    }
+
+    mMosaicTextures.unbind();
+}
+
+void    App::updateDifferenceTexture()
+{
+    const int topIdx = mTopImageRenderTexIdx;
+    if (mDiffTextureKeys[0] == mGradingKeys[topIdx] && mDiffTextureKeys[1] == mGradingKeys[topIdx ^ 1]) {
+        return;
+    }
+
+    ScopeMarker("Update Difference Texture");
+
+    // Half float keeps the texture compatible with the statistics compute shader.
+    const Vec2i size = mRenderTextures[topIdx].size();
+    mDiffTexture.bindAsOutput(size, GL_RGBA16F);
+    glViewport(0, 0, size.x, size.y);
+    glDepthMask(GL_FALSE);
+    glDisable(GL_DEPTH_TEST);
+
+    glActiveTexture(GL_TEXTURE0);
+    mRenderTextures[topIdx].bindAsInput(false);
+    glActiveTexture(GL_TEXTURE1);
+    mRenderTextures[topIdx ^ 1].bindAsInput(false);
+
+    mDifferenceShader.bind();
+    mDifferenceShader.drawTriangle();
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    mDiffTexture.unbind();
+
+    mDiffTextureKeys[0] = mGradingKeys[topIdx];
+    mDiffTextureKeys[1] = mGradingKeys[topIdx ^ 1];
+}
+
+int     App::updateMaxPyramids(float imageScale, bool useDiffImage)
+{
+    const int markerFlags = getPixelMarkerFlags();
+    const int flagMask = static_cast<int>(PixelMarkerFlags::Overflow | PixelMarkerFlags::Underflow | PixelMarkerFlags::Invalid);
+    const bool useMarkerPyramids = (markerFlags & flagMask) != 0;
+    if (imageScale >= 1.0f || (!useMarkerPyramids && !useDiffImage)) {
+        return 0;
+    }
+
+    // A texel of level n covers 2^n pixels, which is no less than the footprint of one screen pixel.
+    // Thus every flagged pixel is covered by the texel fetched by at least one screen pixel.
+    int level = static_cast<int>(std::ceil(-std::log2(imageScale) - 1e-4f));
+    if (level <= 0) {
+        return 0;
+    }
+
+    ScopeMarker("Update Max Pyramids");
+    const int topIdx = mTopImageRenderTexIdx;
+    if (useMarkerPyramids) {
+        const bool hasCmpImage = inCompareMode() && mCmpImageIndex >= 0 && mImageList[mCmpImageIndex]->texId() != 0;
+        for (int i = 0; i < (hasCmpImage ? 2 : 1); ++i) {
+            updateMarkerPyramid(topIdx ^ i);
+            level = std::min(level, mMarkerPyramids[topIdx ^ i].levelNum());
+        }
+    }
+
+    if (useDiffImage) {
+        updateDiffPyramid();
+        level = std::min(level, mDiffPyramid.levelNum());
+    }
+
+    return level;
+}
+
+void    App::updateMarkerPyramid(int renderTexIdx)
+{
+    MarkerPyramidKey key;
+    key.grading = mGradingKeys[renderTexIdx];
+    key.presentMode = mCurrentPresentMode;
+    key.applyToneMapping = mEnableToneMapping;
+    key.useToneMappingLut = mUseToneMappingLut;
+    if (mMarkerPyramidKeys[renderTexIdx] == key) {
+        return;
+    }
+
+    // Level 0 of pyramid is in half resolution, flags are reduced while they are evaluated.
+    MipRenderTexture& pyramid = mMarkerPyramids[renderTexIdx];
+    pyramid.initialize(glm::max(mRenderTextures[renderTexIdx].size() / 2, Vec2i(1)), GL_RGBA8);
+    pyramid.bindAsOutput(0);
+    glDepthMask(GL_FALSE);
+    glDisable(GL_DEPTH_TEST);
+
+    glActiveTexture(GL_TEXTURE0);
+    mRenderTextures[renderTexIdx].bindAsInput(false);
+    glActiveTexture(GL_TEXTURE1);
+    mToneMappingLut.bindAsInput();
+
+    mMarkerMaskShader.bind();
+    mMarkerMaskShader.setUniform("uPresentMode", key.presentMode);
+    mMarkerMaskShader.setUniform("uApplyToneMapping", key.applyToneMapping);
+    mMarkerMaskShader.setUniform("uUseToneMappingLut", key.useToneMappingLut);
+    mMarkerMaskShader.drawTriangle();
+
+    glBindTexture(GL_TEXTURE_3D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    reduceMaxPyramid(pyramid);
+    mMarkerPyramidKeys[renderTexIdx] = key;
+}
+
+void    App::updateDiffPyramid()
+{
+    if (mDiffPyramidKeys[0] == mDiffTextureKeys[0] && mDiffPyramidKeys[1] == mDiffTextureKeys[1]) {
+        return;
+    }
+
+    mDiffPyramid.initialize(glm::max(mDiffTexture.size() / 2, Vec2i(1)), GL_RGBA16F);
+    mDiffPyramid.bindAsOutput(0);
+    glDepthMask(GL_FALSE);
+    glDisable(GL_DEPTH_TEST);
+
+    glActiveTexture(GL_TEXTURE0);
+    mDiffTexture.bindAsInput(false);
+    mMaxReduceShader.bind();
+    mMaxReduceShader.drawTriangle();
+
+    reduceMaxPyramid(mDiffPyramid);
+    mDiffPyramidKeys[0] = mDiffTextureKeys[0];
+    mDiffPyramidKeys[1] = mDiffTextureKeys[1];
+}
+
+void    App::reduceMaxPyramid(MipRenderTexture& pyramid)
+{
+    mMaxReduceShader.bind();
+    glActiveTexture(GL_TEXTURE0);
+    for (int level = 1; level < pyramid.levelNum(); ++level) {
+        pyramid.bindAsOutput(level);
+        pyramid.bindAsInput();
+        mMaxReduceShader.drawTriangle();
+    }
+
+    pyramid.unbind();
+}
+
+void    App::invalidateGradedTextures()
+{
+    mGradingKeys[0] = mGradingKeys[1] = GradingKey();
+    mMosaicTileKeys.clear();
+    mDiffTextureKeys[0] = mDiffTextureKeys[1] = GradingKey();
+    mMarkerPyramidKeys[0] = mMarkerPyramidKeys[1] = MarkerPyramidKey();
+    mDiffPyramidKeys[0] = mDiffPyramidKeys[1] = GradingKey();
+    mStatisticsKeys[0] = mStatisticsKeys[1] = GradingKey();
+    mCpuStatisticsCache.clear();
+    mCpuStatistics = nullptr;
+    mPendingCpuStatisticsKey = StatisticsKey();
+    mHdrStatisticsCache.clear();
+    mPendingHdrStatisticsKey = StatisticsKey();
+    mExposureReductionKey = GradingKey();
+    mHeatRangeReductionKeys[0] = mHeatRangeReductionKeys[1] = GradingKey();
+    mScopeKey = GradingKey();
+    mRegionTableKey = mRegionReadbackKey = GradingKey();
+    mDiffRegionsKeys[0] = mDiffRegionsKeys[1] = GradingKey();
+    mDiffReadbackKeys[0] = mDiffReadbackKeys[1] = GradingKey();
+    mDiffRegions.clear();
+    mImageMetricsCache.clear();
+    mMetricsReadbackKey = mPendingMetricsKey = ImageMetricsKey();
+    mAlignReadbackKeys[0] = mAlignReadbackKeys[1] = GradingKey();
+    mPendingAlignmentKeys[0] = mPendingAlignmentKeys[1] = GradingKey();
+
+    // Offsets are kept for reloaded images, but removed ones might be replaced at the same addresses.
+    auto isRemoved = [this](const Image* image) {
+        return std::none_of(mImageList.begin(), mImageList.end(), [image](const ImageUPtr& item) {
+            return item.get() == image;
+        });
+    };
+
+    for (auto iter = mAlignmentOffsets.begin(); iter != mAlignmentOffsets.end();) {
+        if (isRemoved(iter->first.first) || isRemoved(iter->first.second)) {
+            iter = mAlignmentOffsets.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    for (auto iter = mLayerStatsSelection.begin(); iter != mLayerStatsSelection.end();) {
+        iter = isRemoved(*iter) ? mLayerStatsSelection.erase(iter) : std::next(iter);
+    }
+}
+
+void    App::bakeToneMappingLut()
+{
+    ScopeMarker("Bake Tone Mapping LUT");
+    mToneMappingLut.initialize(kToneMappingLutSize, GL_RGBA16F);
+
+    glDepthMask(GL_FALSE);
+    glDisable(GL_DEPTH_TEST);
+
+    mLutBakeShader.bind();
+    mLutBakeShader.setUniform("uVerify", false);
+
+    for (int slice = 0; slice < kToneMappingLutSize; ++slice) {
+        mToneMappingLut.bindAsOutput(slice);
+        mLutBakeShader.setUniform("uSlice", slice);
+        mLutBakeShader.drawTriangle();
+    }
+
+    mToneMappingLut.unbind();
+    verifyToneMappingLut();
+}
+
+void    App::verifyToneMappingLut()
+{
+    const Vec2f verifyKey(mOutTransformType, mDisplayGamma);
+    if (verifyKey == mLutVerifyKey) {
+        return;
+    }
+
+    ScopeMarker("Verify Tone Mapping LUT");
+
+    // Each texel stores the error at the center of one LUT cell.
+    const int cellNum = kToneMappingLutSize - 1;
+    const Vec2i size(cellNum * cellNum, cellNum);
+    RenderTexture errorTexture;
+    if (!errorTexture.bindAsOutput(size, GL_RGBA32F)) {
+        LOGW("Failed to create render target for verifying tone mapping LUT");
+        return;
+    }
+
+    glViewport(0, 0, size.x, size.y);
+    glActiveTexture(GL_TEXTURE0);
+    mToneMappingLut.bindAsInput();
+
+    mLutBakeShader.bind();
+    mLutBakeShader.setUniform("uOutTransformType", mOutTransformType);
+    mLutBakeShader.setUniform("uDisplayGamma", mDisplayGamma);
+    mLutBakeShader.setUniform("uVerify", true);
+    mLutBakeShader.drawTriangle();
+
+    std::vector<Vec4f> errors(size.x * size.y);
+    glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_FLOAT, errors.data());
+    errorTexture.unbind();
+    errorTexture.release();
+
+    double errorSum = 0.0;
+    mLutMaxError = 0.0f;
+    for (const Vec4f& error : errors) {
+        mLutMaxError = std::max(mLutMaxError, error.a);
+        errorSum += error.a;
+    }
+
+    mLutMeanError = static_cast<float>(errorSum / errors.size());
+    mLutVerifyKey = verifyKey;
+    LOGI("Tone mapping LUT error on display: max {:.5f}, mean {:.6f} (8-bit step is {:.5f})",
+        mLutMaxError, mLutMeanError, 1.0f / 255.0f);
+}
+
+void    App::importLutFiles(const std::vector<std::string>& filepathArray)
+{
+    LutSPtr lastLut;
+    for (const std::string& filepath : filepathArray) {
+        if (LutSPtr lut = mLutLibrary.acquire(filepath)) {
+            lastLut = lut;
+        }
+    }
+
+    if (lastLut) {
+        setDisplayLut(lastLut);
+    }
+}
+
+void    App::setDisplayLut(const LutSPtr& lut)
+{
+    mDisplayLut = lut;
+
+    static const LutTextures kEmptyTextures;
+    const LutTextures* textures = mLutLibrary.getTextures(lut);
+    if (!textures) {
+        textures = &kEmptyTextures;
+    }
+
+    const std::vector<Vec3f> domain1D = { textures->domain1DMin, textures->domain1DMax };
+    const std::vector<Vec3f> domain3D = { textures->domain3DMin, textures->domain3DMax };
+
+    mPresentShader.bind();
+    mPresentShader.setUniform("uDisplayLut1DSize", textures->size1D);
+    mPresentShader.setUniform("uDisplayLut3DSize", textures->lut3D.size());
+    mPresentShader.setUniform("uDisplayLut1DDomain", domain1D);
+    mPresentShader.setUniform("uDisplayLut3DDomain", domain3D);
+    glUseProgram(0);
 }
 
 void    App::computeImageStatistics(const RenderTexture& texture, float valueScale)
@@ -751,23 +1459,740 @@ void    App::computeImageStatistics(const RenderTexture& texture, float valueSca
     ScopeMarker("Compute Image Statistics");
 
     // Calculate image statistics.
-    std::fill(mHistogram.begin(), mHistogram.end(), 0);
+    static const std::array<int, 768> zeros = {};
     glBindTexture(GL_TEXTURE_2D, mTexHistogram);
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLint>(mHistogram.size()), 1, GL_RED_INTEGER, GL_INT, (void*)mHistogram.data());
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLint>(zeros.size()), 1, GL_RED_INTEGER, GL_INT, (void*)zeros.data());
     glBindTexture(GL_TEXTURE_2D, 0);
 
     mStatisticsShader.bind();
     glBindImageTexture(0, texture.id(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA16F);
     glBindImageTexture(1, mTexHistogram, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32I);
 
-    Vec2i size = texture.size();
-    mStatisticsShader.setUniform("uImageSize", size);
-    mStatisticsShader.setUniform("uValueScale", valueScale);
-    mStatisticsShader.compute(size.x / 16, size.y / 16);
+    Vec2i size = texture.size();
+    mStatisticsShader.setUniform("uImageSize", size);
+    mStatisticsShader.setUniform("uValueScale", valueScale);
+    const int tileSize = kStatisticsTileSize;
+    mStatisticsShader.compute((size.x + tileSize - 1) / tileSize, (size.y + tileSize - 1) / tileSize);
+
+    glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
+    mHistogramReadback.readTexture(mTexHistogram, GL_RED_INTEGER, GL_INT);
+}
+
+void    App::updateImageStatistics(bool useDiffImage)
+{
+    if (!mSupportComputeShader) {
+        updateCpuImageStatistics();
+        return;
+    }
+
+    // Linear histogram is hidden in HDR mode, thus it's not updated.
+    if (mShowHdrHistogram) {
+        updateHdrStatistics();
+        return;
+    }
+
+    // The histogram shows per-channel differences in difference views.
+    const GradingKey* keys = useDiffImage ? mDiffTextureKeys : &mGradingKeys[mTopImageRenderTexIdx];
+    const GradingKey secondKey = useDiffImage ? keys[1] : GradingKey();
+    if (mStatisticsKeys[0] == keys[0] && mStatisticsKeys[1] == secondKey) {
+        return;
+    }
+
+    const bool isLinear = keys[0].encodingType == ColorEncodingType::Linear;
+    const float valueScale = isLinear ? 1.0f : 255.0f;
+    computeImageStatistics(useDiffImage ? mDiffTexture : mRenderTextures[mTopImageRenderTexIdx], valueScale);
+
+    mStatisticsKeys[0] = keys[0];
+    mStatisticsKeys[1] = secondKey;
+}
+
+void    App::updateCpuImageStatistics()
+{
+    // Cache the finished computation, it's discarded if graded textures are invalidated meanwhile.
+    if (mCpuStatisticsFuture.valid() &&
+        mCpuStatisticsFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        ImageStatistics statistics = mCpuStatisticsFuture.get();
+        const Image* image = mPendingCpuStatisticsKey.grading.image;
+        if (image) {
+            mCpuStatisticsCache[image] = std::make_pair(mPendingCpuStatisticsKey, std::move(statistics));
+        }
+        mPendingCpuStatisticsKey = StatisticsKey();
+    }
+
+    Image* topImage = getTopImage();
+    const GradingKey& key = mGradingKeys[mTopImageRenderTexIdx];
+    const StatisticsKey statsKey = { key, mHdrLogRange };
+
+    // The last result is shown until the one of current key is done, e.g. while exposure is dragged.
+    auto iter = mCpuStatisticsCache.find(topImage);
+    if (iter != mCpuStatisticsCache.end()) {
+        mCpuStatistics = &iter->second.second;
+        mHistogram = iter->second.second.histogram();
+        if (iter->second.first == statsKey) {
+            return;
+        }
+    }
+
+    // Only one computation is in flight, the latest key is computed after it's done.
+    if (mCpuStatisticsFuture.valid()) {
+        return;
+    }
+
+    // Pixels are copied since the image could be reloaded or removed during computation,
+    // the copy is reused until the content of texture is changed.
+    const Texture* texture = topImage->getTexture();
+    const GLenum pixelDataType = texture->pixelDataType();
+    const Vec2i size(texture->size());
+    if (key.contentId == 0 || key.contentId != mCpuStatisticsContentId) {
+        const size_t channelBytes = pixelDataType == GL_UNSIGNED_BYTE ? 1 : (pixelDataType == GL_HALF_FLOAT ? 2 : 4);
+        const uint8_t* pixels = static_cast<const uint8_t*>(texture->pixels());
+        if (pixels) {
+            mCpuStatisticsPixels.assign(pixels, pixels + static_cast<size_t>(size.x) * size.y * 4 * channelBytes);
+        } else {
+            mCpuStatisticsPixels.clear();
+        }
+        mCpuStatisticsContentId = key.contentId;
+    }
+
+    const uint8_t* pixels = mCpuStatisticsPixels.empty() ? nullptr : mCpuStatisticsPixels.data();
+    const float valueScale = key.encodingType == ColorEncodingType::Linear ? 1.0f : 255.0f;
+    const Vec2f logRange = mHdrLogRange;
+    const std::string filename = topImage->filename();
+    ThreadPool* pool = &mThreadPool;
+    mCpuStatisticsFuture = std::async(std::launch::async, [pixels, pixelDataType, size, key, valueScale, logRange,
+            filename, pool]() {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        // The key is cached even if it's failed, thus we won't retry it every frame.
+        ImageStatistics statistics;
+        if (!statistics.compute(pixels, pixelDataType, size, key.encodingType, key.primaryType, key.exposureValue,
+                valueScale, logRange, pool)) {
+            LOGW("Failed to compute statistics of {}", filename);
+            statistics = ImageStatistics();
+        }
+
+        const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::steady_clock::now() - startTime;
+        LOGD("Compute statistics of {} on CPU in {:.1f} ms", filename, elapsedTime.count());
+        return statistics;
+    });
+    mPendingCpuStatisticsKey = statsKey;
+}
+
+void    App::updateHdrStatistics()
+{
+    const StatisticsKey key = { mGradingKeys[mTopImageRenderTexIdx], mHdrLogRange };
+    auto it = mHdrStatisticsCache.find(key.grading.image);
+    if (it != mHdrStatisticsCache.end() && it->second.first == key) {
+        return;
+    }
+
+    // Wait for the pending readback, since a new one would discard it.
+    if (mHdrHistogramReadback.isPending() && mPendingHdrStatisticsKey == key) {
+        return;
+    }
+
+    ScopeMarker("Compute HDR Statistics");
+
+    static const std::array<int, HdrStatistics::kPackedSize> zeros = {};
+    glBindTexture(GL_TEXTURE_2D, mTexHdrHistogram);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLint>(zeros.size()), 1, GL_RED_INTEGER, GL_INT, (void*)zeros.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    const RenderTexture& texture = mRenderTextures[mTopImageRenderTexIdx];
+    mHdrStatisticsShader.bind();
+    glBindImageTexture(0, texture.id(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA16F);
+    glBindImageTexture(1, mTexHdrHistogram, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32I);
+
+    Vec2i size = texture.size();
+    mHdrStatisticsShader.setUniform("uImageSize", size);
+    mHdrStatisticsShader.setUniform("uLogRange", mHdrLogRange);
+    const int tileSize = kStatisticsTileSize;
+    mHdrStatisticsShader.compute((size.x + tileSize - 1) / tileSize, (size.y + tileSize - 1) / tileSize);
+
+    glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
+    mHdrHistogramReadback.readTexture(mTexHdrHistogram, GL_RED_INTEGER, GL_INT);
+    mPendingHdrStatisticsKey = key;
+}
+
+void    App::dispatchReduction(const RenderTexture& texture, int channel, GpuReadback& readback)
+{
+    ScopeMarker("Dispatch Reduction");
+
+    static const std::array<int, ReductionResult::kPackedSize> zeros = {};
+    glBindTexture(GL_TEXTURE_2D, mTexReductionResult);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLint>(zeros.size()), 1, GL_RED_INTEGER, GL_INT, (void*)zeros.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Huge images are sampled with strides, thus the cost is bounded by kReductionMaxSize.
+    const Vec2i size = texture.size();
+    const Vec2i stride = (size + kReductionMaxSize - 1) / kReductionMaxSize;
+    const Vec2i gridSize = (size + stride - 1) / stride;
+    const Vec2i groupNum = (gridSize + kStatisticsTileSize - 1) / kStatisticsTileSize;
+
+    mReductionShader.bind();
+    glBindImageTexture(0, texture.id(), 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA16F);
+    glBindImageTexture(1, mTexReductionPartials, 0, GL_FALSE, 0, GL_READ_WRITE, GL_RGBA32F);
+    glBindImageTexture(2, mTexReductionResult, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32I);
+
+    mReductionShader.setUniform("uImageSize", size);
+    mReductionShader.setUniform("uSampleStride", stride);
+    mReductionShader.setUniform("uGridSize", gridSize);
+    mReductionShader.setUniform("uChannel", channel);
+    mReductionShader.setUniform("uLogRange", kReductionLogRange);
+    mReductionShader.setUniform("uMinValue", kReductionMinValue);
+    mReductionShader.setUniform("uFinalPass", false);
+    mReductionShader.compute(groupNum.x, groupNum.y);
+
+    glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    mReductionShader.setUniform("uFinalPass", true);
+    mReductionShader.setUniform("uPartialNum", groupNum.x * groupNum.y);
+    mReductionShader.compute(1);
+
+    glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
+    readback.readTexture(mTexReductionResult, GL_RED_INTEGER, GL_INT);
+}
+
+void    App::updateScopes()
+{
+    const GradingKey& key = mGradingKeys[mTopImageRenderTexIdx];
+    if (mScopeKey == key && mScopeDisplayGamma == mDisplayGamma) {
+        return;
+    }
+
+    // Wait for the pending readback, since a new one would discard it.
+    if (mScopeReadback.isPending()) {
+        return;
+    }
+
+    ScopeMarker("Update Scopes");
+
+    // Large images are measured at a mip level, thus the cost is bounded by kScopeMaxSize.
+    RenderTexture& texture = mRenderTextures[mTopImageRenderTexIdx];
+    const Vec2i size = texture.size();
+    int level = 0;
+    while ((std::max(size.x, size.y) >> level) > kScopeMaxSize) {
+        ++level;
+    }
+
+    if (mSupportComputeShader) {
+        if (level > 0) {
+            texture.generateMipmaps();
+        }
+
+        static const std::vector<int> zeros(Scopes::kDensityWidth * Scopes::kSize, 0);
+        glBindTexture(GL_TEXTURE_2D, mTexScopeDensity);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, Scopes::kDensityWidth, Scopes::kSize, GL_RED_INTEGER, GL_INT, (void*)zeros.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        const Vec2i mipSize(std::max(size.x >> level, 1), std::max(size.y >> level, 1));
+        mScopesShader.bind();
+        glBindImageTexture(0, texture.id(), level, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA16F);
+        glBindImageTexture(1, mTexScopeDensity, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32I);
+        mScopesShader.setUniform("uImageSize", mipSize);
+        mScopesShader.setUniform("uDisplayGamma", mDisplayGamma);
+        mScopesShader.compute((mipSize.x + 15) / 16, (mipSize.y + 15) / 16);
+
+        glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
+        mScopeReadback.readTexture(mTexScopeDensity, GL_RED_INTEGER, GL_INT);
+    } else {
+        const Texture* source = getTopImage()->getTexture();
+        GradingTransform xform;
+        if (source && xform.initialize(source->pixels(), source->pixelDataType(),
+                key.encodingType, key.primaryType, key.exposureValue)) {
+            Scopes::computeDensity(xform, Vec2i(source->size()), 1 << level, mDisplayGamma, &mThreadPool, mScopeDensity);
+            mScopes.updateTexture(mScopeDensity.data(), mScopeIntensity);
+        }
+    }
+
+    mScopeKey = key;
+    mScopeDisplayGamma = mDisplayGamma;
+}
+
+void    App::updateRegionTable()
+{
+    const GradingKey& key = mGradingKeys[mTopImageRenderTexIdx];
+    if (mRegionTableKey == key) {
+        return;
+    }
+
+    // Build tables once graded pixels are read back, outdated ones are discarded.
+    if (mRegionReadback.isPending()) {
+        if (!mRegionReadback.tryGetResult(mRegionPixels.data())) {
+            return;
+        } else if (mRegionReadbackKey == key) {
+            const auto startTime = std::chrono::steady_clock::now();
+            mRegionTable.build(mRegionPixels.data(), mRegionPixelsSize, &mThreadPool);
+            mRegionTableKey = key;
+
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::steady_clock::now() - startTime;
+            LOGD("Build summed-area tables of {} in {:.1f} ms", key.image->filename(), elapsedTime.count());
+            return;
+        }
+    }
+
+    // Graded textures are RGBA16F, thus values are read back as half floats.
+    const RenderTexture& texture = mRenderTextures[mTopImageRenderTexIdx];
+    if (texture.size() != mRegionPixelsSize) {
+        mRegionPixelsSize = texture.size();
+        mRegionPixels.resize(static_cast<size_t>(mRegionPixelsSize.x) * mRegionPixelsSize.y * 4);
+        mRegionReadback.initialize(mRegionPixels.size() * sizeof(uint16_t));
+    }
+
+    mRegionReadback.readTexture(texture.id(), GL_RGBA, GL_HALF_FLOAT);
+    mRegionReadbackKey = key;
+}
+
+void    App::updateImageMetrics()
+{
+    const int topIdx = mTopImageRenderTexIdx;
+    ImageMetricsKey key;
+    key.gradings[0] = mGradingKeys[topIdx];
+    key.gradings[1] = mGradingKeys[topIdx ^ 1];
+    key.applyToneMapping = mEnableToneMapping;
+    key.outTransformType = mOutTransformType;
+    key.displayGamma = mDisplayGamma;
+    key.displayLut = mDisplayLut.get();
+    key.pixelsPerDegree = mPixelsPerDegree;
+
+    // Cache the finished computation, it's discarded if graded textures are invalidated meanwhile.
+    if (mMetricsFuture.valid() && mMetricsFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        ImageMetrics metrics = mMetricsFuture.get();
+        if (mPendingMetricsKey.gradings[0].image) {
+            const auto pair = std::make_pair(mPendingMetricsKey.gradings[0].image, mPendingMetricsKey.gradings[1].image);
+            mImageMetricsCache[pair] = std::make_pair(mPendingMetricsKey, metrics);
+            LOGD("Compute metrics of {} and {} in {:.1f} ms", pair.first->filename(), pair.second->filename(),
+                metrics.elapsedTime() * 1000.0);
+        }
+        mPendingMetricsKey = ImageMetricsKey();
+    }
+
+    const auto iter = mImageMetricsCache.find(std::make_pair(key.gradings[0].image, key.gradings[1].image));
+    if ((iter != mImageMetricsCache.end() && iter->second.first == key) || mPendingMetricsKey == key) {
+        return;
+    }
+
+    // Only one computation is in flight, and metrics are only defined for images of the same size.
+    const Vec2i size = mRenderTextures[topIdx].size();
+    if (mMetricsFuture.valid() || size != mRenderTextures[topIdx ^ 1].size()) {
+        return;
+    }
+
+    // Both copies are issued in order, thus the first one is done once the second one is.
+    if (mMetricsReadbacks[1].isPending()) {
+        if (!mMetricsReadbacks[1].tryGetResult(mMetricsPixels[1].data()) ||
+            !mMetricsReadbacks[0].tryGetResult(mMetricsPixels[0].data())) {
+            return;
+        }
+
+        if (mMetricsReadbackKey == key) {
+            ImageMetrics::Settings settings;
+            settings.applyToneMapping = key.applyToneMapping;
+            settings.outTransformType = key.outTransformType;
+            settings.displayGamma = key.displayGamma;
+            settings.pixelsPerDegree = key.pixelsPerDegree;
+
+            // Graded values are linear ACES AP1, which the grading transform of pipeline leaves intact.
+            ColorPipeline::Source sources[2];
+            for (int i = 0; i < 2; ++i) {
+                sources[i].pixels = mMetricsPixels[i].data();
+                sources[i].pixelDataType = GL_HALF_FLOAT;
+                sources[i].encodingType = ColorEncodingType::Linear;
+                sources[i].primaryType = ColorPrimaryType::ACES_AP1;
+                sources[i].exposureValue = 0.0f;
+            }
+
+            // Pixels aren't read back again until the computation is done, and the LUT is kept alive by the task.
+            LutSPtr displayLut = mDisplayLut;
+            ThreadPool* pool = &mThreadPool;
+            mMetricsFuture = std::async(std::launch::async, [sources, size, settings, displayLut, pool]() {
+                ImageMetrics::Settings displaySettings = settings;
+                displaySettings.displayLut = displayLut.get();
+
+                ImageMetrics metrics;
+                metrics.compute(sources[0], sources[1], size, displaySettings, pool);
+                return metrics;
+            });
+            mPendingMetricsKey = key;
+            return;
+        }
+    }
+
+    // Graded textures are RGBA16F, thus values are read back as half floats.
+    if (size != mMetricsPixelsSizes[0]) {
+        for (int i = 0; i < 2; ++i) {
+            mMetricsPixelsSizes[i] = size;
+            mMetricsPixels[i].resize(static_cast<size_t>(size.x) * size.y * 4);
+            mMetricsReadbacks[i].initialize(mMetricsPixels[i].size() * sizeof(uint16_t));
+        }
+    }
+
+    mMetricsReadbacks[0].readTexture(mRenderTextures[topIdx].id(), GL_RGBA, GL_HALF_FLOAT);
+    mMetricsReadbacks[1].readTexture(mRenderTextures[topIdx ^ 1].id(), GL_RGBA, GL_HALF_FLOAT);
+    mMetricsReadbackKey = key;
+}
+
+void    App::updateMetricMatrix()
+{
+    // Images are invalidated if their color properties are changed, or their addresses are reused.
+    std::vector<const Image*> images;
+    std::unordered_map<const Image*, GradingKey> imageKeys;
+    for (const auto& image : mImageList) {
+        if (image->texId() == 0) {
+            continue;
+        }
+
+        GradingKey key;
+        key.image = image.get();
+        key.contentId = image->contentId();
+        key.imageId = image->id();
+        key.encodingType = image->getColorEncodingType();
+        key.primaryType = image->getColorPrimaryType();
+
+        auto iter = mMatrixImageKeys.find(key.image);
+        if (iter != mMatrixImageKeys.end() && iter->second != key) {
+            mMetricMatrix.invalidate(key.image);
+        }
+
+        imageKeys[key.image] = key;
+        images.push_back(key.image);
+    }
+
+    mMatrixImageKeys.swap(imageKeys);
+    mMetricMatrix.setImages(images);
+
+    // Source pixels are read back as they are uploaded, outdated ones are discarded.
+    if (mMatrixReadback.isPending()) {
+        if (mMatrixReadback.tryGetResult(mMatrixPixels.data())) {
+            auto iter = mMatrixImageKeys.find(mMatrixReadbackKey.image);
+            if (iter != mMatrixImageKeys.end() && iter->second == mMatrixReadbackKey) {
+                const Vec2i size(mMatrixReadbackKey.image->size());
+                mMetricMatrix.setImagePixels(mMatrixReadbackKey.image, mMatrixReadbackSource, size, std::move(mMatrixPixels));
+                mMatrixPixels = std::vector<uint8_t>();
+            }
+        }
+    } else if (const Image* image = mMetricMatrix.getRequestedImage()) {
+        const Texture* texture = image->getTexture();
+        const GLenum pixelDataType = texture->pixelDataType();
+        const size_t channelBytes = pixelDataType == GL_UNSIGNED_BYTE ? 1 : (pixelDataType == GL_HALF_FLOAT ? 2 : 4);
+        const Vec2i size(image->size());
+
+        mMatrixReadbackSource.pixelDataType = pixelDataType;
+        mMatrixReadbackSource.encodingType = image->getColorEncodingType();
+        mMatrixReadbackSource.primaryType = image->getColorPrimaryType();
+        mMatrixReadbackSource.exposureValue = 0.0f;
+        mMatrixPixels.resize(static_cast<size_t>(size.x) * size.y * 4 * channelBytes);
+        mMatrixReadback.initialize(mMatrixPixels.size());
+        mMatrixReadback.readTexture(texture->id(), GL_RGBA, pixelDataType);
+        mMatrixReadbackKey = mMatrixImageKeys[image];
+    }
+
+    mMetricMatrix.update(&mThreadPool);
+}
+
+const ImageMetrics* App::getImageMetrics() const
+{
+    const int topIdx = mTopImageRenderTexIdx;
+    const auto iter = mImageMetricsCache.find(std::make_pair(mGradingKeys[topIdx].image, mGradingKeys[topIdx ^ 1].image));
+    return iter != mImageMetricsCache.end() ? &iter->second.second : nullptr;
+}
+
+void    App::updateImageAlignment()
+{
+    const int topIdx = mTopImageRenderTexIdx;
+    const GradingKey* keys = &mGradingKeys[0];
+    auto isCurrentPair = [&](const GradingKey* pairKeys) {
+        return pairKeys[0] == keys[topIdx] && pairKeys[1] == keys[topIdx ^ 1];
+    };
+
+    // Accumulate the residual of finished estimation, it's discarded if either graded texture is changed meanwhile.
+    if (mAlignmentFuture.valid()) {
+        if (mAlignmentFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+
+        const ImageAlignment alignment = mAlignmentFuture.get();
+        if (isCurrentPair(mPendingAlignmentKeys)) {
+            // Rows of graded textures start from bottom, while rows of offsets start from top.
+            const GradingKey& cmpKey = mPendingAlignmentKeys[1];
+            const Vec2f offset = cmpKey.offset + alignment.offset() * Vec2f(1.0f, -1.0f);
+            setAlignmentOffset(mPendingAlignmentKeys[0].image, cmpKey.image, offset);
+            mAlignmentPeak = alignment.peakValue();
+            LOGI("Align {} to {} by ({:.2f}, {:.2f}) in {:.1f} ms, correlation peak: {:.2f}",
+                cmpKey.image->filename(), mPendingAlignmentKeys[0].image->filename(),
+                offset.x, offset.y, alignment.elapsedTime() * 1000.0, alignment.peakValue());
+        }
+
+        mPendingAlignmentKeys[0] = mPendingAlignmentKeys[1] = GradingKey();
+        return;
+    }
+
+    // Both copies are issued in order, thus the first one is done once the second one is.
+    const Vec2i size = mRenderTextures[topIdx].size();
+    if (mAlignReadbacks[1].isPending()) {
+        if (!mAlignReadbacks[1].tryGetResult(mAlignPixels[1].data()) ||
+            !mAlignReadbacks[0].tryGetResult(mAlignPixels[0].data())) {
+            return;
+        }
+
+        if (isCurrentPair(mAlignReadbackKeys)) {
+            // Pixels aren't read back again until the estimation is done.
+            const uint16_t* pixels1 = mAlignPixels[0].data();
+            const uint16_t* pixels2 = mAlignPixels[1].data();
+            ThreadPool* pool = &mThreadPool;
+            mAlignmentFuture = std::async(std::launch::async, [pixels1, pixels2, size, pool]() {
+                ImageAlignment alignment;
+                alignment.estimate(pixels1, pixels2, size, pool);
+                return alignment;
+            });
+            mPendingAlignmentKeys[0] = mAlignReadbackKeys[0];
+            mPendingAlignmentKeys[1] = mAlignReadbackKeys[1];
+        }
+        return;
+    }
+
+    if (!mRequestAlignment) {
+        return;
+    }
+
+    mRequestAlignment = false;
+    if (size != mRenderTextures[topIdx ^ 1].size()) {
+        LOGW("Only images of the same size can be aligned");
+        return;
+    }
+
+    // Graded textures are RGBA16F, thus values are read back as half floats.
+    if (size != mAlignPixelsSize) {
+        mAlignPixelsSize = size;
+        for (int i = 0; i < 2; ++i) {
+            mAlignPixels[i].resize(static_cast<size_t>(size.x) * size.y * 4);
+            mAlignReadbacks[i].initialize(mAlignPixels[i].size() * sizeof(uint16_t));
+        }
+    }
+
+    mAlignReadbacks[0].readTexture(mRenderTextures[topIdx].id(), GL_RGBA, GL_HALF_FLOAT);
+    mAlignReadbacks[1].readTexture(mRenderTextures[topIdx ^ 1].id(), GL_RGBA, GL_HALF_FLOAT);
+    mAlignReadbackKeys[0] = keys[topIdx];
+    mAlignReadbackKeys[1] = keys[topIdx ^ 1];
+}
+
+Vec2f   App::getAlignmentOffset(const Image* topImage, const Image* cmpImage) const
+{
+    // The offset of swapped pair is negated, thus flipping the pair keeps pixels matched.
+    auto iter = mAlignmentOffsets.find(std::make_pair(topImage, cmpImage));
+    if (iter != mAlignmentOffsets.end()) {
+        return iter->second;
+    }
+
+    iter = mAlignmentOffsets.find(std::make_pair(cmpImage, topImage));
+    return iter != mAlignmentOffsets.end() ? -iter->second : Vec2f(0.0f);
+}
+
+void    App::setAlignmentOffset(const Image* topImage, const Image* cmpImage, const Vec2f& offset)
+{
+    mAlignmentOffsets.erase(std::make_pair(cmpImage, topImage));
+    if (offset == Vec2f(0.0f)) {
+        mAlignmentOffsets.erase(std::make_pair(topImage, cmpImage));
+    } else {
+        mAlignmentOffsets[std::make_pair(topImage, cmpImage)] = offset;
+    }
+}
+
+void    App::startLayerStatistics()
+{
+    if (isComputingLayerStatistics()) {
+        return;
+    }
+
+    // Layers are accumulated in the order of image list.
+    Vec2i size(0);
+    mLayerStatsQueue.clear();
+    for (const auto& image : mImageList) {
+        if (mLayerStatsSelection.count(image.get()) == 0 || image->texId() == 0) {
+            continue;
+        }
+
+        if (!mLayerStatsQueue.empty() && Vec2i(image->size()) != size) {
+            LOGW("Statistics are only computed across layers of the same size");
+            mLayerStatsQueue.clear();
+            return;
+        }
+
+        size = Vec2i(image->size());
+        mLayerStatsQueue.push_back(image.get());
+    }
+
+    mLayerStatsTotal = static_cast<int>(mLayerStatsQueue.size());
+    mLayerStatistics.reset(size);
+}
+
+void    App::updateLayerStatistics()
+{
+    if (mLayerStatsFuture.valid()) {
+        if (mLayerStatsFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+
+        if (!mLayerStatsFuture.get()) {
+            LOGW("Failed to accumulate layer {} of statistics", mLayerStatistics.layerCount() + 1);
+        }
+    }
+
+    // Pixels aren't read back again until the accumulation is done.
+    if (mLayerStatsReadback.isPending()) {
+        if (mLayerStatsReadback.tryGetResult(mLayerStatsPixels.data())) {
+            ColorPipeline::Source source = mLayerStatsSource;
+            source.pixels = mLayerStatsPixels.data();
+            LayerStatistics* statistics = &mLayerStatistics;
+            ThreadPool* pool = &mThreadPool;
+            mLayerStatsFuture = std::async(std::launch::async, [source, statistics, pool]() {
+                return statistics->accumulate(source, statistics->size(), pool);
+            });
+        }
+        return;
+    }
+
+    // Source pixels are read back as they are uploaded, removed layers are skipped.
+    while (!mLayerStatsQueue.empty()) {
+        const Image* image = mLayerStatsQueue.front();
+        mLayerStatsQueue.pop_front();
+        if (std::none_of(mImageList.begin(), mImageList.end(), [image](const ImageUPtr& item) { return item.get() == image; })) {
+            continue;
+        }
+
+        const Texture* texture = image->getTexture();
+        const GLenum pixelDataType = texture->pixelDataType();
+        const size_t channelBytes = pixelDataType == GL_UNSIGNED_BYTE ? 1 : (pixelDataType == GL_HALF_FLOAT ? 2 : 4);
+        const Vec2i size(image->size());
+
+        mLayerStatsSource.pixelDataType = pixelDataType;
+        mLayerStatsSource.encodingType = image->getColorEncodingType();
+        mLayerStatsSource.primaryType = image->getColorPrimaryType();
+        mLayerStatsSource.exposureValue = 0.0f;
+        mLayerStatsPixels.resize(static_cast<size_t>(size.x) * size.y * 4 * channelBytes);
+        mLayerStatsReadback.initialize(mLayerStatsPixels.size());
+        mLayerStatsReadback.readTexture(texture->id(), GL_RGBA, pixelDataType);
+        return;
+    }
+
+    // Accumulated values are released even if no layer is accumulated.
+    const int layerCount = mLayerStatistics.layerCount();
+    if (layerCount == 0) {
+        if (mLayerStatistics.size() != Vec2i(0)) {
+            mLayerStatistics.clear();
+        }
+        return;
+    }
+
+    // Outputs are graded values, thus they are linear ACES AP1.
+    const size_t firstIndex = mImageList.size();
+    for (int i = 0; i < LayerStatistics::OutputNum; ++i) {
+        const auto output = static_cast<LayerStatistics::Output>(i);
+        const std::string name = fmt::format("{} of {} layers", LayerStatistics::getOutputName(output), layerCount);
+        TextureSPtr texture = std::make_shared<Texture>();
+        texture->setRetainPixels(!mSupportComputeShader);
+        if (!texture->loadFromPixels(name, mLayerStatistics.size(), mLayerStatistics.getPixels(output).data()) ||
+            !texture->upload()) {
+            LOGW("Failed to create layer {}", name);
+            continue;
+        }
+
+        auto image = std::make_unique<Image>(texture);
+        image->setColorEncodingType(ColorEncodingType::Linear);
+        image->setColorPrimaryType(ColorPrimaryType::ACES_AP1);
+        mImageList.push_back(std::move(image));
+    }
+
+    LOGI("Append mean, variance and median of {} layers", layerCount);
+    mLayerStatistics.clear();
+    mLayerStatsPixels = std::vector<uint8_t>();
+    if (mImageList.size() > firstIndex) {
+        mTopImageIndex = static_cast<int>(firstIndex);
+    }
+}
+
+bool    App::isComputingLayerStatistics() const
+{
+    return !mLayerStatsQueue.empty() || mLayerStatsReadback.isPending() || mLayerStatsFuture.valid() ||
+        mLayerStatistics.layerCount() > 0;
+}
+
+void    App::updateAutoExposure(float deltaTime)
+{
+    // Exposure is excluded from the key, since it's adjusted here.
+    GradingKey key = mGradingKeys[mTopImageRenderTexIdx];
+    const float gradedEv = key.exposureValue;
+    key.exposureValue = 0.0f;
+
+    std::array<int, ReductionResult::kPackedSize> data;
+    if (mExposureReadback.tryGetResult(data.data()) && mExposureReductionKey == key) {
+        ReductionResult result;
+        result.initialize(data.data(), kReductionLogRange);
+        if (result.sampleCount() > 0) {
+            // Luminance is proportional to 2^EV, thus the target doesn't depend on graded exposure.
+            const float targetEv = mExposureReductionEv + std::log2(kMiddleGray / result.logAverage());
+            mAutoExposureTarget = glm::clamp(targetEv, -8.0f, 8.0f);
+        }
+    }
+
+    if (mExposureReductionKey != key && !mExposureReadback.isPending()) {
+        dispatchReduction(mRenderTextures[mTopImageRenderTexIdx], 4, mExposureReadback);
+        mExposureReductionKey = key;
+        mExposureReductionEv = gradedEv;
+        return;
+    }
+
+    if (mExposureReductionKey == key && !mExposureReadback.isPending()) {
+        mExposureValue = mSmoothAutoAdaptation ?
+            smoothTowards(mExposureValue, mAutoExposureTarget, deltaTime, 0.01f) : mAutoExposureTarget;
+    }
+}
+
+void    App::updateAutoHeatRange(float deltaTime)
+{
+    const GradingKey* keys = mDiffTextureKeys;
+    const bool isSameInput = mHeatRangeReductionKeys[0] == keys[0] && mHeatRangeReductionKeys[1] == keys[1];
+
+    std::array<int, ReductionResult::kPackedSize> data;
+    if (mHeatRangeReadback.tryGetResult(data.data()) && isSameInput) {
+        ReductionResult result;
+        result.initialize(data.data(), kReductionLogRange);
+        if (result.sampleCount() > 0) {
+            // Values in the first bin are under the log range, they are regarded as zero.
+            const float binWidth = (kReductionLogRange.y - kReductionLogRange.x) / ReductionResult::kBinNum;
+            float lowValue = result.percentile(0.01f);
+            lowValue = lowValue < std::exp2(kReductionLogRange.x + binWidth) ? 0.0f : lowValue;
+            const float highValue = std::max(result.percentile(0.99f), lowValue + kReductionMinValue);
+            mAutoHeatRangeTarget = Vec2f(lowValue, highValue);
+        }
+    }
+
+    if (!isSameInput && !mHeatRangeReadback.isPending()) {
+        dispatchReduction(mDiffTexture, 3, mHeatRangeReadback);
+        mHeatRangeReductionKeys[0] = keys[0];
+        mHeatRangeReductionKeys[1] = keys[1];
+        return;
+    }
+
+    if (isSameInput && !mHeatRangeReadback.isPending()) {
+        if (mSmoothAutoAdaptation) {
+            const float tolerance = mAutoHeatRangeTarget.y * 1e-3f;
+            mHeatRange.x = smoothTowards(mHeatRange.x, mAutoHeatRangeTarget.x, deltaTime, tolerance);
+            mHeatRange.y = smoothTowards(mHeatRange.y, mAutoHeatRangeTarget.y, deltaTime, tolerance);
+        } else {
+            mHeatRange = mAutoHeatRangeTarget;
+        }
+    }
+}
+
+const HdrStatistics* App::getHdrStatistics()
+{
+    const Image* topImage = getTopImage();
+    if (!mSupportComputeShader) {
+        return mCpuStatistics ? &mCpuStatistics->hdrStatistics() : nullptr;
+    }
 
-    /*glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
-    glBindTexture(GL_TEXTURE_2D, mTexHistogram);
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RED_INTEGER, GL_INT, (void*)mHistogram.data());*/
+    auto it = mHdrStatisticsCache.find(topImage);
+    return it != mHdrStatisticsCache.end() ? &it->second.second : nullptr;
 }
 
 void    App::onKeyPressed(const ImGuiIO& io)
@@ -782,21 +2207,43 @@ void    App::onKeyPressed(const ImGuiIO& io)
         showImportImageDlg();
     } else if (io.KeyCtrl && ImGui::IsKeyPressed(0x45)) { // Ctrl+e
         showExportSessionDlg();
+    } else if (io.KeyCtrl && io.KeyShift && ImGui::IsKeyPressed(0x4C)) { // Ctrl+Shift+l
+        if (inCompareMode() && mCmpImageIndex >= 0) {
+            setAlignmentOffset(getTopImage(), mImageList[mCmpImageIndex].get(), Vec2f(0.0f));
+            mAlignmentPeak = 0.0f;
+        }
+    } else if (io.KeyCtrl && ImGui::IsKeyPressed(0x4C)) { // Ctrl+l
+        mRequestAlignment = inCompareMode() && mCmpImageIndex >= 0;
     } else if (io.KeyAlt && ImGui::IsKeyPressed(0x43)) { // Alt+c
         syncSideBySideView(io);
     } else if (ImGui::IsKeyPressed(0x53)) { // s
         toggleSplitView();
     } else if (ImGui::IsKeyPressed(0x43)) { // c
         toggleSideBySideView();
+    } else if (ImGui::IsKeyPressed(0x47)) { // g
+        toggleMosaicView();
     } else if (ImGui::IsKeyPressed(0x51)) { // q
         mUseLinearFilter ^= true;
     } else if (ImGui::IsKeyPressed(0x57)) { // w
         mShowPixelMarker ^= true;
+    } else if (ImGui::IsKeyPressed(0x4E)) { // n
+        jumpToNextBadPixel();
+    } else if (ImGui::IsKeyPressed(0x2E)) { // .
+        jumpToDiffRegion(1);
+    } else if (ImGui::IsKeyPressed(0x2C)) { // ,
+        jumpToDiffRegion(-1);
+    } else if (ImGui::IsKeyPressed(0x100) && mHasRegionSelection) { // Esc
+        clearRegionSelection();
     } else if (ImGui::IsKeyPressed(0x122)) { // F1
         ImGui::OpenPopup("Home");
+    } else if (ImGui::IsKeyPressed(0x123)) { // F2
+        mShowFrameStats ^= true;
     } else if (ImGui::IsKeyPressed(0x126)) { // F5
         Image* image = getTopImage();
-        if (image) image->reload();
+        if (image && image->reload()) {
+            invalidateGradedTextures();
+            mMetricMatrix.invalidate(image);
+        }
     } else if (ImGui::IsKeyPressed(0x103) || ImGui::IsKeyPressed(0x105)) { // Backspace/Del
         if (mTopImageIndex > -1) ImGui::OpenPopup(kImageRemoveDlgTitle);
     } else {
@@ -848,7 +2295,9 @@ void    App::updateImageTransform(const ImGuiIO& io, bool useColumnView)
 
     Vec2f scalePivot(-1.0f);
 
-    mImageScale = inSideBySideMode() ? mColumnViews[0].getImageScale() : mView.getImageScale();
+    // Tiles of mosaic view share one view, which is used as the single view.
+    View& view = inMosaicMode() ? mMosaicView : mView;
+    mImageScale = inSideBySideMode() ? mColumnViews[0].getImageScale() : view.getImageScale();
 
     bool onFocus = !ImGui::IsWindowFocused(ImGuiFocusedFlags_AnyWindow);
     float oldImageScale = mImageScale;
@@ -866,6 +2315,34 @@ void    App::updateImageTransform(const ImGuiIO& io, bool useColumnView)
             mIsScalingImage = false;
         }
 
+        // Double click a mosaic tile to make its layer the top image, the compared one is swapped.
+        Vec2f localCoords;
+        const int tile = inMosaicMode() && ImGui::IsMouseDoubleClicked(0) ? getMosaicTile(io.MousePos, localCoords) : -1;
+        if (tile >= 0) {
+            const int layer = mMosaicFirstLayer + tile;
+            if (layer == mCmpImageIndex) {
+                mCmpImageIndex = mTopImageIndex;
+            }
+            mTopImageIndex = layer;
+        }
+
+        // Select region with Shift+drag, the cursor is clamped to image while dragging.
+        Vec2f imageCoords;
+        if (io.KeyShift && !mIsMovingSplitter && ImGui::IsMouseClicked(0) && getImageCoordinates(io.MousePos, imageCoords)) {
+            mRegionAnchor = mRegionCursor = Vec2i(imageCoords);
+            mHasRegionSelection = mIsSelectingRegion = true;
+        }
+
+        if (mIsSelectingRegion) {
+            if (ImGui::IsMouseDown(0)) {
+                getImageCoordinates(io.MousePos, imageCoords);
+                mRegionCursor = glm::clamp(Vec2i(imageCoords), Vec2i(0), Vec2i(topImage->size()) - 1);
+                return;
+            }
+
+            mIsSelectingRegion = false;
+        }
+
         if (ImGui::IsMouseDown(0) && ImGui::IsMouseDown(1)) {
             // Scale the image when both left and right buttons are pressed.
             mImageScale *= (1.0f - glm::roundEven(io.MouseDelta.y) * 0.0078125f);
@@ -876,7 +2353,7 @@ void    App::updateImageTransform(const ImGuiIO& io, bool useColumnView)
             Vec2f translate(io.MouseDelta.x, -io.MouseDelta.y);
 
             if (!useColumnView) {
-                mView.translate(translate);
+                view.translate(translate);
             } else if (io.KeyAlt) {
                 static Vec2f residualTranslate = Vec2f(0.0f);
                 translate += residualTranslate;
@@ -895,8 +2372,12 @@ void    App::updateImageTransform(const ImGuiIO& io, bool useColumnView)
     }
 
     bool mouseAtRightColumn = false;
-    auto fetchScalePivot = [](const ImGuiIO& io, bool useColumnView, float viewSplitPos, bool& mouseAtRightColumn) {
+    auto fetchScalePivot = [this](const ImGuiIO& io, bool useColumnView, float viewSplitPos, bool& mouseAtRightColumn) {
         Vec2f scalePivot(io.MousePos.x, io.DisplaySize.y - io.MousePos.y);
+        if (inMosaicMode() && getMosaicTile(io.MousePos, scalePivot) < 0) {
+            return Vec2f(-1.0f);
+        }
+
         if (useColumnView) {
             float leftColumnWidth = io.DisplaySize.x * viewSplitPos;
             if (scalePivot.x > leftColumnWidth) {
@@ -957,7 +2438,7 @@ void    App::updateImageTransform(const ImGuiIO& io, bool useColumnView)
     }
 
     if (!useColumnView) {
-        mView.scale(relativeScale, scalePivot.x > 0.0f ? &scalePivot : nullptr);
+        view.scale(relativeScale, scalePivot.x > 0.0f ? &scalePivot : nullptr);
     } else if (scalePivot.x < 0.0f) {
         // Use previous scale pivot.
         mColumnViews[0].scale(relativeScale);
@@ -1086,6 +2567,13 @@ void    App::initToolbar()
     }
     if (ImGui::IsItemHovered()) { ImGui::SetTooltip("Side by Side View"); }
 
+    ImGui::SameLine();
+    bool inMosaicView = inMosaicMode();
+    if (ToggleButton(ICON_FA_TH, &inMosaicView, buttonSize, couldCompare)) {
+        toggleMosaicView();
+    }
+    if (ImGui::IsItemHovered()) { ImGui::SetTooltip("Mosaic View"); }
+
     ImGui::SameLine();
     ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, Vec2f(5.0f));
     ImGui::PushItemWidth(comboMenuWidth);
@@ -1110,9 +2598,24 @@ void    App::initToolbar()
 
     ImGui::SameLine();
     ImGui::SetNextItemWidth(60.0f);
-    ImGui::SliderFloat("##EV", &mExposureValue, -8.0f, 8.0f, "EV: %.1f");
+    if (ImGui::SliderFloat("##EV", &mExposureValue, -8.0f, 8.0f, "EV: %.1f")) {
+        mEnableAutoExposure = false;
+    }
     if (ImGui::IsItemClicked(1)) {
         mExposureValue = 0.0f;
+        mEnableAutoExposure = false;
+    }
+
+    ImGui::SameLine();
+    if (ToggleButton(ICON_FA_MAGIC, &mEnableAutoExposure, buttonSize, mSupportComputeShader)) {
+        mExposureReductionKey = GradingKey();
+    }
+    if (ImGui::IsItemClicked(1)) { ImGui::OpenPopup("AutoExposureMenu"); }
+    if (ImGui::IsItemHovered()) { ImGui::SetTooltip("Auto Exposure"); }
+
+    if (ImGui::BeginPopup("AutoExposureMenu")) {
+        ImGui::MenuItem("Temporal Smoothing", "", &mSmoothAutoAdaptation);
+        ImGui::EndPopup();
     }
 
     ImGui::SameLine();
@@ -1142,6 +2645,38 @@ void    App::initToolbar()
         ImGui::SetTooltip("Channels");
     }
 
+    ImGui::SameLine();
+    if (ImGui::BeginCombo("##DisplayLut", mDisplayLut ? mDisplayLut->name().c_str() : "No LUT"))
+    {
+        if (ImGui::Selectable("No LUT", !mDisplayLut)) {
+            setDisplayLut(nullptr);
+        }
+
+        // LUTs from different directories might share the same filename.
+        int lutIdx = 0;
+        for (const LutSPtr& lut : mLutLibrary.luts()) {
+            ImGui::PushID(lutIdx++);
+            bool isSelected = (mDisplayLut == lut);
+            if (ImGui::Selectable(lut->name().c_str(), isSelected)) {
+                setDisplayLut(lut);
+            }
+
+            if (isSelected) {
+                ImGui::SetItemDefaultFocus();
+            }
+            ImGui::PopID();
+        }
+
+        ImGui::Separator();
+        if (ImGui::Selectable("Load LUT...")) {
+            showImportLutDlg();
+        }
+        ImGui::EndCombo();
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip(mDisplayLut ? mDisplayLut->filepath().c_str() : "Display LUT");
+    }
+
     ImGui::PopItemWidth();
     ImGui::PopStyleVar(1);
 
@@ -1167,6 +2702,28 @@ void    App::initToolbar()
             mPixelMarkerFlags = (mPixelMarkerFlags & ~PixelMarkerFlags::DiffMask) | newState;
         }
 
+        if (ImGui::MenuItem("Auto Heat Range", "", &mEnableAutoHeatRange, enableCompareView && mSupportComputeShader)) {
+            mHeatRangeReductionKeys[0] = mHeatRangeReductionKeys[1] = GradingKey();
+        }
+        ImGui::MenuItem("Temporal Smoothing", "", &mSmoothAutoAdaptation, mEnableAutoHeatRange);
+
+        // Regions are found in the difference texture, which is only built in difference modes.
+        const bool hasDiffRegions = enableCompareView && !mDiffRegions.isEmpty() &&
+            hasAnyFlags(mPixelMarkerFlags, PixelMarkerFlags::DiffMask);
+        ImGui::PushItemWidth(120.0f);
+        ImGui::SliderFloat("Threshold (Delta E)", &mDiffThreshold, 0.1f, 20.0f, "%.2f", 2.0f);
+        ImGui::PopItemWidth();
+        if (hasDiffRegions) {
+            ImGui::Text("%zu regions, %zu pixels", mDiffRegions.regions().size(), mDiffRegions.pixelCount());
+            if (ImGui::MenuItem("Next Region", ".", false, !mDiffRegions.regions().empty())) {
+                jumpToDiffRegion(1);
+            }
+            if (ImGui::MenuItem("Previous Region", ",", false, !mDiffRegions.regions().empty())) {
+                jumpToDiffRegion(-1);
+            }
+        }
+        ImGui::Separator();
+
         const bool showDiffMarker = hasAnyFlags(mPixelMarkerFlags, PixelMarkerFlags::DiffMask);
         
         itemValue = hasAllFlags(mPixelMarkerFlags, PixelMarkerFlags::Overflow);
@@ -1179,6 +2736,11 @@ void    App::initToolbar()
             mPixelMarkerFlags = toggleFlags(mPixelMarkerFlags, PixelMarkerFlags::Underflow);
         }
 
+        itemValue = hasAllFlags(mPixelMarkerFlags, PixelMarkerFlags::Invalid);
+        if (ImGui::MenuItem("NaN / Inf / Negative", "", &itemValue)) {
+            mPixelMarkerFlags = toggleFlags(mPixelMarkerFlags, PixelMarkerFlags::Invalid);
+        }
+
         ImGui::EndPopup();
     }
 
@@ -1276,38 +2838,109 @@ void App::initImagePropWindow()
     ImGui::PushStyleVar(ImGuiStyleVar_FrameRounding, 6.0f);
     
     auto* topImage = getTopImage();
-    if (ImGui::CollapsingHeader("Histogram") && topImage && mSupportComputeShader) {
+    // The difference texture is only available for the GPU statistics.
+    const bool showDiffHistogram = mSupportComputeShader && !mShowHdrHistogram && inCompareMode() &&
+        (getPixelMarkerFlags() & static_cast<int>(PixelMarkerFlags::DiffMask)) != 0;
+    if (ImGui::CollapsingHeader(showDiffHistogram ? "Difference Histogram###Histogram" : "Histogram###Histogram") && topImage) {
         ScopeMarker("Draw Histogram");
-        glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
-        glBindTexture(GL_TEXTURE_2D, mTexHistogram);
-        glGetTexImage(GL_TEXTURE_2D, 0, GL_RED_INTEGER, GL_INT, (void*)mHistogram.data());
 
-        ImGui::SetNextItemWidth(propWindowWidth - ImGui::GetStyle().ItemSpacing.x);
-        const char* names[3] = {"R", "G", "B"};
-        static ImColor colors[3] = { ImColor(255, 0, 0, 150), ImColor(0, 255, 0, 150), ImColor(0, 0, 255, 150) };
-        const int binSize = 256;
-        static float arr[binSize * 3];
+        ImGui::Checkbox("Log2 Scale (HDR)", &mShowHdrHistogram);
+        if (mShowHdrHistogram) {
+            // Statistics are recomputed after the range is edited instead of during dragging.
+            static Vec2f logRange = mHdrLogRange;
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(-1.0f);
+            ImGui::DragFloatRange2("##EVRange", &logRange.x, &logRange.y, 0.1f, -32.0f, 32.0f, "%.1f EV");
+            if (ImGui::IsItemDeactivatedAfterEdit() && logRange.y - logRange.x >= 1.0f) {
+                mHdrLogRange = logRange;
+            }
 
-        // Get the first 25-th largest bin counts and use it as the normalize factor.
-        std::vector<int> temp;
-        temp.assign(mHistogram.begin(), mHistogram.end());
-        std::nth_element(temp.begin(), temp.end() - 25, temp.end());
-        int normPixelCount =*(temp.end() - 25);
+            if (!ImGui::IsItemActive()) {
+                logRange = mHdrLogRange;
+            }
+        }
 
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, Vec2f(3.0f));
         ImGui::PushStyleColor(ImGuiCol_FrameBg, IM_COL32(69, 69, 69, 255));
         ImGui::PushFont(mSmallFont);
-        ImGui::PlotMultiHistograms("##histogram", 3, names, colors, mHistogram.data(), normPixelCount, binSize, 0.0f, 1.0f, ImVec2(0, 100));
+
+        const float histogramWidth = propWindowWidth - ImGui::GetStyle().ItemSpacing.x;
+        if (mShowHdrHistogram) {
+            const HdrStatistics* hdrStats = getHdrStatistics();
+            if (hdrStats && !hdrStats->isEmpty()) {
+                showHdrStatistics(*hdrStats, histogramWidth);
+            }
+        } else {
+            ImGui::SetNextItemWidth(histogramWidth);
+            const char* names[3] = {"R", "G", "B"};
+            static ImColor colors[3] = { ImColor(255, 0, 0, 150), ImColor(0, 255, 0, 150), ImColor(0, 0, 255, 150) };
+            const int binSize = 256;
+
+            // Get the first 25-th largest bin counts and use it as the normalize factor.
+            std::vector<int> temp;
+            temp.assign(mHistogram.begin(), mHistogram.end());
+            std::nth_element(temp.begin(), temp.end() - 25, temp.end());
+            int normPixelCount =*(temp.end() - 25);
+
+            ImGui::PlotMultiHistograms("##histogram", 3, names, colors, mHistogram.data(), normPixelCount, binSize, 0.0f, 1.0f, ImVec2(0, 100));
+
+            if (!mSupportComputeShader && mCpuStatistics) {
+                showCpuStatistics(*mCpuStatistics);
+            }
+        }
+
         ImGui::PopFont();
         ImGui::PopStyleColor();
         ImGui::PopStyleVar(1);
     }
 
-    //if (ImGui::CollapsingHeader("Scope")) {
-    //}
+    // Densities are recolorized immediately, instead of being recomputed, when intensity is changed.
+    auto showScopeIntensity = [this](const char* label) {
+        ImGui::SetNextItemWidth(-1.0f);
+        if (ImGui::SliderFloat(label, &mScopeIntensity, 0.1f, 8.0f, "intensity: %.1f")) {
+            mScopes.updateTexture(mScopeDensity.data(), mScopeIntensity);
+        }
+    };
+
+    const float scopeWidth = propWindowWidth - ImGui::GetStyle().ItemSpacing.x;
+    mShowWaveform = ImGui::CollapsingHeader("Waveform") && topImage;
+    if (mShowWaveform) {
+        ScopeMarker("Draw Waveform");
+
+        ImGui::SetNextItemWidth(scopeWidth * 0.4f);
+        ImGui::Combo("##WaveformMode", &mWaveformMode, "Luma\0RGB Parade\0");
+        ImGui::SameLine();
+        showScopeIntensity("##WaveformIntensity");
+        showWaveform(scopeWidth);
+    }
+
+    mShowVectorscope = ImGui::CollapsingHeader("Vectorscope") && topImage;
+    if (mShowVectorscope) {
+        ScopeMarker("Draw Vectorscope");
+
+        showScopeIntensity("##VectorscopeIntensity");
+        showVectorscope(scopeWidth);
+    }
+
+    mShowImageMetrics = ImGui::CollapsingHeader("Image Metrics") && topImage;
+    if (mShowImageMetrics) {
+        ScopeMarker("Draw Image Metrics");
+        showImageMetrics();
+    }
+
+    if (ImGui::CollapsingHeader("Image Alignment") && topImage) {
+        showImageAlignment();
+    }
+
+    mShowMetricMatrix = ImGui::CollapsingHeader("Metric Matrix") && topImage;
+    if (mShowMetricMatrix) {
+        ScopeMarker("Draw Metric Matrix");
+        showMetricMatrix(scopeWidth);
+    }
 
-    //if (ImGui::CollapsingHeader("Wavefront")) {
-    //}
+    if (ImGui::CollapsingHeader("Layer Statistics") && topImage) {
+        showLayerStatistics();
+    }
 
     if (ImGui::CollapsingHeader("Image Properties", ImGuiTreeNodeFlags_DefaultOpen)) {
         showImageProperties();
@@ -1454,7 +3087,9 @@ void App::initImagePropWindow()
 
     ImGui::SameLine();
     if (ImGui::Button(ICON_FA_SYNC_ALT "##ReloadImage", buttonSize) && mTopImageIndex > -1) {
-        mImageList[mTopImageIndex]->reload();
+        if (mImageList[mTopImageIndex]->reload()) {
+            mMetricMatrix.invalidate(mImageList[mTopImageIndex].get());
+        }
     }
     if (ImGui::IsItemHovered()) { ImGui::SetTooltip("Reload Selected Image"); }
 
@@ -1484,59 +3119,492 @@ void App::initImagePropWindow()
     ImGui::PopStyleColor();
     ImGui::PopFont();
 
-    if (checkPopupRect) {
-        mPopupImagePropWindow = ImGui::IsWindowHovered();
+    if (checkPopupRect) {
+        mPopupImagePropWindow = ImGui::IsWindowHovered();
+    }
+    ImGui::End();
+}
+
+
+void App::initFooter()
+{
+    ImGuiContext& g = *ImGui::GetCurrentContext();
+    ImGui::PushFont(mSmallFont);
+
+    //g.NextWindowData.MenuBarOffsetMinVal = ImVec2(g.Style.DisplaySafeAreaPadding.x, ImMax(g.Style.DisplaySafeAreaPadding.y - g.Style.FramePadding.y, 0.0f));
+    ImGui::SetNextWindowPos(ImVec2(0.0f, g.IO.DisplaySize.y - mFooterHeight));
+    ImGui::SetNextWindowSize(ImVec2(g.IO.DisplaySize.x, mFooterHeight));
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 0.0f);
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowMinSize, ImVec2(0, 0));
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, g.Style.FramePadding);
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
+    ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoSavedSettings;
+    ImGui::Begin("##MainFooter", NULL, window_flags);
+    ImGui::PopStyleVar(4);
+
+    if (mImageScale > 1.0f) {
+        sprintf_s(mImageScaleInfo, IM_ARRAYSIZE(mImageScaleInfo), "%.1fx", mImageScale);
+    } else {
+        sprintf_s(mImageScaleInfo, IM_ARRAYSIZE(mImageScaleInfo), "%.2f%%\n", mImageScale * 100.0f);
+    }
+
+    ImGui::Text("%s", mImageScaleInfo);
+
+    if (mTopImageIndex >= 0) {
+        const Vec2f& imageSize = mImageList[mTopImageIndex]->size();
+        ImGui::SameLine(g.Style.FramePadding.x + g.FontSize * 4.0f);
+        ImGui::Text("| %.0f x %.0f", imageSize.x, imageSize.y);
+
+        Vec2f imageCoords;
+        if (getImageCoordinates(g.IO.MousePos, imageCoords)) {
+            ImGui::SameLine();
+            imageCoords.y = imageSize.y - imageCoords.y - 1;
+            ImGui::Text("(%.0f, %.0f)", imageCoords.x, imageCoords.y);
+        }
+    }
+
+    const auto* topImage = getTopImage();
+    if (topImage && !inCompareMode()) {
+        const std::string& filename = topImage->filename();
+        ImGui::SameLine(g.IO.DisplaySize.x - ImGui::CalcTextSize(filename.c_str()).x - g.Style.FramePadding.x);
+        ImGui::TextUnformatted(filename.c_str());
+    }
+
+    ImGui::End();
+    ImGui::PopFont();
+}
+
+void    App::showCpuStatistics(const ImageStatistics& stats)
+{
+    ImGui::Columns(4, nullptr, false);
+    ImGui::SetColumnWidth(0, 60.0f);
+
+    ImGui::NextColumn();
+    ImGui::Text("R");
+    ImGui::NextColumn();
+    ImGui::Text("G");
+    ImGui::NextColumn();
+    ImGui::Text("B");
+    ImGui::NextColumn();
+
+    auto showRow = [](const char* label, const Vec3f& value) {
+        ImGui::TextUnformatted(label);
+        ImGui::NextColumn();
+        for (int c = 0; c < 3; ++c) {
+            ImGui::Text("%.4g", value[c]);
+            ImGui::NextColumn();
+        }
+    };
+
+    showRow("Min", stats.minValue());
+    showRow("Max", stats.maxValue());
+    showRow("Mean", stats.meanValue());
+    showRow("1%", stats.percentile(0));
+    showRow("Median", stats.percentile(1));
+    showRow("99%", stats.percentile(2));
+
+    ImGui::Columns(1);
+}
+
+void    App::showImageMetrics()
+{
+    if (!inCompareMode() || mCmpImageIndex < 0) {
+        ImGui::TextDisabled("Metrics are shown in compare mode.");
+        return;
+    }
+
+    const Vec2i topSize = mImageList[mTopImageIndex]->size();
+    const Vec2i cmpSize = mImageList[mCmpImageIndex]->size();
+    if (topSize != cmpSize) {
+        ImGui::TextDisabled("Image sizes differ: %dx%d vs %dx%d", topSize.x, topSize.y, cmpSize.x, cmpSize.y);
+        return;
+    }
+
+    // Metrics are recomputed after the value is edited instead of during dragging.
+    static float pixelsPerDegree = mPixelsPerDegree;
+    ImGui::SetNextItemWidth(-1.0f);
+    ImGui::DragFloat("##PixelsPerDegree", &pixelsPerDegree, 0.5f, 1.0f, 300.0f, "FLIP pixels per degree: %.1f");
+    if (ImGui::IsItemDeactivatedAfterEdit()) {
+        mPixelsPerDegree = glm::clamp(pixelsPerDegree, 1.0f, 300.0f);
+    }
+
+    if (!ImGui::IsItemActive()) {
+        pixelsPerDegree = mPixelsPerDegree;
+    }
+
+    // The cached metrics of this pair are shown until the pending computation is done.
+    const ImageMetrics* metrics = getImageMetrics();
+    if (!metrics) {
+        ImGui::TextDisabled("Computing...");
+        return;
+    }
+
+    ImGui::PushFont(mSmallFont);
+    ImGui::Columns(2, nullptr, false);
+    ImGui::SetColumnWidth(0, 80.0f);
+
+    auto showRow = [](const char* label, const char* format, float value) {
+        ImGui::TextUnformatted(label);
+        ImGui::NextColumn();
+        ImGui::Text(format, value);
+        ImGui::NextColumn();
+    };
+
+    const float psnr = metrics->value(ImageMetrics::PSNR);
+    if (std::isinf(psnr)) {
+        ImGui::TextUnformatted(ImageMetrics::getMetricLabel(ImageMetrics::PSNR));
+        ImGui::NextColumn();
+        ImGui::TextUnformatted("inf");
+        ImGui::NextColumn();
+    } else {
+        showRow(ImageMetrics::getMetricLabel(ImageMetrics::PSNR), "%.2f dB", psnr);
+    }
+
+    showRow(ImageMetrics::getMetricLabel(ImageMetrics::SSIM), "%.5f", metrics->value(ImageMetrics::SSIM));
+    showRow(ImageMetrics::getMetricLabel(ImageMetrics::MSSSIM), "%.5f", metrics->value(ImageMetrics::MSSSIM));
+    showRow(ImageMetrics::getMetricLabel(ImageMetrics::FLIP), "%.5f", metrics->value(ImageMetrics::FLIP));
+
+    ImGui::Columns(1);
+    ImGui::TextDisabled("%d MS-SSIM scales, computed in %.0f ms", metrics->scaleNum(), metrics->elapsedTime() * 1000.0);
+    ImGui::PopFont();
+}
+
+void    App::showImageAlignment()
+{
+    if (!inCompareMode() || mCmpImageIndex < 0) {
+        ImGui::TextDisabled("Alignment is applied in compare mode.");
+        return;
+    }
+
+    const Image* topImage = mImageList[mTopImageIndex].get();
+    const Image* cmpImage = mImageList[mCmpImageIndex].get();
+    Vec2f offset = getAlignmentOffset(topImage, cmpImage);
+    ImGui::SetNextItemWidth(-1.0f);
+    if (ImGui::DragFloat2("##AlignmentOffset", &offset.x, 0.05f, -4096.0f, 4096.0f, "%.2f px")) {
+        setAlignmentOffset(topImage, cmpImage, offset);
+    }
+
+    if (mRequestAlignment || mAlignReadbacks[1].isPending() || mAlignmentFuture.valid()) {
+        ImGui::TextDisabled("Aligning...");
+        return;
+    }
+
+    if (ImGui::Button("Align")) {
+        mRequestAlignment = true;
+    }
+
+    ImGui::SameLine();
+    if (ImGui::Button("Reset")) {
+        setAlignmentOffset(topImage, cmpImage, Vec2f(0.0f));
+        mAlignmentPeak = 0.0f;
+    }
+
+    // The peak drops for images which differ by more than a translation.
+    if (mAlignmentPeak > 0.0f) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("peak: %.2f", mAlignmentPeak);
+    }
+}
+
+void    App::showLayerStatistics()
+{
+    // Layers are selected by checkboxes, and outputs are appended as new layers.
+    for (size_t i = 0; i < mImageList.size(); ++i) {
+        const Image* image = mImageList[i].get();
+        bool isSelected = mLayerStatsSelection.count(image) > 0;
+        ImGui::PushID(static_cast<int>(i));
+        if (ImGui::Checkbox(image->filename().c_str(), &isSelected)) {
+            if (isSelected) {
+                mLayerStatsSelection.insert(image);
+            } else {
+                mLayerStatsSelection.erase(image);
+            }
+        }
+        ImGui::PopID();
+    }
+
+    if (isComputingLayerStatistics()) {
+        ImGui::TextDisabled("Accumulating %d / %d layers...", mLayerStatistics.layerCount(), mLayerStatsTotal);
+    } else if (mLayerStatsSelection.size() < 2) {
+        ImGui::TextDisabled("Select two or more layers of the same size.");
+    } else if (ImGui::Button("Compute Mean, Variance and Median")) {
+        startLayerStatistics();
+    }
+}
+
+void    App::showMetricMatrix(float width)
+{
+    ImGui::SetNextItemWidth(width * 0.4f);
+    ImGui::Combo("##MatrixMetric", &mMatrixMetric, "RMSE\0Delta E\0SSIM\0");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(-1.0f);
+    ImGui::Combo("##MatrixSortMode", &mMatrixSortMode, "Layer Order\0Similarity to Top\0Mean Distance\0");
+
+    const MetricMatrix& matrix = mMetricMatrix;
+    const int imageNum = matrix.imageCount();
+    if (imageNum < 2) {
+        ImGui::TextDisabled("Import two or more images.");
+        return;
+    }
+
+    const auto metric = static_cast<MetricMatrix::Metric>(mMatrixMetric);
+    const Image* topImage = getTopImage();
+    int reference = 0;
+    for (int i = 0; i < imageNum; ++i) {
+        reference = matrix.image(i) == topImage ? i : reference;
+    }
+
+    const std::vector<int> order = matrix.getSortedOrder(metric,
+        static_cast<MetricMatrix::SortMode>(mMatrixSortMode), reference);
+
+    // Distances are normalized by the range of computed pairs.
+    float minDistance = std::numeric_limits<float>::max();
+    float maxDistance = 0.0f;
+    for (int i = 0; i < imageNum; ++i) {
+        for (int j = i + 1; j < imageNum; ++j) {
+            const float distance = matrix.distance(i, j, metric);
+            if (!std::isnan(distance)) {
+                minDistance = std::min(minDistance, distance);
+                maxDistance = std::max(maxDistance, distance);
+            }
+        }
+    }
+
+    ImGui::PushFont(mSmallFont);
+    ImGui::Text("%zu / %zu pairs refined%s", matrix.refinedPairCount(), matrix.pairCount(),
+        matrix.isBusy() ? ", computing..." : "");
+
+    // Rows and columns are labeled by layer numbers, which are omitted if cells are too small.
+    const float labelWidth = ImGui::CalcTextSize("00").x + 4.0f;
+    const float cellSize = std::max(4.0f, std::min(24.0f, std::floor((width - labelWidth) / imageNum)));
+    const bool showLabels = cellSize >= ImGui::GetFontSize();
+    const Vec2f origin = Vec2f(ImGui::GetCursorScreenPos()) + Vec2f(labelWidth, ImGui::GetFontSize() + 2.0f);
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+
+    auto getLayerIndex = [this](const Image* image) {
+        for (int i = 0; i < static_cast<int>(mImageList.size()); ++i) {
+            if (mImageList[i].get() == image) {
+                return i;
+            }
+        }
+        return -1;
+    };
+
+    char label[8];
+    for (int i = 0; i < imageNum && showLabels; ++i) {
+        snprintf(label, sizeof(label), "%d", getLayerIndex(matrix.image(order[i])) + 1);
+        const float offset = i * cellSize + (cellSize - ImGui::CalcTextSize(label).x) * 0.5f;
+        drawList->AddText(origin + Vec2f(offset, -ImGui::GetFontSize() - 2.0f), IM_COL32(200, 200, 200, 255), label);
+        drawList->AddText(origin + Vec2f(-labelWidth, i * cellSize + (cellSize - ImGui::GetFontSize()) * 0.5f),
+            IM_COL32(200, 200, 200, 255), label);
+    }
+
+    // Cells use heat colors of diff view, see getHeatColor@present.frag. Estimated ones are dimmed.
+    for (int row = 0; row < imageNum; ++row) {
+        for (int column = 0; column < imageNum; ++column) {
+            const MetricMatrix::Cell cell = matrix.cell(order[row], order[column]);
+            const float distance = matrix.distance(order[row], order[column], metric);
+            ImU32 color = IM_COL32(60, 60, 60, 255);
+            if (!std::isnan(distance)) {
+                const float kPi = 3.14159265f;
+                const float value = maxDistance > minDistance ?
+                    glm::clamp((distance - minDistance) / (maxDistance - minDistance), 0.0f, 1.0f) : 0.0f;
+                const int alpha = cell.isRefined ? 255 : 128;
+                color = ImColor(value, std::sin(kPi * value), std::cos(kPi / 3.0f * value), alpha / 255.0f);
+            }
+
+            const Vec2f cellMin = origin + Vec2f(column * cellSize, row * cellSize);
+            drawList->AddRectFilled(cellMin, cellMin + Vec2f(cellSize - 1.0f), color);
+        }
+    }
+
+    ImGui::SetCursorScreenPos(origin - Vec2f(labelWidth, 0.0f));
+    ImGui::InvisibleButton("##MetricMatrixGrid", Vec2f(labelWidth + cellSize * imageNum, cellSize * imageNum));
+    if (ImGui::IsItemHovered()) {
+        const Vec2f coords = (Vec2f(ImGui::GetIO().MousePos) - origin) / cellSize;
+        const int row = static_cast<int>(std::floor(coords.y));
+        const int column = static_cast<int>(std::floor(coords.x));
+        if (row >= 0 && row < imageNum && column >= 0 && column < imageNum) {
+            const Image* rowImage = matrix.image(order[row]);
+            const Image* columnImage = matrix.image(order[column]);
+            const MetricMatrix::Cell cell = matrix.cell(order[row], order[column]);
+
+            ImGui::BeginTooltip();
+            ImGui::Text("%s\n%s", rowImage->filename().c_str(), columnImage->filename().c_str());
+            if (!cell.isComparable) {
+                ImGui::TextUnformatted("Sizes differ");
+            } else if (cell.level < 0) {
+                ImGui::TextUnformatted("Pending");
+            } else {
+                for (int i = 0; i < MetricMatrix::MetricNum; ++i) {
+                    const auto type = static_cast<MetricMatrix::Metric>(i);
+                    ImGui::Text("%-8s %.5g", MetricMatrix::getMetricLabel(type), cell.values[i]);
+                }
+                if (!cell.isRefined) {
+                    ImGui::Text("Estimated at 1/%d scale", 1 << cell.level);
+                }
+            }
+            ImGui::EndTooltip();
+
+            // Compare the pair, the row image is on top.
+            if (ImGui::IsItemClicked() && row != column) {
+                mTopImageIndex = getLayerIndex(rowImage);
+                mCmpImageIndex = getLayerIndex(columnImage);
+                if (mCompositeFlags == CompositeFlags::Top) {
+                    mCompositeFlags = CompositeFlags::Split;
+                }
+            }
+        }
+    }
+
+    ImGui::PopFont();
+}
+
+void    App::showWaveform(float width)
+{
+    Vec2f uv0, uv1, unused;
+    if (mWaveformMode == 0) {
+        mScopes.getPlotUv(Scopes::LumaWaveform, uv0, uv1);
+    } else {
+        // Waveforms of R, G and B are adjacent in display texture.
+        mScopes.getPlotUv(Scopes::RedWaveform, uv0, unused);
+        mScopes.getPlotUv(Scopes::BlueWaveform, unused, uv1);
+    }
+
+    const Vec2f pos = ImGui::GetCursorScreenPos();
+    const Vec2f size(width, std::floor(width * 0.5f));
+    ImGui::Image((void*)(intptr_t)mScopes.textureId(), size, uv0, uv1);
+
+    // Graticule at every 10% of signal level.
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImGui::PushFont(mSmallFont);
+    for (int i = 0; i <= 10; ++i) {
+        const float y = std::floor(pos.y + size.y * (1.0f - i * 0.1f)) + 0.5f;
+        const bool isMajor = (i % 5 == 0);
+        drawList->AddLine(Vec2f(pos.x, y), Vec2f(pos.x + size.x, y), IM_COL32(255, 255, 255, isMajor ? 80 : 30));
+        if (isMajor) {
+            const std::string label = std::to_string(i * 10);
+            drawList->AddText(Vec2f(pos.x + 2.0f, std::max(y - ImGui::GetFontSize(), pos.y)), IM_COL32(255, 255, 255, 128), label.c_str());
+        }
+    }
+    ImGui::PopFont();
+
+    if (mWaveformMode == 1) {
+        for (int i = 1; i < 3; ++i) {
+            const float x = std::floor(pos.x + size.x * i / 3.0f) + 0.5f;
+            drawList->AddLine(Vec2f(x, pos.y), Vec2f(x, pos.y + size.y), IM_COL32(255, 255, 255, 80));
+        }
     }
-    ImGui::End();
 }
 
-
-void App::initFooter()
+void    App::showVectorscope(float width)
 {
-    ImGuiContext& g = *ImGui::GetCurrentContext();
+    Vec2f uv0, uv1;
+    mScopes.getPlotUv(Scopes::Vectorscope, uv0, uv1);
+
+    // Keep the plot square and centered.
+    const float edge = std::floor(std::min(width, 256.0f));
+    ImGui::SetCursorPosX(ImGui::GetCursorPosX() + std::floor((width - edge) * 0.5f));
+    const Vec2f pos = ImGui::GetCursorScreenPos();
+    ImGui::Image((void*)(intptr_t)mScopes.textureId(), Vec2f(edge), uv0, uv1);
+
+    // Cb and Cr are within [-0.5, 0.5], thus the plot spans edge length per unit.
+    const Vec2f center = pos + Vec2f(edge * 0.5f);
+    auto toScreen = [&](float cb, float cr) { return center + Vec2f(cb, -cr) * edge; };
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    const ImU32 lineColor = IM_COL32(255, 255, 255, 50);
+    drawList->AddLine(Vec2f(pos.x, center.y), Vec2f(pos.x + edge, center.y), lineColor);
+    drawList->AddLine(Vec2f(center.x, pos.y), Vec2f(center.x, pos.y + edge), lineColor);
+    drawList->AddCircle(center, edge * 0.5f, lineColor, 64);
+
+    // Targets of 75% color bars in BT.709.
+    const char* names[6] = { "R", "Mg", "B", "Cy", "G", "Yl" };
+    const Vec3f colors[6] = { Vec3f(1, 0, 0), Vec3f(1, 0, 1), Vec3f(0, 0, 1), Vec3f(0, 1, 1), Vec3f(0, 1, 0), Vec3f(1, 1, 0) };
     ImGui::PushFont(mSmallFont);
+    for (int i = 0; i < 6; ++i) {
+        const Vec3f color = colors[i] * 0.75f;
+        const float luma = glm::dot(color, Vec3f(0.2126f, 0.7152f, 0.0722f));
+        const Vec2f target = toScreen((color.b - luma) / 1.8556f, (color.r - luma) / 1.5748f);
+        drawList->AddRect(target - Vec2f(4.0f), target + Vec2f(4.0f), IM_COL32(255, 255, 255, 128));
+        drawList->AddText(target + Vec2f(6.0f, -6.0f), IM_COL32(255, 255, 255, 128), names[i]);
+    }
+    ImGui::PopFont();
+}
 
-    //g.NextWindowData.MenuBarOffsetMinVal = ImVec2(g.Style.DisplaySafeAreaPadding.x, ImMax(g.Style.DisplaySafeAreaPadding.y - g.Style.FramePadding.y, 0.0f));
-    ImGui::SetNextWindowPos(ImVec2(0.0f, g.IO.DisplaySize.y - mFooterHeight));
-    ImGui::SetNextWindowSize(ImVec2(g.IO.DisplaySize.x, mFooterHeight));
-    ImGui::PushStyleVar(ImGuiStyleVar_WindowRounding, 0.0f);
-    ImGui::PushStyleVar(ImGuiStyleVar_WindowMinSize, ImVec2(0, 0));
-    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, g.Style.FramePadding);
-    ImGui::PushStyleVar(ImGuiStyleVar_WindowBorderSize, 0.0f);
-    ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoSavedSettings;
-    ImGui::Begin("##MainFooter", NULL, window_flags);
-    ImGui::PopStyleVar(4);
+void    App::showHdrStatistics(const HdrStatistics& stats, float width)
+{
+    const char* names[4] = { "R", "G", "B", "Y" };
+    static ImColor colors[4] = { ImColor(255, 0, 0, 150), ImColor(0, 255, 0, 150), ImColor(0, 0, 255, 150), ImColor(255, 255, 255, 90) };
+    const int binNum = HdrStatistics::kBinNum;
+    const Vec2f& logRange = stats.logRange();
+    const float binWidth = (logRange.y - logRange.x) / binNum;
+
+    // Get the first 25-th largest bin counts and use it as the normalize factor.
+    HdrStatistics::Histogram histogram = stats.histogram();
+    std::vector<int> temp(histogram.begin(), histogram.end());
+    std::nth_element(temp.begin(), temp.end() - 25, temp.end());
+    const int normPixelCount = std::max(*(temp.end() - 25), 1);
+
+    ImGui::SetNextItemWidth(width);
+    ImGui::PlotMultiHistograms("##hdrHistogram", HdrStatistics::kChannelNum, names, colors, histogram.data(),
+        normPixelCount, binNum, 0.0f, 1.0f, ImVec2(0, 100), "EV: %.2f", logRange.x, binWidth);
+
+    ImGui::Text("%.1f EV", logRange.x);
+    const std::string maxLabel = fmt::format("{:.1f} EV", logRange.y);
+    ImGui::SameLine(width - ImGui::CalcTextSize(maxLabel.c_str()).x);
+    ImGui::TextUnformatted(maxLabel.c_str());
+
+    ImGui::Columns(5, nullptr, false);
+    ImGui::SetColumnWidth(0, 60.0f);
 
-    if (mImageScale > 1.0f) {
-        sprintf_s(mImageScaleInfo, IM_ARRAYSIZE(mImageScaleInfo), "%.1fx", mImageScale);
-    } else {
-        sprintf_s(mImageScaleInfo, IM_ARRAYSIZE(mImageScaleInfo), "%.2f%%\n", mImageScale * 100.0f);
+    ImGui::NextColumn();
+    for (const char* name : names) {
+        ImGui::TextUnformatted(name);
+        ImGui::NextColumn();
     }
 
-    ImGui::Text("%s", mImageScaleInfo);
-
-    if (mTopImageIndex >= 0) {
-        const Vec2f& imageSize = mImageList[mTopImageIndex]->size();
-        ImGui::SameLine(g.Style.FramePadding.x + g.FontSize * 4.0f);
-        ImGui::Text("| %.0f x %.0f", imageSize.x, imageSize.y);
+    // Values in the first or the last bin might be out of the EV range.
+    const float lowerBound = std::exp2(logRange.x + binWidth);
+    const float upperBound = std::exp2(logRange.y - binWidth);
+    auto showValue = [&](float value) {
+        const char* prefix = value < lowerBound ? "<" : (value > upperBound ? ">" : "");
+        ImGui::Text("%s%.4g", prefix, value);
+    };
 
-        Vec2f imageCoords;
-        if (getImageCoordinates(g.IO.MousePos, imageCoords)) {
-            ImGui::SameLine();
-            imageCoords.y = imageSize.y - imageCoords.y - 1;
-            ImGui::Text("(%.0f, %.0f)", imageCoords.x, imageCoords.y);
+    const float percentiles[3] = { 0.01f, 0.5f, 0.99f };
+    const char* labels[3] = { "1%", "Median", "99%" };
+    for (int p = 0; p < 3; ++p) {
+        ImGui::TextUnformatted(labels[p]);
+        ImGui::NextColumn();
+        for (int c = 0; c < HdrStatistics::kChannelNum; ++c) {
+            showValue(stats.percentile(c, percentiles[p]));
+            ImGui::NextColumn();
         }
     }
 
-    const auto* topImage = getTopImage();
-    if (topImage && !inCompareMode()) {
-        const std::string& filename = topImage->filename();
-        ImGui::SameLine(g.IO.DisplaySize.x - ImGui::CalcTextSize(filename.c_str()).x - g.Style.FramePadding.x);
-        ImGui::TextUnformatted(filename.c_str());
+    ImGui::TextUnformatted("Max");
+    ImGui::NextColumn();
+    for (int c = 0; c < HdrStatistics::kChannelNum; ++c) {
+        ImGui::Text("%.4g", stats.maxValue()[c]);
+        ImGui::NextColumn();
     }
 
-    ImGui::End();
-    ImGui::PopFont();
+    // Dynamic range in stops between 1% and 99% percentiles.
+    ImGui::TextUnformatted("Stops");
+    ImGui::NextColumn();
+    for (int c = 0; c < HdrStatistics::kChannelNum; ++c) {
+        const float low = stats.percentile(c, 0.01f);
+        const float high = stats.percentile(c, 0.99f);
+        if (low > 0.0f && high > 0.0f) {
+            ImGui::Text("%.1f", std::log2(high / low));
+        } else {
+            ImGui::TextUnformatted("-");
+        }
+        ImGui::NextColumn();
+    }
+
+    ImGui::Columns(1);
 }
 
 void    App::showImageProperties()
@@ -1611,6 +3679,44 @@ void    App::showImageProperties()
     ImGui::Text("%.0fx%.0f", imageSize.x, imageSize.y);
     //ImGui::Text("8 bit");
     ImGui::NextColumn();
+
+    const Texture* texture = topImage->getTexture();
+    if (texture && texture->validation().hasIssues()) {
+        ImGui::Columns(1);
+        ImGui::Separator();
+        showPixelValidation(texture->validation());
+    }
+}
+
+void    App::showPixelValidation(const PixelValidation& validation)
+{
+    ImGui::TextColored(ImVec4(0.0f, 1.0f, 0.0f, 1.0f), "%zu bad pixels", validation.badPixelCount());
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Jump to Next (N)")) {
+        jumpToNextBadPixel();
+    }
+
+    ImGui::Columns(5, nullptr, false);
+    ImGui::SetColumnWidth(0, 70.0f);
+    ImGui::NextColumn();
+
+    const char* channelNames[PixelValidation::kChannelNum] = { "R", "G", "B", "A" };
+    for (const char* name : channelNames) {
+        ImGui::TextUnformatted(name);
+        ImGui::NextColumn();
+    }
+
+    const char* issueNames[PixelValidation::IssueNum] = { "NaN", "Inf", "Negative" };
+    for (int issue = 0; issue < PixelValidation::IssueNum; ++issue) {
+        ImGui::TextUnformatted(issueNames[issue]);
+        ImGui::NextColumn();
+        for (int c = 0; c < PixelValidation::kChannelNum; ++c) {
+            ImGui::Text("%u", validation.count(static_cast<PixelValidation::Issue>(issue), c));
+            ImGui::NextColumn();
+        }
+    }
+
+    ImGui::Columns(1);
 }
 
 void    App::initHomeWindow(const char* name)
@@ -1625,17 +3731,21 @@ void    App::initHomeWindow(const char* name)
                 ImGui::Columns(2, nullptr, false);
 
                 ImGui::Text("Show Home Panel");
+                ImGui::Text("Toggle Frame Statistics");
                 ImGui::Text("Toggle Property Window");
                 ImGui::Text("Toggle Split View");
                 ImGui::Text("Toggle Side-by-Side Column View");
+                ImGui::Text("Toggle Mosaic View");
                 ImGui::Text("Toggle Pixel Warning Markers");
                 ImGui::Text("Toggle Linear Image Filter");
                 ImGui::NextColumn();
 
                 ImGui::Text("F1");
+                ImGui::Text("F2");
                 ImGui::Text("Tab");
                 ImGui::Text("S");
                 ImGui::Text("C");
+                ImGui::Text("G");
                 ImGui::Text("W");
                 ImGui::Text("Q");
                 ImGui::NextColumn();
@@ -1663,7 +3773,12 @@ void    App::initHomeWindow(const char* name)
                 ImGui::Text("Zoom to Actual Size");
                 ImGui::Text("Fit to Viewport");
                 ImGui::Text("Sync Column Views");
+                ImGui::Text("Align/Unalign Compared Image");
                 ImGui::Text("Pixel Sniper");
+                ImGui::Text("Jump to Next Bad Pixel");
+                ImGui::Text("Jump to Next/Previous Difference Region");
+                ImGui::Text("Select Region");
+                ImGui::Text("Clear Region Selection");
                 ImGui::NextColumn();
 
                 ImGui::Text("Drag Left Mouse Button");
@@ -1673,7 +3788,12 @@ void    App::initHomeWindow(const char* name)
                 ImGui::Text("/ or F");
                 ImGui::Text("Shift+F");
                 ImGui::Text("Alt+C");
+                ImGui::Text("Ctrl+L / Ctrl+Shift+L");
                 ImGui::Text("Holding Z");
+                ImGui::Text("N");
+                ImGui::Text(". / ,");
+                ImGui::Text("Drag Left Mouse Button + Shift");
+                ImGui::Text("Esc");
                 ImGui::NextColumn();
 
                 ImGui::Separator();
@@ -1786,6 +3906,191 @@ void    App::showImageNameOverlays()
     ImGui::End();
 }
 
+void    App::showBadPixelMarkers()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImDrawList* drawList = ImGui::GetBackgroundDrawList();
+    const bool enableCompareView = inCompareMode();
+    const bool useColumnView = inSideBySideMode();
+    const float splitPosX = enableCompareView ? std::round(io.DisplaySize.x * mViewSplitPos) : io.DisplaySize.x;
+    const float minMarkerSize = 8.0f;
+    const ImU32 markerColor = IM_COL32(0, 255, 0, 200);
+
+    // The top image is at the left of splitter, and the compared one is at the right.
+    for (int i = 0; i < 2; ++i) {
+        const int imageIdx = (i == 0) ? mTopImageIndex : (enableCompareView ? mCmpImageIndex : -1);
+        if (imageIdx < 0) {
+            continue;
+        }
+
+        const Image* image = mImageList[imageIdx].get();
+        const Texture* texture = image->getTexture();
+        if (!texture || !texture->validation().hasIssues()) {
+            continue;
+        }
+
+        const int columnIdx = useColumnView ? i : 0;
+        const float imageScale = (useColumnView ? mColumnViews[i] : mView).getImageScale();
+        const Vec2f imageSize = image->size();
+
+        // Image coordinates have origin at bottom-left, while rows of tiles start from top.
+        auto toScreen = [&](float x, float row) {
+            return getScreenCoords(Vec2f(x, imageSize.y - row), columnIdx);
+        };
+
+        const Vec2f clipMin(i == 0 ? 0.0f : splitPosX, mToolbarHeight);
+        const Vec2f clipMax(i == 0 ? splitPosX : io.DisplaySize.x, io.DisplaySize.y - mFooterHeight);
+        drawList->PushClipRect(clipMin, clipMax);
+
+        const auto& badTiles = texture->validation().badTiles();
+        const float tileSize = static_cast<float>(PixelValidation::kTileSize);
+        for (const auto& tile : badTiles) {
+            const Vec2f tileMin = glm::floor(Vec2f(tile.firstPixel) / tileSize) * tileSize;
+            const Vec2f tileMax = glm::min(tileMin + tileSize, imageSize);
+            const Vec2f rectMin = toScreen(tileMin.x, tileMin.y);
+            const Vec2f rectMax = toScreen(tileMax.x, tileMax.y);
+
+            if (rectMax.x < clipMin.x || rectMin.x > clipMax.x || rectMax.y < clipMin.y || rectMin.y > clipMax.y) {
+                continue;
+            }
+
+            // Keep tiles visible when image is zoomed out.
+            const Vec2f center = (rectMin + rectMax) * 0.5f;
+            const Vec2f halfSize = glm::max((rectMax - rectMin) * 0.5f, Vec2f(minMarkerSize * 0.5f));
+            drawList->AddRect(center - halfSize, center + halfSize, markerColor);
+        }
+
+        // The index might be out of range after the image is reloaded.
+        if (i == 0 && mBadTileImage == image && mBadTileIndex >= 0 && mBadTileIndex < static_cast<int>(badTiles.size())) {
+            const Vec2i& pixel = badTiles[mBadTileIndex].firstPixel;
+            const Vec2f center = toScreen(pixel.x + 0.5f, pixel.y + 0.5f);
+            drawList->AddCircle(center, std::max(imageScale, minMarkerSize), markerColor, 16, 2.0f);
+        }
+
+        drawList->PopClipRect();
+    }
+}
+
+void    App::showDiffRegionMarker()
+{
+    const Image* topImage = getTopImage();
+    const auto& regions = mDiffRegions.regions();
+    if (!topImage || mDiffRegionIndex < 0 || mDiffRegionIndex >= static_cast<int>(regions.size())) {
+        return;
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    ImDrawList* drawList = ImGui::GetBackgroundDrawList();
+    const bool useColumnView = inSideBySideMode();
+    const float splitPosX = useColumnView ? std::round(io.DisplaySize.x * mViewSplitPos) : io.DisplaySize.x;
+    const float minMarkerSize = 8.0f;
+    const ImU32 markerColor = IM_COL32(0, 255, 255, 200);
+    const DiffRegions::Region& region = regions[mDiffRegionIndex];
+
+    for (int i = 0; i < (useColumnView ? 2 : 1); ++i) {
+        // Rows of regions start from bottom, the same as image coordinates.
+        const Vec2f rectMin = getScreenCoords(Vec2f(region.minPixel), i);
+        const Vec2f rectMax = getScreenCoords(Vec2f(region.maxPixel + 1), i);
+        const Vec2f center = (rectMin + rectMax) * 0.5f;
+        const Vec2f halfSize = glm::max(glm::abs(rectMax - rectMin) * 0.5f, Vec2f(minMarkerSize * 0.5f));
+
+        const Vec2f clipMin(i == 0 ? 0.0f : splitPosX, mToolbarHeight);
+        const Vec2f clipMax(i == 0 ? splitPosX : io.DisplaySize.x, io.DisplaySize.y - mFooterHeight);
+        drawList->PushClipRect(clipMin, clipMax);
+        drawList->AddRect(center - halfSize - 2.0f, center + halfSize + 2.0f, markerColor, 0.0f, ImDrawCornerFlags_All, 2.0f);
+
+        if (i == 0) {
+            const std::string label = fmt::format("{} / {}  max {:.2f}", mDiffRegionIndex + 1, regions.size(), region.maxDistance);
+            drawList->AddText(Vec2f(center.x - halfSize.x - 2.0f, center.y - halfSize.y - 20.0f), markerColor, label.c_str());
+        }
+        drawList->PopClipRect();
+    }
+}
+
+void    App::showRegionStatistics()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const Vec2i imageSize = Vec2i(getTopImage()->size());
+    const Vec2i regionMin = glm::clamp(glm::min(mRegionAnchor, mRegionCursor), Vec2i(0), imageSize);
+    const Vec2i regionMax = glm::clamp(glm::max(mRegionAnchor, mRegionCursor) + 1, Vec2i(0), imageSize);
+    if (regionMin.x >= regionMax.x || regionMin.y >= regionMax.y) {
+        return;
+    }
+
+    // Outline region in each column, image coordinates have origin at bottom-left.
+    ImDrawList* drawList = ImGui::GetBackgroundDrawList();
+    const bool useColumnView = inSideBySideMode();
+    const float splitPosX = useColumnView ? std::round(io.DisplaySize.x * mViewSplitPos) : io.DisplaySize.x;
+    Vec2f anchorPos;
+
+    for (int i = 0; i < (useColumnView ? 2 : 1); ++i) {
+        const Vec2f rectMin = getScreenCoords(Vec2f(regionMin.x, regionMax.y), i);
+        const Vec2f rectMax = getScreenCoords(Vec2f(regionMax.x, regionMin.y), i);
+        if (i == 0) {
+            anchorPos = rectMax;
+        }
+
+        drawList->PushClipRect(Vec2f(i == 0 ? 0.0f : splitPosX, mToolbarHeight),
+            Vec2f(i == 0 ? splitPosX : io.DisplaySize.x, io.DisplaySize.y - mFooterHeight));
+        drawList->AddRect(rectMin, rectMax, IM_COL32(0, 0, 0, 200), 0.0f, ImDrawCornerFlags_All, 3.0f);
+        drawList->AddRect(rectMin, rectMax, IM_COL32(255, 255, 255, 255));
+        drawList->PopClipRect();
+    }
+
+    const ImGuiWindowFlags windowFlags = ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoDecoration
+        | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings
+        | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoInputs;
+
+    // Put overlay at bottom-right of region, and keep it inside viewport with its size of last frame.
+    const char* windowName = "##RegionStatistics";
+    const ImGuiWindow* window = ImGui::FindWindowByName(windowName);
+    const Vec2f windowSize = window ? Vec2f(window->Size) : Vec2f(0.0f);
+    const Vec2f windowPos = glm::clamp(anchorPos + Vec2f(8.0f), Vec2f(8.0f, mToolbarHeight + 8.0f),
+        glm::max(Vec2f(io.DisplaySize.x, io.DisplaySize.y - mFooterHeight) - windowSize - 8.0f, Vec2f(8.0f)));
+
+    ImGui::SetNextWindowPos(windowPos, ImGuiCond_Always);
+    ImGui::SetNextWindowBgAlpha(0.5f);
+    ImGui::PushFont(mSmallFont);
+    if (ImGui::Begin(windowName, nullptr, windowFlags)) {
+        // Pixel rows start from top, the same as footer.
+        const Vec2i regionSize = regionMax - regionMin;
+        ImGui::Text("Region (%d, %d) %d x %d", regionMin.x, imageSize.y - regionMax.y, regionSize.x, regionSize.y);
+
+        if (mRegionTableKey != mGradingKeys[mTopImageRenderTexIdx] || mRegionTable.size() != imageSize) {
+            ImGui::TextUnformatted("Building summed-area tables...");
+        } else {
+            const SummedAreaTable::RegionStatistics stats = mRegionTable.query(regionMin, regionMax);
+            ImGui::Columns(4, nullptr, false);
+            ImGui::SetColumnWidth(0, 60.0f);
+
+            ImGui::NextColumn();
+            ImGui::Text("R");
+            ImGui::NextColumn();
+            ImGui::Text("G");
+            ImGui::NextColumn();
+            ImGui::Text("B");
+            ImGui::NextColumn();
+
+            auto showRow = [](const char* label, const Vec3f& value) {
+                ImGui::TextUnformatted(label);
+                ImGui::NextColumn();
+                for (int c = 0; c < 3; ++c) {
+                    ImGui::Text("%.4g", value[c]);
+                    ImGui::NextColumn();
+                }
+            };
+
+            showRow("Mean", stats.mean);
+            showRow("StdDev", stats.stddev);
+            showRow("Min", stats.minValue);
+            showRow("Max", stats.maxValue);
+            ImGui::Columns(1);
+        }
+    }
+    ImGui::End();
+    ImGui::PopFont();
+}
+
 void App::showHeatRangeOverlay(const Vec2f& pos, float width)
 {
     ImGuiContext& g = *ImGui::GetCurrentContext();
@@ -1802,7 +4107,10 @@ void App::showHeatRangeOverlay(const Vec2f& pos, float width)
     ImGui::PushFont(mSmallFont);
     //ImGui::SetNextWindowBgAlpha(0.5f);
     if (ImGui::Begin("##ImageOverlayBar", nullptr, windowFlags)) {
-        ImGui::Text("low");
+        // Show color distances of both ends if the range is adapted to images.
+        const std::string lowLabel = mEnableAutoHeatRange ? fmt::format("{:.3g}", mHeatRange.x) : "low";
+        const std::string highLabel = mEnableAutoHeatRange ? fmt::format("{:.3g}", mHeatRange.y) : "high";
+        ImGui::TextUnformatted(lowLabel.c_str());
         ImGui::SameLine();
         ImGui::Dummy(barSize);
 
@@ -1815,7 +4123,7 @@ void App::showHeatRangeOverlay(const Vec2f& pos, float width)
         }
 
         Vec2f rampBarPadding = g.Style.WindowPadding + pos;
-        rampBarPadding.x += ImGui::CalcTextSize("low").x + g.Style.ItemSpacing.x;
+        rampBarPadding.x += ImGui::CalcTextSize(lowLabel.c_str()).x + g.Style.ItemSpacing.x;
 
         ImDrawList* drawList = ImGui::GetCurrentWindow()->DrawList;
         for (int i = 0; i < 16; ++i) {
@@ -1828,13 +4136,41 @@ void App::showHeatRangeOverlay(const Vec2f& pos, float width)
         }
 
         ImGui::SameLine();
-        ImGui::Text("high");
+        ImGui::TextUnformatted(highLabel.c_str());
     }
     ImGui::End();
     ImGui::PopFont();
     ImGui::PopStyleVar(1);
 }
 
+void App::showFrameStatsOverlay(const Vec2f& pos)
+{
+    const ImGuiWindowFlags windowFlags = ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoDecoration 
+        | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings 
+        | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+
+    ImGui::SetNextWindowPos(pos, ImGuiCond_Always);
+    ImGui::SetNextWindowBgAlpha(0.5f);
+    ImGui::PushFont(mSmallFont);
+    if (ImGui::Begin("##FrameStatsOverlay", nullptr, windowFlags)) {
+        ImGui::Text("Present: %.3f ms (GPU)", mPresentTimer.elapsedTime());
+
+        // Counts are in framebuffer pixels, which are more than window pixels on high DPI display.
+        const ImGuiIO& io = ImGui::GetIO();
+        const Vec2f framebufferSize = io.DisplaySize * io.DisplayFramebufferScale;
+        const double windowPixelNum = std::max(1.0, static_cast<double>(framebufferSize.x) * framebufferSize.y);
+        const GLuint64 presentPixelNum = mPresentPixelCounter.sampleCount();
+        ImGui::Text("Shaded pixels: %llu (%.1f%%), values %llu", static_cast<unsigned long long>(presentPixelNum),
+            presentPixelNum * 100.0 / windowPixelNum, static_cast<unsigned long long>(mPixelValueCounter.sampleCount()));
+        ImGui::Checkbox("Cull Pixels under UI", &mCullPixelsUnderUI);
+        ImGui::Text("Frame: %.2f ms", 1000.0f / ImGui::GetIO().Framerate);
+        ImGui::Text("Tone mapping LUT %d^3 error: max %.5f, mean %.6f", kToneMappingLutSize, mLutMaxError, mLutMeanError);
+        ImGui::Checkbox("Use Tone Mapping LUT", &mUseToneMappingLut);
+    }
+    ImGui::End();
+    ImGui::PopFont();
+}
+
 //---------------------------------------------------------------------------------------
 //---------------------------------------------------------------------------------------
 
@@ -1874,6 +4210,8 @@ void App::undoAction()
             }
         }
 
+        invalidateGradedTextures();
+
         mTopImageIndex = action.prevTopImageIdx;
         mCmpImageIndex = action.prevCmpImageIdx;
 
@@ -1906,7 +4244,7 @@ void App::undoAction()
 void    App::showImportImageDlg()
 {
     static std::vector<std::string> filters = {
-        "Supported Image Files", "*.bmp; *.exr; *.gif; *.jpg; *.hdr; *.png; *.bts" ,
+        "Supported Image Files", "*.bmp; *.exr; *.gif; *.jpg; *.hdr; *.png; *.bts; *.cube; *.clf" ,
         "BMP (*.BMP)", "*.bmp",
         "OpenEXR (*.EXR)", "*.exr",
         "GIF (*.GIF)", "*.gif",
@@ -1914,24 +4252,40 @@ void    App::showImportImageDlg()
         "HDR (*.HDR)", "*.hdr",
         "PNG (*.PNG)", "*.png",
         "Bak-Tsiu Session (*.BTS)", "*.bts",
+        "Display LUT (*.CUBE, *.CLF)", "*.cube; *.clf",
     };
 
     std::vector<std::string> selection = pfd::open_file("Select image file(s)", "", filters, true).result();
+    std::vector<std::string> lutFilepathArray;
     auto iter = selection.begin();
     while (iter != selection.end()) {
         if (endsWith(*iter, ".bts")) {
             openSession(*iter);
             iter = selection.erase(iter);
+        } else if (Lut::isSupported(*iter)) {
+            lutFilepathArray.push_back(*iter);
+            iter = selection.erase(iter);
         } else {
             ++iter;
         }
     }
 
+    importLutFiles(lutFilepathArray);
+
     if (!selection.empty()) {
         importImageFiles(selection, true);
     }
 }
 
+void    App::showImportLutDlg()
+{
+    static std::vector<std::string> filters = {
+        "Display LUT (*.CUBE, *.CLF)", "*.cube; *.clf",
+    };
+
+    importLutFiles(pfd::open_file("Select LUT file(s)", "", filters, true).result());
+}
+
 void    App::showExportSessionDlg()
 {
     static std::vector<std::string> filters = {
@@ -2029,6 +4383,7 @@ void    App::removeTopImage(bool recordAction)
 
     image.reset();
     mTexturePool.cleanUnusedTextures();
+    invalidateGradedTextures();
     
     const int imageNum = static_cast<int>(mImageList.size());
     if (imageNum < 2) {
@@ -2059,6 +4414,125 @@ void    App::clearImages(bool recordAction)
     mImageList.clear();
     mTopImageIndex = mCmpImageIndex = -1;
     mCompositeFlags = CompositeFlags::Top;
+    invalidateGradedTextures();
+}
+
+void    App::jumpToNextBadPixel()
+{
+    Image* topImage = getTopImage();
+    const Texture* texture = topImage ? topImage->getTexture() : nullptr;
+    if (!texture || !texture->validation().hasIssues()) {
+        return;
+    }
+
+    const auto& badTiles = texture->validation().badTiles();
+    if (mBadTileImage != topImage) {
+        mBadTileImage = topImage;
+        mBadTileIndex = -1;
+    }
+
+    mBadTileIndex = (mBadTileIndex + 1) % static_cast<int>(badTiles.size());
+
+    // Image coordinates have origin at bottom-left, thus the row is flipped.
+    const Vec2i& pixel = badTiles[mBadTileIndex].firstPixel;
+    const Vec2f imageCoords(pixel.x + 0.5f, topImage->size().y - pixel.y - 0.5f);
+    if (inSideBySideMode()) {
+        mColumnViews[0].centerOn(imageCoords);
+        mColumnViews[1].centerOn(imageCoords);
+    } else {
+        mView.centerOn(imageCoords);
+    }
+}
+
+void    App::updateDiffRegions()
+{
+    const GradingKey* keys = mDiffTextureKeys;
+    if (mDiffRegionsKeys[0] == keys[0] && mDiffRegionsKeys[1] == keys[1]) {
+        if (mDiffRegions.threshold() != mDiffThreshold) {
+            mDiffRegions.update(mDiffThreshold, &mThreadPool);
+            mDiffRegionIndex = -1;
+        }
+        return;
+    }
+
+    // Regions of the previous pair are dropped, then the index is built once difference pixels are read back.
+    if (!mDiffRegions.isEmpty()) {
+        mDiffRegions.clear();
+        mDiffRegionIndex = -1;
+    }
+
+    if (mDiffReadback.isPending()) {
+        if (!mDiffReadback.tryGetResult(mDiffPixels.data())) {
+            return;
+        } else if (mDiffReadbackKeys[0] == keys[0] && mDiffReadbackKeys[1] == keys[1]) {
+            const auto startTime = std::chrono::steady_clock::now();
+            mDiffRegions.build(mDiffPixels.data(), mDiffPixelsSize, &mThreadPool);
+            mDiffRegions.update(mDiffThreshold, &mThreadPool);
+            mDiffRegionsKeys[0] = keys[0];
+            mDiffRegionsKeys[1] = keys[1];
+
+            const std::chrono::duration<double, std::milli> elapsedTime = std::chrono::steady_clock::now() - startTime;
+            LOGD("Find {} difference regions of {} in {:.1f} ms", mDiffRegions.regions().size(),
+                keys[0].image->filename(), elapsedTime.count());
+            return;
+        }
+    }
+
+    // Difference texture is RGBA16F, thus values are read back as half floats.
+    if (mDiffTexture.size() != mDiffPixelsSize) {
+        mDiffPixelsSize = mDiffTexture.size();
+        mDiffPixels.resize(static_cast<size_t>(mDiffPixelsSize.x) * mDiffPixelsSize.y * 4);
+        mDiffReadback.initialize(mDiffPixels.size() * sizeof(uint16_t));
+    }
+
+    mDiffReadback.readTexture(mDiffTexture.id(), GL_RGBA, GL_HALF_FLOAT);
+    mDiffReadbackKeys[0] = keys[0];
+    mDiffReadbackKeys[1] = keys[1];
+}
+
+void    App::jumpToDiffRegion(int step)
+{
+    Image* topImage = getTopImage();
+    const auto& regions = mDiffRegions.regions();
+    if (!topImage || regions.empty() || !inCompareMode() || Vec2i(topImage->size()) != mDiffRegions.size()) {
+        return;
+    }
+
+    const int regionNum = static_cast<int>(regions.size());
+    if (mDiffRegionIndex < 0) {
+        mDiffRegionIndex = step > 0 ? 0 : regionNum - 1;
+    } else {
+        mDiffRegionIndex = ((mDiffRegionIndex + step) % regionNum + regionNum) % regionNum;
+    }
+
+    // Zoom to fit region in half of visible size, the scale is a power of two as zooming with keys.
+    const bool useColumnView = inSideBySideMode();
+    View* views[2] = { useColumnView ? &mColumnViews[0] : &mView, useColumnView ? &mColumnViews[1] : nullptr };
+    const DiffRegions::Region& region = regions[mDiffRegionIndex];
+    const Vec2f extent = Vec2f(region.maxPixel - region.minPixel + 1);
+    const Vec2f visibleSize = views[0]->getVisibleSize();
+    const float fitScale = std::min(visibleSize.x / extent.x, visibleSize.y / extent.y) * 0.5f;
+    const float imageScale = std::exp2(std::floor(std::log2(glm::clamp(fitScale, 0.125f, 32.0f))));
+    const float relativeScale = imageScale / mImageScale;
+    mImageScale = imageScale;
+
+    // Rows of regions start from bottom, the same as image coordinates.
+    const Vec2f center = Vec2f(region.minPixel + region.maxPixel + 1) * 0.5f;
+    for (View* view : views) {
+        if (view) {
+            view->scale(relativeScale);
+            view->centerOn(center);
+        }
+    }
+}
+
+void    App::clearRegionSelection()
+{
+    mHasRegionSelection = mIsSelectingRegion = false;
+
+    // Tables of huge images are large, thus they are released with selection.
+    mRegionTable.clear();
+    mRegionTableKey = GradingKey();
 }
 
 void    App::resetImageTransform(const Vec2f &imgSize, bool fitWindow)
@@ -2068,6 +4542,7 @@ void    App::resetImageTransform(const Vec2f &imgSize, bool fitWindow)
     mView.reset(fitWindow);
     mColumnViews[0].reset(fitWindow);
     mColumnViews[1].reset(fitWindow);
+    mMosaicView.reset(fitWindow);
 }
 
 bool App::getImageCoordinates(Vec2f viewportCoords, Vec2f& outImageCoords) const
@@ -2075,7 +4550,14 @@ bool App::getImageCoordinates(Vec2f viewportCoords, Vec2f& outImageCoords) const
     viewportCoords.y = ImGui::GetIO().DisplaySize.y - viewportCoords.y;
 
     bool isOutsideImage = false;
-    if (!inSideBySideMode()) {
+    if (inMosaicMode()) {
+        Vec2f localCoords;
+        if (getMosaicTile(Vec2f(viewportCoords.x, ImGui::GetIO().DisplaySize.y - viewportCoords.y), localCoords) < 0) {
+            return false;
+        }
+
+        outImageCoords = mMosaicView.getImageCoords(localCoords, &isOutsideImage);
+    } else if (!inSideBySideMode()) {
         outImageCoords = mView.getImageCoords(viewportCoords, &isOutsideImage);
     } else {
         auto& io = ImGui::GetIO();
@@ -2093,6 +4575,209 @@ bool App::getImageCoordinates(Vec2f viewportCoords, Vec2f& outImageCoords) const
     return !isOutsideImage;
 }
 
+Vec2f App::getScreenCoords(const Vec2f& imageCoords, int columnIdx) const
+{
+    const ImGuiIO& io = ImGui::GetIO();
+    if (inMosaicMode()) {
+        const Vec2f coords = imageCoords * mMosaicView.getImageScale() + mMosaicView.getImageOffset();
+        const Vec2f tilePos = getMosaicTilePos(mTopImageIndex - mMosaicFirstLayer);
+        return Vec2f(tilePos.x + coords.x, tilePos.y + mMosaicTileSize.y - coords.y);
+    }
+
+    const bool useColumnView = inSideBySideMode();
+    const View& view = useColumnView ? mColumnViews[columnIdx] : mView;
+    const Vec2f coords = imageCoords * view.getImageScale() + view.getImageOffset();
+    const float originX = (useColumnView && columnIdx == 1) ? glm::round(io.DisplaySize.x * mViewSplitPos) : 0.0f;
+    return Vec2f(originX + coords.x, io.DisplaySize.y - coords.y);
+}
+
+void    App::updateMosaicLayout(const ImGuiIO& io)
+{
+    const int imageNum = static_cast<int>(mImageList.size());
+    mMosaicFirstLayer = std::max(mTopImageIndex, 0) / kMaxMosaicTileNum * kMaxMosaicTileNum;
+    mMosaicTileNum = std::min(kMaxMosaicTileNum, imageNum - mMosaicFirstLayer);
+
+    const Image* topImage = getTopImage();
+    const Vec2f imageSize = topImage ? topImage->size() : Vec2f(1.0f);
+    const Vec2f area(io.DisplaySize.x, io.DisplaySize.y - mToolbarHeight - mFooterHeight);
+    float maxScale = -1.0f;
+    for (int columnNum = 1; columnNum <= std::max(mMosaicTileNum, 1); ++columnNum) {
+        const int rowNum = (mMosaicTileNum + columnNum - 1) / columnNum;
+        const Vec2f tileSize = glm::max(glm::floor(area / Vec2f(columnNum, std::max(rowNum, 1))), Vec2f(1.0f));
+        const float scale = std::min(tileSize.x / imageSize.x, tileSize.y / imageSize.y);
+        if (scale > maxScale) {
+            maxScale = scale;
+            mMosaicGrid = Vec2i(columnNum, rowNum);
+            mMosaicTileSize = tileSize;
+        }
+    }
+
+    mMosaicView.resize(mMosaicTileSize);
+    mMosaicView.setImageSize(imageSize);
+    if (mResetMosaicView) {
+        mMosaicView.reset(true);
+        mResetMosaicView = false;
+    }
+}
+
+int     App::getMosaicTile(const Vec2f& screenPos, Vec2f& localCoords) const
+{
+    const Vec2f gridCoords(screenPos.x, screenPos.y - mToolbarHeight);
+    const Vec2i cell(glm::floor(gridCoords / mMosaicTileSize));
+    const int tile = cell.y * mMosaicGrid.x + cell.x;
+    if (gridCoords.x < 0.0f || gridCoords.y < 0.0f || cell.x >= mMosaicGrid.x || tile >= mMosaicTileNum) {
+        return -1;
+    }
+
+    localCoords = Vec2f(gridCoords.x - cell.x * mMosaicTileSize.x, (cell.y + 1) * mMosaicTileSize.y - gridCoords.y);
+    return tile;
+}
+
+Vec2f   App::getMosaicTilePos(int tile) const
+{
+    const Vec2i cell(tile % mMosaicGrid.x, tile / mMosaicGrid.x);
+    return Vec2f(cell) * mMosaicTileSize + Vec2f(0.0f, mToolbarHeight);
+}
+
+void    App::occludeOpaqueWindows()
+{
+    // Child windows and overlays are excluded, the former are within their parents and the latter
+    // are translucent. Rounded corners of property window are over toolbar and footer.
+    const char* windowNames[] = { "toolbar", "##MainFooter", "ImagePropHandle", kImagePropWindowName };
+    const ImGuiIO& io = ImGui::GetIO();
+
+    glEnable(GL_SCISSOR_TEST);
+    glClearDepth(0.0);
+    for (const char* name : windowNames) {
+        const ImGuiWindow* window = ImGui::FindWindowByName(name);
+        if (!window || !window->Active || window->Hidden || (window->Flags & ImGuiWindowFlags_NoBackground)) {
+            continue;
+        }
+
+        // Window rects are in screen coordinates with origin at top-left.
+        const Vec2f rectMin = glm::max(Vec2f(window->Pos), Vec2f(0.0f)) * io.DisplayFramebufferScale;
+        const Vec2f rectMax = glm::min(Vec2f(window->Pos) + Vec2f(window->Size), Vec2f(io.DisplaySize)) * io.DisplayFramebufferScale;
+        const Vec2i scissorMin(glm::round(Vec2f(rectMin.x, io.DisplaySize.y * io.DisplayFramebufferScale.y - rectMax.y)));
+        const Vec2i scissorSize(glm::round(rectMax - rectMin));
+        if (scissorSize.x <= 0 || scissorSize.y <= 0) {
+            continue;
+        }
+
+        glScissor(scissorMin.x, scissorMin.y, scissorSize.x, scissorSize.y);
+        glClear(GL_DEPTH_BUFFER_BIT);
+    }
+
+    glClearDepth(1.0);
+    glDisable(GL_SCISSOR_TEST);
+}
+
+void    App::renderPixelValues()
+{
+    const PresentParams& params = mPresentParams;
+    const float opacity = glm::clamp((params.imageScale - 32.0f) / 48.0f, 0.0f, 1.0f);
+    const Image* topImage = getTopImage();
+    if (opacity == 0.0f || !topImage || topImage->texId() == 0) {
+        return;
+    }
+
+    // Textures of present pass are still bound, i.e. top and compared image at units 0 and 1,
+    // font at unit 2 and mosaic tiles at unit 10.
+    mPixelValueShader.bind();
+    mPixelValueShader.setUniform("uWindowSize", params.windowSize);
+    mPixelValueShader.setUniform("uImageScale", params.imageScale);
+    mPixelValueShader.setUniform("uPresentMode", params.presentMode);
+    mPixelValueShader.setUniform("uApplyToneMapping", mEnableToneMapping);
+    mPixelValueShader.setUniform("uDisplayGamma", params.displayGamma);
+    mPixelValueShader.setUniform("uOpacity", opacity);
+
+    glEnable(GL_BLEND);
+    glBlendEquation(GL_FUNC_ADD);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_SCISSOR_TEST);
+
+    const Vec2f& windowSize = params.windowSize;
+    const Vec2i imageSize(topImage->size());
+    const float splitPosX = params.splitPos * windowSize.x;
+    const Vec4f leftRect(0.0f, 0.0f, splitPosX, windowSize.y);
+    const Vec4f rightRect(splitPosX, 0.0f, windowSize.x, windowSize.y);
+    const bool inDiffMode = (params.pixelMarkerFlags & static_cast<int>(PixelMarkerFlags::DiffMask)) != 0;
+
+    if (params.mosaicTileNum > 0) {
+        for (int tile = 0; tile < params.mosaicTileNum; ++tile) {
+            const Vec2f tilePos = getMosaicTilePos(tile);
+            const Vec2f tileOrigin(tilePos.x, windowSize.y - tilePos.y - mMosaicTileSize.y);
+            const Vec4f tileRect(tileOrigin, tileOrigin + mMosaicTileSize);
+            const Vec2i tileImageSize(mImageList[mMosaicFirstLayer + tile]->size());
+            drawPixelValues(tileRect, tileOrigin, params.offset, tileImageSize, 0, tile);
+        }
+    } else if (params.sideBySide) {
+        // Coordinates of right column start from the rounded split position, as renderSideBySide@present.frag.
+        drawPixelValues(leftRect, Vec2f(0.0f), params.offset, imageSize, 0);
+        drawPixelValues(rightRect, Vec2f(glm::round(splitPosX), 0.0f), params.offsetExtra, imageSize, 1);
+    } else if (!inDiffMode) {
+        drawPixelValues(leftRect, Vec2f(0.0f), params.offset, imageSize, 0);
+        if (params.splitPos < 1.0f) {
+            drawPixelValues(rightRect, Vec2f(0.0f), params.offset, imageSize, 1);
+        }
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_BLEND);
+}
+
+void    App::drawPixelValues(const Vec4f& clipRect, const Vec2f& tileOrigin, const Vec2f& offset,
+    const Vec2i& imageSize, int imageUnit, int layer)
+{
+    const float imageScale = mPresentParams.imageScale;
+    const Vec2f clipMin(clipRect.x, clipRect.y);
+    const Vec2f clipMax(clipRect.z, clipRect.w);
+    const Vec2i firstPixel = glm::clamp(Vec2i(glm::floor((clipMin - tileOrigin - offset) / imageScale)), Vec2i(0), imageSize);
+    const Vec2i lastPixel = glm::clamp(Vec2i(glm::ceil((clipMax - tileOrigin - offset) / imageScale)), Vec2i(0), imageSize);
+    const Vec2i pixelNum = lastPixel - firstPixel;
+    if (pixelNum.x <= 0 || pixelNum.y <= 0) {
+        return;
+    }
+
+    // Scissor box is in framebuffer pixels, which differ from window coordinates on high DPI display.
+    const Vec2f framebufferScale = ImGui::GetIO().DisplayFramebufferScale;
+    const Vec2i scissorMin(glm::round(clipMin * framebufferScale));
+    const Vec2i scissorMax(glm::round(clipMax * framebufferScale));
+    glScissor(scissorMin.x, scissorMin.y, scissorMax.x - scissorMin.x, scissorMax.y - scissorMin.y);
+
+    // Each instance draws 3 rows of 5 glyphs, see pixel_values.vert
+    const GLsizei vertexNumPerPixel = 3 * 5 * 6;
+    mPixelValueShader.setUniform("uImage", imageUnit);
+    mPixelValueShader.setUniform("uImageLayer", layer);
+    mPixelValueShader.setUniform("uPixelRange", Vec4i(firstPixel, pixelNum));
+    mPixelValueShader.setUniform("uImageSize", Vec2f(imageSize));
+    mPixelValueShader.setUniform("uTileOrigin", tileOrigin);
+    mPixelValueShader.setUniform("uOffset", offset);
+    mPixelValueShader.drawInstanced(vertexNumPerPixel, pixelNum.x * pixelNum.y);
+}
+
+void    App::showMosaicLabels()
+{
+    ImDrawList* drawList = ImGui::GetBackgroundDrawList();
+    const float padding = 4.0f;
+    const ImU32 outlineColor = ImGui::GetColorU32(Vec4f(mPixelBorderHighlightColor, 1.0f));
+
+    for (int tile = 0; tile < mMosaicTileNum; ++tile) {
+        const int layer = mMosaicFirstLayer + tile;
+        const Vec2f tilePos = getMosaicTilePos(tile);
+        const std::string label = fmt::format("{}  {}", layer + 1, mImageList[layer]->filename());
+        const Vec2f textPos = tilePos + Vec2f(padding * 2.0f);
+        const Vec2f textSize = ImGui::CalcTextSize(label.c_str());
+
+        drawList->PushClipRect(tilePos, tilePos + mMosaicTileSize);
+        drawList->AddRectFilled(textPos - Vec2f(padding), textPos + textSize + Vec2f(padding), IM_COL32(0, 0, 0, 128));
+        drawList->AddText(textPos, IM_COL32_WHITE, label.c_str());
+        if (layer == mTopImageIndex) {
+            drawList->AddRect(tilePos + Vec2f(1.0f), tilePos + mMosaicTileSize - Vec2f(1.0f), outlineColor, 0.0f, ImDrawCornerFlags_All, 2.0f);
+        }
+        drawList->PopClipRect();
+    }
+}
+
 float App::getPropWindowWidth() const
 {
     ImGuiWindow* window = ImGui::FindWindowByName(kImagePropWindowName);
@@ -2107,7 +4792,7 @@ int App::getPixelMarkerFlags() const
 
     PixelMarkerFlags flags = mPixelMarkerFlags;
     if (inCompareMode()) {
-        flags &= PixelMarkerFlags::DiffMask;  // Only keeps pixel differnce marker.
+        flags &= PixelMarkerFlags::DiffMask | PixelMarkerFlags::Invalid;  // Only keeps pixel differnce and invalid value markers.
     } else {
         flags &= ~PixelMarkerFlags::DiffMask; // Clear any flags for difference modes.
     }
@@ -2118,14 +4803,22 @@ int App::getPixelMarkerFlags() const
 inline void    App::toggleSplitView()
 {
     if (mCmpImageIndex != -1) {
-        mCompositeFlags = toggleFlags(mCompositeFlags & ~CompositeFlags::SideBySide, CompositeFlags::Split);
+        mCompositeFlags = toggleFlags(mCompositeFlags & ~(CompositeFlags::SideBySide | CompositeFlags::Mosaic), CompositeFlags::Split);
     }
 }
 
 inline void    App::toggleSideBySideView()
 {
     if (mCmpImageIndex != -1) {
-        mCompositeFlags = toggleFlags(mCompositeFlags & ~CompositeFlags::Split, CompositeFlags::SideBySide);
+        mCompositeFlags = toggleFlags(mCompositeFlags & ~(CompositeFlags::Split | CompositeFlags::Mosaic), CompositeFlags::SideBySide);
+    }
+}
+
+inline void    App::toggleMosaicView()
+{
+    if (mImageList.size() > 1) {
+        mCompositeFlags = inMosaicMode() ? CompositeFlags::Top : CompositeFlags::Mosaic;
+        mResetMosaicView = inMosaicMode();
     }
 }
 
@@ -2139,6 +4832,11 @@ inline bool    App::inSideBySideMode() const
     return (mCompositeFlags & CompositeFlags::SideBySide) != CompositeFlags::Top;
 }
 
+inline bool    App::inMosaicMode() const
+{
+    return mCompositeFlags == CompositeFlags::Mosaic;
+}
+
 inline bool    App::shouldShowSplitter() const
 {
     return inCompareMode() && (getPixelMarkerFlags() & static_cast<int>(PixelMarkerFlags::DiffMask)) == 0;
@@ -2154,6 +4852,8 @@ void    App::onFileDrop(int count, const char* filepaths[])
 
         if (endsWith(filepath, ".bts")) {
             openSession(filepath);
+        } else if (Lut::isSupported(filepath)) {
+            importLutFiles({ filepath });
         } else {
             filepathArray.push_back(filepath);
         }
@@ -2177,6 +4877,17 @@ void    App::openSession(const std::string& filepath)
         filepathArray.push_back(imageProp.uri);
     }
 
+    // Sessions of regression reports specify the top and compared images, e.g. the worst pair.
+    const auto extras = sessionFile.extensionsAndExtras.find("extras");
+    if (extras != sessionFile.extensionsAndExtras.end() && extras->is_object()) {
+        const int layerOffset = static_cast<int>(mImageList.size());
+        const int topIndex = extras->value("topImage", -1);
+        const int cmpIndex = extras->value("compareImage", -1);
+        if (topIndex >= 0) {
+            mPendingImageSelection = Vec2i(layerOffset + topIndex, cmpIndex >= 0 ? layerOffset + cmpIndex : -1);
+        }
+    }
+
     importImageFiles(filepathArray, true);
 }
 
@@ -2186,6 +4897,11 @@ void    App::saveSession(const std::string& filepath)
     sessionFile.asset.generator = "baktsiu";
 
     for (auto &image : mImageList) {
+        // Layers computed in app, e.g. layer statistics, have no file to reload.
+        if (image->filepath().empty()) {
+            continue;
+        }
+
         fx::gltf::Image imageProp;
         imageProp.uri = image->filepath();
         sessionFile.images.push_back(imageProp);
@@ -2,17 +2,33 @@
 #define BAKTSIU_APP_H_
 
 #include "common.h"
+#include "diff_regions.h"
+#include "gpu_query.h"
 #include "image.h"
+#include "image_alignment.h"
+#include "image_metrics.h"
+#include "image_statistics.h"
+#include "layer_statistics.h"
+#include "lut_library.h"
+#include "metric_matrix.h"
+#include "program_cache.h"
+#include "scopes.h"
 #include "shader.h"
+#include "summed_area_table.h"
 #include "texture.h"
 #include "texture_pool.h"
+#include "thread_pool.h"
 #include "view.h"
 
 #include <atomic>
 #include <condition_variable>
 #include <deque>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 struct  GLFWwindow;
@@ -71,12 +87,144 @@ struct Action
 };
 
 
+// Per-frame parameters of present shader. This is mapped to the uniform block
+// PresentParams@present.frag with std140 layout, thus each boolean occupies 4 bytes.
+struct PresentParams
+{
+    Vec2f   offset = Vec2f(0.0f);
+    Vec2f   offsetExtra = Vec2f(0.0f);
+    Vec2f   relativeOffset = Vec2f(0.0f);
+    Vec2f   imageSize = Vec2f(0.0f);
+    Vec2f   windowSize = Vec2f(0.0f);
+    Vec2f   cursorPos = Vec2f(0.0f);
+    Vec2f   heatRange = Vec2f(0.0f, 1.0f);  // Color distances mapped to both ends of heat map.
+    Vec2f   mosaicOrigin = Vec2f(0.0f);     // Top-left corner of mosaic tiles in window coordinates.
+    Vec2f   mosaicTileSize = Vec2f(0.0f);
+
+    float   splitPos = 1.0f;
+    float   imageScale = 1.0f;
+    float   displayGamma = 2.2f;
+    int32_t presentMode = 0;
+    int32_t outTransformType = 0;
+    int32_t pixelMarkerFlags = 0;
+    int32_t sideBySide = 0;
+    int32_t enablePixelHighlight = 0;
+    int32_t applyToneMapping = 0;
+    int32_t useToneMappingLut = 0;
+    int32_t useDiffImage = 0;
+    float   diffThreshold = 1.0f;           // Squared color distance where pixels are fully marked.
+    int32_t pyramidLevel = 0;               // Level of pixels covered by one screen pixel, see updateMaxPyramids().
+    int32_t mosaicColumnNum = 0;
+    int32_t mosaicTileNum = 0;              // Number of tiles in mosaic view, 0 for other views.
+    int32_t padding[3] = {};
+};
+
+static_assert(sizeof(PresentParams) % 16 == 0, "Size of std140 uniform block should be multiple of vec4");
+
+
+// Inputs of graded texture, grading is skipped if they are unchanged.
+struct GradingKey
+{
+    const Image*        image = nullptr;
+    uint32_t            contentId = 0;    // Uploaded texture content, GL texture ids may be reused.
+    uint8_t             imageId = 0;
+    ColorEncodingType   encodingType = ColorEncodingType::Linear;
+    ColorPrimaryType    primaryType = ColorPrimaryType::sRGB;
+    float               exposureValue = 0.0f;
+    Vec2f               offset = Vec2f(0.0f);   // Alignment offset of compared image, see ImageAlignment.
+
+    bool operator==(const GradingKey& other) const
+    {
+        return image == other.image && contentId == other.contentId && imageId == other.imageId &&
+            encodingType == other.encodingType && primaryType == other.primaryType &&
+            exposureValue == other.exposureValue && offset == other.offset;
+    }
+
+    bool operator!=(const GradingKey& other) const { return !(*this == other); }
+};
+
+
+// Inputs of max pyramid of marker flags, overflow and underflow are tested after present transforms.
+struct MarkerPyramidKey
+{
+    GradingKey  grading;
+    int         presentMode = 0;
+    bool        applyToneMapping = false;
+    bool        useToneMappingLut = false;
+
+    bool operator==(const MarkerPyramidKey& other) const
+    {
+        return grading == other.grading && presentMode == other.presentMode &&
+            applyToneMapping == other.applyToneMapping && useToneMappingLut == other.useToneMappingLut;
+    }
+
+    bool operator!=(const MarkerPyramidKey& other) const { return !(*this == other); }
+};
+
+
+// Inputs of mosaic tile, which is graded at screen resolution over the visible region of image.
+struct MosaicTileKey
+{
+    GradingKey  grading;
+    Vec2i       tileSize = Vec2i(0);
+    Vec2f       imageOffset = Vec2f(0.0f);
+    float       imageScale = 0.0f;
+    bool        useLinearFilter = false;
+
+    bool operator==(const MosaicTileKey& other) const
+    {
+        return grading == other.grading && tileSize == other.tileSize && imageOffset == other.imageOffset &&
+            imageScale == other.imageScale && useLinearFilter == other.useLinearFilter;
+    }
+
+    bool operator!=(const MosaicTileKey& other) const { return !(*this == other); }
+};
+
+
+// Inputs of statistics of graded image, the log range is for HDR histograms.
+struct StatisticsKey
+{
+    GradingKey  grading;
+    Vec2f       logRange = Vec2f(0.0f);
+
+    bool operator==(const StatisticsKey& other) const
+    {
+        return grading == other.grading && logRange == other.logRange;
+    }
+
+    bool operator!=(const StatisticsKey& other) const { return !(*this == other); }
+};
+
+
+// Inputs of metrics of graded top and compared images, including display settings.
+struct ImageMetricsKey
+{
+    GradingKey  gradings[2];
+    bool        applyToneMapping = false;
+    int         outTransformType = 0;
+    float       displayGamma = 0.0f;
+    const Lut*  displayLut = nullptr;
+    float       pixelsPerDegree = 0.0f;
+
+    bool operator==(const ImageMetricsKey& other) const
+    {
+        return gradings[0] == other.gradings[0] && gradings[1] == other.gradings[1] &&
+            applyToneMapping == other.applyToneMapping && outTransformType == other.outTransformType &&
+            displayGamma == other.displayGamma && displayLut == other.displayLut &&
+            pixelsPerDegree == other.pixelsPerDegree;
+    }
+
+    bool operator!=(const ImageMetricsKey& other) const { return !(*this == other); }
+};
+
+
 // Flags of the composition of image viewport.
 enum class CompositeFlags : char
 {
     Top         = 0x0,  // Display top (the selected) image only.
     Split       = 0x1,  // Scaled the compared image and put it underneath the top image.
     SideBySide  = 0x2,  // Display top and compared images side by side.
+    Mosaic      = 0x4,  // Display a grid of layers with the same view transform.
 };
 
 ENUM_CLASS_OPERATORS(CompositeFlags);
@@ -89,7 +237,8 @@ enum class PixelMarkerFlags : char
     DiffMask    = 0x03,
     Overflow    = 0x04, // Draw overflow pixels in red
     Underflow   = 0x08, // Draw underflow pixels in blue
-    Default     = Difference | Overflow | Underflow,
+    Invalid     = 0x10, // Draw NaN, Inf and negative pixels in green
+    Default     = Difference | Overflow | Underflow | Invalid,
 };
 
 ENUM_CLASS_OPERATORS(PixelMarkerFlags);
@@ -106,6 +255,12 @@ public:
     static const char* kImagePropWindowName;
     static const char* kImageRemoveDlgTitle;
     static const char* kClearImagesDlgTitle;
+    static const GLuint kPresentParamBinding;    // Binding point of PresentParams.
+    static const int kToneMappingLutSize;       // Edge length of baked tone mapping LUT.
+    static const int kStatisticsTileSize;       // Pixels per workgroup edge in statistics.comp.
+    static const int kReductionMaxSize;         // Max samples per axis of reduction.comp.
+    static const int kScopeMaxSize;             // Max width or height of mip level measured by scopes.
+    static const int kMaxMosaicTileNum;         // Max layers shown in mosaic view at once.
 
 public:
     bool    initialize(const char* title, int width, int height);
@@ -117,11 +272,12 @@ public:
 
     void    release();
 
+    // Setup console logger, it's also used by command line mode without window.
+    static void initLogger();
+
 private:
     void    setThemeColors();
 
-    void    initLogger();
-
     // Initialize related bitmap and uv info for text.
     void    initDigitCharData(const unsigned char* data);
 
@@ -139,17 +295,55 @@ private:
 
     void    showImageProperties();
 
+    // Show min, max, mean and percentiles computed by CPU statistics engine.
+    void    showCpuStatistics(const ImageStatistics& stats);
+
+    // Show log2 histograms and dynamic range figures of HDR statistics.
+    void    showHdrStatistics(const HdrStatistics& stats, float width);
+
+    // Show metrics of top and compared images, and pixels per degree of FLIP.
+    void    showImageMetrics();
+
+    // Show heat grid of pairwise metrics of all images, clicking a cell compares its pair.
+    void    showMetricMatrix(float width);
+
+    // Show luma waveform or RGB parade with graticule of signal levels.
+    void    showWaveform(float width);
+
+    // Show vectorscope with targets of 75% color bars.
+    void    showVectorscope(float width);
+
     // Show image name overlays viewport.
     void    showImageNameOverlays();
 
+    // Label tiles of mosaic view by layer numbers and names, the top image is outlined.
+    void    showMosaicLabels();
+
     void    showHeatRangeOverlay(const Vec2f& pos, float width);
 
+    // Outline tiles with NaN, Inf or negative pixels, thus they are visible when zoomed out.
+    void    showBadPixelMarkers();
+
+    // Outline the current difference region in each column.
+    void    showDiffRegionMarker();
+
+    // Show counts of NaN, Inf and negative values per channel of top image.
+    void    showPixelValidation(const PixelValidation& validation);
+
+    // Outline selected region and show its statistics next to it.
+    void    showRegionStatistics();
+
+    // Show GPU time of present pass and accuracy of tone mapping LUT.
+    void    showFrameStatsOverlay(const Vec2f& pos);
+
     bool    showRemoveImageDlg(const char *name);
 
     bool    showClearImagesDlg(const char* title);
 
     void    showImportImageDlg();
 
+    void    showImportLutDlg();
+
     void    showExportSessionDlg();
 
     // Handle key pressed cases.
@@ -163,9 +357,81 @@ private:
 
     void    updateImageSplitterPos(ImGuiIO&);
 
-    // Dispatch compute kernels for image statistics.
+    // Dispatch compute kernels for image statistics, the histogram is read back asynchronously.
     void    computeImageStatistics(const RenderTexture&, float valueScale);
 
+    // Update statistics if the source texture is changed since last computation.
+    void    updateImageStatistics(bool useDiffImage);
+
+    // Compute statistics of top image on CPU when compute shaders are not supported.
+    void    updateCpuImageStatistics();
+
+    // Dispatch HDR statistics of top image if it's not cached, the result is read back asynchronously.
+    void    updateHdrStatistics();
+
+    // Return HDR statistics of top image, it might be outdated until the pending one is done.
+    const HdrStatistics* getHdrStatistics();
+
+    // Dispatch reduction.comp over one channel (0-3: RGBA, 4: luminance) of texture,
+    // the result is read back asynchronously.
+    void    dispatchReduction(const RenderTexture& texture, int channel, GpuReadback& readback);
+
+    // Adapt exposure to the log-average luminance of top image.
+    void    updateAutoExposure(float deltaTime);
+
+    // Adapt heat map range to the percentiles of color distances in difference texture.
+    void    updateAutoHeatRange(float deltaTime);
+
+    // Accumulate waveform and vectorscope densities of top image if its grading or display gamma is changed.
+    void    updateScopes();
+
+    // Move view to the first bad pixel of next tile with NaN, Inf or negative values in top image.
+    void    jumpToNextBadPixel();
+
+    // Read back difference texture and find regions above threshold if the pair or threshold is changed.
+    void    updateDiffRegions();
+
+    // Move view to the next difference region in ranked order, a negative step goes backwards.
+    void    jumpToDiffRegion(int step);
+
+    // Read back graded top image and build its summed-area tables if its grading is changed.
+    void    updateRegionTable();
+
+    void    clearRegionSelection();
+
+    // Read back graded top and compared images, then compute their metrics on workers
+    // if the pair isn't cached with the same inputs.
+    void    updateImageMetrics();
+
+    // Return metrics of top and compared images, nullptr if they aren't computed yet.
+    const ImageMetrics* getImageMetrics() const;
+
+    // Read back pixels of images requested by metric matrix one at a time, and advance its jobs.
+    void    updateMetricMatrix();
+
+    // Read back graded top and compared images once alignment is requested, then estimate
+    // the residual offset on workers and accumulate it to the offset of the pair.
+    void    updateImageAlignment();
+
+    // Return offset where pixels of top image match those of compared image.
+    Vec2f   getAlignmentOffset(const Image* topImage, const Image* cmpImage) const;
+
+    // Set offset of the pair, zero offset removes it.
+    void    setAlignmentOffset(const Image* topImage, const Image* cmpImage, const Vec2f& offset);
+
+    void    showImageAlignment();
+
+    // Queue selected layers of the same size for per-pixel statistics.
+    void    startLayerStatistics();
+
+    // Read back the next queued layer and accumulate it on workers, then append
+    // mean, variance and median layers once all of them are accumulated.
+    void    updateLayerStatistics();
+
+    bool    isComputingLayerStatistics() const;
+
+    void    showLayerStatistics();
+
     // Reset image transform to viewport center.
     void    resetImageTransform(const Vec2f& imgSize, bool fitWindow = false);
 
@@ -175,6 +441,37 @@ private:
     // Return pixel coordinates from mouse position.
     bool    getImageCoordinates(Vec2f viewportCoords, Vec2f& outImageCoords) const;
 
+    // Return screen coordinates of image coordinates in given column of side by side mode.
+    // In mosaic view, they are in the tile of top image.
+    Vec2f   getScreenCoords(const Vec2f& imageCoords, int columnIdx = 0) const;
+
+    // Arrange the page of layers containing top image in grid, the grid makes tiles of top image largest.
+    void    updateMosaicLayout(const ImGuiIO& io);
+
+    // Grade visible regions of tiles whose inputs or view transform are changed.
+    void    updateMosaicTiles();
+
+    // Return tile at screen position, or -1 if there is none.
+    // @param localCoords Viewport coordinates of mosaic view in the tile, origin is at bottom-left.
+    int     getMosaicTile(const Vec2f& screenPos, Vec2f& localCoords) const;
+
+    // Return screen position of top-left corner of tile.
+    Vec2f   getMosaicTilePos(int tile) const;
+
+    // Clear depth of framebuffer to zero under opaque UI windows, thus the present
+    // pass doesn't shade pixels which are drawn over by ImGui.
+    void    occludeOpaqueWindows();
+
+    // Draw numerical values of visible pixels over the present pass when image scale is large enough.
+    void    renderPixelValues();
+
+    // Draw values of image pixels within clip rect, one instance per pixel.
+    // @param clipRect Min and max corners in window coordinates, origin is at bottom-left.
+    // @param tileOrigin Origin of coordinates of offset in window coordinates.
+    // @param imageUnit Texture unit of graded image, it's unused if layer of mosaic tiles is given.
+    void    drawPixelValues(const Vec4f& clipRect, const Vec2f& tileOrigin, const Vec2f& offset,
+                const Vec2i& imageSize, int imageUnit, int layer = -1);
+
     void    appendAction(Action&& action);
 
     void    undoAction();
@@ -195,7 +492,43 @@ private:
     // Save compare session with file extension .bts
     void    saveSession(const std::string& filepath);
 
-    void    gradingTexImage(Image& image, int renderTexIdx);
+    // Return inputs of grading image with alignment offset.
+    GradingKey getGradingKey(const Image& image, const Vec2f& offset) const;
+
+    // Grade image into render texture, return false if the texture is up to date.
+    // Pixels are resampled at the offset, i.e. pixel p of output is at p + offset of image.
+    bool    gradingTexImage(Image& image, int renderTexIdx, const Vec2f& offset = Vec2f(0.0f));
+
+    // Rebuild difference texture if any graded texture of the pair is changed.
+    void    updateDifferenceTexture();
+
+    // Force graded and difference textures to be rebuilt.
+    void    invalidateGradedTextures();
+
+    // Rebuild max pyramids of active markers if the image is zoomed out, return the level for present,
+    // i.e. 0 if the image isn't zoomed out or no pyramid is required.
+    int     updateMaxPyramids(float imageScale, bool useDiffImage);
+
+    // Rebuild max pyramid of marker flags of render texture if its inputs are changed.
+    void    updateMarkerPyramid(int renderTexIdx);
+
+    // Rebuild max pyramid of difference texture if it's changed.
+    void    updateDiffPyramid();
+
+    // Reduce levels of pyramid from its level 0.
+    void    reduceMaxPyramid(MipRenderTexture& pyramid);
+
+    // Bake ACES tone mapping into 3D LUT, it's independent of display settings.
+    void    bakeToneMappingLut();
+
+    // Measure errors of tone mapping LUT against analytic evaluation on display.
+    void    verifyToneMappingLut();
+
+    // Load LUT files and select the last loaded one for display.
+    void    importLutFiles(const std::vector<std::string>& filepathArray);
+
+    // Select LUT applied to display-encoded colors, nullptr to disable it.
+    void    setDisplayLut(const LutSPtr& lut);
 
     // Return the width of property window at right hand side.
     float   getPropWindowWidth() const;
@@ -206,12 +539,16 @@ private:
 
     bool    inSideBySideMode() const;
 
+    bool    inMosaicMode() const;
+
     bool    shouldShowSplitter() const;
 
     void    toggleSplitView();
 
     void    toggleSideBySideView();
 
+    void    toggleMosaicView();
+
 private:
     using ImageUPtr = std::unique_ptr<Image>;
 
@@ -219,6 +556,11 @@ private:
     std::deque<Action>          mActionStack;
     Action                      mCurAction;
     TexturePool                 mTexturePool;
+    ThreadPool                  mThreadPool;    // Workers for CPU image processing.
+    LutLibrary                  mLutLibrary;
+    LutSPtr                     mDisplayLut;
+
+    std::chrono::steady_clock::time_point mLaunchTime;
 
     GLFWwindow*     mWindow = nullptr;
     ImFont*         mSmallFont = nullptr;
@@ -229,15 +571,158 @@ private:
     std::vector<Vec4f> mCharUvXforms;   // UV offset of each digit in font texture.
 
     RenderTexture   mRenderTextures[2];   // The intermediate output for input image.
+    GradingKey      mGradingKeys[2];      // Inputs of each render texture.
+    RenderTexture   mDiffTexture;         // Difference of top and compared images, see difference.frag.
+    GradingKey      mDiffTextureKeys[2];  // Inputs of difference texture, the top one comes first.
+    MipRenderTexture mMarkerPyramids[2];  // Max pyramids of marker flags of each render texture.
+    MarkerPyramidKey mMarkerPyramidKeys[2];
+    MipRenderTexture mDiffPyramid;        // Max pyramid of difference texture.
+    GradingKey      mDiffPyramidKeys[2];
     int             mTopImageRenderTexIdx = 0;
+    RenderTextureArray mMosaicTextures;   // Graded visible region of each mosaic tile.
+    std::vector<MosaicTileKey> mMosaicTileKeys;
 
+    ProgramCache    mProgramCache;
     Shader          mGradingShader;
     Shader          mPresentShader;
+    Shader          mPixelValueShader;  // Instanced glyphs of pixel values.
     Shader          mStatisticsShader;
+    Shader          mLutBakeShader;
+    Shader          mDifferenceShader;
+    Shader          mMarkerMaskShader;
+    Shader          mMaxReduceShader;
+    UniformBuffer   mPresentParamBuffer;
+    PresentParams   mPresentParams;
     GLuint          mTexHistogram;
     Sampler         mPointSampler;
+
+    Texture3D       mToneMappingLut;
+    Vec2f           mLutVerifyKey = Vec2f(-1.0f);  // Output transform and gamma of last verification.
+    float           mLutMaxError = 0.0f;
+    float           mLutMeanError = 0.0f;
+    GpuTimer        mPresentTimer;
+    GpuSampleCounter mPresentPixelCounter;  // Shaded pixels of present pass.
+    GpuSampleCounter mPixelValueCounter;    // Shaded pixels of pixel value glyphs.
     
-    std::array<int, 768> mHistogram;
+    std::array<int, 768> mHistogram = {};
+    GpuReadback     mHistogramReadback;
+    GradingKey      mStatisticsKeys[2];     // Inputs of the histogram, see updateImageStatistics().
+
+    // Results of CPU statistics engine per image and the ones of top image.
+    std::unordered_map<const Image*, std::pair<StatisticsKey, ImageStatistics>> mCpuStatisticsCache;
+    const ImageStatistics* mCpuStatistics = nullptr;
+    std::future<ImageStatistics> mCpuStatisticsFuture;
+    StatisticsKey   mPendingCpuStatisticsKey;       // Inputs of the running computation.
+    std::vector<uint8_t> mCpuStatisticsPixels;      // Copy of source pixels, it's read by the computation.
+    uint32_t        mCpuStatisticsContentId = 0;    // Texture content of the copy.
+
+    // Log2 histograms of graded images computed by hdr_statistics.comp.
+    Shader          mHdrStatisticsShader;
+    GLuint          mTexHdrHistogram = 0;
+    GpuReadback     mHdrHistogramReadback;
+    StatisticsKey   mPendingHdrStatisticsKey;   // Inputs of the pending readback.
+    std::unordered_map<const Image*, std::pair<StatisticsKey, HdrStatistics>> mHdrStatisticsCache;
+    Vec2f           mHdrLogRange = Vec2f(-16.0f, 16.0f);
+    bool            mShowHdrHistogram = false;
+
+    // Auto exposure and heat range driven by reduction.comp.
+    Shader          mReductionShader;
+    GLuint          mTexReductionPartials = 0;
+    GLuint          mTexReductionResult = 0;
+    GpuReadback     mExposureReadback;
+    GradingKey      mExposureReductionKey;      // Inputs of the last reduction, exposure is excluded.
+    float           mExposureReductionEv = 0.0f; // Exposure of graded texture of the last reduction.
+    float           mAutoExposureTarget = 0.0f;
+    GpuReadback     mHeatRangeReadback;
+    GradingKey      mHeatRangeReductionKeys[2];
+    Vec2f           mAutoHeatRangeTarget = Vec2f(0.0f, 1.0f);
+    Vec2f           mHeatRange = Vec2f(0.0f, 1.0f);
+    bool            mEnableAutoExposure = false;
+    bool            mEnableAutoHeatRange = false;
+    bool            mSmoothAutoAdaptation = true;   // Converge to targets gradually when flipping images.
+
+    // Waveform monitor and vectorscope accumulated by scopes.comp or on CPU.
+    Shader          mScopesShader;
+    GLuint          mTexScopeDensity = 0;
+    GpuReadback     mScopeReadback;
+    Scopes          mScopes;
+    std::vector<int> mScopeDensity;             // The latest densities, kept to recolorize with new intensity.
+    GradingKey      mScopeKey;                  // Inputs of the latest densities.
+    float           mScopeDisplayGamma = 0.0f;
+    float           mScopeIntensity = 1.0f;
+    int             mWaveformMode = 0;          // 0: luma, 1: RGB parade.
+    bool            mShowWaveform = false;
+    bool            mShowVectorscope = false;
+
+    // Current bad tile visited by jumpToNextBadPixel().
+    const Image*    mBadTileImage = nullptr;
+    int             mBadTileIndex = -1;
+
+    // Regions of difference texture above threshold, visited by jumpToDiffRegion().
+    GpuReadback     mDiffReadback;
+    GradingKey      mDiffReadbackKeys[2];       // Inputs of the pending readback.
+    std::vector<uint16_t> mDiffPixels;
+    Vec2i           mDiffPixelsSize = Vec2i(0);
+    DiffRegions     mDiffRegions;
+    GradingKey      mDiffRegionsKeys[2];
+    float           mDiffThreshold = 1.0f;      // Delta E, it's also the threshold of difference marker.
+    int             mDiffRegionIndex = -1;
+
+    // Region selected with Shift+drag, statistics are queried from summed-area tables of top image.
+    GpuReadback     mRegionReadback;
+    GradingKey      mRegionReadbackKey;         // Inputs of the pending readback.
+    std::vector<uint16_t> mRegionPixels;
+    Vec2i           mRegionPixelsSize = Vec2i(0);
+    SummedAreaTable mRegionTable;
+    GradingKey      mRegionTableKey;
+    Vec2i           mRegionAnchor = Vec2i(0);   // Pixels at both corners in image coordinates.
+    Vec2i           mRegionCursor = Vec2i(0);
+    bool            mHasRegionSelection = false;
+    bool            mIsSelectingRegion = false;
+
+    // Metrics of top and compared images, they are computed asynchronously and cached per pair.
+    GpuReadback     mMetricsReadbacks[2];
+    std::vector<uint16_t> mMetricsPixels[2];
+    Vec2i           mMetricsPixelsSizes[2] = { Vec2i(0), Vec2i(0) };
+    ImageMetricsKey mMetricsReadbackKey;        // Inputs of the pending readbacks.
+    ImageMetricsKey mPendingMetricsKey;         // Inputs of the pending computation.
+    std::future<ImageMetrics> mMetricsFuture;
+    std::map<std::pair<const Image*, const Image*>, std::pair<ImageMetricsKey, ImageMetrics>> mImageMetricsCache;
+    float           mPixelsPerDegree = 67.0f;
+    bool            mShowImageMetrics = false;
+
+    // Pairwise metrics of all images at 0 EV, thus exposure changes don't invalidate them.
+    MetricMatrix    mMetricMatrix;
+    GpuReadback     mMatrixReadback;
+    GradingKey      mMatrixReadbackKey;         // Inputs of the pending readback.
+    ColorPipeline::Source mMatrixReadbackSource;
+    std::vector<uint8_t> mMatrixPixels;
+    std::unordered_map<const Image*, GradingKey> mMatrixImageKeys;
+    int             mMatrixMetric = MetricMatrix::DeltaE;
+    int             mMatrixSortMode = MetricMatrix::LayerOrder;
+    bool            mShowMetricMatrix = false;
+
+    // Offsets of compared images aligned to top images, keyed by pairs of top and compared images.
+    // Compared images are resampled in grading, thus estimations on graded textures are residuals.
+    std::map<std::pair<const Image*, const Image*>, Vec2f> mAlignmentOffsets;
+    GpuReadback     mAlignReadbacks[2];
+    GradingKey      mAlignReadbackKeys[2];      // Inputs of the pending readbacks.
+    GradingKey      mPendingAlignmentKeys[2];   // Inputs of the pending estimation.
+    std::vector<uint16_t> mAlignPixels[2];
+    Vec2i           mAlignPixelsSize = Vec2i(0);
+    std::future<ImageAlignment> mAlignmentFuture;
+    float           mAlignmentPeak = 0.0f;      // Correlation peak of the latest estimation.
+    bool            mRequestAlignment = false;
+
+    // Per-pixel statistics across selected layers, source pixels of one layer are alive at a time.
+    LayerStatistics mLayerStatistics;
+    std::unordered_set<const Image*> mLayerStatsSelection;
+    std::deque<const Image*> mLayerStatsQueue;  // Selected layers waiting for readback.
+    GpuReadback     mLayerStatsReadback;
+    ColorPipeline::Source mLayerStatsSource;    // Grading parameters of the pending readback.
+    std::vector<uint8_t> mLayerStatsPixels;
+    std::future<bool> mLayerStatsFuture;
+    int             mLayerStatsTotal = 0;       // Number of queued layers of the current computation.
 
     CompositeFlags      mCompositeFlags = CompositeFlags::Top;
     PixelMarkerFlags    mPixelMarkerFlags = PixelMarkerFlags::Default;
@@ -245,11 +730,18 @@ private:
     // Image transformation
     View        mView;
     View        mColumnViews[2];    // Views for side by side mode.
+    View        mMosaicView;        // View of each tile in mosaic mode.
+    Vec2i       mMosaicGrid = Vec2i(1); // Columns and rows of mosaic tiles.
+    Vec2f       mMosaicTileSize = Vec2f(1.0f);
+    int         mMosaicFirstLayer = 0;
+    int         mMosaicTileNum = 0;
+    bool        mResetMosaicView = false;
     float       mImageScale = 1.0f;
     float       mPrevImageScale = -1.0f;
 
     int         mTopImageIndex = -1;
     int         mCmpImageIndex = -1;
+    Vec2i       mPendingImageSelection = Vec2i(-1);  // Top and compared layers requested by session.
 
     int         mCurrentPresentMode = 0;
     int         mOutTransformType = 0;
@@ -278,6 +770,9 @@ private:
     bool        mShowPixelMarker = false;
     bool        mSupportComputeShader = false;
     bool        mUpdateImageSelection = false;
+    bool        mUseToneMappingLut = true;
+    bool        mShowFrameStats = false;
+    bool        mCullPixelsUnderUI = true;
 };
 
 }  // namespace baktsiu
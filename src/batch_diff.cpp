@@ -0,0 +1,680 @@
+#include "batch_diff.h"
+#include "texture.h"
+
+#include <fx/gltf.h>
+#include <nlohmann/json.hpp>
+#include <stb_image.h>
+#include <stb_image_write.h>
+
+#ifdef USE_OPENEXR
+#include <ImathBox.h>
+#include <ImfRgbaFile.h>
+#endif
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <thread>
+
+namespace baktsiu
+{
+
+namespace
+{
+
+bool isImageFile(const std::string& filename)
+{
+    const size_t pos = filename.find_last_of('.');
+    if (pos == std::string::npos) {
+        return false;
+    }
+
+    std::string extension = filename.substr(pos + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    static const char* extensions[] = { "bmp", "exr", "gif", "hdr", "jpg", "jpeg", "png", "tga" };
+    for (const char* supportedExtension : extensions) {
+        if (extension == supportedExtension) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::string joinPath(const std::string& dir, const std::string& relativePath)
+{
+    if (dir.empty() || dir.back() == '/' || dir.back() == '\\') {
+        return dir + relativePath;
+    }
+
+    return dir + "/" + relativePath;
+}
+
+#ifdef _WIN32
+std::string toUtf8(const wchar_t* text)
+{
+    const int size = WideCharToMultiByte(CP_UTF8, 0, text, -1, nullptr, 0, nullptr, nullptr);
+    std::string result(size > 0 ? size - 1 : 0, '\0');
+    if (size > 1) {
+        WideCharToMultiByte(CP_UTF8, 0, text, -1, &result[0], size, nullptr, nullptr);
+    }
+    return result;
+}
+
+std::wstring toWide(const std::string& text)
+{
+    const int size = MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, nullptr, 0);
+    std::wstring result(size > 0 ? size - 1 : 0, L'\0');
+    if (size > 1) {
+        MultiByteToWideChar(CP_UTF8, 0, text.c_str(), -1, &result[0], size);
+    }
+    return result;
+}
+#endif
+
+// Append image files under directory recursively, paths are relative to the root with '/' separators.
+void listImageFiles(const std::string& rootDir, const std::string& relativeDir, std::vector<std::string>& files)
+{
+    const std::string dir = relativeDir.empty() ? rootDir : joinPath(rootDir, relativeDir);
+
+#ifdef _WIN32
+    WIN32_FIND_DATAW data;
+    HANDLE handle = FindFirstFileW(toWide(joinPath(dir, "*")).c_str(), &data);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    do {
+        const std::string name = toUtf8(data.cFileName);
+        const bool isDir = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+    DIR* handle = opendir(dir.c_str());
+    if (!handle) {
+        return;
+    }
+
+    while (dirent* item = readdir(handle)) {
+        const std::string name = item->d_name;
+        const bool isDir = BatchDiff::isDirectory(joinPath(dir, name));
+#endif
+        if (name == "." || name == "..") {
+            continue;
+        }
+
+        const std::string relativePath = relativeDir.empty() ? name : relativeDir + "/" + name;
+        if (isDir) {
+            listImageFiles(rootDir, relativePath, files);
+        } else if (isImageFile(name)) {
+            files.push_back(relativePath);
+        }
+#ifdef _WIN32
+    } while (FindNextFileW(handle, &data));
+
+    FindClose(handle);
+#else
+    }
+
+    closedir(handle);
+#endif
+}
+
+std::string getAbsolutePath(const std::string& path)
+{
+#ifdef _WIN32
+    wchar_t buffer[MAX_PATH];
+    if (_wfullpath(buffer, toWide(path).c_str(), MAX_PATH)) {
+        std::string result = toUtf8(buffer);
+        std::replace(result.begin(), result.end(), '\\', '/');
+        return result;
+    }
+#else
+    char buffer[PATH_MAX];
+    if (realpath(path.c_str(), buffer)) {
+        return buffer;
+    }
+#endif
+    return path;
+}
+
+bool areFilesIdentical(const std::string& filepath1, const std::string& filepath2)
+{
+    std::ifstream file1(filepath1, std::ios::binary | std::ios::ate);
+    std::ifstream file2(filepath2, std::ios::binary | std::ios::ate);
+    if (!file1 || !file2 || file1.tellg() != file2.tellg()) {
+        return false;
+    }
+
+    file1.seekg(0);
+    file2.seekg(0);
+
+    const size_t kChunkSize = 1 << 16;
+    std::vector<char> buffer1(kChunkSize), buffer2(kChunkSize);
+    while (file1 && file2) {
+        file1.read(buffer1.data(), kChunkSize);
+        file2.read(buffer2.data(), kChunkSize);
+        const std::streamsize count = file1.gcount();
+        if (count != file2.gcount() || std::memcmp(buffer1.data(), buffer2.data(), count) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Return bytes of decoded pixels by header of image file, or 0 if it's not readable.
+size_t getDecodedSize(const std::string& filepath, Vec2i& size)
+{
+    const ImageType imageType = Texture::getImageType(filepath);
+    size_t pixelSize = 4;
+
+    if (imageType == ImageType::OPENEXR) {
+#ifdef USE_OPENEXR
+        try {
+            Imf::RgbaInputFile file(filepath.c_str());
+            const Imath::Box2i dw = file.dataWindow();
+            size = Vec2i(dw.max.x - dw.min.x + 1, dw.max.y - dw.min.y + 1);
+            return static_cast<size_t>(size.x) * size.y * 4 * sizeof(uint16_t);
+        } catch (const std::exception&) {
+            return 0;
+        }
+#else
+        return 0;
+#endif
+    } else if (imageType == ImageType::HDR) {
+        pixelSize = 4 * sizeof(float);
+    } else if (imageType == ImageType::Unknown) {
+        return 0;
+    }
+
+    int channelNum = 0;
+    if (!stbi_info(filepath.c_str(), &size.x, &size.y, &channelNum)) {
+        return 0;
+    }
+
+    return static_cast<size_t>(size.x) * size.y * pixelSize;
+}
+
+void appendData(void* context, void* data, int size)
+{
+    std::vector<uint8_t>* output = static_cast<std::vector<uint8_t>*>(context);
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    output->insert(output->end(), bytes, bytes + size);
+}
+
+std::vector<uint8_t> encodePng(const std::vector<uint8_t>& rgbPixels, const Vec2i& size)
+{
+    std::vector<uint8_t> data;
+    stbi_write_png_to_func(appendData, &data, size.x, size.y, 3, rgbPixels.data(), size.x * 3);
+    return data;
+}
+
+// Point sample texture to thumbnail and present it as viewer with default settings.
+std::vector<uint8_t> makeThumbnail(const Texture& texture, const Vec2i& thumbnailSize)
+{
+    const Vec2i size(texture.size());
+    const size_t pixelSize = texture.pixelDataType() == GL_FLOAT ? 16 :
+        (texture.pixelDataType() == GL_HALF_FLOAT ? 8 : 4);
+    const size_t pixelCount = static_cast<size_t>(thumbnailSize.x) * thumbnailSize.y;
+    const uint8_t* srcPixels = static_cast<const uint8_t*>(texture.pixels());
+
+    std::vector<uint8_t> samples(pixelCount * pixelSize);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const size_t x = (i % thumbnailSize.x) * size.x / thumbnailSize.x;
+        const size_t y = (i / thumbnailSize.x) * size.y / thumbnailSize.y;
+        std::memcpy(&samples[i * pixelSize], srcPixels + (y * size.x + x) * pixelSize, pixelSize);
+    }
+
+    ColorPipeline::Settings settings;
+    settings.encodingType = ImageDiff::getColorSource(texture).encodingType;
+
+    std::vector<float> values(pixelCount * 4);
+    ColorPipeline pipeline;
+    pipeline.process(samples.data(), texture.pixelDataType(), thumbnailSize, settings, values.data());
+
+    std::vector<uint8_t> rgbPixels(pixelCount * 3);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            const float value = std::min(std::max(values[i * 4 + c], 0.0f), 1.0f);
+            rgbPixels[i * 3 + c] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+        }
+    }
+
+    return encodePng(rgbPixels, thumbnailSize);
+}
+
+std::string encodeBase64(const std::vector<uint8_t>& data)
+{
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string result;
+    result.reserve((data.size() + 2) / 3 * 4);
+    for (size_t i = 0; i < data.size(); i += 3) {
+        const uint32_t value = (data[i] << 16) |
+            (i + 1 < data.size() ? data[i + 1] << 8 : 0) |
+            (i + 2 < data.size() ? data[i + 2] : 0);
+        result.push_back(table[(value >> 18) & 0x3F]);
+        result.push_back(table[(value >> 12) & 0x3F]);
+        result.push_back(i + 1 < data.size() ? table[(value >> 6) & 0x3F] : '=');
+        result.push_back(i + 2 < data.size() ? table[value & 0x3F] : '=');
+    }
+
+    return result;
+}
+
+std::string escapeHtml(const std::string& text)
+{
+    std::string result;
+    for (char c : text) {
+        switch (c) {
+        case '&': result += "&amp;"; break;
+        case '<': result += "&lt;"; break;
+        case '>': result += "&gt;"; break;
+        case '"': result += "&quot;"; break;
+        default: result.push_back(c); break;
+        }
+    }
+
+    return result;
+}
+
+double getAboveThresholdRatio(const ImageDiff::Statistics& stats)
+{
+    return stats.pixelCount > 0 ? static_cast<double>(stats.aboveThresholdCount) / stats.pixelCount : 0.0;
+}
+
+}  // namespace
+
+const char* BatchDiff::getStatusName(Status status)
+{
+    switch (status) {
+    case Status::MissingCandidate:
+        return "missingCandidate";
+    case Status::MissingBaseline:
+        return "missingBaseline";
+    case Status::LoadError:
+        return "loadError";
+    case Status::SizeMismatch:
+        return "sizeMismatch";
+    case Status::Failed:
+        return "failed";
+    default:
+        return "passed";
+    }
+}
+
+bool    BatchDiff::isDirectory(const std::string& path)
+{
+#ifdef _WIN32
+    const DWORD attributes = GetFileAttributesW(toWide(path).c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+#endif
+}
+
+bool    BatchDiff::run(const std::string& baselineDir, const std::string& candidateDir, const Options& options)
+{
+    if (!isDirectory(baselineDir) || !isDirectory(candidateDir)) {
+        LOGW("Both {} and {} should be directories", baselineDir, candidateDir);
+        return false;
+    }
+
+    mBaselineDir = baselineDir;
+    mCandidateDir = candidateDir;
+    mOptions = options;
+    if (mOptions.heatMax <= 0.0f) {
+        mOptions.heatMax = mOptions.threshold;
+    }
+
+    std::vector<std::string> baselineFiles, candidateFiles;
+    listImageFiles(baselineDir, "", baselineFiles);
+    listImageFiles(candidateDir, "", candidateFiles);
+
+    const std::set<std::string> baselineSet(baselineFiles.begin(), baselineFiles.end());
+    const std::set<std::string> candidateSet(candidateFiles.begin(), candidateFiles.end());
+    std::set<std::string> allFiles(baselineSet);
+    allFiles.insert(candidateSet.begin(), candidateSet.end());
+
+    mEntries.clear();
+    mEntries.reserve(allFiles.size());
+    std::vector<size_t> pendingIndices;
+
+    for (const std::string& relativePath : allFiles) {
+        Entry entry;
+        entry.relativePath = relativePath;
+        if (candidateSet.count(relativePath) == 0) {
+            entry.status = Status::MissingCandidate;
+        } else if (baselineSet.count(relativePath) == 0) {
+            entry.status = Status::MissingBaseline;
+        } else {
+            pendingIndices.push_back(mEntries.size());
+        }
+
+        mEntries.push_back(std::move(entry));
+    }
+
+    const int jobNum = options.jobNum > 0 ? options.jobNum :
+        std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    LOGI("Compare {} pairs of images with {} jobs", pendingIndices.size(), jobNum);
+
+    const auto startTime = std::chrono::steady_clock::now();
+    std::atomic<size_t> nextIndex(0);
+    mMemoryInFlight = 0;
+
+    auto processEntries = [&]() {
+        size_t index;
+        while ((index = nextIndex++) < pendingIndices.size()) {
+            processEntry(mEntries[pendingIndices[index]]);
+        }
+    };
+
+    std::vector<std::thread> jobs;
+    for (int i = 1; i < jobNum; ++i) {
+        jobs.push_back(std::thread(processEntries));
+    }
+
+    processEntries();
+    for (auto& job : jobs) {
+        job.join();
+    }
+
+    mElapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    std::stable_sort(mEntries.begin(), mEntries.end(), [](const Entry& a, const Entry& b) {
+        if (a.status != b.status) {
+            return a.status < b.status;
+        }
+
+        const double ratioA = getAboveThresholdRatio(a.statistics);
+        const double ratioB = getAboveThresholdRatio(b.statistics);
+        if (ratioA != ratioB) {
+            return ratioA > ratioB;
+        }
+
+        return a.statistics.maxValue > b.statistics.maxValue;
+    });
+
+    LOGI("Compared {} pairs in {:.2f} s ({:.1f} images/s), {} of {} entries have issues",
+        pendingIndices.size(), mElapsedTime, throughput(), issueCount(), mEntries.size());
+    return true;
+}
+
+void    BatchDiff::processEntry(Entry& entry)
+{
+    const std::string paths[2] = {
+        joinPath(mBaselineDir, entry.relativePath),
+        joinPath(mCandidateDir, entry.relativePath) };
+
+    Vec2i sizes[2];
+    const size_t decodedSizes[2] = { getDecodedSize(paths[0], sizes[0]), getDecodedSize(paths[1], sizes[1]) };
+    entry.size = sizes[1];
+
+    if (decodedSizes[0] > 0 && decodedSizes[1] > 0 && sizes[0] != sizes[1]) {
+        entry.status = Status::SizeMismatch;
+        return;
+    }
+
+    if (decodedSizes[1] > 0 && areFilesIdentical(paths[0], paths[1])) {
+        entry.statistics.pixelCount = static_cast<size_t>(sizes[1].x) * sizes[1].y;
+        return;
+    }
+
+    // Distances and their copy for percentiles are also counted.
+    const size_t pixelCount = static_cast<size_t>(sizes[1].x) * sizes[1].y;
+    const size_t pairBytes = decodedSizes[0] + decodedSizes[1] + pixelCount * sizeof(float) * 2;
+    acquireMemory(pairBytes);
+
+    Texture textures[2];
+    for (int i = 0; i < 2; ++i) {
+        if (!textures[i].loadFromFile(paths[i])) {
+            LOGW("Failed to load {}", paths[i]);
+            entry.status = Status::LoadError;
+            releaseMemory(pairBytes);
+            return;
+        }
+    }
+
+    entry.size = Vec2i(textures[1].size());
+    if (entry.size != Vec2i(textures[0].size())) {
+        entry.status = Status::SizeMismatch;
+        releaseMemory(pairBytes);
+        return;
+    }
+
+    ImageDiff diff;
+    if (!diff.compute(ImageDiff::getColorSource(textures[0]), ImageDiff::getColorSource(textures[1]),
+            entry.size, mOptions.threshold)) {
+        entry.status = Status::LoadError;
+        releaseMemory(pairBytes);
+        return;
+    }
+
+    entry.statistics = diff.statistics();
+    if (entry.statistics.aboveThresholdCount > 0) {
+        entry.status = Status::Failed;
+
+        const float scale = static_cast<float>(mOptions.thumbnailSize) / std::max(entry.size.x, entry.size.y);
+        const Vec2i thumbnailSize = glm::clamp(Vec2i(Vec2f(entry.size) * std::min(scale, 1.0f)), Vec2i(1), entry.size);
+        entry.thumbnailSize = thumbnailSize;
+        entry.thumbnails[BaselineThumbnail] = makeThumbnail(textures[0], thumbnailSize);
+        entry.thumbnails[CandidateThumbnail] = makeThumbnail(textures[1], thumbnailSize);
+
+        std::vector<uint8_t> heatmap;
+        diff.renderHeatmap(thumbnailSize, mOptions.heatMax, heatmap);
+        entry.thumbnails[HeatmapThumbnail] = encodePng(heatmap, thumbnailSize);
+    }
+
+    releaseMemory(pairBytes);
+}
+
+void    BatchDiff::acquireMemory(size_t bytes)
+{
+    // A pair larger than the budget still runs alone, otherwise it would wait forever.
+    std::unique_lock<std::mutex> lock(mMemoryMutex);
+    mMemoryCondVar.wait(lock, [&]() {
+        return mMemoryInFlight == 0 || mMemoryInFlight + bytes <= mOptions.memoryBudget;
+    });
+    mMemoryInFlight += bytes;
+}
+
+void    BatchDiff::releaseMemory(size_t bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMemoryMutex);
+        mMemoryInFlight -= bytes;
+    }
+    mMemoryCondVar.notify_all();
+}
+
+size_t  BatchDiff::issueCount() const
+{
+    return std::count_if(mEntries.begin(), mEntries.end(),
+        [](const Entry& entry) { return entry.status != Status::Passed; });
+}
+
+double  BatchDiff::throughput() const
+{
+    size_t pairNum = 0;
+    for (const Entry& entry : mEntries) {
+        if (entry.status != Status::MissingCandidate && entry.status != Status::MissingBaseline) {
+            ++pairNum;
+        }
+    }
+
+    return mElapsedTime > 0.0 ? pairNum / mElapsedTime : 0.0;
+}
+
+bool    BatchDiff::writeReport(const std::string& filepath) const
+{
+    nlohmann::json entries = nlohmann::json::array();
+    for (const Entry& entry : mEntries) {
+        const ImageDiff::Statistics& stats = entry.statistics;
+        nlohmann::json item = {
+            { "path", entry.relativePath },
+            { "status", getStatusName(entry.status) },
+            { "width", entry.size.x },
+            { "height", entry.size.y },
+        };
+
+        if (entry.status == Status::Passed || entry.status == Status::Failed) {
+            nlohmann::json percentiles = nlohmann::json::object();
+            for (int i = 0; i < ImageDiff::kPercentileNum; ++i) {
+                percentiles[fmt::format("{}", ImageDiff::kPercentileRanks[i])] = stats.percentiles[i];
+            }
+
+            item["aboveThresholdCount"] = stats.aboveThresholdCount;
+            item["aboveThresholdRatio"] = getAboveThresholdRatio(stats);
+            item["nanCount"] = stats.nanCount;
+            item["mean"] = stats.meanValue;
+            item["max"] = stats.maxValue;
+            item["maxPixel"] = { stats.maxPixel.x, stats.maxPixel.y };
+            item["percentiles"] = percentiles;
+        }
+
+        entries.push_back(item);
+    }
+
+    nlohmann::json report = {
+        { "baseline", mBaselineDir },
+        { "candidate", mCandidateDir },
+        { "metric", "deltaE" },
+        { "threshold", mOptions.threshold },
+        { "entryCount", mEntries.size() },
+        { "issueCount", issueCount() },
+        { "elapsedTime", mElapsedTime },
+        { "imagesPerSecond", throughput() },
+        { "entries", entries },
+    };
+
+    std::ofstream file(filepath);
+    if (!file) {
+        LOGW("Failed to write report {}", filepath);
+        return false;
+    }
+
+    file << report.dump(4) << std::endl;
+    return static_cast<bool>(file);
+}
+
+bool    BatchDiff::writeHtml(const std::string& filepath) const
+{
+    std::ofstream file(filepath);
+    if (!file) {
+        LOGW("Failed to write HTML summary {}", filepath);
+        return false;
+    }
+
+    file << "<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n"
+        << "<title>Bak-Tsiu Regression Report</title>\n<style>\n"
+        << "body { font-family: sans-serif; background: #202020; color: #e0e0e0; }\n"
+        << "table { border-collapse: collapse; }\n"
+        << "th, td { border: 1px solid #404040; padding: 4px 8px; text-align: left; vertical-align: top; }\n"
+        << "img { image-rendering: pixelated; }\n"
+        << ".passed { color: #70c070; } .failed { color: #f06060; } .error { color: #f0a040; }\n"
+        << "</style>\n</head>\n<body>\n";
+
+    file << "<h1>Regression Report</h1>\n<p>Baseline: " << escapeHtml(mBaselineDir)
+        << "<br>Candidate: " << escapeHtml(mCandidateDir)
+        << fmt::format("<br>Delta E threshold: {}<br>{} of {} entries have issues, {:.1f} images/s</p>\n",
+            mOptions.threshold, issueCount(), mEntries.size(), throughput());
+
+    file << "<table>\n<tr><th>#</th><th>Path</th><th>Status</th><th>Size</th><th>Above Threshold</th>"
+        << "<th>Mean</th><th>Max</th><th>P99</th><th>Baseline</th><th>Candidate</th><th>Heat Map</th></tr>\n";
+
+    int rowIndex = 0;
+    for (const Entry& entry : mEntries) {
+        const ImageDiff::Statistics& stats = entry.statistics;
+        const bool hasStatistics = entry.status == Status::Passed || entry.status == Status::Failed;
+        const char* statusClass = entry.status == Status::Passed ? "passed" :
+            (entry.status == Status::Failed ? "failed" : "error");
+
+        file << "<tr><td>" << ++rowIndex << "</td><td>" << escapeHtml(entry.relativePath) << "</td>"
+            << "<td class=\"" << statusClass << "\">" << getStatusName(entry.status) << "</td>";
+
+        if (hasStatistics) {
+            file << fmt::format("<td>{}x{}</td><td>{} ({:.3f}%)</td><td>{:.4f}</td><td>{:.4f}</td><td>{:.4f}</td>",
+                entry.size.x, entry.size.y, stats.aboveThresholdCount, getAboveThresholdRatio(stats) * 100.0,
+                stats.meanValue, stats.maxValue, stats.percentiles[3]);
+        } else {
+            file << "<td></td><td></td><td></td><td></td><td></td>";
+        }
+
+        for (int i = 0; i < ThumbnailNum; ++i) {
+            file << "<td>";
+            if (!entry.thumbnails[i].empty()) {
+                file << "<img width=\"" << entry.thumbnailSize.x << "\" height=\"" << entry.thumbnailSize.y
+                    << "\" src=\"data:image/png;base64," << encodeBase64(entry.thumbnails[i]) << "\">";
+            }
+            file << "</td>";
+        }
+
+        file << "</tr>\n";
+    }
+
+    file << "</table>\n</body>\n</html>\n";
+    return static_cast<bool>(file);
+}
+
+bool    BatchDiff::writeSession(const std::string& filepath, int pairNum) const
+{
+    fx::gltf::Document sessionFile;
+    sessionFile.asset.generator = "baktsiu";
+
+    for (const Entry& entry : mEntries) {
+        if (static_cast<int>(sessionFile.images.size()) >= pairNum * 2) {
+            break;
+        }
+
+        // Only pairs which could be viewed together are included.
+        if (entry.status != Status::Failed && entry.status != Status::SizeMismatch) {
+            continue;
+        }
+
+        fx::gltf::Image candidateImage, baselineImage;
+        candidateImage.uri = getAbsolutePath(joinPath(mCandidateDir, entry.relativePath));
+        baselineImage.uri = getAbsolutePath(joinPath(mBaselineDir, entry.relativePath));
+        sessionFile.images.push_back(candidateImage);
+        sessionFile.images.push_back(baselineImage);
+    }
+
+    if (sessionFile.images.empty()) {
+        LOGI("No problematic pairs for session {}", filepath);
+        return true;
+    }
+
+    // The worst candidate is shown on top, and it's compared with its baseline.
+    sessionFile.extensionsAndExtras["extras"] = { { "topImage", 0 }, { "compareImage", 1 } };
+
+    try {
+        fx::gltf::Save(sessionFile, filepath, false);
+    } catch (const std::exception& e) {
+        LOGW("Failed to write session {}: {}", filepath, e.what());
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace baktsiu
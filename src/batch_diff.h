@@ -0,0 +1,117 @@
+#ifndef BAKTSIU_BATCH_DIFF_H_
+#define BAKTSIU_BATCH_DIFF_H_
+
+#include "image_diff.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace baktsiu
+{
+
+/**
+ * Regression comparison between baseline and candidate directories.
+ *
+ * Image files are matched by relative paths. Pairs are compared by a fixed
+ * number of jobs, each one decodes and compares a pair at a time. Before
+ * decoding, jobs also wait until the estimated memory of pairs in flight is
+ * within the budget, thus memory usage doesn't grow with the suite or image
+ * sizes. Decoded pixels are only kept until thumbnails of failed pairs are
+ * made, and pairs of identical files are not decoded at all.
+ */
+class BatchDiff
+{
+public:
+    // Statuses are sorted by severity.
+    enum class Status : char
+    {
+        MissingCandidate = 0,
+        MissingBaseline,
+        LoadError,
+        SizeMismatch,
+        Failed,             // Some pixels have differences above threshold.
+        Passed
+    };
+
+    enum Thumbnail
+    {
+        BaselineThumbnail = 0,
+        CandidateThumbnail,
+        HeatmapThumbnail,
+        ThumbnailNum
+    };
+
+    struct Options
+    {
+        float   threshold = 2.0f;
+        float   heatMax = 0.0f;             // Threshold is used if it's not positive.
+        int     jobNum = 0;                 // Hardware concurrency is used if it's not positive.
+        size_t  memoryBudget = size_t(2) << 30;    // Bytes of decoded pixels in flight.
+        int     thumbnailSize = 160;        // Max edge length of thumbnails of failed pairs.
+    };
+
+    struct Entry
+    {
+        std::string             relativePath;
+        Status                  status = Status::Passed;
+        Vec2i                   size = Vec2i(0);
+        ImageDiff::Statistics   statistics;
+        Vec2i                   thumbnailSize = Vec2i(0);
+        std::vector<uint8_t>    thumbnails[ThumbnailNum];   // PNG encoded files.
+    };
+
+    static const char* getStatusName(Status status);
+
+    static bool isDirectory(const std::string& path);
+
+public:
+    // Compare all images in both directories, entries are sorted by severity afterward.
+    bool    run(const std::string& baselineDir, const std::string& candidateDir, const Options& options);
+
+    // Write statistics of entries as JSON file.
+    bool    writeReport(const std::string& filepath) const;
+
+    // Write HTML summary with embedded thumbnails of failed pairs.
+    bool    writeHtml(const std::string& filepath) const;
+
+    /**
+     * Write session file of worst pairs, it opens with the worst candidate
+     * on top and its baseline as compared image.
+     *
+     * @param pairNum Max number of pairs, which are only the problematic ones.
+     */
+    bool    writeSession(const std::string& filepath, int pairNum = 8) const;
+
+    const std::vector<Entry>& entries() const { return mEntries; }
+
+    // Return number of entries not passed.
+    size_t  issueCount() const;
+
+    // Return throughput of the latest run() in images per second.
+    double  throughput() const;
+
+private:
+    // Decode, compare and make thumbnails of an entry.
+    void    processEntry(Entry& entry);
+
+    // Block until estimated bytes fit in the budget, then they are counted as in flight.
+    void    acquireMemory(size_t bytes);
+
+    void    releaseMemory(size_t bytes);
+
+private:
+    std::string         mBaselineDir;
+    std::string         mCandidateDir;
+    Options             mOptions;
+    std::vector<Entry>  mEntries;
+    double              mElapsedTime = 0.0;     // In seconds.
+
+    std::mutex              mMemoryMutex;
+    std::condition_variable mMemoryCondVar;
+    size_t                  mMemoryInFlight = 0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_BATCH_DIFF_H_
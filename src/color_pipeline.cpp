@@ -0,0 +1,327 @@
+#include "color_pipeline.h"
+#include "color_pipeline_kernels.h"
+#include "image_statistics.h"
+#include "lut.h"
+#include "thread_pool.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(USE_AVX2)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace baktsiu
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+using ColorTransformFunc = void (*)(float* rgba, size_t count, int presentMode, bool applyToneMapping);
+using OutputTransformFunc = void (*)(float* rgba, size_t count, int outTransformType, float displayGamma);
+using ColorDistanceFunc = void (*)(const float* rgba1, const float* rgba2, size_t count, float* distances);
+
+struct Kernels
+{
+    ColorTransformFunc  colorTransform = nullptr;
+    OutputTransformFunc outputTransform = nullptr;
+    ColorDistanceFunc   colorDistance = nullptr;
+};
+
+bool isAvx2Supported()
+{
+#if defined(USE_AVX2)
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+    const bool hasAvx = (info[2] & (1 << 28)) != 0;
+    if (!hasOsxsave || !hasAvx) {
+        return false;
+    }
+
+    // OS has to save YMM registers on context switch.
+    if ((_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+#else
+    return false;
+#endif
+}
+
+Kernels getKernels(ColorPipeline::SimdLevel level)
+{
+    Kernels kernels;
+
+    switch (level) {
+#if defined(USE_AVX2)
+    case ColorPipeline::SimdLevel::AVX2:
+        kernels.colorTransform = pipeline::colorTransformAvx2;
+        kernels.outputTransform = pipeline::outputTransformAvx2;
+        kernels.colorDistance = pipeline::colorDistanceAvx2;
+        break;
+#endif
+#if defined(BAKTSIU_PIPELINE_USE_SSE2) || defined(BAKTSIU_PIPELINE_USE_NEON)
+    case ColorPipeline::SimdLevel::SSE2:
+    case ColorPipeline::SimdLevel::NEON:
+        kernels.colorTransform = pipeline::colorTransformPixels<pipeline::FloatX4>;
+        kernels.outputTransform = pipeline::outputTransformPixels<pipeline::FloatX4>;
+        kernels.colorDistance = pipeline::colorDistancePixels<pipeline::FloatX4>;
+        break;
+#endif
+    default:
+        kernels.colorTransform = pipeline::colorTransformPixels<pipeline::FloatX1>;
+        kernels.outputTransform = pipeline::outputTransformPixels<pipeline::FloatX1>;
+        kernels.colorDistance = pipeline::colorDistancePixels<pipeline::FloatX1>;
+        break;
+    }
+
+    return kernels;
+}
+
+// Alpha of graded texture is the input one stored in half float.
+float getAlpha(const void* pixels, GLenum pixelDataType, size_t index)
+{
+    if (pixelDataType == GL_UNSIGNED_BYTE) {
+        const uint8_t value = static_cast<const uint8_t*>(pixels)[index * 4 + 3];
+        return glm::unpackHalf1x16(glm::packHalf1x16(value / 255.0f));
+    } else if (pixelDataType == GL_HALF_FLOAT) {
+        return glm::unpackHalf1x16(static_cast<const uint16_t*>(pixels)[index * 4 + 3]);
+    }
+
+    return glm::unpackHalf1x16(glm::packHalf1x16(static_cast<const float*>(pixels)[index * 4 + 3]));
+}
+
+double getSeconds(const Clock::time_point& begin, const Clock::time_point& end)
+{
+    return std::chrono::duration<double>(end - begin).count();
+}
+
+}  // namespace
+
+ColorPipeline::SimdLevel ColorPipeline::getSupportedSimdLevel()
+{
+    if (isAvx2Supported()) {
+        return SimdLevel::AVX2;
+    }
+
+#if defined(BAKTSIU_PIPELINE_USE_SSE2)
+    return SimdLevel::SSE2;
+#elif defined(BAKTSIU_PIPELINE_USE_NEON)
+    return SimdLevel::NEON;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+const char* ColorPipeline::getSimdLevelName(SimdLevel level)
+{
+    switch (level) {
+    case SimdLevel::SSE2:
+        return "SSE2";
+    case SimdLevel::NEON:
+        return "NEON";
+    case SimdLevel::AVX2:
+        return "AVX2";
+    default:
+        return "Scalar";
+    }
+}
+
+ColorPipeline::ColorPipeline()
+    : mSimdLevel(getSupportedSimdLevel())
+{
+}
+
+bool    ColorPipeline::setSimdLevel(SimdLevel level)
+{
+    const SimdLevel supportedLevel = getSupportedSimdLevel();
+    bool isSupported = false;
+
+    switch (level) {
+    case SimdLevel::Scalar:
+        isSupported = true;
+        break;
+    case SimdLevel::SSE2:
+    case SimdLevel::NEON:
+        // AVX2 is only available on top of SSE2.
+        isSupported = supportedLevel == level ||
+            (level == SimdLevel::SSE2 && supportedLevel == SimdLevel::AVX2);
+        break;
+    case SimdLevel::AVX2:
+        isSupported = supportedLevel == SimdLevel::AVX2;
+        break;
+    }
+
+    if (!isSupported) {
+        LOGW("{} is not supported for color pipeline", getSimdLevelName(level));
+        return false;
+    }
+
+    mSimdLevel = level;
+    return true;
+}
+
+bool    ColorPipeline::process(const void* pixels, GLenum pixelDataType, const Vec2i& size,
+            const Settings& settings, float* output, ThreadPool* pool)
+{
+    if (!pixels || !output || size.x <= 0 || size.y <= 0) {
+        LOGW("Invalid input of color pipeline");
+        return false;
+    }
+
+    GradingTransform gradingTransform;
+    if (!gradingTransform.initialize(pixels, pixelDataType, settings.encodingType,
+            settings.primaryType, settings.exposureValue)) {
+        return false;
+    }
+
+    const Kernels kernels = getKernels(mSimdLevel);
+    const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+    std::array<double, StageNum> stageTimes = {};
+    std::mutex mergeMutex;
+
+    auto processTiles = [&](size_t begin, size_t end) {
+        std::array<double, StageNum> localTimes = {};
+
+        // Thread pool might give one range for all pixels, thus tiles are split here.
+        for (size_t tileBegin = begin; tileBegin < end; tileBegin += kTilePixelNum) {
+            const size_t tileEnd = std::min(end, tileBegin + kTilePixelNum);
+            const size_t count = tileEnd - tileBegin;
+            float* values = output + tileBegin * 4;
+
+            Clock::time_point time0 = Clock::now();
+            gradingTransform.grade(tileBegin, tileEnd, values);
+            for (size_t i = 0; i < count; ++i) {
+                values[i * 4 + 3] = getAlpha(pixels, pixelDataType, tileBegin + i);
+            }
+
+            Clock::time_point time1 = Clock::now();
+            kernels.colorTransform(values, count, settings.presentMode, settings.applyToneMapping);
+
+            Clock::time_point time2 = Clock::now();
+            kernels.outputTransform(values, count, settings.outTransformType, settings.displayGamma);
+
+            Clock::time_point time3 = Clock::now();
+            if (settings.displayLut) {
+                settings.displayLut->apply(values, count, 4);
+            }
+
+            Clock::time_point time4 = Clock::now();
+            localTimes[Grading] += getSeconds(time0, time1);
+            localTimes[ColorTransform] += getSeconds(time1, time2);
+            localTimes[OutputTransform] += getSeconds(time2, time3);
+            localTimes[DisplayLut] += getSeconds(time3, time4);
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        for (int i = 0; i < StageNum; ++i) {
+            stageTimes[i] += localTimes[i];
+        }
+    };
+
+    const Clock::time_point startTime = Clock::now();
+
+    if (pool) {
+        pool->parallelFor(pixelCount, kTilePixelNum, processTiles);
+    } else {
+        processTiles(0, pixelCount);
+    }
+
+    mElapsedTime = getSeconds(startTime, Clock::now());
+    mStageTimes = stageTimes;
+    mPixelCount = pixelCount;
+
+    LOGD("Color pipeline ({}) of {}x{} pixels: {:.1f} Mpix/s, grading {:.1f}, color transform {:.1f}, "
+        "output transform {:.1f}, display LUT {:.1f} Mpix/s per thread", getSimdLevelName(mSimdLevel),
+        size.x, size.y, throughput(), stageThroughput(Grading), stageThroughput(ColorTransform),
+        stageThroughput(OutputTransform), settings.displayLut ? stageThroughput(DisplayLut) : 0.0);
+    return true;
+}
+
+void    ColorPipeline::transformGradedValues(float* rgba, size_t count, const Settings& settings) const
+{
+    const Kernels kernels = getKernels(mSimdLevel);
+    kernels.colorTransform(rgba, count, settings.presentMode, settings.applyToneMapping);
+    kernels.outputTransform(rgba, count, settings.outTransformType, settings.displayGamma);
+    if (settings.displayLut) {
+        settings.displayLut->apply(rgba, count, 4);
+    }
+}
+
+bool    ColorPipeline::computeColorDistances(const Source& source1, const Source& source2, const Vec2i& size,
+            float* distances, ThreadPool* pool) const
+{
+    if (!source1.pixels || !source2.pixels || !distances || size.x <= 0 || size.y <= 0) {
+        LOGW("Invalid input of color distances");
+        return false;
+    }
+
+    GradingTransform gradingTransforms[2];
+    if (!gradingTransforms[0].initialize(source1.pixels, source1.pixelDataType, source1.encodingType,
+            source1.primaryType, source1.exposureValue) ||
+        !gradingTransforms[1].initialize(source2.pixels, source2.pixelDataType, source2.encodingType,
+            source2.primaryType, source2.exposureValue)) {
+        return false;
+    }
+
+    const Kernels kernels = getKernels(mSimdLevel);
+    const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+
+    auto processTiles = [&](size_t begin, size_t end) {
+        std::vector<float> values1(kTilePixelNum * 4);
+        std::vector<float> values2(kTilePixelNum * 4);
+
+        for (size_t tileBegin = begin; tileBegin < end; tileBegin += kTilePixelNum) {
+            const size_t tileEnd = std::min(end, tileBegin + kTilePixelNum);
+            gradingTransforms[0].grade(tileBegin, tileEnd, values1.data());
+            gradingTransforms[1].grade(tileBegin, tileEnd, values2.data());
+            kernels.colorDistance(values1.data(), values2.data(), tileEnd - tileBegin, distances + tileBegin);
+        }
+    };
+
+    if (pool) {
+        pool->parallelFor(pixelCount, kTilePixelNum, processTiles);
+    } else {
+        processTiles(0, pixelCount);
+    }
+
+    return true;
+}
+
+void    ColorPipeline::computeGradedDistances(const float* rgba1, const float* rgba2, size_t count,
+            float* distances) const
+{
+    getKernels(mSimdLevel).colorDistance(rgba1, rgba2, count, distances);
+}
+
+double  ColorPipeline::stageThroughput(Stage stage) const
+{
+    const double time = mStageTimes[stage];
+    return time > 0.0 ? mPixelCount / time * 1e-6 : 0.0;
+}
+
+double  ColorPipeline::throughput() const
+{
+    return mElapsedTime > 0.0 ? mPixelCount / mElapsedTime * 1e-6 : 0.0;
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,137 @@
+#ifndef BAKTSIU_COLOR_PIPELINE_H_
+#define BAKTSIU_COLOR_PIPELINE_H_
+
+#include "colour.h"
+#include "common.h"
+
+#include <GL/gl3w.h>
+
+#include <array>
+
+namespace baktsiu
+{
+
+class Lut;
+class ThreadPool;
+
+/**
+ * Color pipeline of image presentation on CPU, it doesn't need GL context.
+ *
+ * Stages mirror the shaders: grading is color_grading.frag (see GradingTransform),
+ * color and output transforms are colorTransform and outputTransform of
+ * color_transform.glsl, and the display LUT is the CPU evaluator of Lut. Tone
+ * mapping is always the fitted ACES curve, i.e. the reference of the baked LUT.
+ *
+ * Kernels are written once over packets of floats, the widest instruction set
+ * supported by CPU is selected at runtime. Pixels are split into tiles which
+ * pass all stages while they are in cache, and tiles are processed in parallel.
+ */
+class ColorPipeline
+{
+public:
+    enum Stage
+    {
+        Grading = 0,
+        ColorTransform,
+        OutputTransform,
+        DisplayLut,
+        StageNum
+    };
+
+    enum class SimdLevel : char
+    {
+        Scalar = 0,
+        SSE2,
+        NEON,
+        AVX2,
+    };
+
+    struct Settings
+    {
+        ColorEncodingType   encodingType = ColorEncodingType::Linear;
+        ColorPrimaryType    primaryType = ColorPrimaryType::sRGB;
+        float               exposureValue = 0.0f;
+
+        int         presentMode = 0;            // See presentModes@App::initToolbar.
+        bool        applyToneMapping = false;
+        int         outTransformType = 0;       // 0: sRGB, 1: P3 D65, 2: BT.2020.
+        float       displayGamma = 2.2f;
+        const Lut*  displayLut = nullptr;       // Optional LUT applied to display-encoded values.
+    };
+
+    // Decoded pixels and grading parameters of an image.
+    struct Source
+    {
+        const void*         pixels = nullptr;
+        GLenum              pixelDataType = GL_UNSIGNED_BYTE;
+        ColorEncodingType   encodingType = ColorEncodingType::sRGB;
+        ColorPrimaryType    primaryType = ColorPrimaryType::sRGB;
+        float               exposureValue = 0.0f;
+    };
+
+    // Number of pixels of each tile.
+    static const size_t kTilePixelNum = 16384;
+
+    // Return the widest instruction set supported by both build and CPU.
+    static SimdLevel getSupportedSimdLevel();
+
+    static const char* getSimdLevelName(SimdLevel level);
+
+public:
+    ColorPipeline();
+
+    // Use narrower instruction set, e.g. to compare results. Return false if it's not supported.
+    bool    setSimdLevel(SimdLevel level);
+
+    SimdLevel simdLevel() const { return mSimdLevel; }
+
+    /**
+     * Transform pixels to display values.
+     *
+     * @param pixels RGBA pixels with type GL_UNSIGNED_BYTE, GL_HALF_FLOAT or GL_FLOAT.
+     * @param size Width and height of image.
+     * @param output RGBA floats of display values in the same order of pixels, alpha is
+     *      the graded one.
+     * @param pool Optional thread pool to process tiles in parallel.
+     */
+    bool    process(const void* pixels, GLenum pixelDataType, const Vec2i& size,
+                const Settings& settings, float* output, ThreadPool* pool = nullptr);
+
+    /**
+     * Transform graded values to display values in place, i.e. the stages after grading
+     * of process(). Grading fields of settings are ignored and alpha is unchanged.
+     * Statistics of throughput are not updated.
+     *
+     * @param rgba RGBA floats written by GradingTransform::grade().
+     */
+    void    transformGradedValues(float* rgba, size_t count, const Settings& settings) const;
+
+    // Compute squared distances in CIE Lab space of RGBA floats written by GradingTransform::grade().
+    void    computeGradedDistances(const float* rgba1, const float* rgba2, size_t count, float* distances) const;
+
+    /**
+     * Compute squared distances in CIE Lab space of graded pixels of two images.
+     *
+     * It's the same as getColorDistance@color_transform.glsl, only the grading and
+     * distance are evaluated. Statistics of throughput are not updated.
+     *
+     * @param distances Output of size.x * size.y distances in the same order of pixels.
+     */
+    bool    computeColorDistances(const Source& source1, const Source& source2, const Vec2i& size,
+                float* distances, ThreadPool* pool = nullptr) const;
+
+    // Return throughput of stage per thread in Mpix/s of the latest process().
+    double  stageThroughput(Stage stage) const;
+
+    // Return throughput of the latest process() in Mpix/s of wall-clock time.
+    double  throughput() const;
+
+private:
+    SimdLevel   mSimdLevel = SimdLevel::Scalar;
+    size_t      mPixelCount = 0;
+    double      mElapsedTime = 0.0;                     // In seconds.
+    std::array<double, StageNum> mStageTimes = {};      // Sum of time of all threads in seconds.
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_COLOR_PIPELINE_H_
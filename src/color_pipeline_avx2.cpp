@@ -0,0 +1,54 @@
+// Kernels of ColorPipeline and ImageMetrics compiled with AVX2, they are selected at runtime.
+// Only FloatX8 kernels are instantiated here, see notes of color_pipeline_kernels.h.
+#if defined(USE_AVX2) && defined(__AVX2__)
+#include "color_pipeline_kernels.h"
+
+namespace baktsiu
+{
+namespace pipeline
+{
+
+void colorTransformAvx2(float* rgba, size_t count, int presentMode, bool applyToneMapping)
+{
+    colorTransformPixels<FloatX8>(rgba, count, presentMode, applyToneMapping);
+}
+
+void outputTransformAvx2(float* rgba, size_t count, int outTransformType, float displayGamma)
+{
+    outputTransformPixels<FloatX8>(rgba, count, outTransformType, displayGamma);
+}
+
+void colorDistanceAvx2(const float* rgba1, const float* rgba2, size_t count, float* distances)
+{
+    colorDistancePixels<FloatX8>(rgba1, rgba2, count, distances);
+}
+
+void convolveRowAvx2(const float* src, const float* weights, int tapNum, size_t count, float* dst)
+{
+    convolveRow<FloatX8>(src, weights, tapNum, count, dst);
+}
+
+void convolveColumnAvx2(const float* const* rows, const float* weights, int tapNum, size_t count, float* dst)
+{
+    convolveColumn<FloatX8>(rows, weights, tapNum, count, dst);
+}
+
+void metricInputAvx2(const float* rgba, size_t count, float* luma, float* y, float* cx, float* cz)
+{
+    metricInputPixels<FloatX8>(rgba, count, luma, y, cx, cz);
+}
+
+void ssimAvx2(const float* const* moments, size_t count, float* ssim, float* cs)
+{
+    ssimPixels<FloatX8>(moments, count, ssim, cs);
+}
+
+void flipErrorAvx2(const float* const* colors1, const float* const* colors2, const float* const* features1,
+    const float* const* features2, size_t count, float maxColorError, float* errors)
+{
+    flipErrorPixels<FloatX8>(colors1, colors2, features1, features2, count, maxColorError, errors);
+}
+
+}  // namespace pipeline
+}  // namespace baktsiu
+#endif
@@ -0,0 +1,887 @@
+#ifndef BAKTSIU_COLOR_PIPELINE_KERNELS_H_
+#define BAKTSIU_COLOR_PIPELINE_KERNELS_H_
+
+// Kernels of ColorPipeline and ImageMetrics, they are written once over packets of floats and
+// instantiated for each instruction set. AVX2 kernels are compiled in their own
+// translation unit, see color_pipeline_avx2.cpp.
+//
+// Caution: kernels avoid std templates like std::min, since out-of-line copies
+// of them compiled with AVX2 could be picked by linker for other translation units.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BAKTSIU_PIPELINE_USE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define BAKTSIU_PIPELINE_USE_NEON
+#endif
+
+namespace baktsiu
+{
+namespace pipeline
+{
+
+//-----------------------------------------------------------------------------
+// Packets of floats. Each packet type provides arithmetic operators, comparisons
+// returning masks, and the primitives used by generic math functions below.
+//-----------------------------------------------------------------------------
+
+// The reference packet with single lane.
+struct FloatX1
+{
+    static const int kWidth = 1;
+    using Mask = bool;
+
+    FloatX1() = default;
+    FloatX1(float value) : v(value) {}
+
+    static FloatX1 load(const float* src) { return FloatX1(*src); }
+    void    store(float* dst) const { *dst = v; }
+
+    float   v;
+};
+
+inline FloatX1 operator+(FloatX1 a, FloatX1 b) { return a.v + b.v; }
+inline FloatX1 operator-(FloatX1 a, FloatX1 b) { return a.v - b.v; }
+inline FloatX1 operator*(FloatX1 a, FloatX1 b) { return a.v * b.v; }
+inline FloatX1 operator/(FloatX1 a, FloatX1 b) { return a.v / b.v; }
+inline bool operator<(FloatX1 a, FloatX1 b) { return a.v < b.v; }
+inline bool operator<=(FloatX1 a, FloatX1 b) { return a.v <= b.v; }
+inline bool operator>(FloatX1 a, FloatX1 b) { return a.v > b.v; }
+inline bool operator>=(FloatX1 a, FloatX1 b) { return a.v >= b.v; }
+inline bool operator==(FloatX1 a, FloatX1 b) { return a.v == b.v; }
+inline FloatX1 min(FloatX1 a, FloatX1 b) { return a.v < b.v ? a.v : b.v; }
+inline FloatX1 max(FloatX1 a, FloatX1 b) { return a.v > b.v ? a.v : b.v; }
+inline FloatX1 abs(FloatX1 a) { return std::fabs(a.v); }
+inline FloatX1 sqrt(FloatX1 a) { return std::sqrt(a.v); }
+inline FloatX1 select(bool mask, FloatX1 a, FloatX1 b) { return mask ? a : b; }
+inline bool both(bool a, bool b) { return a && b; }
+
+// Return exponent of value and mantissa in [1, 2), value must be positive and normal.
+inline void splitExponent(FloatX1 a, FloatX1& exponent, FloatX1& mantissa)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &a.v, sizeof(bits));
+    exponent = static_cast<float>(static_cast<int>(bits >> 23) - 127);
+    bits = (bits & 0x7FFFFFu) | 0x3F800000u;
+    std::memcpy(&mantissa.v, &bits, sizeof(bits));
+}
+
+// Return value rounded to the nearest integer and 2 to the power of it, |a| must be less than 127.
+inline void roundPow2(FloatX1 a, FloatX1& n, FloatX1& pow2n)
+{
+    const int i = static_cast<int>(a.v + (a.v < 0.0f ? -0.5f : 0.5f));
+    const uint32_t bits = static_cast<uint32_t>(i + 127) << 23;
+    n = static_cast<float>(i);
+    std::memcpy(&pow2n.v, &bits, sizeof(bits));
+}
+
+#ifdef BAKTSIU_PIPELINE_USE_SSE2
+struct FloatX4
+{
+    static const int kWidth = 4;
+    using Mask = FloatX4;
+
+    FloatX4() = default;
+    FloatX4(float value) : v(_mm_set1_ps(value)) {}
+    FloatX4(__m128 value) : v(value) {}
+
+    static FloatX4 load(const float* src) { return _mm_loadu_ps(src); }
+    void    store(float* dst) const { _mm_storeu_ps(dst, v); }
+
+    __m128  v;
+};
+
+inline FloatX4 operator+(FloatX4 a, FloatX4 b) { return _mm_add_ps(a.v, b.v); }
+inline FloatX4 operator-(FloatX4 a, FloatX4 b) { return _mm_sub_ps(a.v, b.v); }
+inline FloatX4 operator*(FloatX4 a, FloatX4 b) { return _mm_mul_ps(a.v, b.v); }
+inline FloatX4 operator/(FloatX4 a, FloatX4 b) { return _mm_div_ps(a.v, b.v); }
+inline FloatX4 operator<(FloatX4 a, FloatX4 b) { return _mm_cmplt_ps(a.v, b.v); }
+inline FloatX4 operator<=(FloatX4 a, FloatX4 b) { return _mm_cmple_ps(a.v, b.v); }
+inline FloatX4 operator>(FloatX4 a, FloatX4 b) { return _mm_cmpgt_ps(a.v, b.v); }
+inline FloatX4 operator>=(FloatX4 a, FloatX4 b) { return _mm_cmpge_ps(a.v, b.v); }
+inline FloatX4 operator==(FloatX4 a, FloatX4 b) { return _mm_cmpeq_ps(a.v, b.v); }
+inline FloatX4 min(FloatX4 a, FloatX4 b) { return _mm_min_ps(a.v, b.v); }
+inline FloatX4 max(FloatX4 a, FloatX4 b) { return _mm_max_ps(a.v, b.v); }
+inline FloatX4 abs(FloatX4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+inline FloatX4 sqrt(FloatX4 a) { return _mm_sqrt_ps(a.v); }
+inline FloatX4 select(FloatX4 mask, FloatX4 a, FloatX4 b) { return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)); }
+inline FloatX4 both(FloatX4 a, FloatX4 b) { return _mm_and_ps(a.v, b.v); }
+
+inline void splitExponent(FloatX4 a, FloatX4& exponent, FloatX4& mantissa)
+{
+    const __m128i bits = _mm_castps_si128(a.v);
+    exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x7FFFFF)), _mm_set1_epi32(0x3F800000)));
+}
+
+inline void roundPow2(FloatX4 a, FloatX4& n, FloatX4& pow2n)
+{
+    // Round half away from zero, the same as FloatX1.
+    const __m128 half = _mm_or_ps(_mm_and_ps(a.v, _mm_set1_ps(-0.0f)), _mm_set1_ps(0.5f));
+    const __m128i i = _mm_cvttps_epi32(_mm_add_ps(a.v, half));
+    n = _mm_cvtepi32_ps(i);
+    pow2n = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(i, _mm_set1_epi32(127)), 23));
+}
+#endif  // BAKTSIU_PIPELINE_USE_SSE2
+
+#ifdef BAKTSIU_PIPELINE_USE_NEON
+struct FloatX4
+{
+    static const int kWidth = 4;
+    using Mask = uint32x4_t;
+
+    FloatX4() = default;
+    FloatX4(float value) : v(vdupq_n_f32(value)) {}
+    FloatX4(float32x4_t value) : v(value) {}
+
+    static FloatX4 load(const float* src) { return vld1q_f32(src); }
+    void    store(float* dst) const { vst1q_f32(dst, v); }
+
+    float32x4_t v;
+};
+
+inline FloatX4 operator+(FloatX4 a, FloatX4 b) { return vaddq_f32(a.v, b.v); }
+inline FloatX4 operator-(FloatX4 a, FloatX4 b) { return vsubq_f32(a.v, b.v); }
+inline FloatX4 operator*(FloatX4 a, FloatX4 b) { return vmulq_f32(a.v, b.v); }
+inline FloatX4 operator/(FloatX4 a, FloatX4 b) { return vdivq_f32(a.v, b.v); }
+inline uint32x4_t operator<(FloatX4 a, FloatX4 b) { return vcltq_f32(a.v, b.v); }
+inline uint32x4_t operator<=(FloatX4 a, FloatX4 b) { return vcleq_f32(a.v, b.v); }
+inline uint32x4_t operator>(FloatX4 a, FloatX4 b) { return vcgtq_f32(a.v, b.v); }
+inline uint32x4_t operator>=(FloatX4 a, FloatX4 b) { return vcgeq_f32(a.v, b.v); }
+inline uint32x4_t operator==(FloatX4 a, FloatX4 b) { return vceqq_f32(a.v, b.v); }
+inline FloatX4 min(FloatX4 a, FloatX4 b) { return vbslq_f32(vcltq_f32(a.v, b.v), a.v, b.v); }
+inline FloatX4 max(FloatX4 a, FloatX4 b) { return vbslq_f32(vcgtq_f32(a.v, b.v), a.v, b.v); }
+inline FloatX4 abs(FloatX4 a) { return vabsq_f32(a.v); }
+inline FloatX4 sqrt(FloatX4 a) { return vsqrtq_f32(a.v); }
+inline FloatX4 select(uint32x4_t mask, FloatX4 a, FloatX4 b) { return vbslq_f32(mask, a.v, b.v); }
+inline uint32x4_t both(uint32x4_t a, uint32x4_t b) { return vandq_u32(a, b); }
+
+inline void splitExponent(FloatX4 a, FloatX4& exponent, FloatX4& mantissa)
+{
+    const uint32x4_t bits = vreinterpretq_u32_f32(a.v);
+    exponent = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+    mantissa = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x7FFFFF)), vdupq_n_u32(0x3F800000)));
+}
+
+inline void roundPow2(FloatX4 a, FloatX4& n, FloatX4& pow2n)
+{
+    const int32x4_t i = vcvtaq_s32_f32(a.v);   // Round half away from zero.
+    n = vcvtq_f32_s32(i);
+    pow2n = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(i, vdupq_n_s32(127)), 23));
+}
+#endif  // BAKTSIU_PIPELINE_USE_NEON
+
+#if defined(__AVX2__)
+struct FloatX8
+{
+    static const int kWidth = 8;
+    using Mask = FloatX8;
+
+    FloatX8() = default;
+    FloatX8(float value) : v(_mm256_set1_ps(value)) {}
+    FloatX8(__m256 value) : v(value) {}
+
+    static FloatX8 load(const float* src) { return _mm256_loadu_ps(src); }
+    void    store(float* dst) const { _mm256_storeu_ps(dst, v); }
+
+    __m256  v;
+};
+
+// Ordered and non-signaling comparisons, the same as SSE2 ones.
+inline FloatX8 operator+(FloatX8 a, FloatX8 b) { return _mm256_add_ps(a.v, b.v); }
+inline FloatX8 operator-(FloatX8 a, FloatX8 b) { return _mm256_sub_ps(a.v, b.v); }
+inline FloatX8 operator*(FloatX8 a, FloatX8 b) { return _mm256_mul_ps(a.v, b.v); }
+inline FloatX8 operator/(FloatX8 a, FloatX8 b) { return _mm256_div_ps(a.v, b.v); }
+inline FloatX8 operator<(FloatX8 a, FloatX8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+inline FloatX8 operator<=(FloatX8 a, FloatX8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+inline FloatX8 operator>(FloatX8 a, FloatX8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+inline FloatX8 operator>=(FloatX8 a, FloatX8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+inline FloatX8 operator==(FloatX8 a, FloatX8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+inline FloatX8 min(FloatX8 a, FloatX8 b) { return _mm256_min_ps(a.v, b.v); }
+inline FloatX8 max(FloatX8 a, FloatX8 b) { return _mm256_max_ps(a.v, b.v); }
+inline FloatX8 abs(FloatX8 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+inline FloatX8 sqrt(FloatX8 a) { return _mm256_sqrt_ps(a.v); }
+inline FloatX8 select(FloatX8 mask, FloatX8 a, FloatX8 b) { return _mm256_blendv_ps(b.v, a.v, mask.v); }
+inline FloatX8 both(FloatX8 a, FloatX8 b) { return _mm256_and_ps(a.v, b.v); }
+
+inline void splitExponent(FloatX8 a, FloatX8& exponent, FloatX8& mantissa)
+{
+    const __m256i bits = _mm256_castps_si256(a.v);
+    exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFF)),
+        _mm256_set1_epi32(0x3F800000)));
+}
+
+inline void roundPow2(FloatX8 a, FloatX8& n, FloatX8& pow2n)
+{
+    const __m256 half = _mm256_or_ps(_mm256_and_ps(a.v, _mm256_set1_ps(-0.0f)), _mm256_set1_ps(0.5f));
+    const __m256i i = _mm256_cvttps_epi32(_mm256_add_ps(a.v, half));
+    n = _mm256_cvtepi32_ps(i);
+    pow2n = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(i, _mm256_set1_epi32(127)), 23));
+}
+#endif  // __AVX2__
+
+//-----------------------------------------------------------------------------
+// Math functions. GPUs evaluate pow as exp2(y * log2(x)), thus these functions
+// follow the same formulation with polynomials accurate to about 1e-7.
+//-----------------------------------------------------------------------------
+
+template <typename F>
+inline F clamp(F x, F lower, F upper)
+{
+    return min(max(x, lower), upper);
+}
+
+template <typename F>
+inline F sign(F x)
+{
+    return select(x > F(0.0f), F(1.0f), select(x < F(0.0f), F(-1.0f), F(0.0f)));
+}
+
+// Return log2 of positive normal value, the same series as fastLog2@image_statistics.cpp.
+template <typename F>
+inline F log2(F x)
+{
+    F exponent, mantissa;
+    splitExponent(x, exponent, mantissa);
+
+    // Reduce mantissa to [sqrt(0.5), sqrt(2)).
+    const auto isLarge = mantissa > F(1.4142135624f);
+    mantissa = select(isLarge, mantissa * F(0.5f), mantissa);
+    exponent = select(isLarge, exponent + F(1.0f), exponent);
+
+    const F t = (mantissa - F(1.0f)) / (mantissa + F(1.0f));
+    const F t2 = t * t;
+    const float c1 = 2.8853900818f;     // 2 / ln(2)
+    return exponent + t * (F(c1) + t2 * (F(c1 / 3.0f) + t2 * (F(c1 / 5.0f) + t2 * F(c1 / 7.0f))));
+}
+
+// Return 2^x by Taylor series of the fraction in [-0.5, 0.5], x is clamped to [-126, 126].
+template <typename F>
+inline F exp2(F x)
+{
+    x = clamp(x, F(-126.0f), F(126.0f));
+    F n, pow2n;
+    roundPow2(x, n, pow2n);
+
+    const F f = (x - n) * F(0.6931471806f);
+    F series = F(1.0f / 5040.0f);
+    series = F(1.0f / 720.0f) + f * series;
+    series = F(1.0f / 120.0f) + f * series;
+    series = F(1.0f / 24.0f) + f * series;
+    series = F(1.0f / 6.0f) + f * series;
+    series = F(0.5f) + f * series;
+    series = F(1.0f) + f * series;
+    series = F(1.0f) + f * series;
+    return series * pow2n;
+}
+
+// Return pow(x, y) for x >= 0, where pow(0, y) is zero.
+template <typename F>
+inline F pow(F x, F y)
+{
+    return select(x > F(0.0f), exp2(y * log2(max(x, F(1e-30f)))), F(0.0f));
+}
+
+// Return atan(y, x) in radians, the reduced argument is evaluated by polynomial of Cephes atanf.
+template <typename F>
+inline F atan2(F y, F x)
+{
+    const F absX = abs(x);
+    const F absY = abs(y);
+    const F maxValue = max(absX, absY);
+    F a = min(absX, absY) / select(maxValue > F(0.0f), maxValue, F(1.0f));
+
+    // Reduce a in [0, 1] to [-tan(pi/8), tan(pi/8)].
+    const auto isLarge = a > F(0.4142135624f);
+    const F offset = select(isLarge, F(0.7853981634f), F(0.0f));
+    a = select(isLarge, (a - F(1.0f)) / (a + F(1.0f)), a);
+
+    const F z = a * a;
+    F angle = F(8.05374449538e-2f) * z - F(1.38776856032e-1f);
+    angle = angle * z + F(1.99777106478e-1f);
+    angle = angle * z - F(3.33329491539e-1f);
+    angle = offset + angle * z * a + a;
+
+    angle = select(absY > absX, F(1.5707963268f) - angle, angle);
+    angle = select(x < F(0.0f), F(3.1415926536f) - angle, angle);
+    return select(y < F(0.0f), F(0.0f) - angle, angle);
+}
+
+//-----------------------------------------------------------------------------
+// Color transforms, the same as color_transform.glsl and present.frag.
+//-----------------------------------------------------------------------------
+
+// Matrices in row-major order, rows are the same as the ones of color_transform.glsl.
+const float kAP1ToXYZ[9] = {
+     0.6624541811f, 0.1340042065f, 0.1561876870f,
+     0.2722287168f, 0.6740817658f, 0.0536895174f,
+    -0.0055746495f, 0.0040607335f, 1.0103391003f };
+
+const float kXYZToAP1[9] = {
+     1.6410233797f, -0.3248032942f, -0.2364246952f,
+    -0.6636628587f,  1.6153315917f,  0.0167563477f,
+     0.0117218943f, -0.0082844420f,  0.9883948585f };
+
+const float kAP1ToBT709[9] = {
+     1.7050515f, -0.6217907f, -0.0832587f,
+    -0.1302571f,  1.1408029f, -0.0105482f,
+    -0.0240033f, -0.1289688f,  1.1529717f };
+
+const float kAP1ToP3D65[9] = {
+     1.3792145f, -0.3088633f, -0.0703498f,
+    -0.0693355f,  1.0822950f, -0.0129618f,
+    -0.0021590f, -0.0454592f,  1.0476177f };
+
+const float kAP1ToBT2020[9] = {
+     1.0258249f, -0.0200529f, -0.0057714f,
+    -0.002235f,   1.0045849f, -0.0023520f,
+    -0.0050133f, -0.0252900f,  1.0303028f };
+
+const float kAP1ToAP0[9] = {
+     0.6954522414f, 0.1406786965f, 0.1638690622f,
+     0.0447945634f, 0.8596711185f, 0.0955343182f,
+    -0.0055258826f, 0.0040252103f, 1.0015006723f };
+
+const float kAP0ToAP1[9] = {
+     1.4514393161f, -0.2365107469f, -0.2149285693f,
+    -0.0765537734f,  1.1762296998f, -0.0996759264f,
+     0.0083161484f, -0.0060324498f,  0.9977163014f };
+
+const float kRrtSatMat[9] = {
+    0.9708890f, 0.0269633f, 0.00214758f,
+    0.0108892f, 0.9869630f, 0.00214758f,
+    0.0108892f, 0.0269633f, 0.96214800f };
+
+const float kOdtSatMat[9] = {
+    0.949056f, 0.0471857f, 0.00375827f,
+    0.019056f, 0.9771860f, 0.00375827f,
+    0.019056f, 0.0471857f, 0.93375800f };
+
+template <typename F>
+struct Rgb
+{
+    F   r, g, b;
+};
+
+// The same as mul(M, color) of GLSL.
+template <typename F>
+inline Rgb<F> mul(const float* m, const Rgb<F>& c)
+{
+    return {
+        F(m[0]) * c.r + F(m[1]) * c.g + F(m[2]) * c.b,
+        F(m[3]) * c.r + F(m[4]) * c.g + F(m[5]) * c.b,
+        F(m[6]) * c.r + F(m[7]) * c.g + F(m[8]) * c.b };
+}
+
+template <typename F>
+inline F labf(F v)
+{
+    return select(v > F(0.008856451679f), pow(v, F(1.0f / 3.0f)), F(7.787037037f) * v + F(0.1379310345f));
+}
+
+template <typename F>
+inline Rgb<F> XYZtoLab(const Rgb<F>& xyz)
+{
+    const F fx = labf(xyz.r / F(0.95047f));
+    const F fy = labf(xyz.g);
+    const F fz = labf(xyz.b / F(1.08883f));
+    return { F(116.0f) * fy - F(16.0f), F(500.0f) * (fx - fy), F(200.0f) * (fy - fz) };
+}
+
+// AcesToneMapping@color_transform.glsl, it returns linear color in AP1.
+template <typename F>
+Rgb<F> acesToneMapping(Rgb<F> aces)
+{
+    const F halfMin(5.96e-08f);
+    const F halfMax(65504.0f);
+    const F zero(0.0f);
+    const F one(1.0f);
+
+    // --- Glow module --- //
+    const F ma = max(aces.r, max(aces.g, aces.b));
+    const F mi = min(aces.r, min(aces.g, aces.b));
+    const F saturation = (max(ma, halfMin) - max(mi, halfMin)) / max(ma, F(1e-2f));
+
+    const F chroma = sqrt(aces.b * (aces.b - aces.g) + aces.g * (aces.g - aces.r) + aces.r * (aces.r - aces.b));
+    const F ycIn = (aces.b + aces.g + aces.r + F(1.75f) * chroma) / F(3.0f);
+
+    const F x = (saturation - F(0.4f)) / F(0.2f);
+    const F t = max(one - abs(x / F(2.0f)), zero);
+    const F s = (one + sign(x) * (one - t * t)) / F(2.0f);
+
+    const F glowGainIn = F(0.05f) * s;
+    const F glowMid(0.08f);
+    F glowGainOut = glowGainIn * (glowMid / ycIn - F(0.5f));
+    glowGainOut = select(ycIn >= F(2.0f) * glowMid, zero, glowGainOut);
+    glowGainOut = select(ycIn <= F(2.0f / 3.0f) * glowMid, glowGainIn, glowGainOut);
+
+    const F addedGlow = one + glowGainOut;
+    aces.r = aces.r * addedGlow;
+    aces.g = aces.g * addedGlow;
+    aces.b = aces.b * addedGlow;
+
+    // --- Red modifier --- //
+    const F radianToDegree(57.2957795131f);
+    F hue = radianToDegree * atan2(F(1.7320508076f) * (aces.g - aces.b), F(2.0f) * aces.r - aces.g - aces.b);
+    hue = select(both(aces.r == aces.g, aces.g == aces.b), zero, hue);
+    hue = select(hue < zero, hue + F(360.0f), hue);
+
+    F centeredHue = hue;    // RRT_RED_HUE is zero.
+    centeredHue = select(centeredHue < F(-180.0f), centeredHue + F(360.0f),
+        select(centeredHue > F(180.0f), centeredHue - F(360.0f), centeredHue));
+
+    F hueWeight = clamp(one - abs(F(2.0f) * centeredHue / F(135.0f)), zero, one);
+    hueWeight = hueWeight * hueWeight * (F(3.0f) - F(2.0f) * hueWeight);
+    hueWeight = hueWeight * hueWeight;
+
+    aces.r = aces.r + hueWeight * saturation * (F(0.03f) - aces.r) * (one - F(0.82f));
+
+    // --- ACES to RGB rendering space --- //
+    aces.r = max(zero, aces.r);
+    aces.g = max(zero, aces.g);
+    aces.b = max(zero, aces.b);
+    Rgb<F> rgbPre = mul(kAP0ToAP1, aces);
+    rgbPre.r = clamp(rgbPre.r, zero, halfMax);
+    rgbPre.g = clamp(rgbPre.g, zero, halfMax);
+    rgbPre.b = clamp(rgbPre.b, zero, halfMax);
+
+    // --- Global desaturation --- //
+    rgbPre = mul(kRrtSatMat, rgbPre);
+
+    // Achromatic curve of post RRT and pre ODT.
+    auto curve = [](F v) {
+        return (v * (F(180.08877305f) * v + F(5.82507674f))) / (v * (F(190.14106451f) * v + F(56.89654471f)) + F(53.22517853f));
+    };
+    const Rgb<F> rgbPost = { curve(rgbPre.r), curve(rgbPre.g), curve(rgbPre.b) };
+
+    // --- Dark to dim surround --- //
+    Rgb<F> xyz = mul(kAP1ToXYZ, rgbPost);
+    const F divisor = max(xyz.r + xyz.g + xyz.b, halfMin);
+    const F chromaX = xyz.r / divisor;
+    const F chromaY = xyz.g / divisor;
+    const F luminance = pow(clamp(xyz.g, zero, halfMax), F(0.9811f));
+    const F m = luminance / max(chromaY, halfMin);
+    xyz = { chromaX * m, luminance, (one - chromaX - chromaY) * m };
+
+    return mul(kOdtSatMat, mul(kXYZToAP1, xyz));
+}
+
+// colorTransform@color_transform.glsl followed by clamping of drawRGBValues@present.frag.
+template <typename F>
+Rgb<F> colorTransform(Rgb<F> color, int presentMode, bool applyToneMapping)
+{
+    if (applyToneMapping) {
+        color = acesToneMapping(mul(kAP1ToAP0, color));
+    }
+
+    if (presentMode == 1) {
+        color.g = color.b = color.r;
+    } else if (presentMode == 2) {
+        color.r = color.b = color.g;
+    } else if (presentMode == 3) {
+        color.r = color.g = color.b;
+    } else if (presentMode == 4) {
+        color.r = color.g = color.b = mul(kAP1ToXYZ, color).g;
+    } else if (presentMode >= 5 && presentMode < 8) {
+        const Rgb<F> lab = XYZtoLab(mul(kAP1ToXYZ, color));
+        const F value = presentMode == 5 ? lab.r / F(100.0f) : ((presentMode == 6 ? lab.g : lab.b) + F(128.0f)) / F(256.0f);
+        color.r = color.g = color.b = value;
+    }
+
+    const F zero(0.0f);
+    const F one(1.0f);
+    return { clamp(color.r, zero, one), clamp(color.g, zero, one), clamp(color.b, zero, one) };
+}
+
+// outputTransform@color_transform.glsl.
+template <typename F>
+Rgb<F> outputTransform(Rgb<F> color, int outTransformType, float displayGamma)
+{
+    if (outTransformType == 0) {
+        color = mul(kAP1ToBT709, color);
+    } else if (outTransformType == 1) {
+        color = mul(kAP1ToP3D65, color);
+    } else if (outTransformType == 2) {
+        color = mul(kAP1ToBT2020, color);
+    }
+
+    const F zero(0.0f);
+    const F invGamma(1.0f / displayGamma);
+    return { pow(max(color.r, zero), invGamma), pow(max(color.g, zero), invGamma), pow(max(color.b, zero), invGamma) };
+}
+
+// Apply function to interleaved RGBA pixels in place, pixels are transposed to planes per packet.
+template <typename F, typename Func>
+void transformPixels(float* rgba, size_t count, Func func)
+{
+    const int width = F::kWidth;
+    float planes[3][width];
+
+    for (size_t begin = 0; begin < count; begin += width) {
+        const int num = count - begin < static_cast<size_t>(width) ? static_cast<int>(count - begin) : width;
+        float* pixels = rgba + begin * 4;
+        for (int i = 0; i < width; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                planes[c][i] = i < num ? pixels[i * 4 + c] : 0.0f;
+            }
+        }
+
+        const Rgb<F> result = func(Rgb<F>{ F::load(planes[0]), F::load(planes[1]), F::load(planes[2]) });
+        result.r.store(planes[0]);
+        result.g.store(planes[1]);
+        result.b.store(planes[2]);
+
+        for (int i = 0; i < num; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                pixels[i * 4 + c] = planes[c][i];
+            }
+        }
+    }
+}
+
+template <typename F>
+void colorTransformPixels(float* rgba, size_t count, int presentMode, bool applyToneMapping)
+{
+    transformPixels<F>(rgba, count, [&](const Rgb<F>& color) {
+        return colorTransform(color, presentMode, applyToneMapping);
+    });
+}
+
+template <typename F>
+void outputTransformPixels(float* rgba, size_t count, int outTransformType, float displayGamma)
+{
+    transformPixels<F>(rgba, count, [&](const Rgb<F>& color) {
+        return outputTransform(color, outTransformType, displayGamma);
+    });
+}
+
+// Write squared Lab distances of RGBA pixels (linear AP1), see getColorDistance@color_transform.glsl.
+template <typename F>
+void colorDistancePixels(const float* rgba1, const float* rgba2, size_t count, float* distances)
+{
+    const int width = F::kWidth;
+    float planes[6][width];
+    float result[width];
+
+    for (size_t begin = 0; begin < count; begin += width) {
+        const int num = count - begin < static_cast<size_t>(width) ? static_cast<int>(count - begin) : width;
+        const float* pixels1 = rgba1 + begin * 4;
+        const float* pixels2 = rgba2 + begin * 4;
+        for (int i = 0; i < width; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                planes[c][i] = i < num ? pixels1[i * 4 + c] : 0.0f;
+                planes[c + 3][i] = i < num ? pixels2[i * 4 + c] : 0.0f;
+            }
+        }
+
+        const Rgb<F> lab1 = XYZtoLab(mul(kAP1ToXYZ, Rgb<F>{ F::load(planes[0]), F::load(planes[1]), F::load(planes[2]) }));
+        const Rgb<F> lab2 = XYZtoLab(mul(kAP1ToXYZ, Rgb<F>{ F::load(planes[3]), F::load(planes[4]), F::load(planes[5]) }));
+        const F dl = lab1.r - lab2.r;
+        const F da = lab1.g - lab2.g;
+        const F db = lab1.b - lab2.b;
+        (dl * dl + da * da + db * db).store(result);
+
+        for (int i = 0; i < num; ++i) {
+            distances[begin + i] = result[i];
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Kernels of ImageMetrics, i.e. separable filters and per-pixel terms of SSIM and FLIP.
+//-----------------------------------------------------------------------------
+
+// Linear sRGB to CIE XYZ and its inverse, the matrices of the reference implementation of FLIP.
+const float kLinearSrgbToXYZ[9] = {
+    0.4124564f, 0.3575761f, 0.1804375f,
+    0.2126729f, 0.7151522f, 0.0721750f,
+    0.0193339f, 0.1191920f, 0.9503041f };
+
+const float kXYZToLinearSrgb[9] = {
+     3.2404542f, -1.5371385f, -0.4985314f,
+    -0.9692660f,  1.8760108f,  0.0415560f,
+     0.0556434f, -0.2040259f,  1.0572252f };
+
+// XYZ of linear sRGB (1, 1, 1), the reference white of YCxCz.
+const float kFlipWhite[3] = { 0.950428545f, 1.0f, 1.088900371f };
+
+// Return 1 if weights are symmetric, -1 if antisymmetric, or 0 otherwise.
+inline int getFilterParity(const float* weights, int tapNum)
+{
+    bool symmetric = true;
+    bool antisymmetric = true;
+    for (int k = 0; k < tapNum / 2; ++k) {
+        symmetric = symmetric && weights[k] == weights[tapNum - 1 - k];
+        antisymmetric = antisymmetric && weights[k] == -weights[tapNum - 1 - k];
+    }
+
+    return symmetric ? 1 : (antisymmetric ? -1 : 0);
+}
+
+// Write dst[x] = sum of weights[k] * src[x + k] for x in [0, count), src has count + tapNum - 1 values.
+// Taps of symmetric and antisymmetric filters are paired to halve multiplications.
+template <typename F>
+void convolveRow(const float* src, const float* weights, int tapNum, size_t count, float* dst)
+{
+    const size_t width = F::kWidth;
+    const int parity = getFilterParity(weights, tapNum);
+    const int pairNum = parity != 0 ? tapNum / 2 : 0;
+    size_t x = 0;
+    for (; x + width <= count; x += width) {
+        F sum(0.0f);
+        for (int k = 0; k < pairNum; ++k) {
+            const F first = F::load(src + x + k);
+            const F last = F::load(src + x + tapNum - 1 - k);
+            sum = sum + F(weights[k]) * (parity > 0 ? first + last : first - last);
+        }
+
+        for (int k = pairNum; k < tapNum - pairNum; ++k) {
+            sum = sum + F(weights[k]) * F::load(src + x + k);
+        }
+        sum.store(dst + x);
+    }
+
+    for (; x < count; ++x) {
+        float sum = 0.0f;
+        for (int k = 0; k < tapNum; ++k) {
+            sum = sum + weights[k] * src[x + k];
+        }
+        dst[x] = sum;
+    }
+}
+
+// Write dst[x] = sum of weights[k] * rows[k][x] for x in [0, count).
+template <typename F>
+void convolveColumn(const float* const* rows, const float* weights, int tapNum, size_t count, float* dst)
+{
+    const size_t width = F::kWidth;
+    const int parity = getFilterParity(weights, tapNum);
+    const int pairNum = parity != 0 ? tapNum / 2 : 0;
+    size_t x = 0;
+    for (; x + width <= count; x += width) {
+        F sum(0.0f);
+        for (int k = 0; k < pairNum; ++k) {
+            const F first = F::load(rows[k] + x);
+            const F last = F::load(rows[tapNum - 1 - k] + x);
+            sum = sum + F(weights[k]) * (parity > 0 ? first + last : first - last);
+        }
+
+        for (int k = pairNum; k < tapNum - pairNum; ++k) {
+            sum = sum + F(weights[k]) * F::load(rows[k] + x);
+        }
+        sum.store(dst + x);
+    }
+
+    for (; x < count; ++x) {
+        float sum = 0.0f;
+        for (int k = 0; k < tapNum; ++k) {
+            sum = sum + weights[k] * rows[k][x];
+        }
+        dst[x] = sum;
+    }
+}
+
+// Split RGBA display values, clamped to [0, 1], into planes of luma (BT.709 weights
+// of encoded values) and YCxCz of FLIP, where values are decoded as sRGB signals.
+template <typename F>
+void metricInputPixels(const float* rgba, size_t count, float* luma, float* y, float* cx, float* cz)
+{
+    const int width = F::kWidth;
+    float planes[4][width];
+    const F zero(0.0f);
+    const F one(1.0f);
+
+    for (size_t begin = 0; begin < count; begin += width) {
+        const int num = count - begin < static_cast<size_t>(width) ? static_cast<int>(count - begin) : width;
+        const float* pixels = rgba + begin * 4;
+        for (int i = 0; i < width; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                planes[c][i] = i < num ? pixels[i * 4 + c] : 0.0f;
+            }
+        }
+
+        Rgb<F> color = { F::load(planes[0]), F::load(planes[1]), F::load(planes[2]) };
+        color = { clamp(color.r, zero, one), clamp(color.g, zero, one), clamp(color.b, zero, one) };
+        const F value = F(0.2126f) * color.r + F(0.7152f) * color.g + F(0.0722f) * color.b;
+
+        auto decode = [&](F v) {
+            return select(v <= F(0.04045f), v / F(12.92f), pow((v + F(0.055f)) / F(1.055f), F(2.4f)));
+        };
+        const Rgb<F> xyz = mul(kLinearSrgbToXYZ, Rgb<F>{ decode(color.r), decode(color.g), decode(color.b) });
+        const F yRatio = xyz.g / F(kFlipWhite[1]);
+
+        value.store(planes[0]);
+        (F(116.0f) * yRatio - F(16.0f)).store(planes[1]);
+        (F(500.0f) * (xyz.r / F(kFlipWhite[0]) - yRatio)).store(planes[2]);
+        (F(200.0f) * (yRatio - xyz.b / F(kFlipWhite[2]))).store(planes[3]);
+
+        for (int i = 0; i < num; ++i) {
+            luma[begin + i] = planes[0][i];
+            y[begin + i] = planes[1][i];
+            cx[begin + i] = planes[2][i];
+            cz[begin + i] = planes[3][i];
+        }
+    }
+}
+
+// Write SSIM and its contrast-structure term from local moments, which are the
+// filtered x, y, x^2, y^2 and xy of values in [0, 1].
+template <typename F>
+void ssimPixels(const float* const* moments, size_t count, float* ssim, float* cs)
+{
+    const int width = F::kWidth;
+    float planes[5][width];
+    float results[2][width];
+    const F c1(0.0001f);    // (0.01 * L)^2
+    const F c2(0.0009f);    // (0.03 * L)^2
+    const F two(2.0f);
+
+    for (size_t begin = 0; begin < count; begin += width) {
+        const int num = count - begin < static_cast<size_t>(width) ? static_cast<int>(count - begin) : width;
+        for (int m = 0; m < 5; ++m) {
+            for (int i = 0; i < width; ++i) {
+                planes[m][i] = i < num ? moments[m][begin + i] : 0.0f;
+            }
+        }
+
+        const F mx = F::load(planes[0]);
+        const F my = F::load(planes[1]);
+        const F mxx = mx * mx;
+        const F myy = my * my;
+        const F mxy = mx * my;
+        const F varX = F::load(planes[2]) - mxx;
+        const F varY = F::load(planes[3]) - myy;
+        const F covariance = F::load(planes[4]) - mxy;
+
+        const F contrastStructure = (two * covariance + c2) / (varX + varY + c2);
+        const F luminance = (two * mxy + c1) / (mxx + myy + c1);
+        (luminance * contrastStructure).store(results[0]);
+        contrastStructure.store(results[1]);
+
+        for (int i = 0; i < num; ++i) {
+            ssim[begin + i] = results[0][i];
+            cs[begin + i] = results[1][i];
+        }
+    }
+}
+
+// Return CIE Lab with Hunt adjustment of YCxCz, it's clamped to linear sRGB box as FLIP.
+template <typename F>
+Rgb<F> getHuntLab(F y, F cx, F cz)
+{
+    const F zero(0.0f);
+    const F one(1.0f);
+    const F yRatio = (y + F(16.0f)) / F(116.0f);
+    const Rgb<F> xyz = {
+        F(kFlipWhite[0]) * (cx / F(500.0f) + yRatio),
+        F(kFlipWhite[1]) * yRatio,
+        F(kFlipWhite[2]) * (yRatio - cz / F(200.0f)) };
+
+    Rgb<F> rgb = mul(kXYZToLinearSrgb, xyz);
+    rgb = { clamp(rgb.r, zero, one), clamp(rgb.g, zero, one), clamp(rgb.b, zero, one) };
+
+    Rgb<F> lab = XYZtoLab(mul(kLinearSrgbToXYZ, rgb));
+    lab.g = F(0.01f) * lab.r * lab.g;
+    lab.b = F(0.01f) * lab.r * lab.b;
+    return lab;
+}
+
+// Return HyAB distance, the sum of lightness difference and Euclidean distance of chroma.
+template <typename F>
+F getHyAB(const Rgb<F>& lab1, const Rgb<F>& lab2)
+{
+    const F da = lab1.g - lab2.g;
+    const F db = lab1.b - lab2.b;
+    return abs(lab1.r - lab2.r) + sqrt(da * da + db * db);
+}
+
+/**
+ * Write LDR-FLIP errors of pixels.
+ *
+ * @param colors1 Planes of YCxCz filtered by contrast sensitivity functions.
+ * @param features1 Planes of edge (x, y) and point (x, y) responses of normalized luminance.
+ * @param maxColorError HyAB of green and blue raised to 0.7, the color error mapped to 1.
+ */
+template <typename F>
+void flipErrorPixels(const float* const* colors1, const float* const* colors2, const float* const* features1,
+    const float* const* features2, size_t count, float maxColorError, float* errors)
+{
+    const int width = F::kWidth;
+    float planes[14][width];
+    float result[width];
+    const F one(1.0f);
+
+    // Remap power of HyAB, errors of the lower 40% of range occupy 95% of output.
+    const float lowerError = 0.4f * maxColorError;
+    const F lowerScale(0.95f / lowerError);
+    const F upperScale(0.05f / (maxColorError - lowerError));
+
+    for (size_t begin = 0; begin < count; begin += width) {
+        const int num = count - begin < static_cast<size_t>(width) ? static_cast<int>(count - begin) : width;
+        for (int i = 0; i < width; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                planes[c][i] = i < num ? colors1[c][begin + i] : 0.0f;
+                planes[c + 3][i] = i < num ? colors2[c][begin + i] : 0.0f;
+            }
+            for (int c = 0; c < 4; ++c) {
+                planes[c + 6][i] = i < num ? features1[c][begin + i] : 0.0f;
+                planes[c + 10][i] = i < num ? features2[c][begin + i] : 0.0f;
+            }
+        }
+
+        const Rgb<F> lab1 = getHuntLab(F::load(planes[0]), F::load(planes[1]), F::load(planes[2]));
+        const Rgb<F> lab2 = getHuntLab(F::load(planes[3]), F::load(planes[4]), F::load(planes[5]));
+        const F colorError = pow(getHyAB(lab1, lab2), F(0.7f));
+        const F remappedError = select(colorError < F(lowerError), lowerScale * colorError,
+            F(0.95f) + (colorError - F(lowerError)) * upperScale);
+
+        auto magnitude = [&](int plane) {
+            const F x = F::load(planes[plane]);
+            const F y = F::load(planes[plane + 1]);
+            return sqrt(x * x + y * y);
+        };
+        const F edgeDifference = abs(magnitude(6) - magnitude(10));
+        const F pointDifference = abs(magnitude(8) - magnitude(12));
+        const F featureError = sqrt(max(edgeDifference, pointDifference) * F(0.7071067812f));
+
+        pow(remappedError, one - featureError).store(result);
+        for (int i = 0; i < num; ++i) {
+            errors[begin + i] = result[i];
+        }
+    }
+}
+
+#if defined(USE_AVX2)
+// Instantiations of color_pipeline_avx2.cpp.
+void    colorTransformAvx2(float* rgba, size_t count, int presentMode, bool applyToneMapping);
+
+void    outputTransformAvx2(float* rgba, size_t count, int outTransformType, float displayGamma);
+
+void    colorDistanceAvx2(const float* rgba1, const float* rgba2, size_t count, float* distances);
+
+void    convolveRowAvx2(const float* src, const float* weights, int tapNum, size_t count, float* dst);
+
+void    convolveColumnAvx2(const float* const* rows, const float* weights, int tapNum, size_t count, float* dst);
+
+void    metricInputAvx2(const float* rgba, size_t count, float* luma, float* y, float* cx, float* cz);
+
+void    ssimAvx2(const float* const* moments, size_t count, float* ssim, float* cs);
+
+void    flipErrorAvx2(const float* const* colors1, const float* const* colors2, const float* const* features1,
+            const float* const* features2, size_t count, float maxColorError, float* errors);
+#endif
+
+}  // namespace pipeline
+}  // namespace baktsiu
+#endif // BAKTSIU_COLOR_PIPELINE_KERNELS_H_
@@ -1,5 +1,7 @@
 #include "colour.h"
 
+#include <glm/gtc/packing.hpp>
+
 namespace baktsiu
 {
 
@@ -53,4 +55,17 @@ const char* getPropertyLabel(ColorEncodingType type)
     }
 }
 
+const std::vector<float>& getHalfTable()
+{
+    static const std::vector<float> table = []() {
+        std::vector<float> values(65536);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = glm::unpackHalf1x16(static_cast<glm::uint16>(i));
+        }
+        return values;
+    }();
+
+    return table;
+}
+
 }  // namespace baktsiu
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define BAKTSIU_COLOUR_H_
 #pragma once
 
+#include <vector>
+
 //
 // https://github.com/colour-science/colour
 
@@ -59,5 +61,8 @@ enum class EOTF : char
 const char* getPropertyLabel(ColorPrimaryType);
 const char* getPropertyLabel(ColorEncodingType);
 
+// Return float values of all 65536 bit patterns of half floats, thus half pixels are decoded by lookup.
+const std::vector<float>& getHalfTable();
+
 }  // namespace baktsiu
 #endif
\ No newline at end of file
@@ -0,0 +1,322 @@
+#include "diff_regions.h"
+#include "colour.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+
+namespace
+{
+
+using namespace baktsiu;
+
+// Return root of cell with path halving. Parents are never larger than children,
+// thus roots are the first cells of regions in row-major order.
+int findRoot(std::vector<int>& parents, int index)
+{
+    while (parents[index] != index) {
+        parents[index] = parents[parents[index]];
+        index = parents[index];
+    }
+
+    return index;
+}
+
+void unite(std::vector<int>& parents, int index1, int index2)
+{
+    const int root1 = findRoot(parents, index1);
+    const int root2 = findRoot(parents, index2);
+    if (root1 < root2) {
+        parents[root2] = root1;
+    } else if (root2 < root1) {
+        parents[root1] = root2;
+    }
+}
+
+void mergeRegion(DiffRegions::Region& region, const DiffRegions::Region& other)
+{
+    if (region.pixelCount == 0) {
+        region = other;
+        return;
+    }
+
+    region.minPixel = glm::min(region.minPixel, other.minPixel);
+    region.maxPixel = glm::max(region.maxPixel, other.maxPixel);
+    if (other.maxDistance > region.maxDistance) {
+        region.maxDistance = other.maxDistance;
+        region.peakPixel = other.peakPixel;
+    }
+
+    region.pixelCount += other.pixelCount;
+    region.distanceSum += other.distanceSum;
+}
+
+}  // namespace
+
+namespace baktsiu
+{
+
+bool DiffRegions::build(const uint16_t* pixels, const Vec2i& size, ThreadPool* pool)
+{
+    clear();
+    if (!pixels || size.x <= 0 || size.y <= 0) {
+        return false;
+    }
+
+    // Levels are built up to a single cell, and at least up to the level of tiles.
+    mSize = size;
+    Vec2i levelSize = (size + kCellSize - 1) / kCellSize;
+    mLevelSizes.push_back(levelSize);
+    while (levelSize.x > 1 || levelSize.y > 1 || static_cast<int>(mLevelSizes.size()) <= kTileLevel) {
+        levelSize = (levelSize + 1) / 2;
+        mLevelSizes.push_back(levelSize);
+    }
+
+    mLevels.resize(mLevelSizes.size());
+    for (size_t level = 0; level < mLevels.size(); ++level) {
+        mLevels[level].assign(static_cast<size_t>(mLevelSizes[level].x) * mLevelSizes[level].y, 0.0f);
+    }
+
+    // Distances are kept in floats, NaN values never pass the threshold.
+    const std::vector<float>& halfTable = getHalfTable();
+    mDistances.resize(static_cast<size_t>(size.x) * size.y);
+    const Vec2i cellNum = mLevelSizes[0];
+    parallelFor(pool, cellNum.y, [&](size_t begin, size_t end) {
+        for (int cy = static_cast<int>(begin); cy < static_cast<int>(end); ++cy) {
+            float* cellRow = &mLevels[0][static_cast<size_t>(cy) * cellNum.x];
+            const int endY = std::min((cy + 1) * kCellSize, size.y);
+            for (int y = cy * kCellSize; y < endY; ++y) {
+                const uint16_t* row = pixels + static_cast<size_t>(y) * size.x * 4;
+                float* distances = &mDistances[static_cast<size_t>(y) * size.x];
+                for (int x = 0; x < size.x; ++x) {
+                    const float value = halfTable[row[x * 4 + 3]];
+                    distances[x] = value;
+                    float& cellMax = cellRow[x / kCellSize];
+                    cellMax = value > cellMax ? value : cellMax;
+                }
+            }
+        }
+    });
+
+    for (size_t level = 1; level < mLevels.size(); ++level) {
+        const Vec2i childSize = mLevelSizes[level - 1];
+        const Vec2i parentSize = mLevelSizes[level];
+        const std::vector<float>& children = mLevels[level - 1];
+        std::vector<float>& parents = mLevels[level];
+
+        parallelFor(pool, parentSize.y, [&](size_t begin, size_t end) {
+            for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y) {
+                for (int x = 0; x < parentSize.x; ++x) {
+                    float value = 0.0f;
+                    for (int cy = y * 2; cy < std::min(y * 2 + 2, childSize.y); ++cy) {
+                        for (int cx = x * 2; cx < std::min(x * 2 + 2, childSize.x); ++cx) {
+                            value = std::max(value, children[static_cast<size_t>(cy) * childSize.x + cx]);
+                        }
+                    }
+                    parents[static_cast<size_t>(y) * parentSize.x + x] = value;
+                }
+            }
+        });
+    }
+
+    return true;
+}
+
+void DiffRegions::update(float threshold, ThreadPool* pool)
+{
+    if (isEmpty() || threshold == mThreshold) {
+        return;
+    }
+
+    mThreshold = threshold;
+    mRegions.clear();
+    mPixelCount = 0;
+
+    const float squaredThreshold = threshold * threshold;
+    const Vec2i cellNum = mLevelSizes[0];
+    const int bandRowNum = 1 << kTileLevel;
+    const int bandNum = mLevelSizes[kTileLevel].y;
+    mCellParents.assign(static_cast<size_t>(cellNum.x) * cellNum.y, -1);
+
+    auto isMarked = [&](int x, int y) {
+        return x >= 0 && x < cellNum.x && mCellParents[static_cast<size_t>(y) * cellNum.x + x] >= 0;
+    };
+
+    // Cells are joined within bands in parallel, thus trees never cross bands.
+    parallelFor(pool, bandNum, [&](size_t begin, size_t end) {
+        markCells(squaredThreshold, static_cast<int>(begin), static_cast<int>(end));
+
+        for (int band = static_cast<int>(begin); band < static_cast<int>(end); ++band) {
+            const int beginY = band * bandRowNum;
+            const int endY = std::min(beginY + bandRowNum, cellNum.y);
+            for (int y = beginY; y < endY; ++y) {
+                for (int x = 0; x < cellNum.x; ++x) {
+                    if (!isMarked(x, y)) {
+                        continue;
+                    }
+
+                    const int index = y * cellNum.x + x;
+                    if (isMarked(x - 1, y)) {
+                        unite(mCellParents, index, index - 1);
+                    }
+
+                    if (y == beginY) {
+                        continue;
+                    }
+
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        if (isMarked(x + dx, y - 1)) {
+                            unite(mCellParents, index, index - cellNum.x + dx);
+                        }
+                    }
+                }
+            }
+        }
+    });
+
+    // Merge trees across borders of bands.
+    for (int band = 1; band < bandNum; ++band) {
+        const int y = band * bandRowNum;
+        for (int x = 0; x < cellNum.x; ++x) {
+            if (!isMarked(x, y)) {
+                continue;
+            }
+
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (isMarked(x + dx, y - 1)) {
+                    unite(mCellParents, y * cellNum.x + x, (y - 1) * cellNum.x + x + dx);
+                }
+            }
+        }
+    }
+
+    // Parents precede children, thus one pass in order links all cells to roots.
+    for (size_t i = 0; i < mCellParents.size(); ++i) {
+        if (mCellParents[i] >= 0) {
+            mCellParents[i] = mCellParents[mCellParents[i]];
+        }
+    }
+
+    // Gather pixels of marked cells per band, then merge regions sharing roots.
+    std::vector<std::unordered_map<int, Region>> bandRegions(bandNum);
+    parallelFor(pool, bandNum, [&](size_t begin, size_t end) {
+        for (int band = static_cast<int>(begin); band < static_cast<int>(end); ++band) {
+            auto& regions = bandRegions[band];
+            const int endCellY = std::min((band + 1) * bandRowNum, cellNum.y);
+            for (int cy = band * bandRowNum; cy < endCellY; ++cy) {
+                for (int cx = 0; cx < cellNum.x; ++cx) {
+                    const int root = mCellParents[static_cast<size_t>(cy) * cellNum.x + cx];
+                    if (root < 0) {
+                        continue;
+                    }
+
+                    Region cellRegion;
+                    cellRegion.minPixel = Vec2i(mSize);
+                    cellRegion.maxPixel = Vec2i(-1);
+                    const int endY = std::min((cy + 1) * kCellSize, mSize.y);
+                    const int endX = std::min((cx + 1) * kCellSize, mSize.x);
+                    for (int y = cy * kCellSize; y < endY; ++y) {
+                        const float* distances = &mDistances[static_cast<size_t>(y) * mSize.x];
+                        for (int x = cx * kCellSize; x < endX; ++x) {
+                            if (!(distances[x] >= squaredThreshold)) {
+                                continue;
+                            }
+
+                            const float distance = std::sqrt(distances[x]);
+                            cellRegion.minPixel = glm::min(cellRegion.minPixel, Vec2i(x, y));
+                            cellRegion.maxPixel = glm::max(cellRegion.maxPixel, Vec2i(x, y));
+                            if (distance > cellRegion.maxDistance || cellRegion.pixelCount == 0) {
+                                cellRegion.maxDistance = distance;
+                                cellRegion.peakPixel = Vec2i(x, y);
+                            }
+                            cellRegion.pixelCount++;
+                            cellRegion.distanceSum += distance;
+                        }
+                    }
+
+                    if (cellRegion.pixelCount > 0) {
+                        mergeRegion(regions[root], cellRegion);
+                    }
+                }
+            }
+        }
+    });
+
+    std::map<int, Region> regions;
+    for (const auto& band : bandRegions) {
+        for (const auto& item : band) {
+            mergeRegion(regions[item.first], item.second);
+        }
+    }
+
+    mRegions.reserve(regions.size());
+    for (const auto& item : regions) {
+        mRegions.push_back(item.second);
+        mPixelCount += item.second.pixelCount;
+    }
+
+    // Regions with equal sums keep the row-major order of their first cells.
+    std::stable_sort(mRegions.begin(), mRegions.end(), [](const Region& a, const Region& b) {
+        return a.distanceSum > b.distanceSum;
+    });
+}
+
+void DiffRegions::clear()
+{
+    mSize = Vec2i(0);
+    mDistances.clear();
+    mLevels.clear();
+    mLevelSizes.clear();
+    mCellParents.clear();
+    mRegions.clear();
+    mPixelCount = 0;
+    mThreshold = -1.0f;
+}
+
+float DiffRegions::maxDistance() const
+{
+    return mLevels.empty() ? 0.0f : std::sqrt(mLevels.back()[0]);
+}
+
+void DiffRegions::markCells(float squaredThreshold, int tileBegin, int tileEnd)
+{
+    // Descend from tiles and only visit children of nodes at or above threshold.
+    struct Node
+    {
+        int level;
+        int x;
+        int y;
+    };
+
+    std::vector<Node> stack;
+    const Vec2i& tileNum = mLevelSizes[kTileLevel];
+    for (int ty = tileBegin; ty < tileEnd; ++ty) {
+        for (int tx = 0; tx < tileNum.x; ++tx) {
+            stack.push_back(Node{ kTileLevel, tx, ty });
+            while (!stack.empty()) {
+                const Node node = stack.back();
+                stack.pop_back();
+
+                const Vec2i& levelSize = mLevelSizes[node.level];
+                const size_t index = static_cast<size_t>(node.y) * levelSize.x + node.x;
+                if (!(mLevels[node.level][index] >= squaredThreshold)) {
+                    continue;
+                } else if (node.level == 0) {
+                    mCellParents[index] = static_cast<int>(index);
+                    continue;
+                }
+
+                const Vec2i& childSize = mLevelSizes[node.level - 1];
+                for (int cy = node.y * 2; cy < std::min(node.y * 2 + 2, childSize.y); ++cy) {
+                    for (int cx = node.x * 2; cx < std::min(node.x * 2 + 2, childSize.x); ++cx) {
+                        stack.push_back(Node{ node.level - 1, cx, cy });
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,90 @@
+#ifndef BAKTSIU_DIFF_REGIONS_H_
+#define BAKTSIU_DIFF_REGIONS_H_
+
+#include "common.h"
+
+#include <vector>
+
+namespace baktsiu
+{
+
+class ThreadPool;
+
+/**
+ * Ranked regions of pixels whose color distances exceed a threshold.
+ *
+ * Squared color distances of the difference texture are reduced to a max
+ * pyramid of cells, where level 0 keeps the max of each kCellSize x kCellSize
+ * cell and each level above halves the resolution. Cells at or above the
+ * threshold are found by descending from tiles of kTileLevel, thus tiles
+ * without differences are skipped. Cells are joined by 8-connectivity in
+ * parallel bands of tiles, then bands are merged at their borders. Thus a
+ * line of anti-aliasing differences forms one region even if its pixels are
+ * not adjacent.
+ *
+ * The pyramid is built once per difference texture, changing threshold only
+ * repeats the connected components, which is fast enough for a slider.
+ */
+class DiffRegions
+{
+public:
+    static const int kCellSize = 4;
+    static const int kTileLevel = 4;    // Tiles of 64 x 64 pixels are the unit of parallel bands.
+
+    struct Region
+    {
+        Vec2i   minPixel = Vec2i(0);    // Bounding box of pixels at or above threshold, y is the row of pixel arrays.
+        Vec2i   maxPixel = Vec2i(0);    // Inclusive corner of bounding box.
+        Vec2i   peakPixel = Vec2i(0);   // Pixel with max distance.
+        size_t  pixelCount = 0;         // Number of pixels at or above threshold.
+        float   maxDistance = 0.0f;     // Max color distance, i.e. Delta E.
+        double  distanceSum = 0.0;      // Sum of color distances of pixels, regions are ranked by it.
+    };
+
+public:
+    /**
+     * Build max pyramid from difference pixels, regions are cleared.
+     *
+     * @param pixels RGBA half float pixels of difference texture, alpha is squared color distance.
+     * @param size Width and height of image.
+     * @param pool Optional thread pool to process rows of cells in parallel.
+     */
+    bool    build(const uint16_t* pixels, const Vec2i& size, ThreadPool* pool = nullptr);
+
+    // Find regions of pixels whose color distances are at or above threshold, it's skipped if threshold is unchanged.
+    void    update(float threshold, ThreadPool* pool = nullptr);
+
+    void    clear();
+
+    // Return regions in descending order of distance sums.
+    const std::vector<Region>& regions() const { return mRegions; }
+
+    // Return number of pixels in all regions.
+    size_t  pixelCount() const { return mPixelCount; }
+
+    // Return max color distance of all pixels, i.e. the top of pyramid.
+    float   maxDistance() const;
+
+    float   threshold() const { return mThreshold; }
+
+    const Vec2i& size() const { return mSize; }
+
+    bool    isEmpty() const { return mDistances.empty(); }
+
+private:
+    // Mark cells at or above squared threshold in tiles of rows [tileBegin, tileEnd).
+    void    markCells(float squaredThreshold, int tileBegin, int tileEnd);
+
+private:
+    Vec2i                           mSize = Vec2i(0);
+    std::vector<float>              mDistances;     // Squared color distances in rows of pixel arrays.
+    std::vector<std::vector<float>> mLevels;        // Max squared distances, level 0 is of cells.
+    std::vector<Vec2i>              mLevelSizes;
+    std::vector<int>                mCellParents;   // Union-find forest of marked cells, -1 for unmarked ones.
+    std::vector<Region>             mRegions;
+    size_t                          mPixelCount = 0;
+    float                           mThreshold = -1.0f;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_DIFF_REGIONS_H_
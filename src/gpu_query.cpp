@@ -0,0 +1,183 @@
+#include "gpu_query.h"
+
+#include <cstring>
+
+namespace baktsiu
+{
+
+bool GpuTimer::initialize()
+{
+    if (mQueries[0] == 0) {
+        glGenQueries(kQueryNum, mQueries);
+    }
+
+    return mQueries[0] != 0;
+}
+
+void GpuTimer::release()
+{
+    glDeleteQueries(kQueryNum, mQueries);
+    mQueries[0] = mQueries[1] = 0;
+    mIssued[0] = mIssued[1] = false;
+}
+
+void GpuTimer::begin()
+{
+    if (mQueries[0] == 0) {
+        return;
+    }
+
+    // Fetch the result of the query issued in previous frame.
+    const int prevIndex = mIndex ^ 1;
+    if (mIssued[prevIndex]) {
+        GLint available = 0;
+        glGetQueryObjectiv(mQueries[prevIndex], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            GLuint64 nanoseconds = 0;
+            glGetQueryObjectui64v(mQueries[prevIndex], GL_QUERY_RESULT, &nanoseconds);
+            mElapsedTime = glm::mix(mElapsedTime, nanoseconds * 1e-6f, 0.1f);
+            mIssued[prevIndex] = false;
+        }
+    }
+
+    glBeginQuery(GL_TIME_ELAPSED, mQueries[mIndex]);
+}
+
+void GpuTimer::end()
+{
+    if (mQueries[0] == 0) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    mIssued[mIndex] = true;
+    mIndex ^= 1;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GpuSampleCounter::initialize()
+{
+    if (mQueries[0] == 0) {
+        glGenQueries(kQueryNum, mQueries);
+    }
+
+    return mQueries[0] != 0;
+}
+
+void GpuSampleCounter::release()
+{
+    glDeleteQueries(kQueryNum, mQueries);
+    mQueries[0] = mQueries[1] = 0;
+    mIssued[0] = mIssued[1] = false;
+}
+
+void GpuSampleCounter::begin()
+{
+    if (mQueries[0] == 0) {
+        return;
+    }
+
+    // Fetch the result of the query issued in previous frame.
+    const int prevIndex = mIndex ^ 1;
+    if (mIssued[prevIndex]) {
+        GLint available = 0;
+        glGetQueryObjectiv(mQueries[prevIndex], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            glGetQueryObjectui64v(mQueries[prevIndex], GL_QUERY_RESULT, &mSampleCount);
+            mIssued[prevIndex] = false;
+        }
+    }
+
+    glBeginQuery(GL_SAMPLES_PASSED, mQueries[mIndex]);
+}
+
+void GpuSampleCounter::end()
+{
+    if (mQueries[0] == 0) {
+        return;
+    }
+
+    glEndQuery(GL_SAMPLES_PASSED);
+    mIssued[mIndex] = true;
+    mIndex ^= 1;
+}
+
+//-----------------------------------------------------------------------------
+
+bool GpuReadback::initialize(size_t byteSize)
+{
+    if (mBufferId == 0) {
+        glGenBuffers(1, &mBufferId);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mBufferId);
+    glBufferData(GL_PIXEL_PACK_BUFFER, byteSize, nullptr, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    mByteSize = byteSize;
+
+    return mBufferId != 0;
+}
+
+void GpuReadback::release()
+{
+    if (mFence) {
+        glDeleteSync(mFence);
+        mFence = nullptr;
+    }
+
+    glDeleteBuffers(1, &mBufferId);
+    mBufferId = 0;
+    mByteSize = 0;
+}
+
+void GpuReadback::readTexture(GLuint texId, GLenum format, GLenum type)
+{
+    if (mBufferId == 0) {
+        return;
+    }
+
+    if (mFence) {
+        glDeleteSync(mFence);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mBufferId);
+    glBindTexture(GL_TEXTURE_2D, texId);
+    glGetTexImage(GL_TEXTURE_2D, 0, format, type, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    mFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+bool GpuReadback::tryGetResult(void* data)
+{
+    if (!mFence) {
+        return false;
+    }
+
+    const GLenum status = glClientWaitSync(mFence, 0, 0);
+    if (status == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+
+    glDeleteSync(mFence);
+    mFence = nullptr;
+
+    if (status == GL_WAIT_FAILED) {
+        LOGW("Failed to wait for GPU readback");
+        return false;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mBufferId);
+    const void* buffer = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, mByteSize, GL_MAP_READ_BIT);
+    if (buffer) {
+        std::memcpy(data, buffer, mByteSize);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return buffer != nullptr;
+}
+
+}  // namespace baktsiu
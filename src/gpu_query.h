@@ -0,0 +1,100 @@
+#ifndef BAKTSIU_GPU_QUERY_H_
+#define BAKTSIU_GPU_QUERY_H_
+
+#include "common.h"
+
+#include <GL/gl3w.h>
+
+namespace baktsiu
+{
+
+/**
+ * Measure GPU time of commands between begin() and end().
+ *
+ * Queries are double buffered, the result of previous frame is fetched
+ * when begin() is called, thus it never stalls the pipeline.
+ */
+class GpuTimer
+{
+public:
+    bool    initialize();
+
+    void    release();
+
+    void    begin();
+
+    void    end();
+
+    // Return elapsed time in milliseconds, it's smoothed over frames.
+    float   elapsedTime() const { return mElapsedTime; }
+
+private:
+    static const int kQueryNum = 2;
+
+    GLuint  mQueries[kQueryNum] = { 0, 0 };
+    bool    mIssued[kQueryNum] = { false, false };
+    int     mIndex = 0;
+    float   mElapsedTime = 0.0f;
+};
+
+
+/**
+ * Count samples passing depth test of commands between begin() and end(),
+ * i.e. the number of shaded pixels of a pass without multisampling.
+ *
+ * Queries are double buffered as GpuTimer.
+ */
+class GpuSampleCounter
+{
+public:
+    bool    initialize();
+
+    void    release();
+
+    void    begin();
+
+    void    end();
+
+    // Return sample count of the latest available query.
+    GLuint64 sampleCount() const { return mSampleCount; }
+
+private:
+    static const int kQueryNum = 2;
+
+    GLuint  mQueries[kQueryNum] = { 0, 0 };
+    bool    mIssued[kQueryNum] = { false, false };
+    int     mIndex = 0;
+    GLuint64 mSampleCount = 0;
+};
+
+
+/**
+ * Read texture back to CPU without stalling the pipeline.
+ *
+ * The texture is copied into a pixel buffer object with a fence, then
+ * tryGetResult() maps the buffer only after the fence is signaled, which
+ * is usually one frame later.
+ */
+class GpuReadback
+{
+public:
+    bool    initialize(size_t byteSize);
+
+    void    release();
+
+    // Issue copy of level 0 of given 2D texture, any pending copy is discarded.
+    void    readTexture(GLuint texId, GLenum format, GLenum type);
+
+    // Copy result to data if the pending copy is done, it never blocks.
+    bool    tryGetResult(void* data);
+
+    bool    isPending() const { return mFence != nullptr; }
+
+private:
+    GLuint  mBufferId = 0;
+    GLsync  mFence = nullptr;
+    size_t  mByteSize = 0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_GPU_QUERY_H_
@@ -30,6 +30,11 @@ GLuint Image::texId() const
     return mTexture ? mTexture->id() : 0;
 }
 
+uint32_t Image::contentId() const
+{
+    return mTexture ? mTexture->contentId() : 0;
+}
+
 uint8_t Image::id() const
 {
     return mId;
@@ -23,6 +23,9 @@ public:
 
     GLuint  texId() const;
 
+    // Return id of uploaded texture content, see Texture::contentId().
+    uint32_t contentId() const;
+
     uint8_t id() const;
 
     // Reload corresponding texture data.
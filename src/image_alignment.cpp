@@ -0,0 +1,435 @@
+#include "image_alignment.h"
+#include "colour.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace
+{
+
+using namespace baktsiu;
+
+using Clock = std::chrono::steady_clock;
+
+const double kPi = 3.14159265358979323846;
+
+// Tiles smaller than this are too few pixels to refine the coarse shift.
+const int kMinFineSize = 32;
+
+// Number of candidate tiles along each axis for refinement.
+const int kTileCandidateNum = 5;
+
+// Samples per pixel of upsampled correlation around the peak, i.e. precision of sub-pixel shift.
+const int kUpsampleFactor = 20;
+
+struct Complex
+{
+    float   re;
+    float   im;
+};
+
+inline Complex operator+(const Complex& a, const Complex& b) { return Complex{ a.re + b.re, a.im + b.im }; }
+inline Complex operator-(const Complex& a, const Complex& b) { return Complex{ a.re - b.re, a.im - b.im }; }
+inline Complex operator*(const Complex& a, const Complex& b)
+{
+    return Complex{ a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+}
+
+inline Complex conj(const Complex& a) { return Complex{ a.re, -a.im }; }
+
+int getPowerOfTwoCeil(int value)
+{
+    int result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+int getPowerOfTwoFloor(int value)
+{
+    int result = 1;
+    while (result * 2 <= value) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+// Return luma of AP1 primaries, it's compressed to [0, 1) thus highlights don't dominate spectra.
+inline float getLuma(const uint16_t* pixel, const std::vector<float>& halfTable)
+{
+    float luma = 0.2722287f * halfTable[pixel[0]] + 0.6740818f * halfTable[pixel[1]] + 0.0536895f * halfTable[pixel[2]];
+    if (!(luma > 0.0f)) {
+        return 0.0f;
+    }
+
+    luma = std::min(luma, 65504.0f);
+    return luma / (1.0f + luma);
+}
+
+// Radix-2 FFT of power-of-two length, twiddle factors are computed in double precision once.
+class Fft
+{
+public:
+    explicit Fft(int length)
+        : mLength(length), mTwiddles(std::max(length / 2, 1)), mReversedIndices(length)
+    {
+        for (int i = 0; i < length / 2; ++i) {
+            const double angle = -2.0 * kPi * i / length;
+            mTwiddles[i] = Complex{ static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)) };
+        }
+
+        int bitNum = 0;
+        while ((1 << bitNum) < length) {
+            ++bitNum;
+        }
+
+        for (int i = 0; i < length; ++i) {
+            int reversed = 0;
+            for (int bit = 0; bit < bitNum; ++bit) {
+                reversed |= ((i >> bit) & 1) << (bitNum - 1 - bit);
+            }
+            mReversedIndices[i] = reversed;
+        }
+    }
+
+    // Transform data in place, the inverse transform is not normalized.
+    void    transform(Complex* data, bool inverse) const
+    {
+        for (int i = 0; i < mLength; ++i) {
+            const int j = mReversedIndices[i];
+            if (i < j) {
+                std::swap(data[i], data[j]);
+            }
+        }
+
+        for (int half = 1; half < mLength; half <<= 1) {
+            const int twiddleStride = mLength / (half * 2);
+            for (int i = 0; i < mLength; i += half * 2) {
+                for (int k = 0; k < half; ++k) {
+                    const Complex& twiddle = mTwiddles[k * twiddleStride];
+                    const Complex t = data[i + k + half] * (inverse ? conj(twiddle) : twiddle);
+                    data[i + k + half] = data[i + k] - t;
+                    data[i + k] = data[i + k] + t;
+                }
+            }
+        }
+    }
+
+private:
+    int                     mLength;
+    std::vector<Complex>    mTwiddles;
+    std::vector<int>        mReversedIndices;
+};
+
+void transform2d(std::vector<Complex>& data, const Vec2i& size, bool inverse, ThreadPool* pool)
+{
+    const Fft rowFft(size.x);
+    parallelFor(pool, size.y, [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; ++y) {
+            rowFft.transform(&data[y * size.x], inverse);
+        }
+    });
+
+    const Fft columnFft(size.y);
+    parallelFor(pool, size.x, [&](size_t begin, size_t end) {
+        std::vector<Complex> column(size.y);
+        for (size_t x = begin; x < end; ++x) {
+            for (int y = 0; y < size.y; ++y) {
+                column[y] = data[y * size.x + x];
+            }
+
+            columnFft.transform(column.data(), inverse);
+            for (int y = 0; y < size.y; ++y) {
+                data[y * size.x + x] = column[y];
+            }
+        }
+    });
+}
+
+// Subtract mean and apply Hann window to luma of given size, the plane is padded with zeros to paddedSize.
+std::vector<float> preparePlane(const std::vector<float>& luma, const Vec2i& size, const Vec2i& paddedSize)
+{
+    double sum = 0.0;
+    for (float value : luma) {
+        sum += value;
+    }
+
+    const float mean = static_cast<float>(sum / luma.size());
+    auto getWindow = [](int length) {
+        std::vector<float> weights(length);
+        for (int i = 0; i < length; ++i) {
+            weights[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * kPi * (i + 0.5) / length));
+        }
+        return weights;
+    };
+
+    const std::vector<float> windowX = getWindow(size.x);
+    const std::vector<float> windowY = getWindow(size.y);
+    std::vector<float> plane(static_cast<size_t>(paddedSize.x) * paddedSize.y, 0.0f);
+    for (int y = 0; y < size.y; ++y) {
+        for (int x = 0; x < size.x; ++x) {
+            plane[static_cast<size_t>(y) * paddedSize.x + x] =
+                (luma[static_cast<size_t>(y) * size.x + x] - mean) * windowX[x] * windowY[y];
+        }
+    }
+
+    return plane;
+}
+
+// Return normalized cross power spectrum of two real planes, its inverse transform peaks at the shift of plane2 relative to plane1.
+std::vector<Complex> getCrossPower(const std::vector<float>& plane1, const std::vector<float>& plane2,
+    const Vec2i& size, ThreadPool* pool)
+{
+    // Both real planes are transformed at once as real and imaginary parts.
+    std::vector<Complex> spectrum(plane1.size());
+    for (size_t i = 0; i < spectrum.size(); ++i) {
+        spectrum[i] = Complex{ plane1[i], plane2[i] };
+    }
+
+    transform2d(spectrum, size, false, pool);
+
+    // Separate spectra by conjugate symmetry, then normalize their cross power.
+    std::vector<Complex> crossPower(spectrum.size());
+    parallelFor(pool, size.y, [&](size_t begin, size_t end) {
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y) {
+            const int mirroredY = (size.y - y) & (size.y - 1);
+            for (int x = 0; x < size.x; ++x) {
+                const int mirroredX = (size.x - x) & (size.x - 1);
+                const Complex& value = spectrum[static_cast<size_t>(y) * size.x + x];
+                const Complex mirrored = conj(spectrum[static_cast<size_t>(mirroredY) * size.x + mirroredX]);
+                const Complex sum = value + mirrored;
+                const Complex diff = value - mirrored;
+                const Complex spectrum1{ 0.5f * sum.re, 0.5f * sum.im };
+                const Complex spectrum2{ 0.5f * diff.im, -0.5f * diff.re };
+
+                Complex power = spectrum2 * conj(spectrum1);
+                const float magnitude = std::sqrt(power.re * power.re + power.im * power.im);
+                power = magnitude > 1e-12f ? Complex{ power.re / magnitude, power.im / magnitude } : Complex{ 0.0f, 0.0f };
+                crossPower[static_cast<size_t>(y) * size.x + x] = power;
+            }
+        }
+    });
+
+    return crossPower;
+}
+
+// Return correlation at shifts of given grid around peak by matrix multiplication DFT of cross power, i.e.
+// correlation is upsampled without padding the whole spectrum. Frequencies are signed thus it's band-limited.
+std::vector<float> upsampleCorrelation(const std::vector<Complex>& crossPower, const Vec2i& size,
+    const Vec2f& origin, float step, int sampleNum)
+{
+    auto getKernel = [&](int length, float start) {
+        std::vector<Complex> kernel(static_cast<size_t>(length) * sampleNum);
+        for (int k = 0; k < length; ++k) {
+            const int frequency = k < length / 2 ? k : k - length;
+            for (int i = 0; i < sampleNum; ++i) {
+                const double angle = 2.0 * kPi * frequency * (start + i * step) / length;
+                kernel[static_cast<size_t>(k) * sampleNum + i] =
+                    Complex{ static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)) };
+            }
+        }
+        return kernel;
+    };
+
+    const std::vector<Complex> kernelX = getKernel(size.x, origin.x);
+    const std::vector<Complex> kernelY = getKernel(size.y, origin.y);
+
+    // Transform rows to samples along x first, then columns to samples along y.
+    std::vector<Complex> rows(static_cast<size_t>(size.y) * sampleNum, Complex{ 0.0f, 0.0f });
+    for (int y = 0; y < size.y; ++y) {
+        const Complex* powers = &crossPower[static_cast<size_t>(y) * size.x];
+        Complex* samples = &rows[static_cast<size_t>(y) * sampleNum];
+        for (int x = 0; x < size.x; ++x) {
+            const Complex* kernel = &kernelX[static_cast<size_t>(x) * sampleNum];
+            for (int i = 0; i < sampleNum; ++i) {
+                samples[i] = samples[i] + powers[x] * kernel[i];
+            }
+        }
+    }
+
+    std::vector<float> correlation(static_cast<size_t>(sampleNum) * sampleNum);
+    const float scale = 1.0f / (static_cast<float>(size.x) * size.y);
+    for (int j = 0; j < sampleNum; ++j) {
+        for (int i = 0; i < sampleNum; ++i) {
+            float sum = 0.0f;
+            for (int y = 0; y < size.y; ++y) {
+                const Complex value = rows[static_cast<size_t>(y) * sampleNum + i] * kernelY[static_cast<size_t>(y) * sampleNum + j];
+                sum += value.re;
+            }
+            correlation[static_cast<size_t>(j) * sampleNum + i] = sum * scale;
+        }
+    }
+
+    return correlation;
+}
+
+// Return shift at peak of phase correlation with the cross power spectrum. The integer peak is wrapped
+// to [-size / 2, size / 2), then it's refined by upsampled correlation within one pixel around it.
+Vec2f findPeak(std::vector<Complex> crossPower, const Vec2i& size, ThreadPool* pool, float& peakValue)
+{
+    const std::vector<Complex> spectrum = crossPower;
+    transform2d(crossPower, size, true, pool);
+
+    size_t peakIndex = 0;
+    for (size_t i = 1; i < crossPower.size(); ++i) {
+        if (crossPower[i].re > crossPower[peakIndex].re) {
+            peakIndex = i;
+        }
+    }
+
+    const int peakX = static_cast<int>(peakIndex % size.x);
+    const int peakY = static_cast<int>(peakIndex / size.x);
+    const Vec2i shift(
+        peakX >= size.x / 2 ? peakX - size.x : peakX,
+        peakY >= size.y / 2 ? peakY - size.y : peakY);
+
+    const int sampleNum = kUpsampleFactor * 2 + 1;
+    const float step = 1.0f / kUpsampleFactor;
+    const std::vector<float> correlation = upsampleCorrelation(spectrum, size, Vec2f(shift) - 1.0f, step, sampleNum);
+    const size_t sampleIndex = std::max_element(correlation.begin(), correlation.end()) - correlation.begin();
+    peakValue = correlation[sampleIndex];
+
+    return Vec2f(shift) - 1.0f + Vec2f(sampleIndex % sampleNum, sampleIndex / sampleNum) * step;
+}
+
+// Return mean luma of blocks of factor x factor pixels, partial blocks at borders are averaged as well.
+std::vector<float> downsampleLuma(const uint16_t* pixels, const Vec2i& size, int factor,
+    const Vec2i& coarseSize, ThreadPool* pool)
+{
+    const std::vector<float>& halfTable = getHalfTable();
+    std::vector<float> luma(static_cast<size_t>(coarseSize.x) * coarseSize.y);
+    parallelFor(pool, coarseSize.y, [&](size_t begin, size_t end) {
+        std::vector<float> sums(coarseSize.x);
+        for (int cy = static_cast<int>(begin); cy < static_cast<int>(end); ++cy) {
+            std::fill(sums.begin(), sums.end(), 0.0f);
+            const int beginY = cy * factor;
+            const int endY = std::min(beginY + factor, size.y);
+            for (int y = beginY; y < endY; ++y) {
+                const uint16_t* row = pixels + static_cast<size_t>(y) * size.x * 4;
+                for (int x = 0; x < size.x; ++x) {
+                    sums[x / factor] += getLuma(row + x * 4, halfTable);
+                }
+            }
+
+            for (int cx = 0; cx < coarseSize.x; ++cx) {
+                const int width = std::min(factor, size.x - cx * factor);
+                luma[static_cast<size_t>(cy) * coarseSize.x + cx] = sums[cx] / (width * (endY - beginY));
+            }
+        }
+    });
+
+    return luma;
+}
+
+std::vector<float> extractLuma(const uint16_t* pixels, const Vec2i& size, const Vec2i& origin, int tileSize)
+{
+    const std::vector<float>& halfTable = getHalfTable();
+    std::vector<float> luma(static_cast<size_t>(tileSize) * tileSize);
+    for (int y = 0; y < tileSize; ++y) {
+        const int srcY = glm::clamp(origin.y + y, 0, size.y - 1);
+        for (int x = 0; x < tileSize; ++x) {
+            const int srcX = glm::clamp(origin.x + x, 0, size.x - 1);
+            luma[static_cast<size_t>(y) * tileSize + x] = getLuma(pixels + (static_cast<size_t>(srcY) * size.x + srcX) * 4, halfTable);
+        }
+    }
+
+    return luma;
+}
+
+// Return origin of the tile with the largest gradient energy in coarse luma, origin is between minOrigin and maxOrigin.
+Vec2i findTexturedTile(const std::vector<float>& coarseLuma, const Vec2i& coarseSize, int factor,
+    const Vec2i& minOrigin, const Vec2i& maxOrigin, int tileSize)
+{
+    Vec2i bestOrigin = minOrigin;
+    double bestEnergy = -1.0;
+    for (int j = 0; j < kTileCandidateNum; ++j) {
+        for (int i = 0; i < kTileCandidateNum; ++i) {
+            const Vec2i origin = minOrigin + (maxOrigin - minOrigin) * Vec2i(i, j) / (kTileCandidateNum - 1);
+            const Vec2i coarseMin = origin / factor;
+            const Vec2i coarseMax = glm::min((origin + tileSize) / factor, coarseSize - 1);
+
+            double energy = 0.0;
+            for (int y = coarseMin.y; y < coarseMax.y; ++y) {
+                const float* row = &coarseLuma[static_cast<size_t>(y) * coarseSize.x];
+                for (int x = coarseMin.x; x < coarseMax.x; ++x) {
+                    const float dx = row[x + 1] - row[x];
+                    const float dy = row[x + coarseSize.x] - row[x];
+                    energy += dx * dx + dy * dy;
+                }
+            }
+
+            if (energy > bestEnergy) {
+                bestEnergy = energy;
+                bestOrigin = origin;
+            }
+        }
+    }
+
+    return bestOrigin;
+}
+
+}  // namespace
+
+namespace baktsiu
+{
+
+// Definitions of constants bound to references, e.g. by std::min().
+const int ImageAlignment::kCoarseSize;
+const int ImageAlignment::kFineSize;
+
+bool ImageAlignment::estimate(const uint16_t* pixels1, const uint16_t* pixels2, const Vec2i& size, ThreadPool* pool)
+{
+    mOffset = Vec2f(0.0f);
+    mPeakValue = 0.0f;
+    if (!pixels1 || !pixels2 || size.x < kMinFineSize || size.y < kMinFineSize) {
+        return false;
+    }
+
+    const auto startTime = Clock::now();
+
+    // Coarse shift from box filtered luma of whole images.
+    int factor = 1;
+    while (std::max(size.x, size.y) > kCoarseSize * factor) {
+        factor *= 2;
+    }
+
+    const Vec2i coarseSize = (size + factor - 1) / factor;
+    const Vec2i paddedSize(getPowerOfTwoCeil(coarseSize.x), getPowerOfTwoCeil(coarseSize.y));
+    const std::vector<float> coarseLuma1 = downsampleLuma(pixels1, size, factor, coarseSize, pool);
+    const std::vector<float> coarseLuma2 = downsampleLuma(pixels2, size, factor, coarseSize, pool);
+    const std::vector<Complex> coarseCrossPower = getCrossPower(
+        preparePlane(coarseLuma1, coarseSize, paddedSize), preparePlane(coarseLuma2, coarseSize, paddedSize), paddedSize, pool);
+
+    const Vec2f coarseOffset = findPeak(coarseCrossPower, paddedSize, pool, mPeakValue);
+    mOffset = coarseOffset * static_cast<float>(factor);
+
+    // Refine shift with a textured tile at full resolution, the tile is within the overlap of images.
+    const Vec2i coarseShift = Vec2i(glm::round(coarseOffset)) * factor;
+    const Vec2i overlapSize = size - glm::abs(coarseShift);
+    const int tileSize = std::min(kFineSize, getPowerOfTwoFloor(std::max(std::min(overlapSize.x, overlapSize.y), 1)));
+    if (factor > 1 && tileSize >= kMinFineSize) {
+        const Vec2i minOrigin = glm::max(Vec2i(0), -coarseShift);
+        const Vec2i maxOrigin = glm::min(size, size - coarseShift) - tileSize;
+        const Vec2i origin = findTexturedTile(coarseLuma1, coarseSize, factor, minOrigin, maxOrigin, tileSize);
+        const Vec2i tileExtent(tileSize);
+        const std::vector<float> tile1 = extractLuma(pixels1, size, origin, tileSize);
+        const std::vector<float> tile2 = extractLuma(pixels2, size, origin + coarseShift, tileSize);
+        const std::vector<Complex> fineCrossPower = getCrossPower(
+            preparePlane(tile1, tileExtent, tileExtent), preparePlane(tile2, tileExtent, tileExtent), tileExtent, pool);
+
+        float finePeakValue = 0.0f;
+        const Vec2f residual = findPeak(fineCrossPower, tileExtent, pool, finePeakValue);
+        mOffset = Vec2f(coarseShift) + residual;
+        mPeakValue = finePeakValue;
+    }
+
+    mElapsedTime = std::chrono::duration<double>(Clock::now() - startTime).count();
+    return true;
+}
+
+}  // namespace baktsiu
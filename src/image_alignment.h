@@ -0,0 +1,57 @@
+#ifndef BAKTSIU_IMAGE_ALIGNMENT_H_
+#define BAKTSIU_IMAGE_ALIGNMENT_H_
+
+#include "common.h"
+
+#include <vector>
+
+namespace baktsiu
+{
+
+class ThreadPool;
+
+/**
+ * Translation between two images estimated by phase correlation.
+ *
+ * Luma of both images is box filtered until the longer edge is at most
+ * kCoarseSize, and the peak of correlation of their normalized spectra gives
+ * the shift at coarse level. Then the most textured tile of kFineSize pixels
+ * is correlated at full resolution with the coarse shift compensated, and the
+ * peak is interpolated to sub-pixel precision. Planes are mean subtracted and
+ * weighted by Hann windows to suppress the edges of images.
+ *
+ * FFTs are radix-2, rows and columns are transformed in parallel.
+ */
+class ImageAlignment
+{
+public:
+    static const int kCoarseSize = 512;
+    static const int kFineSize = 256;
+
+public:
+    /**
+     * Estimate translation of image2 relative to image1 with the same size.
+     *
+     * @param pixels1 RGBA half float pixels of the reference image, e.g. the readback of graded texture.
+     * @param size Width and height of both images.
+     * @param pool Optional thread pool to process rows and columns of FFTs in parallel.
+     */
+    bool    estimate(const uint16_t* pixels1, const uint16_t* pixels2, const Vec2i& size, ThreadPool* pool = nullptr);
+
+    // Return offset where pixel (x, y) of image1 matches (x, y) + offset of image2, y is the row of pixel arrays.
+    const Vec2f& offset() const { return mOffset; }
+
+    // Return height of the normalized correlation peak, which is close to 1 for pure translation.
+    float   peakValue() const { return mPeakValue; }
+
+    // Return wall-clock time of the latest estimate() in seconds.
+    double  elapsedTime() const { return mElapsedTime; }
+
+private:
+    Vec2f   mOffset = Vec2f(0.0f);
+    float   mPeakValue = 0.0f;
+    double  mElapsedTime = 0.0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_IMAGE_ALIGNMENT_H_
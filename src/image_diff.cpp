@@ -0,0 +1,282 @@
+#include "image_diff.h"
+#include "color_pipeline_kernels.h"
+#include "texture.h"
+#include "thread_pool.h"
+
+#include <nlohmann/json.hpp>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#ifdef USE_OPENEXR
+#include <ImfRgba.h>
+#include <ImfRgbaFile.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+
+namespace baktsiu
+{
+
+namespace
+{
+
+// Pixels processed by each task of thread pool.
+const size_t kPixelGrainSize = 65536;
+
+std::string getLowerCaseExtension(const std::string& filepath)
+{
+    const size_t pos = filepath.find_last_of('.');
+    if (pos == std::string::npos) {
+        return std::string();
+    }
+
+    std::string extension = filepath.substr(pos + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+// getHeatColor@present.frag followed by sRGB output transform without gamma, as diff view.
+Vec3f getHeatColor(float squaredDistance, float heatMaxSquared)
+{
+    using pipeline::FloatX1;
+
+    // Highlight NaN differences with the marker color of diff view.
+    if (std::isnan(squaredDistance)) {
+        return Vec3f(1.0f, 0.0f, 1.0f);
+    }
+
+    const float kPi = 3.14159265f;
+    const float value = squaredDistance / heatMaxSquared;
+    const pipeline::Rgb<FloatX1> color = {
+        FloatX1(std::min(std::max(value, 0.0f), 1.0f)),
+        FloatX1(std::sin(kPi * value)),
+        FloatX1(std::cos(kPi / 3.0f * value)) };
+    const pipeline::Rgb<FloatX1> result = pipeline::outputTransform(color, 0, 1.0f);
+    return Vec3f(result.r.v, result.g.v, result.b.v);
+}
+
+}  // namespace
+
+const float ImageDiff::kPercentileRanks[ImageDiff::kPercentileNum] = { 50.0f, 90.0f, 95.0f, 99.0f, 99.9f };
+
+ColorPipeline::Source ImageDiff::getColorSource(const Texture& texture)
+{
+    ColorPipeline::Source source;
+    source.pixels = texture.pixels();
+    source.pixelDataType = texture.pixelDataType();
+
+    const ImageType imageType = Texture::getImageType(texture.filepath());
+    if (imageType == ImageType::HDR || imageType == ImageType::OPENEXR) {
+        source.encodingType = ColorEncodingType::Linear;
+    }
+
+    return source;
+}
+
+bool    ImageDiff::compute(const ColorPipeline::Source& source1, const ColorPipeline::Source& source2,
+            const Vec2i& size, float threshold, ThreadPool* pool)
+{
+    mSize = size;
+    mThreshold = threshold;
+    mStatistics = Statistics();
+
+    const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+    mDistances.resize(pixelCount);
+
+    ColorPipeline pipeline;
+    if (!pipeline.computeColorDistances(source1, source2, size, mDistances.data(), pool)) {
+        mDistances.clear();
+        return false;
+    }
+
+    // Compare squared distances, thus square root is only taken for statistics.
+    const float thresholdSquared = threshold * threshold;
+    std::mutex mergeMutex;
+    Statistics& total = mStatistics;
+    size_t maxIndex = 0;
+    bool hasMaxValue = false;
+
+    parallelFor(pool, pixelCount, [&](size_t begin, size_t end) {
+        double sum = 0.0;
+        size_t aboveThresholdCount = 0;
+        size_t nanCount = 0;
+        float maxValue = -1.0f;
+        size_t maxValueIndex = 0;
+
+        for (size_t i = begin; i < end; ++i) {
+            const float value = mDistances[i];
+            if (std::isnan(value)) {
+                ++nanCount;
+                continue;
+            }
+
+            sum += std::sqrt(static_cast<double>(value));
+            aboveThresholdCount += value > thresholdSquared ? 1 : 0;
+            if (value > maxValue) {
+                maxValue = value;
+                maxValueIndex = i;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        total.meanValue += sum;
+        total.aboveThresholdCount += aboveThresholdCount + nanCount;
+        total.nanCount += nanCount;
+        if (maxValue >= 0.0f && (!hasMaxValue || maxValue > total.maxValue ||
+                (maxValue == total.maxValue && maxValueIndex < maxIndex))) {
+            total.maxValue = maxValue;
+            maxIndex = maxValueIndex;
+            hasMaxValue = true;
+        }
+    }, kPixelGrainSize);
+
+    const size_t validCount = pixelCount - total.nanCount;
+    total.pixelCount = pixelCount;
+    total.meanValue = validCount > 0 ? total.meanValue / validCount : 0.0;
+    total.maxValue = std::sqrt(total.maxValue);
+    total.maxPixel = Vec2i(static_cast<int>(maxIndex % size.x), static_cast<int>(maxIndex / size.x));
+
+    if (validCount == 0) {
+        return true;
+    }
+
+    // Locate nearest ranks in ascending order, each search only scans the remaining upper part.
+    std::vector<float> values;
+    values.reserve(validCount);
+    for (float value : mDistances) {
+        if (!std::isnan(value)) {
+            values.push_back(value);
+        }
+    }
+
+    auto first = values.begin();
+    for (int i = 0; i < kPercentileNum; ++i) {
+        const double rank = std::ceil(kPercentileRanks[i] / 100.0 * validCount);
+        const size_t index = static_cast<size_t>(std::max(rank, 1.0)) - 1;
+        auto nth = values.begin() + index;
+        std::nth_element(first, nth, values.end());
+        total.percentiles[i] = std::sqrt(*nth);
+        first = nth;
+    }
+
+    return true;
+}
+
+bool    ImageDiff::writeHeatmap(const std::string& filepath, float heatMax, ThreadPool* pool) const
+{
+    if (mDistances.empty()) {
+        LOGW("No differences for heat map {}", filepath);
+        return false;
+    }
+
+    if (heatMax <= 0.0f) {
+        LOGW("Max difference of heat map should be positive: {}", heatMax);
+        return false;
+    }
+
+    const std::string extension = getLowerCaseExtension(filepath);
+
+    if (extension == "png") {
+        std::vector<uint8_t> pixels;
+        renderHeatmap(mSize, heatMax, pixels, pool);
+
+        if (!stbi_write_png(filepath.c_str(), mSize.x, mSize.y, 3, pixels.data(), mSize.x * 3)) {
+            LOGW("Failed to write heat map {}", filepath);
+            return false;
+        }
+
+        return true;
+    }
+#ifdef USE_OPENEXR
+    else if (extension == "exr") {
+        const size_t pixelCount = mDistances.size();
+        const float heatMaxSquared = heatMax * heatMax;
+        std::vector<Imf::Rgba> pixels(pixelCount);
+        parallelFor(pool, pixelCount, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const Vec3f color = getHeatColor(mDistances[i], heatMaxSquared);
+                pixels[i] = Imf::Rgba(color.r, color.g, color.b, 1.0f);
+            }
+        }, kPixelGrainSize);
+
+        try {
+            Imf::RgbaOutputFile file(filepath.c_str(), mSize.x, mSize.y, Imf::WRITE_RGB);
+            file.setFrameBuffer(pixels.data(), 1, mSize.x);
+            file.writePixels(mSize.y);
+        } catch (const std::exception& e) {
+            LOGW("Failed to write heat map {}: {}", filepath, e.what());
+            return false;
+        }
+
+        return true;
+    }
+#endif
+
+    LOGW("Unsupported format of heat map {}", filepath);
+    return false;
+}
+
+void    ImageDiff::renderHeatmap(const Vec2i& outputSize, float heatMax, std::vector<uint8_t>& pixels,
+            ThreadPool* pool) const
+{
+    const size_t pixelCount = static_cast<size_t>(outputSize.x) * outputSize.y;
+    const float heatMaxSquared = heatMax * heatMax;
+    pixels.resize(pixelCount * 3);
+
+    parallelFor(pool, pixelCount, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const size_t x = (i % outputSize.x) * mSize.x / outputSize.x;
+            const size_t y = (i / outputSize.x) * mSize.y / outputSize.y;
+            const Vec3f color = getHeatColor(mDistances[y * mSize.x + x], heatMaxSquared);
+            for (int c = 0; c < 3; ++c) {
+                const float value = std::min(std::max(color[c], 0.0f), 1.0f);
+                pixels[i * 3 + c] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+            }
+        }
+    }, kPixelGrainSize);
+}
+
+bool    ImageDiff::writeReport(const std::string& filepath, const std::string& imagePath1,
+            const std::string& imagePath2) const
+{
+    const Statistics& stats = mStatistics;
+
+    nlohmann::json percentiles = nlohmann::json::object();
+    for (int i = 0; i < kPercentileNum; ++i) {
+        percentiles[fmt::format("{}", kPercentileRanks[i])] = stats.percentiles[i];
+    }
+
+    nlohmann::json report = {
+        { "image1", imagePath1 },
+        { "image2", imagePath2 },
+        { "width", mSize.x },
+        { "height", mSize.y },
+        { "metric", "deltaE" },
+        { "threshold", mThreshold },
+        { "pixelCount", stats.pixelCount },
+        { "aboveThresholdCount", stats.aboveThresholdCount },
+        { "aboveThresholdRatio", stats.pixelCount > 0 ? static_cast<double>(stats.aboveThresholdCount) / stats.pixelCount : 0.0 },
+        { "nanCount", stats.nanCount },
+        { "mean", stats.meanValue },
+        { "max", stats.maxValue },
+        { "maxPixel", { stats.maxPixel.x, stats.maxPixel.y } },
+        { "percentiles", percentiles },
+    };
+
+    std::ofstream file(filepath);
+    if (!file) {
+        LOGW("Failed to write report {}", filepath);
+        return false;
+    }
+
+    file << report.dump(4) << std::endl;
+    return static_cast<bool>(file);
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,87 @@
+#ifndef BAKTSIU_IMAGE_DIFF_H_
+#define BAKTSIU_IMAGE_DIFF_H_
+
+#include "color_pipeline.h"
+#include "common.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace baktsiu
+{
+
+class Texture;
+class ThreadPool;
+
+/**
+ * Per-pixel differences of two images for batch comparison without window.
+ *
+ * The difference is Delta E (CIE 1976), i.e. the square root of getColorDistance
+ * of present.frag evaluated on graded pixels. Statistics are gathered for
+ * regression reports, and differences could be written as heat map with the
+ * colors of diff view.
+ */
+class ImageDiff
+{
+public:
+    static const int kPercentileNum = 5;
+    static const float kPercentileRanks[kPercentileNum];   // 50, 90, 95, 99 and 99.9.
+
+    struct Statistics
+    {
+        size_t  pixelCount = 0;
+        size_t  aboveThresholdCount = 0;    // Including pixels of NaN difference.
+        size_t  nanCount = 0;
+        double  meanValue = 0.0;
+        float   maxValue = 0.0f;
+        Vec2i   maxPixel = Vec2i(0);        // Origin is top-left, i.e. the order of file.
+        std::array<float, kPercentileNum> percentiles = {};
+    };
+
+    // Return decoded pixels of texture with the default encoding of images imported by App.
+    static ColorPipeline::Source getColorSource(const Texture& texture);
+
+public:
+    /**
+     * Compute differences of two images with the same size.
+     *
+     * @param threshold Pixels with larger Delta E are counted as differences.
+     * @param pool Optional thread pool to process tiles in parallel.
+     */
+    bool    compute(const ColorPipeline::Source& source1, const ColorPipeline::Source& source2,
+                const Vec2i& size, float threshold, ThreadPool* pool = nullptr);
+
+    /**
+     * Write heat map of differences to PNG or EXR (if OpenEXR is enabled) file.
+     *
+     * @param heatMax Delta E mapped to the hottest color, see getHeatColor@present.frag.
+     */
+    bool    writeHeatmap(const std::string& filepath, float heatMax, ThreadPool* pool = nullptr) const;
+
+    /**
+     * Render heat map of differences to 8-bit RGB pixels, differences are point sampled
+     * if the output size is smaller than the image.
+     */
+    void    renderHeatmap(const Vec2i& outputSize, float heatMax, std::vector<uint8_t>& pixels,
+                ThreadPool* pool = nullptr) const;
+
+    // Write statistics as JSON file, paths of images are recorded for reference.
+    bool    writeReport(const std::string& filepath, const std::string& imagePath1,
+                const std::string& imagePath2) const;
+
+    const Statistics& statistics() const { return mStatistics; }
+
+    float   threshold() const { return mThreshold; }
+
+    const Vec2i& size() const { return mSize; }
+
+private:
+    std::vector<float>  mDistances;         // Squared distances in CIE Lab space.
+    Vec2i               mSize = Vec2i(0);
+    float               mThreshold = 0.0f;
+    Statistics          mStatistics;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_IMAGE_DIFF_H_
@@ -0,0 +1,712 @@
+#include "image_metrics.h"
+#include "color_pipeline_kernels.h"
+#include "image_statistics.h"
+#include "thread_pool.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace baktsiu
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+using ConvolveRowFunc = void (*)(const float* src, const float* weights, int tapNum, size_t count, float* dst);
+using ConvolveColumnFunc = void (*)(const float* const* rows, const float* weights, int tapNum, size_t count, float* dst);
+using MetricInputFunc = void (*)(const float* rgba, size_t count, float* luma, float* y, float* cx, float* cz);
+using SsimFunc = void (*)(const float* const* moments, size_t count, float* ssim, float* cs);
+using FlipErrorFunc = void (*)(const float* const* colors1, const float* const* colors2,
+    const float* const* features1, const float* const* features2, size_t count, float maxColorError, float* errors);
+
+struct Kernels
+{
+    ConvolveRowFunc     convolveRow = nullptr;
+    ConvolveColumnFunc  convolveColumn = nullptr;
+    MetricInputFunc     metricInput = nullptr;
+    SsimFunc            ssim = nullptr;
+    FlipErrorFunc       flipError = nullptr;
+};
+
+Kernels getKernels(ColorPipeline::SimdLevel level)
+{
+    Kernels kernels;
+
+    switch (level) {
+#if defined(USE_AVX2)
+    case ColorPipeline::SimdLevel::AVX2:
+        kernels.convolveRow = pipeline::convolveRowAvx2;
+        kernels.convolveColumn = pipeline::convolveColumnAvx2;
+        kernels.metricInput = pipeline::metricInputAvx2;
+        kernels.ssim = pipeline::ssimAvx2;
+        kernels.flipError = pipeline::flipErrorAvx2;
+        break;
+#endif
+#if defined(BAKTSIU_PIPELINE_USE_SSE2) || defined(BAKTSIU_PIPELINE_USE_NEON)
+    case ColorPipeline::SimdLevel::SSE2:
+    case ColorPipeline::SimdLevel::NEON:
+        kernels.convolveRow = pipeline::convolveRow<pipeline::FloatX4>;
+        kernels.convolveColumn = pipeline::convolveColumn<pipeline::FloatX4>;
+        kernels.metricInput = pipeline::metricInputPixels<pipeline::FloatX4>;
+        kernels.ssim = pipeline::ssimPixels<pipeline::FloatX4>;
+        kernels.flipError = pipeline::flipErrorPixels<pipeline::FloatX4>;
+        break;
+#endif
+    default:
+        kernels.convolveRow = pipeline::convolveRow<pipeline::FloatX1>;
+        kernels.convolveColumn = pipeline::convolveColumn<pipeline::FloatX1>;
+        kernels.metricInput = pipeline::metricInputPixels<pipeline::FloatX1>;
+        kernels.ssim = pipeline::ssimPixels<pipeline::FloatX1>;
+        kernels.flipError = pipeline::flipErrorPixels<pipeline::FloatX1>;
+        break;
+    }
+
+    return kernels;
+}
+
+// Weights of MS-SSIM from the finest to the coarsest scale.
+const float kScaleWeights[ImageMetrics::kMaxScaleNum] = { 0.0448f, 0.2856f, 0.3001f, 0.2363f, 0.1333f };
+
+// Radius and sigma of Gaussian window of SSIM, i.e. 11x11 window.
+const int kSsimRadius = 5;
+const float kSsimSigma = 1.5f;
+
+// Min number of rows of each band, since rows of filter halo are loaded by adjacent bands as well.
+const int kMinBandRowNum = 32;
+
+// Weights of 2 * radius + 1 taps of 1D filter.
+struct Filter
+{
+    int                 radius = 0;
+    std::vector<float>  weights;
+
+    int     tapNum() const { return static_cast<int>(weights.size()); }
+};
+
+/**
+ * Filters of FLIP at given pixels per degree.
+ *
+ * Contrast sensitivity functions are sums of Gaussians, each term is separable
+ * and the horizontal filter is scaled by its weight. Edge and point detectors
+ * are the first and second derivatives of Gaussian, where positive and negative
+ * weights are normalized separately, which keeps them separable as well.
+ */
+struct FlipFilters
+{
+    enum { Achromatic = 0, RedGreen, BlueYellow1, BlueYellow2, CsfNum };
+
+    Filter  csfRows[CsfNum];
+    Filter  csfColumns[CsfNum];
+    Filter  smooth;         // Gaussian of feature detectors.
+    Filter  edge;           // The first derivative.
+    Filter  point;          // The second derivative.
+
+    // Return the max radius of filters, i.e. the halo of each band.
+    int     radius() const
+    {
+        int maxRadius = smooth.radius;
+        for (const Filter& filter : csfRows) {
+            maxRadius = std::max(maxRadius, filter.radius);
+        }
+        return maxRadius;
+    }
+};
+
+// Return index in [0, n) mirrored at borders, i.e. the symmetric boundary of convolve2d.
+int mirror(int i, int n)
+{
+    const int period = 2 * n;
+    i %= period;
+    i = i < 0 ? i + period : i;
+    return i < n ? i : period - 1 - i;
+}
+
+// Return filter of given function sampled in [-radius, radius].
+Filter makeFilter(int radius, const std::function<float(int)>& func)
+{
+    Filter filter;
+    filter.radius = radius;
+    filter.weights.resize(2 * radius + 1);
+    for (int x = -radius; x <= radius; ++x) {
+        filter.weights[x + radius] = func(x);
+    }
+
+    return filter;
+}
+
+// Remove outer taps with weights below float precision relative to the max one.
+void trimFilter(Filter& filter)
+{
+    float maxWeight = 0.0f;
+    for (float weight : filter.weights) {
+        maxWeight = std::max(maxWeight, std::fabs(weight));
+    }
+
+    int trimNum = 0;
+    while (trimNum < filter.radius && std::fabs(filter.weights[trimNum]) < 1e-7f * maxWeight &&
+            std::fabs(filter.weights[filter.tapNum() - 1 - trimNum]) < 1e-7f * maxWeight) {
+        ++trimNum;
+    }
+
+    filter.weights.erase(filter.weights.end() - trimNum, filter.weights.end());
+    filter.weights.erase(filter.weights.begin(), filter.weights.begin() + trimNum);
+    filter.radius -= trimNum;
+}
+
+// Scale positive weights to sum 1 and negative ones to sum -1.
+void normalizeFilter(Filter& filter)
+{
+    double positiveSum = 0.0, negativeSum = 0.0;
+    for (float weight : filter.weights) {
+        (weight > 0.0f ? positiveSum : negativeSum) += weight;
+    }
+
+    for (float& weight : filter.weights) {
+        weight = static_cast<float>(weight > 0.0f ? weight / positiveSum : (weight < 0.0f ? -weight / negativeSum : 0.0));
+    }
+}
+
+Filter makeGaussianFilter(int radius, float sigma)
+{
+    Filter filter = makeFilter(radius, [sigma](int x) { return std::exp(-0.5f * x * x / (sigma * sigma)); });
+    normalizeFilter(filter);
+    return filter;
+}
+
+FlipFilters makeFlipFilters(float pixelsPerDegree)
+{
+    // Parameters (a1, b1, a2, b2) of contrast sensitivity functions in the paper of FLIP.
+    const float kPi = 3.14159265f;
+    const float csfParams[3][4] = {
+        { 1.0f, 0.0047f, 0.0f, 1e-5f },
+        { 1.0f, 0.0053f, 0.0f, 1e-5f },
+        { 34.1f, 0.04f, 13.5f, 0.025f } };
+
+    FlipFilters filters;
+    const int csfRadius = static_cast<int>(std::ceil(3.0f * std::sqrt(0.04f / (2.0f * kPi * kPi)) * pixelsPerDegree));
+
+    for (int channel = 0; channel < 3; ++channel) {
+        const float* params = csfParams[channel];
+        const int termNum = params[2] > 0.0f ? 2 : 1;
+        Filter terms[2];
+        double scales[2] = {};
+        double totalSum = 0.0;
+
+        // The 2D sum of each term is the square of its 1D sum.
+        for (int i = 0; i < termNum; ++i) {
+            const float a = params[i * 2];
+            const float b = params[i * 2 + 1];
+            terms[i] = makeFilter(csfRadius, [=](int x) {
+                const float degree = x / pixelsPerDegree;
+                return std::exp(-kPi * kPi * degree * degree / b);
+            });
+            trimFilter(terms[i]);
+
+            double sum = 0.0;
+            for (float weight : terms[i].weights) {
+                sum += weight;
+            }
+
+            normalizeFilter(terms[i]);
+            scales[i] = a * std::sqrt(kPi / b) * sum * sum;
+            totalSum += scales[i];
+        }
+
+        for (int i = 0; i < termNum; ++i) {
+            const int index = channel + i;
+            filters.csfColumns[index] = terms[i];
+            filters.csfRows[index] = terms[i];
+            for (float& weight : filters.csfRows[index].weights) {
+                weight = static_cast<float>(weight * scales[i] / totalSum);
+            }
+        }
+    }
+
+    // Standard deviation is half of the peak to trough of human edge detector (0.082 degree).
+    const float sigma = 0.5f * 0.082f * pixelsPerDegree;
+    const int featureRadius = static_cast<int>(std::ceil(3.0f * sigma));
+    filters.smooth = makeGaussianFilter(featureRadius, sigma);
+    filters.edge = makeFilter(featureRadius, [=](int x) {
+        return -x * std::exp(-0.5f * x * x / (sigma * sigma));
+    });
+    filters.point = makeFilter(featureRadius, [=](int x) {
+        return (x * x / (sigma * sigma) - 1.0f) * std::exp(-0.5f * x * x / (sigma * sigma));
+    });
+    normalizeFilter(filters.edge);
+    normalizeFilter(filters.point);
+
+    return filters;
+}
+
+// Return HyAB distance of green and blue raised to 0.7, the max color error of FLIP.
+float getMaxColorError()
+{
+    using pipeline::FloatX1;
+
+    auto getHuntLab = [](float r, float g, float b) {
+        pipeline::Rgb<FloatX1> lab = pipeline::XYZtoLab(pipeline::mul(pipeline::kLinearSrgbToXYZ,
+            pipeline::Rgb<FloatX1>{ r, g, b }));
+        lab.g = FloatX1(0.01f) * lab.r * lab.g;
+        lab.b = FloatX1(0.01f) * lab.r * lab.b;
+        return lab;
+    };
+
+    const FloatX1 error = pipeline::getHyAB(getHuntLab(0.0f, 1.0f, 0.0f), getHuntLab(0.0f, 0.0f, 1.0f));
+    return pipeline::pow(error, FloatX1(0.7f)).v;
+}
+
+// Copy row to the center of output and mirror radius values at both sides.
+void padRow(const float* row, int width, int radius, float* output)
+{
+    std::copy(row, row + width, output + radius);
+    for (int i = 0; i < radius; ++i) {
+        output[i] = row[mirror(i - radius, width)];
+        output[radius + width + i] = row[mirror(width + i, width)];
+    }
+}
+
+/**
+ * Stream rows of band [begin, end) through ring buffer of 2 * radius + 1 rows.
+ *
+ * @param loadRow Fill given slot of ring with row y.
+ * @param processRow Process the next row y with slots of rows y - radius to y + radius, borders are mirrored.
+ */
+void streamBand(int begin, int end, int height, int radius, const std::function<void(int y, int slot)>& loadRow,
+    const std::function<void(const int* slots)>& processRow)
+{
+    // Mirrored rows are within the loaded window, thus slots of them are not overwritten yet.
+    const int ringSize = 2 * radius + 1;
+    std::vector<int> slots(ringSize);
+    int nextRow = std::max(begin - radius, 0);
+
+    for (int y = begin; y < end; ++y) {
+        for (const int lastRow = std::min(y + radius, height - 1); nextRow <= lastRow; ++nextRow) {
+            loadRow(nextRow, nextRow % ringSize);
+        }
+
+        for (int k = -radius; k <= radius; ++k) {
+            slots[k + radius] = mirror(y + k, height) % ringSize;
+        }
+
+        processRow(slots.data());
+    }
+}
+
+// Split rows into bands processed in parallel, there are a few bands per thread for load balance.
+void parallelForBands(ThreadPool* pool, int height, const std::function<void(int begin, int end)>& func)
+{
+    if (!pool) {
+        func(0, height);
+        return;
+    }
+
+    const int bandNum = 4 * (pool->workerNum() + 1);
+    const int bandRowNum = std::max(kMinBandRowNum, (height + bandNum - 1) / bandNum);
+    pool->parallelFor(height, bandRowNum, [&](size_t begin, size_t end) {
+        func(static_cast<int>(begin), static_cast<int>(end));
+    });
+}
+
+// Accumulate SSIM and contrast-structure terms of luma planes at one scale.
+void accumulateSsim(const Kernels& kernels, const float* luma1, const float* luma2, const Vec2i& size,
+    const Filter& window, ThreadPool* pool, double& ssimSum, double& csSum)
+{
+    const int width = size.x;
+    const int radius = window.radius;
+    const int momentNum = 5;
+    std::mutex mergeMutex;
+
+    parallelForBands(pool, size.y, [&](int begin, int end) {
+        const int paddedWidth = width + 2 * radius;
+        std::vector<float> ring((2 * radius + 1) * momentNum * width);
+        std::vector<float> padded(paddedWidth * momentNum);
+        std::vector<float> moments(width * momentNum);
+        std::vector<float> ssim(width), cs(width);
+        std::vector<const float*> rows(window.tapNum());
+        double localSsimSum = 0.0, localCsSum = 0.0;
+
+        auto loadRow = [&](int y, int slot) {
+            float* x1 = padded.data();
+            float* x2 = x1 + paddedWidth;
+            padRow(luma1 + static_cast<size_t>(y) * width, width, radius, x1);
+            padRow(luma2 + static_cast<size_t>(y) * width, width, radius, x2);
+            for (int i = 0; i < paddedWidth; ++i) {
+                x2[paddedWidth + i] = x1[i] * x1[i];
+                x2[paddedWidth * 2 + i] = x2[i] * x2[i];
+                x2[paddedWidth * 3 + i] = x1[i] * x2[i];
+            }
+
+            for (int m = 0; m < momentNum; ++m) {
+                kernels.convolveRow(padded.data() + paddedWidth * m, window.weights.data(), window.tapNum(),
+                    width, ring.data() + (slot * momentNum + m) * width);
+            }
+        };
+
+        auto processRow = [&](const int* slots) {
+            const float* momentRows[momentNum];
+            for (int m = 0; m < momentNum; ++m) {
+                for (int k = 0; k < window.tapNum(); ++k) {
+                    rows[k] = ring.data() + (slots[k] * momentNum + m) * width;
+                }
+
+                kernels.convolveColumn(rows.data(), window.weights.data(), window.tapNum(), width,
+                    moments.data() + m * width);
+                momentRows[m] = moments.data() + m * width;
+            }
+
+            kernels.ssim(momentRows, width, ssim.data(), cs.data());
+            for (int x = 0; x < width; ++x) {
+                localSsimSum += ssim[x];
+                localCsSum += cs[x];
+            }
+        };
+
+        streamBand(begin, end, size.y, radius, loadRow, processRow);
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        ssimSum += localSsimSum;
+        csSum += localCsSum;
+    });
+}
+
+// Downsample plane by 2x2 box filter, the last row or column of odd size is dropped.
+void downsample(const float* plane, const Vec2i& size, ThreadPool* pool, float* output)
+{
+    const int width = size.x / 2;
+    parallelForBands(pool, size.y / 2, [&](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            const float* row0 = plane + static_cast<size_t>(y * 2) * size.x;
+            const float* row1 = row0 + size.x;
+            for (int x = 0; x < width; ++x) {
+                output[static_cast<size_t>(y) * width + x] =
+                    0.25f * (row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] + row1[x * 2 + 1]);
+            }
+        }
+    });
+}
+
+}  // namespace
+
+const char* ImageMetrics::getMetricName(Metric metric)
+{
+    switch (metric) {
+    case PSNR:
+        return "psnr";
+    case SSIM:
+        return "ssim";
+    case MSSSIM:
+        return "msssim";
+    case FLIP:
+        return "flip";
+    default:
+        return "unknown";
+    }
+}
+
+const char* ImageMetrics::getMetricLabel(Metric metric)
+{
+    switch (metric) {
+    case PSNR:
+        return "PSNR";
+    case SSIM:
+        return "SSIM";
+    case MSSSIM:
+        return "MS-SSIM";
+    case FLIP:
+        return "FLIP";
+    default:
+        return "Unknown";
+    }
+}
+
+float   ImageMetrics::computeSsim(const float* luma1, const float* luma2, const Vec2i& size,
+            ColorPipeline::SimdLevel level, ThreadPool* pool)
+{
+    const Filter window = makeGaussianFilter(kSsimRadius, kSsimSigma);
+    double ssimSum = 0.0, csSum = 0.0;
+    accumulateSsim(getKernels(level), luma1, luma2, size, window, pool, ssimSum, csSum);
+    return static_cast<float>(ssimSum / (static_cast<size_t>(size.x) * size.y));
+}
+
+bool    ImageMetrics::compute(const ColorPipeline::Source& source1, const ColorPipeline::Source& source2,
+            const Vec2i& size, const Settings& settings, ThreadPool* pool)
+{
+    const Clock::time_point startTime = Clock::now();
+    mValues.fill(std::numeric_limits<float>::quiet_NaN());
+    mSize = size;
+    mPixelsPerDegree = settings.pixelsPerDegree;
+    mScaleNum = 0;
+
+    if (!source1.pixels || !source2.pixels || size.x <= 0 || size.y <= 0) {
+        LOGW("Invalid input of image metrics");
+        return false;
+    }
+
+    if (settings.pixelsPerDegree <= 0.0f) {
+        LOGW("Pixels per degree of image metrics should be positive: {}", settings.pixelsPerDegree);
+        return false;
+    }
+
+    GradingTransform gradingTransforms[2];
+    if (!gradingTransforms[0].initialize(source1.pixels, source1.pixelDataType, source1.encodingType,
+            source1.primaryType, source1.exposureValue) ||
+        !gradingTransforms[1].initialize(source2.pixels, source2.pixelDataType, source2.encodingType,
+            source2.primaryType, source2.exposureValue)) {
+        return false;
+    }
+
+    const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+    std::vector<float> lumaPlanes[2] = { std::vector<float>(pixelCount), std::vector<float>(pixelCount) };
+    float* lumaData[2] = { lumaPlanes[0].data(), lumaPlanes[1].data() };
+    double squaredErrorSum = 0.0, flipSum = 0.0;
+    computeFlip(gradingTransforms, settings, lumaData, squaredErrorSum, flipSum, pool);
+
+    const double meanSquaredError = squaredErrorSum / (pixelCount * 3);
+    mValues[PSNR] = meanSquaredError > 0.0 ? static_cast<float>(-10.0 * std::log10(meanSquaredError))
+        : std::numeric_limits<float>::infinity();
+    mValues[FLIP] = static_cast<float>(flipSum / pixelCount);
+
+    // Scales are halved until the window doesn't fit in the coarsest one.
+    Vec2i scaleSize = size;
+    mScaleNum = 1;
+    while (mScaleNum < kMaxScaleNum && std::min(scaleSize.x, scaleSize.y) / 2 >= 2 * kSsimRadius + 1) {
+        scaleSize /= 2;
+        ++mScaleNum;
+    }
+
+    float weightSum = 0.0f;
+    for (int i = 0; i < mScaleNum; ++i) {
+        weightSum += kScaleWeights[i];
+    }
+
+    const Kernels kernels = getKernels(mPipeline.simdLevel());
+    const Filter window = makeGaussianFilter(kSsimRadius, kSsimSigma);
+    std::vector<float> downsampledPlanes[2];
+    double msssim = 1.0;
+    scaleSize = size;
+
+    for (int scale = 0; scale < mScaleNum; ++scale) {
+        double ssimSum = 0.0, csSum = 0.0;
+        accumulateSsim(kernels, lumaData[0], lumaData[1], scaleSize, window, pool, ssimSum, csSum);
+
+        const size_t scalePixelCount = static_cast<size_t>(scaleSize.x) * scaleSize.y;
+        const double meanSsim = ssimSum / scalePixelCount;
+        if (scale == 0) {
+            mValues[SSIM] = static_cast<float>(meanSsim);
+        }
+
+        // Only the coarsest scale contributes the luminance term. Negative terms are clamped to zero.
+        const double term = scale + 1 < mScaleNum ? csSum / scalePixelCount : meanSsim;
+        msssim *= std::pow(std::max(term, 0.0), kScaleWeights[scale] / weightSum);
+        if (scale + 1 == mScaleNum) {
+            break;
+        }
+
+        for (int i = 0; i < 2; ++i) {
+            std::vector<float> plane(static_cast<size_t>(scaleSize.x / 2) * (scaleSize.y / 2));
+            downsample(lumaData[i], scaleSize, pool, plane.data());
+            downsampledPlanes[i] = std::move(plane);
+            lumaData[i] = downsampledPlanes[i].data();
+        }
+        scaleSize /= 2;
+    }
+
+    mValues[MSSSIM] = static_cast<float>(msssim);
+    mElapsedTime = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+    LOGD("Image metrics ({}) of {}x{} pixels in {:.1f} ms: PSNR {:.2f} dB, SSIM {:.5f}, MS-SSIM {:.5f}, FLIP {:.5f}",
+        ColorPipeline::getSimdLevelName(mPipeline.simdLevel()), size.x, size.y, mElapsedTime * 1000.0,
+        mValues[PSNR], mValues[SSIM], mValues[MSSSIM], mValues[FLIP]);
+    return true;
+}
+
+void    ImageMetrics::computeFlip(const GradingTransform* gradingTransforms, const Settings& settings,
+            float* lumaPlanes[2], double& squaredErrorSum, double& flipSum, ThreadPool* pool) const
+{
+    ColorPipeline::Settings displaySettings;
+    displaySettings.applyToneMapping = settings.applyToneMapping;
+    displaySettings.outTransformType = settings.outTransformType;
+    displaySettings.displayGamma = settings.displayGamma;
+    displaySettings.displayLut = settings.displayLut;
+
+    const Kernels kernels = getKernels(mPipeline.simdLevel());
+    const FlipFilters filters = makeFlipFilters(settings.pixelsPerDegree);
+    const float maxColorError = getMaxColorError();
+    const int width = mSize.x;
+    const int radius = filters.radius();
+    std::mutex mergeMutex;
+
+    // Horizontally filtered planes of each image in ring, 4 terms of contrast
+    // sensitivity followed by smoothed, edge and point responses of luminance.
+    enum { SmoothPlane = FlipFilters::CsfNum, EdgePlane, PointPlane, RingPlaneNum };
+
+    parallelForBands(pool, mSize.y, [&](int begin, int end) {
+        const int paddedWidth = width + 2 * radius;
+        std::vector<float> ring((2 * radius + 1) * 2 * RingPlaneNum * width);
+        std::vector<float> displayValues[2] = { std::vector<float>(width * 4), std::vector<float>(width * 4) };
+        std::vector<float> inputs(width * 4);        // Luma and YCxCz.
+        std::vector<float> padded(paddedWidth);
+        std::vector<float> outputs(2 * 7 * width);   // Filtered YCxCz and feature responses of both images.
+        std::vector<float> temp(width);
+        std::vector<float> errors(width);
+        std::vector<const float*> rows(2 * radius + 1);
+        double localSquaredErrorSum = 0.0, localFlipSum = 0.0;
+
+        auto getRingRow = [&](int slot, int image, int plane) {
+            return ring.data() + ((slot * 2 + image) * RingPlaneNum + plane) * width;
+        };
+
+        auto filterRow = [&](const Filter& filter, float* output) {
+            kernels.convolveRow(padded.data() + radius - filter.radius, filter.weights.data(), filter.tapNum(),
+                width, output);
+        };
+
+        auto loadRow = [&](int y, int slot) {
+            const size_t rowBegin = static_cast<size_t>(y) * width;
+            const bool isBandRow = y >= begin && y < end;
+
+            for (int i = 0; i < 2; ++i) {
+                float* values = displayValues[i].data();
+                gradingTransforms[i].grade(rowBegin, rowBegin + width, values);
+                mPipeline.transformGradedValues(values, width, displaySettings);
+
+                // Luma of rows in halo is written by other bands.
+                float* luma = isBandRow ? lumaPlanes[i] + rowBegin : inputs.data();
+                float* lightness = inputs.data() + width;
+                float* redGreen = lightness + width;
+                float* blueYellow = redGreen + width;
+                kernels.metricInput(values, width, luma, lightness, redGreen, blueYellow);
+
+                const float* csfInputs[FlipFilters::CsfNum] = { lightness, redGreen, blueYellow, blueYellow };
+                for (int p = 0; p < FlipFilters::CsfNum; ++p) {
+                    padRow(csfInputs[p], width, radius, padded.data());
+                    filterRow(filters.csfRows[p], getRingRow(slot, i, p));
+                }
+
+                // Features are detected on luminance normalized to [0, 1].
+                padRow(lightness, width, radius, padded.data());
+                for (float& value : padded) {
+                    value = (value + 16.0f) / 116.0f;
+                }
+
+                filterRow(filters.smooth, getRingRow(slot, i, SmoothPlane));
+                filterRow(filters.edge, getRingRow(slot, i, EdgePlane));
+                filterRow(filters.point, getRingRow(slot, i, PointPlane));
+            }
+
+            if (isBandRow) {
+                const float* values1 = displayValues[0].data();
+                const float* values2 = displayValues[1].data();
+                float sum = 0.0f;
+                for (int x = 0; x < width; ++x) {
+                    for (int c = 0; c < 3; ++c) {
+                        const float difference = std::min(std::max(values1[x * 4 + c], 0.0f), 1.0f) -
+                            std::min(std::max(values2[x * 4 + c], 0.0f), 1.0f);
+                        sum += difference * difference;
+                    }
+                }
+                localSquaredErrorSum += sum;
+            }
+        };
+
+        auto processRow = [&](const int* slots) {
+            const float* colors[2][3];
+            const float* features[2][4];
+
+            for (int i = 0; i < 2; ++i) {
+                float* output = outputs.data() + i * 7 * width;
+                auto filterColumn = [&](int plane, const Filter& filter, float* dst) {
+                    for (int k = 0; k < filter.tapNum(); ++k) {
+                        rows[k] = getRingRow(slots[radius - filter.radius + k], i, plane);
+                    }
+                    kernels.convolveColumn(rows.data(), filter.weights.data(), filter.tapNum(), width, dst);
+                };
+
+                for (int p = 0; p < 3; ++p) {
+                    filterColumn(p, filters.csfColumns[p], output + p * width);
+                    colors[i][p] = output + p * width;
+                }
+
+                float* blueYellow = output + 2 * width;
+                filterColumn(FlipFilters::BlueYellow2, filters.csfColumns[FlipFilters::BlueYellow2], temp.data());
+                for (int x = 0; x < width; ++x) {
+                    blueYellow[x] += temp[x];
+                }
+
+                // Responses in x and y of edge and point detectors.
+                float* response = output + 3 * width;
+                filterColumn(EdgePlane, filters.smooth, response);
+                filterColumn(SmoothPlane, filters.edge, response + width);
+                filterColumn(PointPlane, filters.smooth, response + width * 2);
+                filterColumn(SmoothPlane, filters.point, response + width * 3);
+                for (int f = 0; f < 4; ++f) {
+                    features[i][f] = response + f * width;
+                }
+            }
+
+            kernels.flipError(colors[0], colors[1], features[0], features[1], width, maxColorError, errors.data());
+            double sum = 0.0;
+            for (int x = 0; x < width; ++x) {
+                sum += errors[x];
+            }
+            localFlipSum += sum;
+        };
+
+        streamBand(begin, end, mSize.y, radius, loadRow, processRow);
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        squaredErrorSum += localSquaredErrorSum;
+        flipSum += localFlipSum;
+    });
+}
+
+bool    ImageMetrics::isPassed(Metric metric, float threshold) const
+{
+    const float value = mValues[metric];
+    return isSimilarity(metric) ? value >= threshold : value <= threshold;
+}
+
+bool    ImageMetrics::writeReport(const std::string& filepath, const std::string& imagePath1,
+            const std::string& imagePath2, Metric metric, float threshold) const
+{
+    // Infinite PSNR of identical images is written as null.
+    nlohmann::json values = nlohmann::json::object();
+    for (int i = 0; i < MetricNum; ++i) {
+        const float value = mValues[i];
+        values[getMetricName(static_cast<Metric>(i))] = std::isfinite(value) ? nlohmann::json(value) : nlohmann::json();
+    }
+
+    nlohmann::json report = {
+        { "image1", imagePath1 },
+        { "image2", imagePath2 },
+        { "width", mSize.x },
+        { "height", mSize.y },
+        { "metric", getMetricName(metric) },
+        { "threshold", threshold },
+        { "passed", isPassed(metric, threshold) },
+        { "values", values },
+        { "msssimScaleNum", mScaleNum },
+        { "pixelsPerDegree", mPixelsPerDegree },
+    };
+
+    std::ofstream file(filepath);
+    if (!file) {
+        LOGW("Failed to write report {}", filepath);
+        return false;
+    }
+
+    file << report.dump(4) << std::endl;
+    return static_cast<bool>(file);
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,124 @@
+#ifndef BAKTSIU_IMAGE_METRICS_H_
+#define BAKTSIU_IMAGE_METRICS_H_
+
+#include "color_pipeline.h"
+#include "common.h"
+
+#include <array>
+#include <string>
+
+namespace baktsiu
+{
+
+class GradingTransform;
+class Lut;
+class ThreadPool;
+
+/**
+ * Full-reference metrics of two images as they are displayed.
+ *
+ * Images are graded and transformed to display values by ColorPipeline, and
+ * display values clamped to [0, 1] are regarded as sRGB signals:
+ *  - PSNR of RGB values.
+ *  - SSIM of luma with Gaussian window of sigma 1.5 (Wang et al. 2004).
+ *  - MS-SSIM of luma over 5 scales (Wang et al. 2003), fewer scales are
+ *    used if the image is smaller than 176 pixels.
+ *  - Mean of LDR-FLIP errors (Andersson et al. 2020) at the viewing distance
+ *    given by pixels per degree.
+ *
+ * Filters are separable, rows are streamed through ring buffers of filtered
+ * rows, thus bands of rows are processed in parallel with bounded memory.
+ * Borders are mirrored as the reference implementation of FLIP.
+ */
+class ImageMetrics
+{
+public:
+    enum Metric
+    {
+        PSNR = 0,
+        SSIM,
+        MSSSIM,
+        FLIP,
+        MetricNum
+    };
+
+    struct Settings
+    {
+        bool        applyToneMapping = false;
+        int         outTransformType = 0;       // 0: sRGB, 1: P3 D65, 2: BT.2020.
+        float       displayGamma = 2.2f;
+        const Lut*  displayLut = nullptr;       // Optional LUT applied to display-encoded values.
+        float       pixelsPerDegree = 67.0f;    // 0.7 m from a 0.7 m wide 4K display, the default of FLIP.
+    };
+
+    static const int kMaxScaleNum = 5;
+
+    // Return name of metric for command line and reports, e.g. "msssim".
+    static const char* getMetricName(Metric metric);
+
+    // Return label of metric for display, e.g. "MS-SSIM".
+    static const char* getMetricLabel(Metric metric);
+
+    // Return true if larger values mean more similar images, i.e. all metrics except FLIP.
+    static bool isSimilarity(Metric metric) { return metric != FLIP; }
+
+    /**
+     * Return mean SSIM of two luma planes with the same size, e.g. of downsampled images.
+     *
+     * @param level Instruction set of kernels, see ColorPipeline::getSupportedSimdLevel().
+     * @param pool Optional thread pool to process bands of rows in parallel.
+     */
+    static float computeSsim(const float* luma1, const float* luma2, const Vec2i& size,
+                    ColorPipeline::SimdLevel level, ThreadPool* pool = nullptr);
+
+public:
+    /**
+     * Compute all metrics of two images with the same size.
+     *
+     * @param source1 Decoded pixels of the reference image.
+     * @param pool Optional thread pool to process bands of rows in parallel.
+     */
+    bool    compute(const ColorPipeline::Source& source1, const ColorPipeline::Source& source2,
+                const Vec2i& size, const Settings& settings, ThreadPool* pool = nullptr);
+
+    // Use narrower instruction set, e.g. to compare results. Return false if it's not supported.
+    bool    setSimdLevel(ColorPipeline::SimdLevel level) { return mPipeline.setSimdLevel(level); }
+
+    // Return value of metric, PSNR is infinity if display values are identical.
+    float   value(Metric metric) const { return mValues[metric]; }
+
+    // Return number of scales of MS-SSIM.
+    int     scaleNum() const { return mScaleNum; }
+
+    const Vec2i& size() const { return mSize; }
+
+    // Return wall-clock time of the latest compute() in seconds.
+    double  elapsedTime() const { return mElapsedTime; }
+
+    /**
+     * Write values of all metrics as JSON file, paths of images are recorded for reference.
+     *
+     * @param metric The metric compared with threshold for result of regression test.
+     */
+    bool    writeReport(const std::string& filepath, const std::string& imagePath1,
+                const std::string& imagePath2, Metric metric, float threshold) const;
+
+    // Return true if value of metric is on the similar side of threshold.
+    bool    isPassed(Metric metric, float threshold) const;
+
+private:
+    // Compute PSNR and FLIP, and write display luma of both images for SSIM.
+    void    computeFlip(const GradingTransform* gradingTransforms, const Settings& settings,
+                float* lumaPlanes[2], double& squaredErrorSum, double& flipSum, ThreadPool* pool) const;
+
+private:
+    ColorPipeline   mPipeline;
+    std::array<float, MetricNum> mValues = {};
+    Vec2i           mSize = Vec2i(0);
+    float           mPixelsPerDegree = 0.0f;
+    int             mScaleNum = 0;
+    double          mElapsedTime = 0.0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_IMAGE_METRICS_H_
@@ -0,0 +1,596 @@
+#include "image_statistics.h"
+#include "thread_pool.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BAKTSIU_STATS_USE_SSE2
+#endif
+
+namespace
+{
+
+using namespace baktsiu;
+
+const size_t kPixelGrainSize = 16384;   // Number of pixels per task of thread pool.
+const int kFineBinNum = 4096;           // Bins per channel between min and max values to locate percentiles.
+
+// Input transforms of color_grading.frag in row-major order.
+const float kBT709ToAP1[9] = {
+    0.6130973f, 0.3395229f, 0.0473793f,
+    0.0701942f, 0.9163555f, 0.0134523f,
+    0.0206156f, 0.1095698f, 0.8698151f };
+
+const float kP3D65ToAP1[9] = {
+    0.7357978f, 0.2121662f, 0.0520355f,
+    0.0471804f, 0.9380473f, 0.0147744f,
+    0.0035637f, 0.0411419f, 0.9552950f };
+
+const float kBT2020ToAP1[9] = {
+    0.9748949f, 0.0195988f, 0.0055058f,
+    0.0021802f, 0.9955371f, 0.0022849f,
+    0.0047972f, 0.024532f,  0.9706713f };
+
+// Luminance of ACES AP1 color, the same as AP1_RGB2Y@hdr_statistics.comp.
+const float kAP1ToY[3] = { 0.2722287168f, 0.6740817658f, 0.0536895174f };
+
+// Decode channel value to linear signal, the same as decode@color_grading.frag.
+float decodeValue(float value, ColorEncodingType type)
+{
+    if (type == ColorEncodingType::sRGB) {
+        return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+    } else if (type == ColorEncodingType::BT_709) {
+        return value <= 0.081f ? value / 4.5f : std::pow((value + 0.099f) / 1.099f, 1.0f / 0.45f);
+    } else if (type == ColorEncodingType::BT_2100_PQ) {
+        const float m1 = 0.1593017578125f, m2 = 78.84375f;
+        const float c1 = 0.8359375f, c2 = 18.8515625f, c3 = 18.6875f;
+        const float np = std::pow(value, 1.0f / m2);
+        const float l = std::max(0.0f, np - c1) / (c2 - c3 * np);
+        return std::pow(l, 1.0f / m1) * 10000.0f;
+    }
+
+    return value;
+}
+
+// Coefficients of log2(m) = c1 * t + c3 * t^3 + c5 * t^5 + c7 * t^7, where t = (m - 1) / (m + 1).
+const float kLog2C1 = 2.8853900818f;    // 2 / ln(2)
+const float kLog2C3 = kLog2C1 / 3.0f;
+const float kLog2C5 = kLog2C1 / 5.0f;
+const float kLog2C7 = kLog2C1 / 7.0f;
+const float kSqrt2 = 1.4142135624f;
+
+// Return log2 of positive normal value. The mantissa is reduced to [sqrt(0.5), sqrt(2)),
+// thus the error of series is about 4e-8, which is far less than bin width.
+inline float fastLog2(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    int exponent = static_cast<int>(bits >> 23) - 127;
+    bits = (bits & 0x7FFFFFu) | 0x3F800000u;
+
+    float mantissa;
+    std::memcpy(&mantissa, &bits, sizeof(bits));
+    if (mantissa > kSqrt2) {
+        mantissa *= 0.5f;
+        exponent += 1;
+    }
+
+    const float t = (mantissa - 1.0f) / (mantissa + 1.0f);
+    const float t2 = t * t;
+    return exponent + t * (kLog2C1 + t2 * (kLog2C3 + t2 * (kLog2C5 + t2 * kLog2C7)));
+}
+
+#ifdef BAKTSIU_STATS_USE_SSE2
+// The same as fastLog2() for 4 lanes.
+inline __m128 fastLog2(__m128 value)
+{
+    const __m128i bits = _mm_castps_si128(value);
+    __m128 exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    __m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x7FFFFF)),
+        _mm_set1_epi32(0x3F800000)));
+
+    const __m128 isLarge = _mm_cmpgt_ps(mantissa, _mm_set1_ps(kSqrt2));
+    mantissa = _mm_mul_ps(mantissa, _mm_or_ps(_mm_and_ps(isLarge, _mm_set1_ps(0.5f)), _mm_andnot_ps(isLarge, _mm_set1_ps(1.0f))));
+    exponent = _mm_add_ps(exponent, _mm_and_ps(isLarge, _mm_set1_ps(1.0f)));
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 t = _mm_div_ps(_mm_sub_ps(mantissa, one), _mm_add_ps(mantissa, one));
+    const __m128 t2 = _mm_mul_ps(t, t);
+    __m128 series = _mm_add_ps(_mm_set1_ps(kLog2C5), _mm_mul_ps(t2, _mm_set1_ps(kLog2C7)));
+    series = _mm_add_ps(_mm_set1_ps(kLog2C3), _mm_mul_ps(t2, series));
+    series = _mm_add_ps(_mm_set1_ps(kLog2C1), _mm_mul_ps(t2, series));
+    return _mm_add_ps(exponent, _mm_mul_ps(t, series));
+}
+#endif
+
+// Map values to bins of HdrStatistics, it must be the same as hdr_statistics.comp.
+struct LogBinning
+{
+    explicit LogBinning(const Vec2f& logRange)
+        : minEv(logRange.x), binScale(HdrStatistics::kBinNum / (logRange.y - logRange.x)) {}
+
+    // Zero and negative values fall into the first bin.
+    int operator()(float value) const
+    {
+        const float ev = fastLog2(std::max(value, 1e-20f));
+        return static_cast<int>(glm::clamp((ev - minEv) * binScale, 0.0f, HdrStatistics::kBinNum - 1.0f));
+    }
+
+#ifdef BAKTSIU_STATS_USE_SSE2
+    // Return bins of 4 lanes, NaN lanes are undefined.
+    __m128i operator()(__m128 value) const
+    {
+        const __m128 ev = fastLog2(_mm_max_ps(value, _mm_set1_ps(1e-20f)));
+        __m128 bin = _mm_mul_ps(_mm_sub_ps(ev, _mm_set1_ps(minEv)), _mm_set1_ps(binScale));
+        bin = _mm_min_ps(_mm_max_ps(bin, _mm_setzero_ps()), _mm_set1_ps(HdrStatistics::kBinNum - 1.0f));
+        return _mm_cvttps_epi32(bin);
+    }
+#endif
+
+    float   minEv;
+    float   binScale;
+};
+
+// Round to the nearest half float, since float images and graded results are stored in RGBA16F textures.
+inline float roundToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits = (bits + 0xFFFu + ((bits >> 13) & 1u)) & ~0x1FFFu;
+    std::memcpy(&value, &bits, sizeof(bits));
+    return value;
+}
+
+// Return bin of value, NaN falls into the first bin.
+inline int getBinIndex(float value, int binNum)
+{
+    return value >= binNum - 1 ? binNum - 1 : (value > 0.0f ? static_cast<int>(value) : 0);
+}
+
+void accumulateBins(int* dst, const int* src, size_t count)
+{
+    size_t i = 0;
+#ifdef BAKTSIU_STATS_USE_SSE2
+    for (; i + 4 <= count; i += 4) {
+        const __m128i sum = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), sum);
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+// Return value at percentile p of log2 histogram by its cumulative counts, the
+// value is interpolated in log domain within the bin and limited by maxValue.
+float getPercentile(const unsigned int* cdf, int binNum, const Vec2f& logRange, float maxValue, float p)
+{
+    const unsigned int count = cdf[binNum - 1];
+    if (count == 0) {
+        return 0.0f;
+    }
+
+    // Find the first bin whose cumulative count reaches the rank.
+    const double rank = std::max(glm::clamp(p, 0.0f, 1.0f) * static_cast<double>(count), 1.0);
+    const int binIdx = static_cast<int>(std::lower_bound(cdf, cdf + binNum, rank) - cdf);
+    const unsigned int prevCount = binIdx > 0 ? cdf[binIdx - 1] : 0;
+    const double fraction = (rank - prevCount) / (cdf[binIdx] - prevCount);
+
+    const double binWidth = (logRange.y - logRange.x) / static_cast<double>(binNum);
+    const double ev = logRange.x + (binIdx + std::min(fraction, 1.0)) * binWidth;
+    return std::min(static_cast<float>(std::exp2(ev)), maxValue);
+}
+
+// Statistics of one task, they are merged after all tasks are done.
+struct PartialStatistics
+{
+    ImageStatistics::Histogram histogram = {};
+    Vec3f       minValue = Vec3f(std::numeric_limits<float>::infinity());
+    Vec3f       maxValue = Vec3f(-std::numeric_limits<float>::infinity());
+    glm::dvec3  sum = glm::dvec3(0.0);
+    glm::uvec3  validCount = glm::uvec3(0);
+
+    HdrStatistics::Histogram logHistogram = {};
+    float       maxLuminance = 0.0f;
+};
+
+// Accumulate log2-domain histograms of RGB and luminance, see HdrStatistics.
+void accumulateLogStatistics(const float* values, size_t pixelCount, const Vec2f& logRange, PartialStatistics& stats)
+{
+    const int binNum = HdrStatistics::kBinNum;
+    const LogBinning getBinIndex(logRange);
+    int* histogram = stats.logHistogram.data();
+
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const float* rgb = values + i * 4;
+        const float luminance = rgb[0] * kAP1ToY[0] + rgb[1] * kAP1ToY[1] + rgb[2] * kAP1ToY[2];
+
+#ifdef BAKTSIU_STATS_USE_SSE2
+        const __m128 value = _mm_setr_ps(rgb[0], rgb[1], rgb[2], luminance);
+        const int validMask = _mm_movemask_ps(_mm_cmpord_ps(value, value));
+
+        alignas(16) int bins[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(bins), getBinIndex(value));
+        for (int c = 0; c < 4; ++c) {
+            if (validMask & (1 << c)) {
+                histogram[bins[c] + binNum * c]++;
+            }
+        }
+#else
+        const float channels[4] = { rgb[0], rgb[1], rgb[2], luminance };
+        for (int c = 0; c < 4; ++c) {
+            if (!std::isnan(channels[c])) {
+                histogram[getBinIndex(channels[c]) + binNum * c]++;
+            }
+        }
+#endif
+
+        if (luminance > stats.maxLuminance) {
+            stats.maxLuminance = luminance;
+        }
+    }
+}
+
+// Accumulate histogram, min, max and sum of graded values. NaN values are
+// excluded except for the histogram, which follows statistics.comp.
+void accumulateStatistics(const float* values, size_t pixelCount, float valueScale, PartialStatistics& stats)
+{
+    const int binNum = ImageStatistics::kBinNum;
+    int* histogram = stats.histogram.data();
+
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const float* rgb = values + i * 4;
+        histogram[getBinIndex(rgb[0] * valueScale, binNum)]++;
+        histogram[getBinIndex(rgb[1] * valueScale, binNum) + binNum]++;
+        histogram[getBinIndex(rgb[2] * valueScale, binNum) + binNum * 2]++;
+    }
+
+#ifdef BAKTSIU_STATS_USE_SSE2
+    __m128 minValue = _mm_set1_ps(std::numeric_limits<float>::infinity());
+    __m128 maxValue = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+    __m128d sumRG = _mm_setzero_pd();
+    __m128d sumBX = _mm_setzero_pd();
+    __m128i validCount = _mm_setzero_si128();
+
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const __m128 value = _mm_loadu_ps(values + i * 4);
+        const __m128 isValid = _mm_cmpord_ps(value, value);
+
+        // The second operand is returned if any operand is NaN.
+        minValue = _mm_min_ps(value, minValue);
+        maxValue = _mm_max_ps(value, maxValue);
+
+        const __m128 validValue = _mm_and_ps(value, isValid);
+        sumRG = _mm_add_pd(sumRG, _mm_cvtps_pd(validValue));
+        sumBX = _mm_add_pd(sumBX, _mm_cvtps_pd(_mm_movehl_ps(validValue, validValue)));
+        validCount = _mm_sub_epi32(validCount, _mm_castps_si128(isValid));
+    }
+
+    alignas(16) float minArray[4], maxArray[4];
+    alignas(16) double sumArray[4];
+    alignas(16) int countArray[4];
+    _mm_store_ps(minArray, minValue);
+    _mm_store_ps(maxArray, maxValue);
+    _mm_store_pd(sumArray, sumRG);
+    _mm_store_pd(sumArray + 2, sumBX);
+    _mm_store_si128(reinterpret_cast<__m128i*>(countArray), validCount);
+
+    for (int c = 0; c < 3; ++c) {
+        stats.minValue[c] = std::min(stats.minValue[c], minArray[c]);
+        stats.maxValue[c] = std::max(stats.maxValue[c], maxArray[c]);
+        stats.sum[c] += sumArray[c];
+        stats.validCount[c] += countArray[c];
+    }
+#else
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const float* rgb = values + i * 4;
+        for (int c = 0; c < 3; ++c) {
+            if (!std::isnan(rgb[c])) {
+                stats.minValue[c] = std::min(stats.minValue[c], rgb[c]);
+                stats.maxValue[c] = std::max(stats.maxValue[c], rgb[c]);
+                stats.sum[c] += rgb[c];
+                stats.validCount[c]++;
+            }
+        }
+    }
+#endif
+}
+
+}  // namespace
+
+
+namespace baktsiu
+{
+
+bool GradingTransform::initialize(const void* pixels, GLenum pixelDataType,
+    ColorEncodingType encodingType, ColorPrimaryType primaryType, float exposureValue)
+{
+    if (pixelDataType != GL_UNSIGNED_BYTE && pixelDataType != GL_HALF_FLOAT && pixelDataType != GL_FLOAT) {
+        LOGW("Unsupported pixel data type {:#x} for CPU grading", pixelDataType);
+        return false;
+    }
+
+    mPixels = pixels;
+    mPixelDataType = pixelDataType;
+    mEncodingType = encodingType;
+    mDecodeTable.clear();
+
+    if (pixelDataType == GL_UNSIGNED_BYTE) {
+        mDecodeTable.resize(256);
+        for (size_t i = 0; i < mDecodeTable.size(); ++i) {
+            mDecodeTable[i] = decodeValue(i / 255.0f, encodingType);
+        }
+    } else if (pixelDataType == GL_HALF_FLOAT) {
+        mDecodeTable.resize(65536);
+        for (size_t i = 0; i < mDecodeTable.size(); ++i) {
+            const float value = glm::unpackHalf1x16(static_cast<glm::uint16>(i));
+            mDecodeTable[i] = decodeValue(value, encodingType);
+        }
+    }
+
+    // Color primaries other than these are already in AP1, see inputTransform@color_grading.frag.
+    const float identity[9] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+    const float* matrix = identity;
+    if (primaryType == ColorPrimaryType::BT_709) {
+        matrix = kBT709ToAP1;
+    } else if (primaryType == ColorPrimaryType::DCI_P3_D65) {
+        matrix = kP3D65ToAP1;
+    } else if (primaryType == ColorPrimaryType::BT_2020) {
+        matrix = kBT2020ToAP1;
+    }
+
+    const float exposureScale = std::pow(2.0f, exposureValue);
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            mColumns[col * 4 + row] = matrix[row * 3 + col] * exposureScale;
+        }
+        mColumns[col * 4 + 3] = 0.0f;
+    }
+
+    return true;
+}
+
+void GradingTransform::grade(size_t begin, size_t end, float* output, size_t stride) const
+{
+    const size_t pixelNum = (end - begin + stride - 1) / stride;
+    const size_t valueNum = pixelNum * 4;
+
+    if (mPixelDataType == GL_UNSIGNED_BYTE) {
+        const uint8_t* src = static_cast<const uint8_t*>(mPixels) + begin * 4;
+        for (size_t i = 0; i < pixelNum; ++i) {
+            for (int c = 0; c < 4; ++c) {
+                output[i * 4 + c] = mDecodeTable[src[i * stride * 4 + c]];
+            }
+        }
+    } else if (mPixelDataType == GL_HALF_FLOAT) {
+        const uint16_t* src = static_cast<const uint16_t*>(mPixels) + begin * 4;
+        for (size_t i = 0; i < pixelNum; ++i) {
+            for (int c = 0; c < 4; ++c) {
+                output[i * 4 + c] = mDecodeTable[src[i * stride * 4 + c]];
+            }
+        }
+    } else {
+        const float* src = static_cast<const float*>(mPixels) + begin * 4;
+        for (size_t i = 0; i < pixelNum; ++i) {
+            for (int c = 0; c < 4; ++c) {
+                output[i * 4 + c] = decodeValue(roundToHalf(src[i * stride * 4 + c]), mEncodingType);
+            }
+        }
+    }
+
+    const float* c = mColumns;
+
+#ifdef BAKTSIU_STATS_USE_SSE2
+    const __m128 col0 = _mm_loadu_ps(c);
+    const __m128 col1 = _mm_loadu_ps(c + 4);
+    const __m128 col2 = _mm_loadu_ps(c + 8);
+    const __m128i roundBias = _mm_set1_epi32(0xFFF);
+    const __m128i lsbMask = _mm_set1_epi32(1);
+    const __m128i truncMask = _mm_set1_epi32(~0x1FFF);
+
+    for (size_t i = 0; i < valueNum; i += 4) {
+        float* rgb = output + i;
+        __m128 result = _mm_mul_ps(_mm_set1_ps(rgb[0]), col0);
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(rgb[1]), col1));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(rgb[2]), col2));
+
+        // The same as roundToHalf() for 4 lanes.
+        __m128i bits = _mm_castps_si128(result);
+        const __m128i lsb = _mm_and_si128(_mm_srli_epi32(bits, 13), lsbMask);
+        bits = _mm_and_si128(_mm_add_epi32(bits, _mm_add_epi32(roundBias, lsb)), truncMask);
+        _mm_storeu_ps(rgb, _mm_castsi128_ps(bits));
+    }
+#else
+    for (size_t i = 0; i < valueNum; i += 4) {
+        float* rgb = output + i;
+        const float r = rgb[0], g = rgb[1], b = rgb[2];
+        for (int k = 0; k < 3; ++k) {
+            rgb[k] = roundToHalf(r * c[k] + g * c[4 + k] + b * c[8 + k]);
+        }
+    }
+#endif
+}
+
+int HdrStatistics::getBinIndex(float value, const Vec2f& logRange)
+{
+    return LogBinning(logRange)(value);
+}
+
+void HdrStatistics::initialize(const Histogram& histogram, const Vec4f& maxValue, const Vec2f& logRange)
+{
+    mHistogram = histogram;
+    mMaxValue = maxValue;
+    mLogRange = logRange;
+
+    for (int c = 0; c < kChannelNum; ++c) {
+        unsigned int cumulativeCount = 0;
+        for (int i = kBinNum * c; i < kBinNum * (c + 1); ++i) {
+            cumulativeCount += static_cast<unsigned int>(mHistogram[i]);
+            mCdf[i] = cumulativeCount;
+        }
+    }
+}
+
+void HdrStatistics::initialize(const int* packedData, const Vec2f& logRange)
+{
+    Histogram histogram;
+    std::copy(packedData, packedData + histogram.size(), histogram.begin());
+
+    Vec4f maxValue;
+    std::memcpy(&maxValue[0], packedData + histogram.size(), sizeof(float) * kChannelNum);
+    initialize(histogram, maxValue, logRange);
+}
+
+float HdrStatistics::percentile(int channel, float p) const
+{
+    return getPercentile(mCdf.data() + kBinNum * channel, kBinNum, mLogRange, mMaxValue[channel], p);
+}
+
+void ReductionResult::initialize(const int* packedData, const Vec2f& logRange)
+{
+    unsigned int cumulativeCount = 0;
+    for (int i = 0; i < kBinNum; ++i) {
+        cumulativeCount += static_cast<unsigned int>(packedData[i]);
+        mCdf[i] = cumulativeCount;
+    }
+
+    std::memcpy(&mLogSum, packedData + kBinNum, sizeof(float));
+    std::memcpy(&mMaxValue, packedData + kBinNum + 2, sizeof(float));
+    mLogRange = logRange;
+}
+
+float ReductionResult::logAverage() const
+{
+    const unsigned int count = sampleCount();
+    return count > 0 ? std::exp2(mLogSum / count) : 0.0f;
+}
+
+float ReductionResult::percentile(float p) const
+{
+    return getPercentile(mCdf.data(), kBinNum, mLogRange, mMaxValue, p);
+}
+
+const float ImageStatistics::kPercentiles[ImageStatistics::kPercentileNum] = { 0.01f, 0.5f, 0.99f };
+
+bool ImageStatistics::compute(const void* pixels, GLenum pixelDataType, const Vec2i& size,
+    ColorEncodingType encodingType, ColorPrimaryType primaryType,
+    float exposureValue, float valueScale, const Vec2f& logRange, ThreadPool* pool)
+{
+    ScopeMarker("Compute CPU Image Statistics");
+
+    if (!pixels || size.x <= 0 || size.y <= 0) {
+        return false;
+    }
+
+    GradingTransform xform;
+    if (!xform.initialize(pixels, pixelDataType, encodingType, primaryType, exposureValue)) {
+        return false;
+    }
+
+    const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+    std::mutex mergeMutex;
+
+    // First pass: histogram, min, max and mean values.
+    PartialStatistics total;
+    auto firstPass = [&](size_t begin, size_t end) {
+        std::vector<float> values((end - begin) * 4);
+        xform.grade(begin, end, values.data());
+
+        PartialStatistics stats;
+        accumulateStatistics(values.data(), end - begin, valueScale, stats);
+        accumulateLogStatistics(values.data(), end - begin, logRange, stats);
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        accumulateBins(total.histogram.data(), stats.histogram.data(), stats.histogram.size());
+        accumulateBins(total.logHistogram.data(), stats.logHistogram.data(), stats.logHistogram.size());
+        total.maxLuminance = std::max(total.maxLuminance, stats.maxLuminance);
+        total.minValue = glm::min(total.minValue, stats.minValue);
+        total.maxValue = glm::max(total.maxValue, stats.maxValue);
+        total.sum += stats.sum;
+        total.validCount += stats.validCount;
+    };
+
+    if (pool) {
+        pool->parallelFor(pixelCount, kPixelGrainSize, firstPass);
+    } else {
+        firstPass(0, pixelCount);
+    }
+
+    // Second pass: locate percentiles by fine histograms between min and max values.
+    const Vec3f range = total.maxValue - total.minValue;
+    const bool hasFiniteRange = std::isfinite(range.x) && std::isfinite(range.y) && std::isfinite(range.z);
+    const Vec3f fineScale = static_cast<float>(kFineBinNum) / glm::max(range, Vec3f(std::numeric_limits<float>::min()));
+    std::vector<int> fineHistogram(kFineBinNum * 3, 0);
+
+    auto secondPass = [&](size_t begin, size_t end) {
+        std::vector<float> values((end - begin) * 4);
+        xform.grade(begin, end, values.data());
+
+        std::vector<int> bins(kFineBinNum * 3, 0);
+        for (size_t i = 0; i < end - begin; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                const float value = (values[i * 4 + c] - total.minValue[c]) * fineScale[c];
+                if (!std::isnan(value)) {
+                    bins[getBinIndex(value, kFineBinNum) + kFineBinNum * c]++;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        accumulateBins(fineHistogram.data(), bins.data(), bins.size());
+    };
+
+    if (hasFiniteRange) {
+        if (pool) {
+            pool->parallelFor(pixelCount, kPixelGrainSize, secondPass);
+        } else {
+            secondPass(0, pixelCount);
+        }
+    }
+
+    for (int c = 0; c < 3; ++c) {
+        const unsigned int validCount = total.validCount[c];
+        mMeanValue[c] = validCount > 0 ? static_cast<float>(total.sum[c] / validCount) : 0.0f;
+
+        for (int p = 0; p < kPercentileNum; ++p) {
+            if (!hasFiniteRange || validCount == 0) {
+                mPercentiles[p][c] = kPercentiles[p] < 0.5f ? total.minValue[c] : total.maxValue[c];
+                continue;
+            }
+
+            // Interpolate linearly within the bin which contains the rank.
+            const double rank = kPercentiles[p] * (validCount - 1);
+            const int* bins = fineHistogram.data() + kFineBinNum * c;
+            size_t cumulativeCount = 0;
+            int binIdx = 0;
+            while (binIdx < kFineBinNum - 1 && cumulativeCount + bins[binIdx] <= rank) {
+                cumulativeCount += bins[binIdx++];
+            }
+
+            const double fraction = bins[binIdx] > 0 ? (rank - cumulativeCount + 0.5) / bins[binIdx] : 0.5;
+            const float value = total.minValue[c] + static_cast<float>((binIdx + std::min(fraction, 1.0)) / fineScale[c]);
+            mPercentiles[p][c] = glm::clamp(value, total.minValue[c], total.maxValue[c]);
+        }
+    }
+
+    mHistogram = total.histogram;
+    mMinValue = total.minValue;
+    mMaxValue = total.maxValue;
+    mPixelCount = pixelCount;
+
+    // NaN values are excluded, thus max values are never less than zero.
+    const Vec3f maxValue = glm::max(total.maxValue, Vec3f(0.0f));
+    mHdrStatistics.initialize(total.logHistogram, Vec4f(maxValue, total.maxLuminance), logRange);
+
+    return true;
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,188 @@
+#ifndef BAKTSIU_IMAGE_STATISTICS_H_
+#define BAKTSIU_IMAGE_STATISTICS_H_
+
+#include "colour.h"
+#include "common.h"
+
+#include <GL/gl3w.h>
+
+namespace baktsiu
+{
+
+class ThreadPool;
+
+/**
+ * Decode and grade pixels on CPU, the same as color_grading.frag.
+ *
+ * Graded values are RGBx in ACES AP1, and they are rounded to half floats as
+ * the RGBA16F render target. Pixels must be alive while grading.
+ */
+class GradingTransform
+{
+public:
+    // Resolve parameters of pixels with type GL_UNSIGNED_BYTE, GL_HALF_FLOAT or GL_FLOAT.
+    bool    initialize(const void* pixels, GLenum pixelDataType, ColorEncodingType encodingType,
+                ColorPrimaryType primaryType, float exposureValue);
+
+    // Decode and grade every stride-th pixel in [begin, end) to RGBx values.
+    void    grade(size_t begin, size_t end, float* output, size_t stride = 1) const;
+
+private:
+    const void*         mPixels = nullptr;
+    GLenum              mPixelDataType = GL_UNSIGNED_BYTE;
+    ColorEncodingType   mEncodingType = ColorEncodingType::Linear;
+    float               mColumns[12];       // Columns (RGBx) of input transform scaled by exposure.
+
+    // Decoded values of all 8-bit or half float inputs, thus transfer functions
+    // are evaluated once per distinct value instead of per channel.
+    std::vector<float>  mDecodeTable;
+};
+
+
+/**
+ * Log2-domain histograms of graded HDR values.
+ *
+ * Bins evenly split the EV range [logRange.x, logRange.y] of each channel.
+ * Values under the range, including zero and negative ones, fall into the first
+ * bin and values over the range fall into the last one. NaN values are excluded.
+ * Percentile queries are answered by the cumulative distribution of bins.
+ */
+class HdrStatistics
+{
+public:
+    static const int kBinNum = 256;
+    static const int kChannelNum = 4;       // R, G, B and luminance.
+
+    // Number of integers of bins followed by max values, the layout of hdr_statistics.comp.
+    static const int kPackedSize = kBinNum * kChannelNum + kChannelNum;
+
+    using Histogram = std::array<int, kBinNum * kChannelNum>;
+
+    // Return bin of value, it must be the same as hdr_statistics.comp.
+    static int getBinIndex(float value, const Vec2f& logRange);
+
+public:
+    // Build from histogram and the max value of each channel.
+    void    initialize(const Histogram& histogram, const Vec4f& maxValue, const Vec2f& logRange);
+
+    // Build from data packed by hdr_statistics.comp, max values are stored as float bits.
+    void    initialize(const int* packedData, const Vec2f& logRange);
+
+    // Return value of channel at percentile in [0, 1], it's interpolated in log domain within a bin.
+    float   percentile(int channel, float p) const;
+
+    const Histogram& histogram() const { return mHistogram; }
+
+    const Vec4f& maxValue() const { return mMaxValue; }
+
+    const Vec2f& logRange() const { return mLogRange; }
+
+    // Return number of non-NaN values of channel.
+    unsigned int sampleCount(int channel) const { return mCdf[kBinNum * (channel + 1) - 1]; }
+
+    bool    isEmpty() const { return sampleCount(kChannelNum - 1) == 0; }
+
+private:
+    Histogram   mHistogram = {};
+    std::array<unsigned int, kBinNum * kChannelNum> mCdf = {};  // Inclusive cumulative counts per channel.
+    Vec4f       mMaxValue = Vec4f(0.0f);
+    Vec2f       mLogRange = Vec2f(0.0f);
+};
+
+
+/**
+ * Result of reduction.comp over one channel of graded texture.
+ *
+ * Values are sampled on a grid bounded by App::kReductionMaxSize, and
+ * non-finite values are excluded. It contains the log-average, the max value
+ * and a log2 histogram with the same binning rule as HdrStatistics.
+ */
+class ReductionResult
+{
+public:
+    static const int kBinNum = 256;
+
+    // Number of integers of bins followed by sum of log2, count and max value.
+    static const int kPackedSize = kBinNum + 4;
+
+public:
+    // Build from data packed by reduction.comp, floats are stored as bits.
+    void    initialize(const int* packedData, const Vec2f& logRange);
+
+    // Return 2^(mean of log2 values), i.e. the geometric mean.
+    float   logAverage() const;
+
+    // Return value at percentile in [0, 1], it's interpolated in log domain within a bin.
+    float   percentile(float p) const;
+
+    float   maxValue() const { return mMaxValue; }
+
+    unsigned int sampleCount() const { return mCdf.back(); }
+
+private:
+    std::array<unsigned int, kBinNum> mCdf = {};    // Inclusive cumulative counts.
+    float       mLogSum = 0.0f;
+    float       mMaxValue = 0.0f;
+    Vec2f       mLogRange = Vec2f(0.0f);
+};
+
+
+/**
+ * Statistics of graded image computed on CPU.
+ *
+ * Source pixels are decoded and transformed to ACES AP1 the same as
+ * color_grading.frag, and the histogram has the same layout as the one of
+ * statistics.comp. It's the fallback when compute shaders are not supported.
+ */
+class ImageStatistics
+{
+public:
+    static const int kBinNum = 256;
+    static const int kPercentileNum = 3;
+    static const float kPercentiles[kPercentileNum];   // 1%, 50% and 99%.
+
+    using Histogram = std::array<int, kBinNum * 3>;
+
+public:
+    /**
+     * Compute statistics of graded pixels.
+     *
+     * @param pixels RGBA pixels of decoded image file.
+     * @param pixelDataType Type of channel, GL_UNSIGNED_BYTE, GL_HALF_FLOAT or GL_FLOAT.
+     * @param size Width and height of image.
+     * @param valueScale Scale of graded values for binning, the same as uValueScale@statistics.comp.
+     * @param logRange EV range of HDR histograms, see HdrStatistics.
+     * @param pool Optional thread pool to process pixels in parallel.
+     */
+    bool    compute(const void* pixels, GLenum pixelDataType, const Vec2i& size,
+                ColorEncodingType encodingType, ColorPrimaryType primaryType,
+                float exposureValue, float valueScale, const Vec2f& logRange,
+                ThreadPool* pool = nullptr);
+
+    const Histogram& histogram() const { return mHistogram; }
+
+    const Vec3f& minValue() const { return mMinValue; }
+
+    const Vec3f& maxValue() const { return mMaxValue; }
+
+    const Vec3f& meanValue() const { return mMeanValue; }
+
+    // Return graded value at percentile kPercentiles[index].
+    const Vec3f& percentile(int index) const { return mPercentiles[index]; }
+
+    size_t  pixelCount() const { return mPixelCount; }
+
+    const HdrStatistics& hdrStatistics() const { return mHdrStatistics; }
+
+private:
+    Histogram   mHistogram = {};
+    HdrStatistics mHdrStatistics;
+    Vec3f       mMinValue = Vec3f(0.0f);
+    Vec3f       mMaxValue = Vec3f(0.0f);
+    Vec3f       mMeanValue = Vec3f(0.0f);
+    Vec3f       mPercentiles[kPercentileNum];
+    size_t      mPixelCount = 0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_IMAGE_STATISTICS_H_
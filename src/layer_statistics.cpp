@@ -0,0 +1,140 @@
+#include "layer_statistics.h"
+#include "image_statistics.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+using namespace baktsiu;
+
+// Steps of median estimate are this times mean absolute deviation over layer count,
+// i.e. about the inverse density at median of normal distribution.
+const float kMedianStepScale = 1.25f;
+
+// Deviations of new values are clamped to this times the running one, thus fireflies don't enlarge steps.
+const float kMaxDeviationRatio = 4.0f;
+
+}  // namespace
+
+namespace baktsiu
+{
+
+const char* LayerStatistics::getOutputName(Output output)
+{
+    static const char* names[OutputNum] = { "Mean", "Variance", "Median" };
+    return names[output];
+}
+
+void LayerStatistics::reset(const Vec2i& size)
+{
+    const size_t valueCount = static_cast<size_t>(size.x) * size.y * 3;
+    mSize = size;
+    mLayerCount = 0;
+    mMeans.assign(valueCount, 0.0f);
+    mSquaredDiffSums.assign(valueCount, 0.0f);
+    mMedians.assign(valueCount, 0.0f);
+    mDeviations.assign(valueCount, 0.0f);
+}
+
+bool LayerStatistics::accumulate(const ColorPipeline::Source& source, const Vec2i& size, ThreadPool* pool)
+{
+    if (size != mSize || mMeans.empty()) {
+        return false;
+    }
+
+    GradingTransform xform;
+    if (!xform.initialize(source.pixels, source.pixelDataType, source.encodingType, source.primaryType, 0.0f)) {
+        return false;
+    }
+
+    const int count = ++mLayerCount;
+    const size_t pixelCount = static_cast<size_t>(size.x) * size.y;
+    const size_t tilePixelNum = ColorPipeline::kTilePixelNum;
+    const size_t tileNum = (pixelCount + tilePixelNum - 1) / tilePixelNum;
+    parallelFor(pool, tileNum, [&](size_t begin, size_t end) {
+        std::vector<float> colors(tilePixelNum * 4);
+        for (size_t tile = begin; tile < end; ++tile) {
+            const size_t first = tile * tilePixelNum;
+            const size_t last = std::min(pixelCount, first + tilePixelNum);
+            xform.grade(first, last, colors.data());
+
+            for (size_t i = first; i < last; ++i) {
+                for (int c = 0; c < 3; ++c) {
+                    const size_t index = i * 3 + c;
+                    const float value = colors[(i - first) * 4 + c];
+
+                    float& mean = mMeans[index];
+                    const float delta = value - mean;
+                    mean += delta / count;
+                    mSquaredDiffSums[index] += delta * (value - mean);
+
+                    // The second value is kept in deviation until the median of first three is known.
+                    float& median = mMedians[index];
+                    float& deviation = mDeviations[index];
+                    if (count == 1) {
+                        median = value;
+                    } else if (count == 2) {
+                        deviation = value;
+                    } else if (count == 3) {
+                        const float value1 = median;
+                        const float value2 = deviation;
+                        median = std::max(std::min(value1, value2), std::min(std::max(value1, value2), value));
+                        deviation = (std::abs(value1 - median) + std::abs(value2 - median) + std::abs(value - median)) / 3.0f;
+                    } else {
+                        float valueDeviation = std::abs(value - median);
+                        if (deviation > 0.0f) {
+                            valueDeviation = std::min(valueDeviation, kMaxDeviationRatio * deviation);
+                        }
+
+                        deviation += (valueDeviation - deviation) / count;
+                        const float step = kMedianStepScale * deviation / count;
+                        median += value > median ? step : (value < median ? -step : 0.0f);
+                    }
+                }
+            }
+        }
+    });
+
+    return true;
+}
+
+std::vector<float> LayerStatistics::getPixels(Output output) const
+{
+    const size_t pixelCount = static_cast<size_t>(mSize.x) * mSize.y;
+    std::vector<float> pixels(pixelCount * 4, 1.0f);
+    const int layerCount = mLayerCount;
+    if (layerCount == 0 || mMeans.empty()) {
+        return pixels;
+    }
+
+    for (size_t i = 0; i < pixelCount; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            const size_t index = i * 3 + c;
+            float value = mMeans[index];
+            if (output == Variance) {
+                value = layerCount > 1 ? mSquaredDiffSums[index] / (layerCount - 1) : 0.0f;
+            } else if (output == Median) {
+                value = layerCount == 2 ? (mMedians[index] + mDeviations[index]) * 0.5f : mMedians[index];
+            }
+
+            pixels[i * 4 + c] = value;
+        }
+    }
+
+    return pixels;
+}
+
+void LayerStatistics::clear()
+{
+    mSize = Vec2i(0);
+    mLayerCount = 0;
+    mMeans = std::vector<float>();
+    mSquaredDiffSums = std::vector<float>();
+    mMedians = std::vector<float>();
+    mDeviations = std::vector<float>();
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,72 @@
+#ifndef BAKTSIU_LAYER_STATISTICS_H_
+#define BAKTSIU_LAYER_STATISTICS_H_
+
+#include "color_pipeline.h"
+#include "common.h"
+
+#include <atomic>
+#include <vector>
+
+namespace baktsiu
+{
+
+class ThreadPool;
+
+/**
+ * Per-pixel statistics across layers, e.g. renders of one frame with different seeds.
+ *
+ * Layers are graded to ACES AP1 at 0 EV and accumulated one at a time in tiles,
+ * thus only the decoded pixels of one layer are alive besides four RGB floats
+ * per pixel. Mean and variance are updated by Welford's algorithm. Median is
+ * approximated by a stochastic estimate, which starts from the median of the
+ * first three layers and moves towards each new value by a step proportional to
+ * the running mean absolute deviation divided by the layer count. Deviations
+ * of new values are clamped, thus unlike mean, it's barely moved by fireflies.
+ */
+class LayerStatistics
+{
+public:
+    enum Output
+    {
+        Mean = 0,
+        Variance,
+        Median,
+        OutputNum
+    };
+
+    static const char* getOutputName(Output output);
+
+public:
+    // Drop accumulated layers and prepare for layers of the size.
+    void    reset(const Vec2i& size);
+
+    /**
+     * Grade pixels of layer and accumulate them.
+     *
+     * @param source Decoded pixels and grading parameters, exposure is ignored.
+     * @param size Width and height of layer, it must be the size of reset().
+     * @param pool Optional thread pool to process tiles in parallel.
+     */
+    bool    accumulate(const ColorPipeline::Source& source, const Vec2i& size, ThreadPool* pool = nullptr);
+
+    // Return RGBA floats of output in the same order of pixels, alpha is 1.
+    std::vector<float> getPixels(Output output) const;
+
+    // Release accumulated values.
+    void    clear();
+
+    int     layerCount() const { return mLayerCount; }
+
+    const Vec2i& size() const { return mSize; }
+
+private:
+    Vec2i               mSize = Vec2i(0);
+    std::atomic<int>    mLayerCount{ 0 };   // Read by UI thread while accumulate() runs on another one.
+    std::vector<float>  mMeans;             // RGB of pixels.
+    std::vector<float>  mSquaredDiffSums;   // Sums of squared differences from means, i.e. M2 of Welford.
+    std::vector<float>  mMedians;
+    std::vector<float>  mDeviations;        // Mean absolute deviations from medians, the second layer before the third one.
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_LAYER_STATISTICS_H_
@@ -0,0 +1,683 @@
+#include "lut.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BAKTSIU_LUT_USE_SSE2
+#endif
+
+namespace
+{
+
+using namespace baktsiu;
+
+const size_t kPixelGrainSize = 16384;   // Number of pixels per task of thread pool.
+
+bool endsWithNoCase(const std::string& str, const std::string& token)
+{
+    if (str.size() < token.size()) {
+        return false;
+    }
+
+    return std::equal(token.rbegin(), token.rend(), str.rbegin(), [](char a, char b) {
+        return std::tolower(a) == std::tolower(b);
+    });
+}
+
+std::string getFilename(const std::string& filepath)
+{
+    const size_t pos = filepath.find_last_of("/\\");
+    return pos == std::string::npos ? filepath : filepath.substr(pos + 1);
+}
+
+//-----------------------------------------------------------------------------
+// Evaluation of each operator. The pixels are processed in place.
+//-----------------------------------------------------------------------------
+
+void applyMatrix(const LutOp& op, float* pixels, size_t pixelCount, int channelNum)
+{
+    const float* m = op.values.data();
+    for (size_t i = 0; i < pixelCount; ++i) {
+        float* rgb = pixels + i * channelNum;
+        const float r = rgb[0], g = rgb[1], b = rgb[2];
+        rgb[0] = m[0] * r + m[1] * g + m[2] * b + m[3];
+        rgb[1] = m[4] * r + m[5] * g + m[6] * b + m[7];
+        rgb[2] = m[8] * r + m[9] * g + m[10] * b + m[11];
+    }
+}
+
+void applyRange(const LutOp& op, float* pixels, size_t pixelCount, int channelNum)
+{
+    const float scale = op.values[0];
+    const float offset = op.values[1];
+    for (size_t i = 0; i < pixelCount; ++i) {
+        float* rgb = pixels + i * channelNum;
+        for (int c = 0; c < 3; ++c) {
+            rgb[c] = glm::clamp(rgb[c] * scale + offset, op.rangeMin[c], op.rangeMax[c]);
+        }
+    }
+}
+
+// Clamp fractional index of LUT entries to [0, maxIndex]. NaN is mapped to the
+// lower edge, since glm::clamp passes it through and casting it to int is undefined.
+float clampLutIndex(float t, float maxIndex)
+{
+    t = (t >= 0.0f) ? t : 0.0f;
+    return std::min(t, maxIndex);
+}
+
+void applyLut1D(const LutOp& op, float* pixels, size_t pixelCount, int channelNum)
+{
+    const float* values = op.values.data();
+    const float maxIndex = static_cast<float>(op.size - 1);
+    const Vec3f scale = maxIndex / (op.domainMax - op.domainMin);
+
+    for (size_t i = 0; i < pixelCount; ++i) {
+        float* rgb = pixels + i * channelNum;
+        for (int c = 0; c < 3; ++c) {
+            const float t = clampLutIndex((rgb[c] - op.domainMin[c]) * scale[c], maxIndex);
+            const int index = std::min(static_cast<int>(t), op.size - 2);
+            const float f = t - index;
+            const float v0 = values[index * 4 + c];
+            const float v1 = values[index * 4 + 4 + c];
+            rgb[c] = v0 + (v1 - v0) * f;
+        }
+    }
+}
+
+// Tetrahedral interpolation of 3D LUT.
+//
+// The cube of lattice is split into 6 tetrahedra by the order of fractional
+// coordinates. Each tetrahedron shares the diagonal from c000 to c111, thus
+// the result is c000 + f0 * (c1 - c000) + f1 * (c2 - c1) + f2 * (c111 - c2),
+// where f0 >= f1 >= f2 are sorted fractions, c1 and c2 are the lattice points
+// by stepping along the axes of f0 and f1 successively.
+void applyLut3D(const LutOp& op, float* pixels, size_t pixelCount, int channelNum)
+{
+    const float* values = op.values.data();
+    const int size = op.size;
+    const float maxIndex = static_cast<float>(size - 1);
+    const Vec3f scale = maxIndex / (op.domainMax - op.domainMin);
+
+    // Offsets of entries (in floats) when stepping along r, g, b axes.
+    const int strides[3] = { 4, size * 4, size * size * 4 };
+
+    for (size_t i = 0; i < pixelCount; ++i) {
+        float* rgb = pixels + i * channelNum;
+
+        int base = 0;
+        float f[3];
+        for (int c = 0; c < 3; ++c) {
+            const float t = clampLutIndex((rgb[c] - op.domainMin[c]) * scale[c], maxIndex);
+            const int index = std::min(static_cast<int>(t), size - 2);
+            f[c] = t - index;
+            base += index * strides[c];
+        }
+
+        // Sort axes by fractions in descending order.
+        int a0 = 0, a1 = 1, a2 = 2;
+        if (f[a0] < f[a1]) std::swap(a0, a1);
+        if (f[a1] < f[a2]) std::swap(a1, a2);
+        if (f[a0] < f[a1]) std::swap(a0, a1);
+
+        const float* c0 = values + base;
+        const float* c1 = c0 + strides[a0];
+        const float* c2 = c1 + strides[a1];
+        const float* c3 = c2 + strides[a2];
+
+#ifdef BAKTSIU_LUT_USE_SSE2
+        const __m128 v0 = _mm_loadu_ps(c0);
+        const __m128 v1 = _mm_loadu_ps(c1);
+        const __m128 v2 = _mm_loadu_ps(c2);
+        const __m128 v3 = _mm_loadu_ps(c3);
+
+        __m128 result = _mm_add_ps(v0, _mm_mul_ps(_mm_set1_ps(f[a0]), _mm_sub_ps(v1, v0)));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(f[a1]), _mm_sub_ps(v2, v1)));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(f[a2]), _mm_sub_ps(v3, v2)));
+
+        alignas(16) float output[4];
+        _mm_store_ps(output, result);
+        rgb[0] = output[0];
+        rgb[1] = output[1];
+        rgb[2] = output[2];
+#else
+        for (int c = 0; c < 3; ++c) {
+            rgb[c] = c0[c] + f[a0] * (c1[c] - c0[c]) + f[a1] * (c2[c] - c1[c]) + f[a2] * (c3[c] - c2[c]);
+        }
+#endif
+    }
+}
+
+void applyOp(const LutOp& op, float* pixels, size_t pixelCount, int channelNum)
+{
+    switch (op.type) {
+    case LutOpType::Matrix:
+        applyMatrix(op, pixels, pixelCount, channelNum);
+        break;
+    case LutOpType::Range:
+        applyRange(op, pixels, pixelCount, channelNum);
+        break;
+    case LutOpType::Lut1D:
+        applyLut1D(op, pixels, pixelCount, channelNum);
+        break;
+    case LutOpType::Lut3D:
+        applyLut3D(op, pixels, pixelCount, channelNum);
+        break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Helpers of CLF parsing. CLF is XML, but we only need to walk through the
+// child elements of ProcessList, thus a tiny tag scanner is sufficient.
+//-----------------------------------------------------------------------------
+
+struct XmlElement
+{
+    std::string name;
+    std::string attributes;
+    std::string body;
+};
+
+// Find next element starting from pos, comments and declarations are skipped.
+// @return False if there is no more element or we reach a closing tag.
+bool nextXmlElement(const std::string& xml, size_t& pos, XmlElement& element)
+{
+    while (true) {
+        pos = xml.find('<', pos);
+        if (pos == std::string::npos || pos + 1 >= xml.size()) {
+            return false;
+        }
+
+        if (xml.compare(pos, 4, "<!--") == 0) {
+            pos = xml.find("-->", pos);
+            if (pos == std::string::npos) return false;
+            continue;
+        }
+
+        if (xml[pos + 1] == '?' || xml[pos + 1] == '!') {
+            pos = xml.find('>', pos);
+            if (pos == std::string::npos) return false;
+            continue;
+        }
+
+        break;
+    }
+
+    if (xml[pos + 1] == '/') {
+        return false;
+    }
+
+    const size_t tagEnd = xml.find('>', pos);
+    if (tagEnd == std::string::npos) {
+        return false;
+    }
+
+    size_t nameEnd = pos + 1;
+    while (nameEnd < tagEnd && !std::isspace(static_cast<unsigned char>(xml[nameEnd])) && xml[nameEnd] != '/') {
+        ++nameEnd;
+    }
+
+    element.name = xml.substr(pos + 1, nameEnd - pos - 1);
+    element.attributes = xml.substr(nameEnd, tagEnd - nameEnd);
+    element.body.clear();
+
+    if (xml[tagEnd - 1] == '/') {
+        pos = tagEnd + 1;
+        return true;
+    }
+
+    const std::string closingTag = "</" + element.name;
+    const size_t bodyEnd = xml.find(closingTag, tagEnd);
+    if (bodyEnd == std::string::npos) {
+        return false;
+    }
+
+    element.body = xml.substr(tagEnd + 1, bodyEnd - tagEnd - 1);
+    pos = xml.find('>', bodyEnd);
+    pos = pos == std::string::npos ? xml.size() : pos + 1;
+    return true;
+}
+
+std::string getXmlAttribute(const std::string& attributes, const std::string& name)
+{
+    size_t pos = 0;
+    while ((pos = attributes.find(name, pos)) != std::string::npos) {
+        const bool isWholeName = pos == 0 || std::isspace(static_cast<unsigned char>(attributes[pos - 1]));
+        size_t valuePos = attributes.find_first_not_of(" \t\r\n", pos + name.size());
+        pos += name.size();
+
+        if (!isWholeName || valuePos == std::string::npos || attributes[valuePos] != '=') {
+            continue;
+        }
+
+        valuePos = attributes.find_first_of("\"'", valuePos);
+        if (valuePos == std::string::npos) {
+            break;
+        }
+
+        const size_t valueEnd = attributes.find(attributes[valuePos], valuePos + 1);
+        if (valueEnd == std::string::npos) {
+            break;
+        }
+
+        return attributes.substr(valuePos + 1, valueEnd - valuePos - 1);
+    }
+
+    return "";
+}
+
+// Return the first child element with given name.
+bool findXmlChild(const std::string& body, const std::string& name, XmlElement& child)
+{
+    size_t pos = 0;
+    XmlElement element;
+    while (nextXmlElement(body, pos, element)) {
+        if (element.name == name) {
+            child = std::move(element);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool parseFloats(const std::string& text, std::vector<float>& values)
+{
+    const char* ptr = text.c_str();
+    char* end = nullptr;
+    while (true) {
+        const float value = std::strtof(ptr, &end);
+        if (end == ptr) {
+            break;
+        }
+        values.push_back(value);
+        ptr = end;
+    }
+
+    // Only trailing white spaces are allowed.
+    while (*ptr != '\0' && std::isspace(static_cast<unsigned char>(*ptr))) {
+        ++ptr;
+    }
+    return *ptr == '\0';
+}
+
+// Return the max code value of CLF bit depth, e.g. 1023 for "10i".
+float getBitDepthScale(const std::string& bitDepth)
+{
+    if (bitDepth == "8i") return 255.0f;
+    if (bitDepth == "10i") return 1023.0f;
+    if (bitDepth == "12i") return 4095.0f;
+    if (bitDepth == "16i") return 65535.0f;
+    return 1.0f;  // 16f, 32f
+}
+
+// Parse <Array dim="..."> element of CLF.
+// @param dimNum Number of leading dimensions which determine the value count.
+bool parseClfArray(const XmlElement& parent, size_t dimNum, std::vector<int>& dims, std::vector<float>& values)
+{
+    XmlElement array;
+    if (!findXmlChild(parent.body, "Array", array)) {
+        LOGW("Missing Array in {}", parent.name);
+        return false;
+    }
+
+    std::vector<float> dimValues;
+    parseFloats(getXmlAttribute(array.attributes, "dim"), dimValues);
+    dims.assign(dimValues.begin(), dimValues.end());
+
+    if (!parseFloats(array.body, values)) {
+        LOGW("Invalid values in Array of {}", parent.name);
+        return false;
+    }
+
+    // Matrix of CLF v2 has a redundant 3rd dimension, e.g. "3 4 3".
+    size_t expectedCount = dims.size() < dimNum ? 0 : 1;
+    for (size_t i = 0; i < dimNum && i < dims.size(); ++i) {
+        expectedCount *= std::max(dims[i], 0);
+    }
+
+    if (expectedCount == 0 || values.size() != expectedCount) {
+        LOGW("Array of {} has {} values, but {} are expected", parent.name, values.size(), expectedCount);
+        return false;
+    }
+
+    return true;
+}
+
+bool parseClfOptionalFloat(const std::string& body, const std::string& name, float& value)
+{
+    XmlElement element;
+    if (!findXmlChild(body, name, element)) {
+        return false;
+    }
+
+    std::vector<float> values;
+    parseFloats(element.body, values);
+    if (values.empty()) {
+        return false;
+    }
+
+    value = values[0];
+    return true;
+}
+
+}  // namespace
+
+
+namespace baktsiu
+{
+
+bool Lut::isSupported(const std::string& filepath)
+{
+    return endsWithNoCase(filepath, ".cube") || endsWithNoCase(filepath, ".clf");
+}
+
+bool Lut::loadFromFile(const std::string& filepath)
+{
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file) {
+        LOGW("Failed to open LUT file {}", filepath);
+        return false;
+    }
+
+    std::ostringstream stream;
+    stream << file.rdbuf();
+
+    mFilePath = filepath;
+    mName = getFilename(filepath);
+    mOps.clear();
+
+    const bool status = endsWithNoCase(filepath, ".clf") ? parseClf(stream.str()) : parseCube(stream.str());
+    if (!status) {
+        LOGW("Failed to parse LUT file {}", filepath);
+        mOps.clear();
+    }
+
+    return status;
+}
+
+bool Lut::parseCube(const std::string& contents)
+{
+    std::istringstream stream(contents);
+    std::string line;
+    int lineNo = 0;
+
+    int size1D = 0;
+    int size3D = 0;
+    Vec3f domainMin(0.0f), domainMax(1.0f);
+    Vec2f inputRange1D(0.0f, 1.0f), inputRange3D(0.0f, 1.0f);
+    bool hasInputRange1D = false, hasInputRange3D = false;
+    std::vector<float> entries;
+
+    while (std::getline(stream, line)) {
+        ++lineNo;
+
+        const size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#') {
+            continue;
+        }
+
+        const char ch = line[begin];
+        if (std::isdigit(static_cast<unsigned char>(ch)) || ch == '-' || ch == '+' || ch == '.') {
+            const size_t prevCount = entries.size();
+            if (!parseFloats(line.substr(begin), entries) || entries.size() - prevCount != 3) {
+                LOGW("Invalid LUT entry at line {}", lineNo);
+                return false;
+            }
+            entries.push_back(0.0f);    // Padding for RGBx layout.
+            continue;
+        }
+
+        std::istringstream lineStream(line.substr(begin));
+        std::string keyword;
+        lineStream >> keyword;
+
+        if (keyword == "TITLE") {
+            continue;
+        } else if (keyword == "LUT_1D_SIZE") {
+            lineStream >> size1D;
+        } else if (keyword == "LUT_3D_SIZE") {
+            lineStream >> size3D;
+        } else if (keyword == "DOMAIN_MIN") {
+            lineStream >> domainMin.r >> domainMin.g >> domainMin.b;
+        } else if (keyword == "DOMAIN_MAX") {
+            lineStream >> domainMax.r >> domainMax.g >> domainMax.b;
+        } else if (keyword == "LUT_1D_INPUT_RANGE") {
+            lineStream >> inputRange1D.x >> inputRange1D.y;
+            hasInputRange1D = true;
+        } else if (keyword == "LUT_3D_INPUT_RANGE") {
+            lineStream >> inputRange3D.x >> inputRange3D.y;
+            hasInputRange3D = true;
+        } else {
+            LOGW("Skip unknown keyword {} at line {}", keyword, lineNo);
+            continue;
+        }
+
+        if (lineStream.fail()) {
+            LOGW("Invalid value of {} at line {}", keyword, lineNo);
+            return false;
+        }
+    }
+
+    if (size1D < 0 || size3D < 0 || (size1D == 0 && size3D == 0) ||
+        size1D == 1 || size1D > 65536 || size3D == 1 || size3D > 256) {
+        LOGW("Invalid LUT size (1D: {}, 3D: {})", size1D, size3D);
+        return false;
+    }
+
+    // Sizes are bounded above, thus the count fits in int64_t without overflow.
+    const int64_t entryNum = static_cast<int64_t>(size1D) + static_cast<int64_t>(size3D) * size3D * size3D;
+    if (static_cast<int64_t>(entries.size() / 4) != entryNum) {
+        LOGW("LUT has {} entries, but {} are expected", entries.size() / 4, entryNum);
+        return false;
+    }
+
+    if (glm::any(glm::lessThanEqual(domainMax, domainMin)) ||
+        inputRange1D.y <= inputRange1D.x || inputRange3D.y <= inputRange3D.x) {
+        LOGW("Invalid input domain of LUT");
+        return false;
+    }
+
+    // A shaper 1D LUT (as Resolve does) is followed by 3D LUT in the same file.
+    if (size1D > 0) {
+        LutOp op;
+        op.type = LutOpType::Lut1D;
+        op.size = size1D;
+        op.domainMin = hasInputRange1D ? Vec3f(inputRange1D.x) : domainMin;
+        op.domainMax = hasInputRange1D ? Vec3f(inputRange1D.y) : domainMax;
+        op.values.assign(entries.begin(), entries.begin() + size1D * 4);
+        mOps.push_back(std::move(op));
+    }
+
+    if (size3D > 0) {
+        LutOp op;
+        op.type = LutOpType::Lut3D;
+        op.size = size3D;
+        op.domainMin = hasInputRange3D ? Vec3f(inputRange3D.x) : (size1D > 0 ? Vec3f(0.0f) : domainMin);
+        op.domainMax = hasInputRange3D ? Vec3f(inputRange3D.y) : (size1D > 0 ? Vec3f(1.0f) : domainMax);
+        op.values.assign(entries.begin() + size1D * 4, entries.end());
+        mOps.push_back(std::move(op));
+    }
+
+    return true;
+}
+
+bool Lut::parseClf(const std::string& contents)
+{
+    size_t pos = contents.find("<ProcessList");
+    XmlElement processList;
+    if (pos == std::string::npos || !nextXmlElement(contents, pos, processList)) {
+        LOGW("Missing ProcessList in CLF");
+        return false;
+    }
+
+    XmlElement node;
+    pos = 0;
+    while (nextXmlElement(processList.body, pos, node)) {
+        if (node.name == "Description" || node.name == "InputDescriptor" ||
+            node.name == "OutputDescriptor" || node.name == "Info") {
+            continue;
+        }
+
+        // Values in CLF are scaled by bit depth, we normalize them to [0, 1].
+        const float inScale = getBitDepthScale(getXmlAttribute(node.attributes, "inBitDepth"));
+        const float outScale = getBitDepthScale(getXmlAttribute(node.attributes, "outBitDepth"));
+        std::vector<int> dims;
+        std::vector<float> values;
+        LutOp op;
+
+        if (node.name == "Matrix") {
+            if (!parseClfArray(node, 2, dims, values)) {
+                return false;
+            }
+
+            const int columnNum = dims[1];
+            if (dims[0] != 3 || (columnNum != 3 && columnNum != 4)) {
+                LOGW("Unsupported Matrix dimension in CLF");
+                return false;
+            }
+
+            op.type = LutOpType::Matrix;
+            op.values.assign(12, 0.0f);
+            for (int row = 0; row < 3; ++row) {
+                for (int col = 0; col < columnNum; ++col) {
+                    const float scale = col < 3 ? inScale / outScale : 1.0f / outScale;
+                    op.values[row * 4 + col] = values[row * columnNum + col] * scale;
+                }
+            }
+        } else if (node.name == "Range") {
+            float minIn = 0.0f, maxIn = 0.0f, minOut = 0.0f, maxOut = 0.0f;
+            const bool hasMin = parseClfOptionalFloat(node.body, "minInValue", minIn) &&
+                parseClfOptionalFloat(node.body, "minOutValue", minOut);
+            const bool hasMax = parseClfOptionalFloat(node.body, "maxInValue", maxIn) &&
+                parseClfOptionalFloat(node.body, "maxOutValue", maxOut);
+            const bool noClamp = getXmlAttribute(node.attributes, "style") == "noClamp";
+
+            minIn /= inScale;
+            maxIn /= inScale;
+            minOut /= outScale;
+            maxOut /= outScale;
+
+            float scale = 1.0f;
+            float offset = 0.0f;
+            if (hasMin && hasMax) {
+                if (maxIn <= minIn) {
+                    LOGW("Invalid input range of Range in CLF");
+                    return false;
+                }
+                scale = (maxOut - minOut) / (maxIn - minIn);
+                offset = minOut - minIn * scale;
+            } else if (hasMin) {
+                offset = minOut - minIn;
+            } else if (hasMax) {
+                offset = maxOut - maxIn;
+            }
+
+            const float infinity = std::numeric_limits<float>::infinity();
+            op.type = LutOpType::Range;
+            op.values = { scale, offset };
+            op.rangeMin = Vec3f(hasMin && !noClamp ? minOut : -infinity);
+            op.rangeMax = Vec3f(hasMax && !noClamp ? maxOut : infinity);
+        } else if (node.name == "LUT1D") {
+            if (!getXmlAttribute(node.attributes, "halfDomain").empty()) {
+                LOGW("LUT1D with half domain is not supported");
+                return false;
+            }
+
+            if (!parseClfArray(node, 2, dims, values)) {
+                return false;
+            }
+
+            const int channelNum = dims[1];
+            if (dims[0] < 2 || (channelNum != 1 && channelNum != 3)) {
+                LOGW("Unsupported LUT1D dimension in CLF");
+                return false;
+            }
+
+            op.type = LutOpType::Lut1D;
+            op.size = dims[0];
+            op.values.resize(op.size * 4, 0.0f);
+            for (int i = 0; i < op.size; ++i) {
+                for (int c = 0; c < 3; ++c) {
+                    op.values[i * 4 + c] = values[i * channelNum + (channelNum == 3 ? c : 0)] / outScale;
+                }
+            }
+        } else if (node.name == "LUT3D") {
+            if (!parseClfArray(node, 4, dims, values)) {
+                return false;
+            }
+
+            const int size = dims[0];
+            if (size < 2 || dims[1] != size || dims[2] != size || dims[3] != 3) {
+                LOGW("Unsupported LUT3D dimension in CLF");
+                return false;
+            }
+
+            // CLF orders LUT3D with blue changing fastest, we reorder it to red fastest.
+            op.type = LutOpType::Lut3D;
+            op.size = size;
+            op.values.resize(static_cast<size_t>(size) * size * size * 4, 0.0f);
+            for (int r = 0; r < size; ++r) {
+                for (int g = 0; g < size; ++g) {
+                    for (int b = 0; b < size; ++b) {
+                        const float* src = &values[((r * size + g) * size + b) * 3];
+                        float* dst = &op.values[((b * size + g) * size + r) * 4];
+                        dst[0] = src[0] / outScale;
+                        dst[1] = src[1] / outScale;
+                        dst[2] = src[2] / outScale;
+                    }
+                }
+            }
+        } else {
+            LOGW("Unsupported process node {} in CLF", node.name);
+            return false;
+        }
+
+        mOps.push_back(std::move(op));
+    }
+
+    if (mOps.empty()) {
+        LOGW("No process node in CLF");
+        return false;
+    }
+
+    return true;
+}
+
+void Lut::apply(float* pixels, size_t pixelCount, int channelNum, ThreadPool* pool) const
+{
+    if (channelNum < 3) {
+        LOGW("LUT requires at least 3 channels, but {} is given", channelNum);
+        return;
+    }
+
+    auto process = [&](size_t begin, size_t end) {
+        // Apply operators chunk by chunk to keep the inner loops tight.
+        float* chunk = pixels + begin * channelNum;
+        for (const LutOp& op : mOps) {
+            applyOp(op, chunk, end - begin, channelNum);
+        }
+    };
+
+    if (pool) {
+        pool->parallelFor(pixelCount, kPixelGrainSize, process);
+    } else {
+        process(0, pixelCount);
+    }
+}
+
+Vec3f Lut::apply(const Vec3f& color) const
+{
+    Vec3f result = color;
+    apply(&result.r, 1, 3);
+    return result;
+}
+
+}  // namespace baktsiu
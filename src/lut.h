@@ -0,0 +1,101 @@
+#ifndef BAKTSIU_LUT_H_
+#define BAKTSIU_LUT_H_
+
+#include "common.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace baktsiu
+{
+
+class ThreadPool;
+
+// Type of color operator in a LUT file.
+enum class LutOpType : char
+{
+    Matrix,     // 3x4 matrix with offsets.
+    Range,      // Linear remapping with clamping.
+    Lut1D,      // Per-channel curve with linear interpolation.
+    Lut3D,      // 3D lattice with tetrahedral interpolation.
+};
+
+
+// Single color operator of LUT. All values are normalized to [0, 1] range,
+// thus bit depth scaling of CLF has been resolved during parsing.
+struct LutOp
+{
+    LutOpType   type = LutOpType::Lut3D;
+
+    // Number of entries of Lut1D, or edge length of Lut3D.
+    int         size = 0;
+
+    // Input domain of Lut1D and Lut3D.
+    Vec3f       domainMin = Vec3f(0.0f);
+    Vec3f       domainMax = Vec3f(1.0f);
+
+    // Clamping bounds of Range, they are infinite for unclamped ranges.
+    Vec3f       rangeMin = Vec3f(0.0f);
+    Vec3f       rangeMax = Vec3f(1.0f);
+
+    // Lut1D and Lut3D entries are stored as RGBx with 4 floats, which could be
+    // directly loaded to SIMD registers and uploaded as RGBA textures. Lut3D
+    // is ordered with red changing fastest. Matrix stores 3 rows of 4 floats.
+    // Range stores scale and offset, i.e. out = clamp(in * scale + offset).
+    std::vector<float> values;
+};
+
+
+/**
+ * Color look-up table loaded from .cube or CLF (Common LUT Format) file.
+ *
+ * A LUT is an ordered list of color operators. The CPU evaluator applies
+ * these operators with SIMD instructions and splits pixels to threads.
+ */
+class Lut
+{
+public:
+    // Return true if file extension is .cube or .clf.
+    static bool isSupported(const std::string& filepath);
+
+public:
+    bool    loadFromFile(const std::string& filepath);
+
+    // Parse contents of .cube file.
+    bool    parseCube(const std::string& contents);
+
+    // Parse ProcessList of CLF file, only Matrix, Range, LUT1D and LUT3D are supported.
+    bool    parseClf(const std::string& contents);
+
+    /**
+     * Apply LUT to pixels in place.
+     *
+     * @param pixels Interleaved pixel values, the 4th channel is untouched.
+     * @param pixelCount Number of pixels.
+     * @param channelNum Number of channels per pixel, which should be 3 or 4.
+     * @param pool Optional thread pool to process pixels in parallel.
+     */
+    void    apply(float* pixels, size_t pixelCount, int channelNum, ThreadPool* pool = nullptr) const;
+
+    // Apply LUT to single color.
+    Vec3f   apply(const Vec3f& color) const;
+
+    const std::vector<LutOp>& ops() const { return mOps; }
+
+    bool    isEmpty() const { return mOps.empty(); }
+
+    inline const std::string& filepath() const { return mFilePath; }
+
+    inline const std::string& name() const { return mName; }
+
+private:
+    std::string         mFilePath;
+    std::string         mName;
+    std::vector<LutOp>  mOps;
+};
+
+using LutSPtr = std::shared_ptr<Lut>;
+
+}  // namespace baktsiu
+#endif // BAKTSIU_LUT_H_
@@ -0,0 +1,160 @@
+#include "lut_library.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace baktsiu;
+
+// Return true if the operators are a 3D LUT with an optional 1D shaper,
+// which could be evaluated by present.frag directly.
+bool isDisplayable(const std::vector<LutOp>& ops)
+{
+    if (ops.size() == 1) {
+        return ops[0].type == LutOpType::Lut1D || ops[0].type == LutOpType::Lut3D;
+    }
+
+    return ops.size() == 2 && ops[0].type == LutOpType::Lut1D && ops[1].type == LutOpType::Lut3D;
+}
+
+GLuint createLut1DTexture(const LutOp& op)
+{
+    const int width = std::min(op.size, LutTextures::kLut1DRowSize);
+    const int height = (op.size + LutTextures::kLut1DRowSize - 1) / LutTextures::kLut1DRowSize;
+
+    // Pad the last row for uploading a complete rectangle.
+    std::vector<float> values(op.values);
+    values.resize(static_cast<size_t>(width) * height * 4, 0.0f);
+
+    GLuint texId = 0;
+    glGenTextures(1, &texId);
+    glBindTexture(GL_TEXTURE_2D, texId);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, values.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return texId;
+}
+
+}  // namespace
+
+
+namespace baktsiu
+{
+
+void LutLibrary::initialize(ThreadPool* pool)
+{
+    mThreadPool = pool;
+}
+
+void LutLibrary::release()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (auto& item : mTextures) {
+        LutTextures& textures = item.second;
+        if (textures.lut1D != 0) {
+            glDeleteTextures(1, &textures.lut1D);
+        }
+
+        textures.lut3D.release();
+    }
+
+    mTextures.clear();
+    mLuts.clear();
+}
+
+LutSPtr LutLibrary::acquire(const std::string& filepath)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = std::find_if(mLuts.begin(), mLuts.end(), [&filepath](const LutSPtr& lut) {
+            return lut->filepath() == filepath;
+        });
+
+        if (iter != mLuts.end()) {
+            return *iter;
+        }
+    }
+
+    // Parse file without holding the lock, since it might take a while for large LUTs.
+    LutSPtr lut = std::make_shared<Lut>();
+    if (!lut->loadFromFile(filepath)) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mLuts.push_back(lut);
+    return lut;
+}
+
+const LutTextures* LutLibrary::getTextures(const LutSPtr& lut)
+{
+    if (!lut) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto iter = mTextures.find(lut.get());
+    if (iter == mTextures.end()) {
+        iter = mTextures.emplace(lut.get(), LutTextures()).first;
+        uploadTextures(*lut, iter->second);
+    }
+
+    return &iter->second;
+}
+
+std::vector<LutSPtr> LutLibrary::luts() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mLuts;
+}
+
+void LutLibrary::uploadTextures(const Lut& lut, LutTextures& textures)
+{
+    const std::vector<LutOp>& ops = lut.ops();
+
+    if (isDisplayable(ops)) {
+        for (const LutOp& op : ops) {
+            if (op.type == LutOpType::Lut1D) {
+                textures.lut1D = createLut1DTexture(op);
+                textures.size1D = op.size;
+                textures.domain1DMin = op.domainMin;
+                textures.domain1DMax = op.domainMax;
+            } else {
+                textures.lut3D.initialize(op.size, GL_RGBA32F, op.values.data());
+                textures.domain3DMin = op.domainMin;
+                textures.domain3DMax = op.domainMax;
+            }
+        }
+
+        return;
+    }
+
+    // Bake operators into a 3D LUT by the CPU evaluator.
+    const int size = kBakedLutSize;
+    const float maxIndex = static_cast<float>(size - 1);
+    std::vector<float> values(static_cast<size_t>(size) * size * size * 4, 1.0f);
+
+    for (int b = 0, idx = 0; b < size; ++b) {
+        for (int g = 0; g < size; ++g) {
+            for (int r = 0; r < size; ++r, idx += 4) {
+                values[idx] = r / maxIndex;
+                values[idx + 1] = g / maxIndex;
+                values[idx + 2] = b / maxIndex;
+            }
+        }
+    }
+
+    lut.apply(values.data(), values.size() / 4, 4, mThreadPool);
+    textures.lut3D.initialize(size, GL_RGBA32F, values.data());
+    LOGI("Baked LUT {} into {}^3 lattice", lut.name(), size);
+}
+
+}  // namespace baktsiu
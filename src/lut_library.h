@@ -0,0 +1,76 @@
+#ifndef BAKTSIU_LUT_LIBRARY_H_
+#define BAKTSIU_LUT_LIBRARY_H_
+
+#include "lut.h"
+#include "texture.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace baktsiu
+{
+
+// Textures of LUT for display in present.frag.
+struct LutTextures
+{
+    // Number of 1D LUT entries are wrapped into rows of this width, it must match
+    // LUT1D_ROW_SIZE@present.frag.
+    static const int kLut1DRowSize = 4096;
+
+    GLuint      lut1D = 0;      // RGBA32F 2D texture, zero if there is no 1D LUT.
+    Texture3D   lut3D;          // RGBA32F 3D texture, its size is zero if there is no 3D LUT.
+
+    int         size1D = 0;
+    Vec3f       domain1DMin = Vec3f(0.0f);
+    Vec3f       domain1DMax = Vec3f(1.0f);
+    Vec3f       domain3DMin = Vec3f(0.0f);
+    Vec3f       domain3DMax = Vec3f(1.0f);
+};
+
+
+/**
+ * Cache of loaded LUTs and their textures.
+ *
+ * LUT files are parsed once per file path. Textures are uploaded at the first
+ * request. LUTs composed of a 1D shaper and a 3D LUT are uploaded directly,
+ * otherwise the whole operator chain is baked into a 3D LUT over [0, 1].
+ */
+class LutLibrary
+{
+public:
+    LutLibrary() = default;
+    LutLibrary(const LutLibrary&) = delete;
+    LutLibrary& operator=(const LutLibrary&) = delete;
+
+    // The thread pool is used to bake LUTs, it must outlive this library.
+    void    initialize(ThreadPool* pool);
+
+    // Release all textures, they should be released in the thread of GL context.
+    void    release();
+
+    // Return LUT of given file path, the file is only parsed at the first time.
+    // Return nullptr if the file is failed to parse.
+    LutSPtr acquire(const std::string& filepath);
+
+    // Return textures of given LUT, it must be called in the thread of GL context.
+    const LutTextures* getTextures(const LutSPtr& lut);
+
+    // Return loaded LUTs in loading order.
+    std::vector<LutSPtr> luts() const;
+
+private:
+    void    uploadTextures(const Lut& lut, LutTextures& textures);
+
+private:
+    static const int kBakedLutSize = 65;
+
+    mutable std::mutex  mMutex;
+    std::vector<LutSPtr> mLuts;
+    std::unordered_map<const Lut*, LutTextures> mTextures;
+    ThreadPool*         mThreadPool = nullptr;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_LUT_LIBRARY_H_
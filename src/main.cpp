@@ -3,26 +3,210 @@
 #include <vector>
 
 #include "app.h"
+#include "batch_diff.h"
+#include "image_diff.h"
+#include "image_metrics.h"
+#include "texture.h"
+#include "thread_pool.h"
 #include "docopt/docopt.h"
 
+#include <cstdlib>
+#include <thread>
+
 static const char USAGE[] =
 R"(Bak-Tsiu, examining every image details.
 
     Usage:
       baktsiu
+      baktsiu diff <path1> <path2> [options]
       baktsiu [--split | --columns] <name>...
       baktsiu (-h | --help)
       baktsiu --version
 
     Options:
-      -h --help     Show this screen.
-      --version     Show version.
+      -h --help             Show this screen.
+      --version             Show version.
+      --metric=<name>       Metric of differences: deltaE, psnr, ssim, msssim or flip [default: deltaE].
+      --threshold=<value>   Pixels with larger delta E are counted, or the bound of image metric to pass.
+                            Defaults: deltaE 2, psnr 40 (dB), ssim and msssim 0.99, flip 0.05.
+      --ppd=<value>         Pixels per degree of viewing distance for FLIP [default: 67].
+      --json=<path>         Write statistics of differences or values of image metrics to JSON file.
+      --heatmap=<path>      Write heat map of delta E to PNG or EXR file.
+      --heat-max=<value>    Difference mapped to the hottest color, it's the threshold by default.
+      --html=<path>         Write HTML summary of comparison between directories.
+      --session=<path>      Write session of the worst pairs of comparison between directories.
+      --jobs=<num>          Number of images compared at a time, it's hardware concurrency by default.
 )";
 
+// Exit codes of diff command.
+enum DiffExitCode
+{
+    DiffPassed = 0,
+    DiffFailed = 1,     // Some pixels have differences above threshold, or the image metric isn't within it.
+    DiffError = 2
+};
+
+static bool parseFloat(const std::string& text, float& value)
+{
+    char* end = nullptr;
+    value = std::strtof(text.c_str(), &end);
+    return end != text.c_str() && *end == '\0';
+}
+
+// Compare two images, or images of two directories, without any window or GL context.
+// Thus it runs on headless machines.
+static int runDiffCommand(std::map<std::string, docopt::value>& args)
+{
+    using namespace baktsiu;
+
+    App::initLogger();
+
+    // Image metrics are computed instead of delta E of pixels, if any of them is given.
+    const std::string metric = args["--metric"].asString();
+    const float defaultThresholds[ImageMetrics::MetricNum] = { 40.0f, 0.99f, 0.99f, 0.05f };
+    int imageMetric = -1;
+    for (int i = 0; i < ImageMetrics::MetricNum; ++i) {
+        if (metric == ImageMetrics::getMetricName(static_cast<ImageMetrics::Metric>(i))) {
+            imageMetric = i;
+        }
+    }
+
+    if (metric != "deltaE" && imageMetric < 0) {
+        LOGW("Unsupported metric {}", metric);
+        return DiffError;
+    }
+
+    float threshold = imageMetric >= 0 ? defaultThresholds[imageMetric] : 2.0f;
+    if (args["--threshold"] && (!parseFloat(args["--threshold"].asString(), threshold) || threshold < 0.0f)) {
+        LOGW("Invalid threshold {}", args["--threshold"].asString());
+        return DiffError;
+    }
+
+    float pixelsPerDegree = 0.0f;
+    if (!parseFloat(args["--ppd"].asString(), pixelsPerDegree) || pixelsPerDegree <= 0.0f) {
+        LOGW("Invalid pixels per degree {}", args["--ppd"].asString());
+        return DiffError;
+    }
+
+    if (imageMetric >= 0 && args["--heatmap"]) {
+        LOGW("Heat map is only available for deltaE");
+        return DiffError;
+    }
+
+    float heatMax = threshold;
+    if (args["--heat-max"] && !parseFloat(args["--heat-max"].asString(), heatMax)) {
+        LOGW("Invalid max difference of heat map {}", args["--heat-max"].asString());
+        return DiffError;
+    }
+
+    const std::string paths[2] = { args["<path1>"].asString(), args["<path2>"].asString() };
+    if (BatchDiff::isDirectory(paths[0]) && BatchDiff::isDirectory(paths[1])) {
+        if (imageMetric >= 0) {
+            LOGW("Directories are only compared with deltaE");
+            return DiffError;
+        }
+
+        BatchDiff::Options options;
+        options.threshold = threshold;
+        options.heatMax = heatMax;
+        if (args["--jobs"]) {
+            options.jobNum = std::atoi(args["--jobs"].asString().c_str());
+        }
+
+        BatchDiff batchDiff;
+        if (!batchDiff.run(paths[0], paths[1], options)) {
+            return DiffError;
+        }
+
+        if ((args["--json"] && !batchDiff.writeReport(args["--json"].asString())) ||
+            (args["--html"] && !batchDiff.writeHtml(args["--html"].asString())) ||
+            (args["--session"] && !batchDiff.writeSession(args["--session"].asString()))) {
+            return DiffError;
+        }
+
+        return batchDiff.issueCount() > 0 ? DiffFailed : DiffPassed;
+    }
+
+    // Decode both images in parallel.
+    Texture textures[2];
+    bool isLoaded[2] = {};
+    std::thread loader([&]() { isLoaded[1] = textures[1].loadFromFile(paths[1]); });
+    isLoaded[0] = textures[0].loadFromFile(paths[0]);
+    loader.join();
+
+    for (int i = 0; i < 2; ++i) {
+        if (!isLoaded[i]) {
+            LOGW("Failed to load {}", paths[i]);
+            return DiffError;
+        }
+    }
+
+    const Vec2i size(textures[0].size());
+    if (size != Vec2i(textures[1].size())) {
+        LOGW("Image sizes are different: {}x{} and {}x{}", size.x, size.y,
+            textures[1].size().x, textures[1].size().y);
+        return DiffError;
+    }
+
+    ThreadPool pool;
+    pool.initialize();
+
+    if (imageMetric >= 0) {
+        ImageMetrics::Settings settings;
+        settings.pixelsPerDegree = pixelsPerDegree;
+
+        ImageMetrics metrics;
+        if (!metrics.compute(ImageDiff::getColorSource(textures[0]), ImageDiff::getColorSource(textures[1]),
+                size, settings, &pool)) {
+            return DiffError;
+        }
+
+        LOGI("Metrics of {}x{} pixels in {:.1f} ms:", size.x, size.y, metrics.elapsedTime() * 1000.0);
+        for (int i = 0; i < ImageMetrics::MetricNum; ++i) {
+            const auto type = static_cast<ImageMetrics::Metric>(i);
+            LOGI("  {}: {:.6f}", ImageMetrics::getMetricLabel(type), metrics.value(type));
+        }
+
+        const auto type = static_cast<ImageMetrics::Metric>(imageMetric);
+        const bool isPassed = metrics.isPassed(type, threshold);
+        LOGI("{} {} threshold {}", ImageMetrics::getMetricLabel(type), isPassed ? "passes" : "fails", threshold);
+
+        if (args["--json"] && !metrics.writeReport(args["--json"].asString(), paths[0], paths[1], type, threshold)) {
+            return DiffError;
+        }
+
+        return isPassed ? DiffPassed : DiffFailed;
+    }
+
+    ImageDiff diff;
+    if (!diff.compute(ImageDiff::getColorSource(textures[0]), ImageDiff::getColorSource(textures[1]),
+            size, threshold, &pool)) {
+        return DiffError;
+    }
+
+    const ImageDiff::Statistics& stats = diff.statistics();
+    LOGI("Delta E of {}x{} pixels: mean {:.4f}, max {:.4f} at ({}, {})", size.x, size.y,
+        stats.meanValue, stats.maxValue, stats.maxPixel.x, stats.maxPixel.y);
+    for (int i = 0; i < ImageDiff::kPercentileNum; ++i) {
+        LOGI("  P{}: {:.4f}", ImageDiff::kPercentileRanks[i], stats.percentiles[i]);
+    }
+    LOGI("{} pixels ({:.4f}%) above threshold {}, {} NaN", stats.aboveThresholdCount,
+        100.0 * stats.aboveThresholdCount / stats.pixelCount, threshold, stats.nanCount);
+
+    if (args["--json"] && !diff.writeReport(args["--json"].asString(), paths[0], paths[1])) {
+        return DiffError;
+    }
+
+    if (args["--heatmap"] && !diff.writeHeatmap(args["--heatmap"].asString(), heatMax, &pool)) {
+        return DiffError;
+    }
+
+    return stats.aboveThresholdCount > 0 ? DiffFailed : DiffPassed;
+}
+
 
 int main(int argc, char** argv)
 {
-    baktsiu::App app;
     std::vector<std::string> argList = { argv + 1, argv + argc };
 
 #ifdef __APPLE__
@@ -45,6 +229,11 @@ int main(int argc, char** argv)
         = docopt::docopt(USAGE, argList, showHelpWhenRequest, "Bak-Tsiu v" VERSION);
     PopRangeMarker();
 
+    if (args["diff"].asBool()) {
+        return runDiffCommand(args);
+    }
+
+    baktsiu::App app;
     if (app.initialize(u8"目睭 Bak Tsiu", 1280, 720))
     {
         if (args["<name>"]) {
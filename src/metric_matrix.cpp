@@ -0,0 +1,574 @@
+#include "metric_matrix.h"
+#include "image_metrics.h"
+#include "image_statistics.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <numeric>
+
+namespace baktsiu
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// Pyramids are downsampled until the longer edge fits, it's the level of estimates.
+const int kCoarseSize = 256;
+
+// Min length of shorter edge of levels, which still covers the window of SSIM.
+const int kMinLevelSize = 16;
+
+// Bytes per pixel of each level, i.e. RGBx colors and luma.
+const size_t kLevelPixelBytes = 5 * sizeof(float);
+
+// Pixels graded or compared at a time, they are kept in cache.
+const size_t kChunkPixelNum = 4096;
+
+// Chunks of each task queued to the pool. Tasks are short, thus threads which share
+// the pool, e.g. the render thread, don't wait for whole images.
+const size_t kBandChunkNum = 16;
+
+size_t getChunkCount(size_t pixelCount)
+{
+    return (pixelCount + kChunkPixelNum - 1) / kChunkPixelNum;
+}
+
+Vec2i getLevelSize(const Vec2i& size, int level)
+{
+    return Vec2i(size.x >> level, size.y >> level);
+}
+
+// Return number of levels from full size to the coarse one.
+int getLevelNum(const Vec2i& size)
+{
+    int levelNum = 1;
+    Vec2i levelSize = size;
+    while (std::max(levelSize.x, levelSize.y) > kCoarseSize && std::min(levelSize.x, levelSize.y) / 2 >= kMinLevelSize) {
+        levelSize /= 2;
+        ++levelNum;
+    }
+
+    return levelNum;
+}
+
+// Return BT.709 luma of display values clamped to [0, 1], the same as luma of ImageMetrics.
+void computeDisplayLuma(const ColorPipeline& pipeline, const float* colors, size_t count, float* luma, ThreadPool* pool)
+{
+    const ColorPipeline::Settings displaySettings;
+    parallelFor(pool, getChunkCount(count), [&](size_t beginChunk, size_t endChunk) {
+        std::vector<float> values(kChunkPixelNum * 4);
+        for (size_t chunk = beginChunk; chunk < endChunk; ++chunk) {
+            const size_t begin = chunk * kChunkPixelNum;
+            const size_t num = std::min(kChunkPixelNum, count - begin);
+            std::copy(colors + begin * 4, colors + (begin + num) * 4, values.begin());
+            pipeline.transformGradedValues(values.data(), num, displaySettings);
+
+            for (size_t i = 0; i < num; ++i) {
+                const float* value = &values[i * 4];
+                luma[begin + i] = 0.2126f * glm::clamp(value[0], 0.0f, 1.0f) +
+                    0.7152f * glm::clamp(value[1], 0.0f, 1.0f) + 0.0722f * glm::clamp(value[2], 0.0f, 1.0f);
+            }
+        }
+    }, kBandChunkNum);
+}
+
+// Downsample RGBx colors by 2x2 box filter, the last row or column of odd size is dropped.
+std::vector<float> downsampleColors(const std::vector<float>& colors, const Vec2i& size)
+{
+    const Vec2i outputSize = size / 2;
+    std::vector<float> output(static_cast<size_t>(outputSize.x) * outputSize.y * 4);
+
+    for (int y = 0; y < outputSize.y; ++y) {
+        const float* row0 = colors.data() + static_cast<size_t>(y * 2) * size.x * 4;
+        const float* row1 = row0 + static_cast<size_t>(size.x) * 4;
+        float* dst = output.data() + static_cast<size_t>(y) * outputSize.x * 4;
+        for (int x = 0; x < outputSize.x * 4; ++x) {
+            const int i = (x / 4) * 8 + x % 4;
+            dst[x] = 0.25f * (row0[i] + row0[i + 4] + row1[i] + row1[i + 4]);
+        }
+    }
+
+    return output;
+}
+
+}  // namespace
+
+MetricMatrix::Cell::Cell()
+{
+    values.fill(std::numeric_limits<float>::quiet_NaN());
+}
+
+const char* MetricMatrix::getMetricLabel(Metric metric)
+{
+    switch (metric) {
+    case RMSE:
+        return "RMSE";
+    case DeltaE:
+        return "Delta E";
+    case SSIM:
+        return "SSIM";
+    default:
+        return "Unknown";
+    }
+}
+
+MetricMatrix::~MetricMatrix()
+{
+    clear();
+}
+
+MetricMatrix::PairKey MetricMatrix::getPairKey(const Image* image1, const Image* image2)
+{
+    return std::less<const Image*>()(image1, image2) ? PairKey(image1, image2) : PairKey(image2, image1);
+}
+
+void    MetricMatrix::setImages(const std::vector<const Image*>& images)
+{
+    if (images == mImages) {
+        return;
+    }
+
+    mImages = images;
+
+    // Results of running job are discarded for removed images, since their revisions are gone.
+    auto isRemoved = [this](const Image* image) {
+        return std::find(mImages.begin(), mImages.end(), image) == mImages.end();
+    };
+
+    for (auto iter = mRevisions.begin(); iter != mRevisions.end();) {
+        iter = isRemoved(iter->first) ? mRevisions.erase(iter) : std::next(iter);
+    }
+
+    for (auto iter = mPyramids.begin(); iter != mPyramids.end();) {
+        iter = isRemoved(iter->first) ? mPyramids.erase(iter) : std::next(iter);
+    }
+
+    for (auto iter = mPendingPixels.begin(); iter != mPendingPixels.end();) {
+        iter = isRemoved(iter->first) ? mPendingPixels.erase(iter) : std::next(iter);
+    }
+
+    for (auto iter = mCells.begin(); iter != mCells.end();) {
+        iter = isRemoved(iter->first.first) || isRemoved(iter->first.second) ? mCells.erase(iter) : std::next(iter);
+    }
+
+    for (const Image* image : mImages) {
+        if (mRevisions.find(image) == mRevisions.end()) {
+            mRevisions[image] = mNextRevision++;
+        }
+    }
+}
+
+void    MetricMatrix::invalidate(const Image* image)
+{
+    auto iter = mRevisions.find(image);
+    if (iter == mRevisions.end()) {
+        return;
+    }
+
+    iter->second = mNextRevision++;
+    mPyramids.erase(image);
+    mPendingPixels.erase(image);
+    for (auto cellIter = mCells.begin(); cellIter != mCells.end();) {
+        const bool isRelated = cellIter->first.first == image || cellIter->first.second == image;
+        cellIter = isRelated ? mCells.erase(cellIter) : std::next(cellIter);
+    }
+}
+
+const Image* MetricMatrix::getRequestedImage() const
+{
+    for (const Image* image : mImages) {
+        if (mPyramids.find(image) == mPyramids.end() && mPendingPixels.find(image) == mPendingPixels.end()) {
+            return image;
+        }
+    }
+
+    return nullptr;
+}
+
+void    MetricMatrix::setImagePixels(const Image* image, const ColorPipeline::Source& source, const Vec2i& size,
+            std::vector<uint8_t>&& buffer)
+{
+    auto iter = mRevisions.find(image);
+    if (iter == mRevisions.end() || size.x <= 0 || size.y <= 0) {
+        return;
+    }
+
+    PendingPixels& pending = mPendingPixels[image];
+    pending.revision = iter->second;
+    pending.source = source;
+    pending.size = size;
+    pending.buffer = std::make_shared<std::vector<uint8_t>>(std::move(buffer));
+    pending.source.pixels = pending.buffer->data();
+}
+
+void    MetricMatrix::update(ThreadPool* pool)
+{
+    if (mJob.valid()) {
+        if (mJob.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
+
+        // Outdated results of invalidated or removed images are discarded.
+        JobResult result = mJob.get();
+        for (auto& entry : result.pyramids) {
+            auto iter = mRevisions.find(entry.first);
+            if (iter != mRevisions.end() && iter->second == entry.second.revision) {
+                mPendingPixels.erase(entry.first);
+                mPyramids[entry.first] = std::move(entry.second);
+            }
+        }
+
+        for (const CellResult& entry : result.cells) {
+            auto iter1 = mRevisions.find(entry.key.first);
+            auto iter2 = mRevisions.find(entry.key.second);
+            if (iter1 != mRevisions.end() && iter2 != mRevisions.end() &&
+                iter1->second == entry.revisions[0] && iter2->second == entry.revisions[1]) {
+                mCells[entry.key] = entry.cell;
+            }
+        }
+    }
+
+    launchJob(pool);
+}
+
+void    MetricMatrix::clear()
+{
+    if (mJob.valid()) {
+        mJob.wait();
+        mJob = std::future<JobResult>();
+    }
+
+    mImages.clear();
+    mRevisions.clear();
+    mPyramids.clear();
+    mPendingPixels.clear();
+    mCells.clear();
+}
+
+int     MetricMatrix::getRefineLevel() const
+{
+    std::vector<Vec2i> sizes;
+    for (const Image* image : mImages) {
+        auto pyramidIter = mPyramids.find(image);
+        auto pendingIter = mPendingPixels.find(image);
+        if (pyramidIter != mPyramids.end()) {
+            sizes.push_back(pyramidIter->second.size);
+        } else if (pendingIter != mPendingPixels.end()) {
+            sizes.push_back(pendingIter->second.size);
+        }
+    }
+
+    for (int level = 0; ; ++level) {
+        size_t bytes = 0;
+        bool isEmpty = true;
+        for (const Vec2i& size : sizes) {
+            for (int i = level; i < getLevelNum(size); ++i) {
+                const Vec2i levelSize = getLevelSize(size, i);
+                bytes += static_cast<size_t>(levelSize.x) * levelSize.y * kLevelPixelBytes;
+                isEmpty = false;
+            }
+        }
+
+        if (bytes <= mMemoryBudget || isEmpty) {
+            return level;
+        }
+    }
+}
+
+void    MetricMatrix::launchJob(ThreadPool* pool)
+{
+    if (mJob.valid()) {
+        return;
+    }
+
+    const int refineLevel = getRefineLevel();
+
+    // Grade pending pixels into pyramids first, finer levels than refinement are dropped.
+    if (!mPendingPixels.empty()) {
+        std::vector<std::pair<const Image*, PendingPixels>> tasks(mPendingPixels.begin(), mPendingPixels.end());
+        mJob = std::async(std::launch::async, [tasks, refineLevel, pool]() {
+            const auto startTime = Clock::now();
+            JobResult result;
+            result.pyramids.resize(tasks.size());
+
+            auto buildPyramid = [&](size_t index) {
+                const PendingPixels& pending = tasks[index].second;
+                Pyramid& pyramid = result.pyramids[index].second;
+                result.pyramids[index].first = tasks[index].first;
+                pyramid.revision = pending.revision;
+                pyramid.size = pending.size;
+
+                GradingTransform xform;
+                const ColorPipeline::Source& source = pending.source;
+                if (!xform.initialize(source.pixels, source.pixelDataType, source.encodingType,
+                        source.primaryType, source.exposureValue)) {
+                    return;
+                }
+
+                const size_t pixelCount = static_cast<size_t>(pending.size.x) * pending.size.y;
+                std::vector<float> colors(pixelCount * 4);
+                parallelFor(pool, getChunkCount(pixelCount), [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        const size_t first = i * kChunkPixelNum;
+                        xform.grade(first, std::min(pixelCount, first + kChunkPixelNum), colors.data() + first * 4);
+                    }
+                }, kBandChunkNum);
+
+                const ColorPipeline pipeline;
+                const int levelNum = getLevelNum(pending.size);
+                pyramid.baseLevel = std::min(refineLevel, levelNum - 1);
+                for (int level = 0; level < levelNum; ++level) {
+                    const Vec2i levelSize = getLevelSize(pending.size, level);
+                    if (level > 0) {
+                        colors = downsampleColors(colors, getLevelSize(pending.size, level - 1));
+                    }
+
+                    if (level >= pyramid.baseLevel) {
+                        auto data = std::make_shared<Level>();
+                        data->size = levelSize;
+                        data->colors = colors;
+                        data->luma.resize(static_cast<size_t>(levelSize.x) * levelSize.y);
+                        computeDisplayLuma(pipeline, data->colors.data(), data->luma.size(), data->luma.data(), pool);
+                        pyramid.levels.push_back(data);
+                    }
+                }
+            };
+
+            // Bands of each image are processed in parallel, thus tasks queued to the pool are short.
+            for (size_t i = 0; i < tasks.size(); ++i) {
+                buildPyramid(i);
+            }
+
+            const std::chrono::duration<double, std::milli> elapsedTime = Clock::now() - startTime;
+            LOGD("Build {} pyramids of metric matrix in {:.1f} ms", tasks.size(), elapsedTime.count());
+            return result;
+        });
+        return;
+    }
+
+    // Drop levels finer than refinement, e.g. more images are added. Running jobs still keep them alive.
+    for (auto& entry : mPyramids) {
+        Pyramid& pyramid = entry.second;
+        const int dropNum = std::min(refineLevel - pyramid.baseLevel, static_cast<int>(pyramid.levels.size()) - 1);
+        if (dropNum > 0) {
+            pyramid.levels.erase(pyramid.levels.begin(), pyramid.levels.begin() + dropNum);
+            pyramid.baseLevel += dropNum;
+        }
+    }
+
+    // Pairs without values are estimated at once, then estimated ones are refined in batches.
+    struct PairTask
+    {
+        CellResult  result;
+        LevelSPtr   levels[2];
+        bool        isRefined = false;
+    };
+
+    std::vector<PairTask> estimateTasks;
+    std::vector<PairTask> refineTasks;
+    for (size_t i = 0; i < mImages.size(); ++i) {
+        for (size_t j = i + 1; j < mImages.size(); ++j) {
+            const PairKey key = getPairKey(mImages[i], mImages[j]);
+            auto iter1 = mPyramids.find(key.first);
+            auto iter2 = mPyramids.find(key.second);
+            if (iter1 == mPyramids.end() || iter2 == mPyramids.end()) {
+                continue;
+            }
+
+            const Pyramid& pyramid1 = iter1->second;
+            const Pyramid& pyramid2 = iter2->second;
+            auto cellIter = mCells.find(key);
+            if (cellIter == mCells.end() && (pyramid1.size != pyramid2.size ||
+                    pyramid1.levels.empty() || pyramid2.levels.empty())) {
+                Cell& cell = mCells[key];
+                cell.isComparable = false;
+                cell.isRefined = true;
+                continue;
+            }
+
+            if (cellIter != mCells.end() && cellIter->second.isRefined) {
+                continue;
+            }
+
+            PairTask task;
+            task.result.key = key;
+            task.result.revisions[0] = pyramid1.revision;
+            task.result.revisions[1] = pyramid2.revision;
+
+            // Both pyramids have the same levels, since images have the same size.
+            const int fineLevel = std::max(pyramid1.baseLevel, pyramid2.baseLevel);
+            const bool isEstimated = cellIter != mCells.end();
+            const int level = isEstimated ? fineLevel : pyramid1.baseLevel + static_cast<int>(pyramid1.levels.size()) - 1;
+            task.levels[0] = pyramid1.levels[level - pyramid1.baseLevel];
+            task.levels[1] = pyramid2.levels[level - pyramid2.baseLevel];
+            task.result.cell.level = level;
+            task.result.cell.isRefined = level == fineLevel;
+            (isEstimated ? refineTasks : estimateTasks).push_back(task);
+        }
+    }
+
+    std::vector<PairTask> tasks = estimateTasks.empty() ? refineTasks : estimateTasks;
+    if (tasks.empty()) {
+        return;
+    }
+
+    // Batches of refinement are small, thus results show up progressively.
+    const size_t batchSize = 2 * static_cast<size_t>(pool ? pool->workerNum() + 1 : 1);
+    if (estimateTasks.empty() && tasks.size() > batchSize) {
+        tasks.resize(batchSize);
+    }
+
+    mJob = std::async(std::launch::async, [tasks, pool]() mutable {
+        const auto startTime = Clock::now();
+
+        auto computePair = [&](PairTask& task) {
+            const Level& level1 = *task.levels[0];
+            const Level& level2 = *task.levels[1];
+            const size_t pixelCount = static_cast<size_t>(level1.size.x) * level1.size.y;
+            const ColorPipeline pipeline;
+            double squaredErrorSum = 0.0, distanceSum = 0.0;
+            size_t validCount = 0;
+            std::mutex mergeMutex;
+
+            // Pixels of NaN colors are excluded, the same as ImageDiff.
+            parallelFor(pool, getChunkCount(pixelCount), [&](size_t beginChunk, size_t endChunk) {
+                std::vector<float> distances(kChunkPixelNum);
+                double localSquaredErrorSum = 0.0, localDistanceSum = 0.0;
+                size_t localValidCount = 0;
+
+                for (size_t chunk = beginChunk; chunk < endChunk; ++chunk) {
+                    const size_t begin = chunk * kChunkPixelNum;
+                    const size_t num = std::min(kChunkPixelNum, pixelCount - begin);
+                    const float* colors1 = level1.colors.data() + begin * 4;
+                    const float* colors2 = level2.colors.data() + begin * 4;
+                    pipeline.computeGradedDistances(colors1, colors2, num, distances.data());
+
+                    for (size_t i = 0; i < num; ++i) {
+                        if (std::isnan(distances[i])) {
+                            continue;
+                        }
+
+                        for (int c = 0; c < 3; ++c) {
+                            const double error = colors1[i * 4 + c] - colors2[i * 4 + c];
+                            localSquaredErrorSum += error * error;
+                        }
+                        localDistanceSum += std::sqrt(static_cast<double>(distances[i]));
+                        ++localValidCount;
+                    }
+                }
+
+                const std::lock_guard<std::mutex> lock(mergeMutex);
+                squaredErrorSum += localSquaredErrorSum;
+                distanceSum += localDistanceSum;
+                validCount += localValidCount;
+            }, kBandChunkNum);
+
+            Cell& cell = task.result.cell;
+            if (validCount > 0) {
+                cell.values[RMSE] = static_cast<float>(std::sqrt(squaredErrorSum / (validCount * 3)));
+                cell.values[DeltaE] = static_cast<float>(distanceSum / validCount);
+            }
+            cell.values[SSIM] = ImageMetrics::computeSsim(level1.luma.data(), level2.luma.data(), level1.size,
+                pipeline.simdLevel(), pool);
+        };
+
+        // Bands of each pair are processed in parallel, thus tasks queued to the pool are short.
+        for (PairTask& task : tasks) {
+            computePair(task);
+        }
+
+        JobResult result;
+        for (const PairTask& task : tasks) {
+            result.cells.push_back(task.result);
+        }
+
+        const std::chrono::duration<double, std::milli> elapsedTime = Clock::now() - startTime;
+        LOGD("Compute {} pairs of metric matrix at level {} in {:.1f} ms", tasks.size(),
+            tasks.front().result.cell.level, elapsedTime.count());
+        return result;
+    });
+}
+
+MetricMatrix::Cell MetricMatrix::cell(int row, int column) const
+{
+    Cell result;
+    if (row == column) {
+        result.values[RMSE] = result.values[DeltaE] = 0.0f;
+        result.values[SSIM] = 1.0f;
+        result.isRefined = true;
+        result.level = 0;
+        return result;
+    }
+
+    auto iter = mCells.find(getPairKey(mImages[row], mImages[column]));
+    return iter != mCells.end() ? iter->second : result;
+}
+
+float   MetricMatrix::distance(int row, int column, Metric metric) const
+{
+    const float value = cell(row, column).values[metric];
+    return isSimilarity(metric) ? 1.0f - value : value;
+}
+
+std::vector<int> MetricMatrix::getSortedOrder(Metric metric, SortMode mode, int reference) const
+{
+    const int imageNum = imageCount();
+    std::vector<int> order(imageNum);
+    std::iota(order.begin(), order.end(), 0);
+    if (mode == LayerOrder || imageNum == 0) {
+        return order;
+    }
+
+    // Keys of rows are ascending, NaN keys come last.
+    std::vector<float> keys(imageNum, std::numeric_limits<float>::quiet_NaN());
+    if (mode == DistanceToReference && reference >= 0 && reference < imageNum) {
+        for (int i = 0; i < imageNum; ++i) {
+            keys[i] = distance(reference, i, metric);
+        }
+    } else if (mode == MeanDistance) {
+        for (int i = 0; i < imageNum; ++i) {
+            double sum = 0.0;
+            int count = 0;
+            for (int j = 0; j < imageNum; ++j) {
+                const float value = distance(i, j, metric);
+                if (i != j && !std::isnan(value)) {
+                    sum += value;
+                    ++count;
+                }
+            }
+
+            keys[i] = count > 0 ? static_cast<float>(sum / count) : std::numeric_limits<float>::quiet_NaN();
+        }
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&keys](int a, int b) {
+        if (std::isnan(keys[a]) || std::isnan(keys[b])) {
+            return !std::isnan(keys[a]) && std::isnan(keys[b]);
+        }
+        return keys[a] < keys[b];
+    });
+    return order;
+}
+
+size_t  MetricMatrix::pairCount() const
+{
+    return mImages.size() * (mImages.size() - std::min<size_t>(mImages.size(), 1)) / 2;
+}
+
+size_t  MetricMatrix::refinedPairCount() const
+{
+    size_t count = 0;
+    for (const auto& entry : mCells) {
+        count += entry.second.isRefined ? 1 : 0;
+    }
+    return count;
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,184 @@
+#ifndef BAKTSIU_METRIC_MATRIX_H_
+#define BAKTSIU_METRIC_MATRIX_H_
+
+#include "color_pipeline.h"
+#include "common.h"
+
+#include <array>
+#include <future>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace baktsiu
+{
+
+class Image;
+class ThreadPool;
+
+/**
+ * Pairwise metrics of all images, computed incrementally by background jobs.
+ *
+ * Each image is graded once at 0 EV into a pyramid of linear colors and display
+ * luma (sRGB, gamma 2.2), which is cached until the image is invalidated or
+ * removed. Pairs are estimated on a coarse level first, then refined on the
+ * finest level whose pyramids of all images fit in memory budget. Thus adding
+ * an image only computes pairs of it, and removing one only drops its pairs.
+ *
+ * Jobs run on a background thread, and images or pairs are processed one by one
+ * in bands of pixels on the thread pool, thus completion time scales with cores
+ * and the pool is never occupied by a whole image. All methods are called from
+ * the same thread, results are merged in update().
+ */
+class MetricMatrix
+{
+public:
+    enum Metric
+    {
+        RMSE = 0,       // Root mean square error of graded RGB values.
+        DeltaE,         // Mean CIE76 Delta E of graded colors, the distance of diff view.
+        SSIM,           // Mean SSIM of display luma.
+        MetricNum
+    };
+
+    enum SortMode
+    {
+        LayerOrder = 0,
+        DistanceToReference,    // The reference comes first, followed by the most similar images.
+        MeanDistance,           // Typical images come first, outliers come last.
+        SortModeNum
+    };
+
+    struct Cell
+    {
+        std::array<float, MetricNum> values;    // NaN if it's not computed or comparable.
+        bool    isComparable = true;            // False if sizes differ or image fails to be graded.
+        bool    isRefined = false;              // False if values are estimated on coarse level.
+        int     level = -1;                     // Pyramid level of values, -1 if it's not computed.
+
+        Cell();
+    };
+
+    static const char* getMetricLabel(Metric metric);
+
+    // Return true if larger values mean more similar images.
+    static bool isSimilarity(Metric metric) { return metric == SSIM; }
+
+public:
+    MetricMatrix() = default;
+    MetricMatrix(const MetricMatrix&) = delete;
+    MetricMatrix& operator=(const MetricMatrix&) = delete;
+
+    ~MetricMatrix();
+
+    // Set images in the order of rows, pairs of removed images are dropped and new ones are pending.
+    void    setImages(const std::vector<const Image*>& images);
+
+    // Drop pyramid and pairs of image, e.g. its pixels or color properties are changed.
+    void    invalidate(const Image* image);
+
+    // Return the next image without pyramid or pending pixels, nullptr if there is none.
+    const Image* getRequestedImage() const;
+
+    /**
+     * Provide decoded pixels of requested image, they are graded by the next job.
+     *
+     * @param source Pixel type and grading parameters, pixels are replaced by buffer.
+     * @param buffer RGBA pixels of source, it's released after grading.
+     */
+    void    setImagePixels(const Image* image, const ColorPipeline::Source& source, const Vec2i& size,
+                std::vector<uint8_t>&& buffer);
+
+    // Merge results of finished job and launch the next one if there is pending work, it never blocks.
+    void    update(ThreadPool* pool);
+
+    // Wait for the running job and drop all results.
+    void    clear();
+
+    void    setMemoryBudget(size_t bytes) { mMemoryBudget = bytes; }
+
+    int     imageCount() const { return static_cast<int>(mImages.size()); }
+
+    const Image* image(int index) const { return mImages[index]; }
+
+    // Return cell of pair of images in rows of setImages(), values are symmetric.
+    Cell    cell(int row, int column) const;
+
+    // Return distance of pair, i.e. 1 - SSIM for similarity, NaN if it's not computed.
+    float   distance(int row, int column, Metric metric) const;
+
+    // Return order of rows sorted by distances of metric, reference is the row of DistanceToReference.
+    std::vector<int> getSortedOrder(Metric metric, SortMode mode, int reference) const;
+
+    // Return number of pairs and refined ones, diagonal cells are excluded.
+    size_t  pairCount() const;
+
+    size_t  refinedPairCount() const;
+
+    bool    isBusy() const { return mJob.valid(); }
+
+private:
+    struct Level
+    {
+        Vec2i               size = Vec2i(0);
+        std::vector<float>  colors;     // Graded RGBx values.
+        std::vector<float>  luma;
+    };
+
+    using LevelSPtr = std::shared_ptr<const Level>;
+
+    // Levels starting from baseLevel, where level n is downsampled by 2^n.
+    struct Pyramid
+    {
+        uint32_t                revision = 0;       // Revision of image when it's graded.
+        Vec2i                   size = Vec2i(0);    // Size of level 0.
+        int                     baseLevel = 0;
+        std::vector<LevelSPtr>  levels;
+    };
+
+    struct PendingPixels
+    {
+        uint32_t                revision = 0;
+        ColorPipeline::Source   source;
+        Vec2i                   size = Vec2i(0);
+        std::shared_ptr<std::vector<uint8_t>> buffer;
+    };
+
+    using PairKey = std::pair<const Image*, const Image*>;
+
+    // Cell computed from pyramids of given revisions.
+    struct CellResult
+    {
+        PairKey     key;
+        uint32_t    revisions[2] = {};
+        Cell        cell;
+    };
+
+    struct JobResult
+    {
+        std::vector<std::pair<const Image*, Pyramid>>   pyramids;
+        std::vector<CellResult>                         cells;
+    };
+
+    // Return key of unordered pair.
+    static PairKey getPairKey(const Image* image1, const Image* image2);
+
+    // Return the finest level whose pyramids of all images fit in memory budget.
+    int     getRefineLevel() const;
+
+    // Launch job of pending pyramids, estimates or refinements in order.
+    void    launchJob(ThreadPool* pool);
+
+private:
+    std::vector<const Image*>                   mImages;
+    std::map<const Image*, uint32_t>            mRevisions;     // Changed when image is added or invalidated.
+    uint32_t                                    mNextRevision = 1;
+    std::map<const Image*, Pyramid>             mPyramids;
+    std::map<const Image*, PendingPixels>       mPendingPixels;
+    std::map<PairKey, Cell>                     mCells;
+    std::future<JobResult>                      mJob;
+    size_t                                      mMemoryBudget = size_t(1) << 30;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_METRIC_MATRIX_H_
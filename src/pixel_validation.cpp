@@ -0,0 +1,177 @@
+#include "pixel_validation.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BAKTSIU_VALIDATION_USE_SSE2
+#endif
+
+namespace
+{
+
+using namespace baktsiu;
+
+// Bit masks of IEEE 754 half and single precision values.
+template <typename Bits>
+struct FloatTraits;
+
+template <>
+struct FloatTraits<uint16_t>
+{
+    static const uint16_t kSignMask = 0x8000;
+    static const uint16_t kExponentMask = 0x7C00;
+    static const uint16_t kMantissaMask = 0x03FF;
+};
+
+template <>
+struct FloatTraits<uint32_t>
+{
+    static const uint32_t kSignMask = 0x80000000u;
+    static const uint32_t kExponentMask = 0x7F800000u;
+    static const uint32_t kMantissaMask = 0x007FFFFFu;
+};
+
+// Return issue of value, or IssueNum if it's valid.
+template <typename Bits>
+inline int classify(Bits value)
+{
+    using Traits = FloatTraits<Bits>;
+    if ((value & Traits::kExponentMask) == Traits::kExponentMask) {
+        return (value & Traits::kMantissaMask) != 0 ? PixelValidation::NaN : PixelValidation::Inf;
+    }
+
+    const bool isNegative = (value & Traits::kSignMask) != 0 && (value & ~Traits::kSignMask) != 0;
+    return isNegative ? PixelValidation::Negative : PixelValidation::IssueNum;
+}
+
+// Return true if any value is non-finite or negative.
+inline bool hasInvalidValue(const uint16_t* values, size_t count)
+{
+    size_t i = 0;
+#ifdef BAKTSIU_VALIDATION_USE_SSE2
+    const __m128i exponentMask = _mm_set1_epi16(0x7C00);
+    const __m128i negativeZero = _mm_set1_epi16(static_cast<short>(0x8000));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i mask = zero;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        const __m128i nonFinite = _mm_cmpeq_epi16(_mm_and_si128(v, exponentMask), exponentMask);
+        const __m128i negative = _mm_andnot_si128(_mm_cmpeq_epi16(v, negativeZero), _mm_cmplt_epi16(v, zero));
+        mask = _mm_or_si128(mask, _mm_or_si128(nonFinite, negative));
+    }
+
+    if (_mm_movemask_epi8(mask) != 0) {
+        return true;
+    }
+#endif
+    for (; i < count; ++i) {
+        if (classify(values[i]) != PixelValidation::IssueNum) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline bool hasInvalidValue(const uint32_t* values, size_t count)
+{
+    size_t i = 0;
+#ifdef BAKTSIU_VALIDATION_USE_SSE2
+    const __m128i exponentMask = _mm_set1_epi32(0x7F800000);
+    const __m128i negativeZero = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i mask = zero;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        const __m128i nonFinite = _mm_cmpeq_epi32(_mm_and_si128(v, exponentMask), exponentMask);
+        const __m128i negative = _mm_andnot_si128(_mm_cmpeq_epi32(v, negativeZero), _mm_cmplt_epi32(v, zero));
+        mask = _mm_or_si128(mask, _mm_or_si128(nonFinite, negative));
+    }
+
+    if (_mm_movemask_epi8(mask) != 0) {
+        return true;
+    }
+#endif
+    for (; i < count; ++i) {
+        if (classify(values[i]) != PixelValidation::IssueNum) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename Bits>
+void scanPixels(const Bits* values, const Vec2i& size,
+    std::array<std::array<unsigned int, PixelValidation::kChannelNum>, PixelValidation::IssueNum>& counts,
+    std::vector<PixelValidation::BadTile>& badTiles, size_t& badPixelCount)
+{
+    const int tileSize = PixelValidation::kTileSize;
+    const int channelNum = PixelValidation::kChannelNum;
+    const Vec2i tileNum = (size + tileSize - 1) / tileSize;
+    const size_t rowValueNum = static_cast<size_t>(size.x) * channelNum;
+
+    // Bad tiles of current row of tiles are appended after all rows of them are scanned.
+    std::vector<PixelValidation::BadTile> rowTiles(tileNum.x);
+
+    for (int tileY = 0; tileY < tileNum.y; ++tileY) {
+        std::fill(rowTiles.begin(), rowTiles.end(), PixelValidation::BadTile{ Vec2i(0), 0 });
+        const int endY = std::min((tileY + 1) * tileSize, size.y);
+
+        for (int y = tileY * tileSize; y < endY; ++y) {
+            const Bits* row = values + rowValueNum * y;
+            if (!hasInvalidValue(row, rowValueNum)) {
+                continue;
+            }
+
+            for (int x = 0; x < size.x; ++x) {
+                bool isBad = false;
+                for (int c = 0; c < channelNum; ++c) {
+                    const int issue = classify(row[x * channelNum + c]);
+                    if (issue != PixelValidation::IssueNum) {
+                        counts[issue][c]++;
+                        isBad = true;
+                    }
+                }
+
+                if (isBad) {
+                    PixelValidation::BadTile& tile = rowTiles[x / tileSize];
+                    if (tile.pixelCount++ == 0) {
+                        tile.firstPixel = Vec2i(x, y);
+                    }
+                    badPixelCount++;
+                }
+            }
+        }
+
+        for (const auto& tile : rowTiles) {
+            if (tile.pixelCount > 0) {
+                badTiles.push_back(tile);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+namespace baktsiu
+{
+
+void PixelValidation::compute(const void* pixels, GLenum pixelDataType, const Vec2i& size)
+{
+    mCounts = {};
+    mBadTiles.clear();
+    mBadPixelCount = 0;
+
+    // Normalized integer pixels are always valid.
+    if (!pixels || size.x <= 0 || size.y <= 0) {
+        return;
+    } else if (pixelDataType == GL_HALF_FLOAT) {
+        scanPixels(static_cast<const uint16_t*>(pixels), size, mCounts, mBadTiles, mBadPixelCount);
+    } else if (pixelDataType == GL_FLOAT) {
+        scanPixels(static_cast<const uint32_t*>(pixels), size, mCounts, mBadTiles, mBadPixelCount);
+    }
+}
+
+}  // namespace baktsiu
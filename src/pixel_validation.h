@@ -0,0 +1,63 @@
+#ifndef BAKTSIU_PIXEL_VALIDATION_H_
+#define BAKTSIU_PIXEL_VALIDATION_H_
+
+#include "common.h"
+
+#include <GL/gl3w.h>
+
+#include <array>
+#include <vector>
+
+namespace baktsiu
+{
+
+/**
+ * Counts and locations of NaN, Inf and negative values of decoded pixels.
+ *
+ * Rows are first tested with SIMD instructions and only rows with invalid
+ * values are classified per value. Locations are recorded per tile instead of
+ * per pixel, thus the result stays compact for huge images.
+ */
+class PixelValidation
+{
+public:
+    enum Issue
+    {
+        NaN = 0,
+        Inf,
+        Negative,       // Finite values less than zero, -0 is excluded.
+        IssueNum
+    };
+
+    static const int kTileSize = 32;
+    static const int kChannelNum = 4;
+
+    struct BadTile
+    {
+        Vec2i   firstPixel;     // The first bad pixel in row-major order, y is the row from top.
+        int     pixelCount;     // Number of bad pixels in tile.
+    };
+
+public:
+    // Scan RGBA pixels, only GL_HALF_FLOAT and GL_FLOAT pixels could have invalid values.
+    void    compute(const void* pixels, GLenum pixelDataType, const Vec2i& size);
+
+    // Return number of values of channel with given issue.
+    unsigned int count(Issue issue, int channel) const { return mCounts[issue][channel]; }
+
+    // Return number of pixels with any invalid channel.
+    size_t  badPixelCount() const { return mBadPixelCount; }
+
+    bool    hasIssues() const { return mBadPixelCount > 0; }
+
+    // Return tiles with bad pixels in row-major order of tiles.
+    const std::vector<BadTile>& badTiles() const { return mBadTiles; }
+
+private:
+    std::array<std::array<unsigned int, kChannelNum>, IssueNum> mCounts = {};
+    std::vector<BadTile>    mBadTiles;
+    size_t                  mBadPixelCount = 0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_PIXEL_VALIDATION_H_
@@ -0,0 +1,244 @@
+#include "program_cache.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+const uint32_t kCacheFileMagic = 0x42505442;    // "BTPB"
+
+// 64-bit FNV-1a hash.
+uint64_t hashString(const std::string& str, uint64_t hash = 14695981039346656037ull)
+{
+    for (unsigned char c : str) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+std::string getString(GLenum name)
+{
+    const GLubyte* value = glGetString(name);
+    return value ? reinterpret_cast<const char*>(value) : "";
+}
+
+bool makeDirectory(const std::string& path)
+{
+#ifdef _WIN32
+    return _mkdir(path.c_str()) == 0 || errno == EEXIST;
+#else
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+// Create directory and its missing parents.
+bool makeDirectories(std::string path)
+{
+    std::replace(path.begin(), path.end(), '\\', '/');
+
+    for (size_t pos = path.find('/', 1); pos != std::string::npos; pos = path.find('/', pos + 1)) {
+        const std::string parent = path.substr(0, pos);
+        if (parent.back() != ':') { // Skip drive letter on Windows.
+            makeDirectory(parent);
+        }
+    }
+
+    return makeDirectory(path);
+}
+
+int getProcessId()
+{
+#ifdef _WIN32
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+// Rename file, the existing target is replaced.
+bool replaceFile(const std::string& from, const std::string& to)
+{
+#ifdef _WIN32
+    std::remove(to.c_str());    // rename() doesn't overwrite existing files on Windows.
+#endif
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+} // namespace
+
+namespace baktsiu
+{
+
+std::string ProgramCache::getDefaultCacheDir()
+{
+#if defined(_WIN32)
+    const char* baseDir = std::getenv("LOCALAPPDATA");
+    return baseDir ? std::string(baseDir) + "/baktsiu/shader_cache" : "";
+#elif defined(__APPLE__)
+    const char* homeDir = std::getenv("HOME");
+    return homeDir ? std::string(homeDir) + "/Library/Caches/baktsiu/shader_cache" : "";
+#else
+    const char* baseDir = std::getenv("XDG_CACHE_HOME");
+    if (baseDir && baseDir[0] != '\0') {
+        return std::string(baseDir) + "/baktsiu/shader_cache";
+    }
+
+    const char* homeDir = std::getenv("HOME");
+    return homeDir ? std::string(homeDir) + "/.cache/baktsiu/shader_cache" : "";
+#endif
+}
+
+bool ProgramCache::initialize(const std::string& cacheDir)
+{
+    mEnabled = false;
+
+    // Program binary is supported since GL 4.1 or with GL_ARB_get_program_binary.
+    GLint formatNum = 0;
+    if (glGetProgramBinary != nullptr && glProgramBinary != nullptr) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatNum);
+    }
+
+    if (formatNum <= 0 || cacheDir.empty()) {
+        LOGI("Program binary cache is disabled");
+        return false;
+    }
+
+    if (!makeDirectories(cacheDir)) {
+        LOGW("Failed to create program cache directory {}", cacheDir);
+        return false;
+    }
+
+    mCacheDir = cacheDir;
+    mDriverSignature = getString(GL_VENDOR) + "|" + getString(GL_RENDERER) + "|" + getString(GL_VERSION);
+    mEnabled = true;
+
+    LOGD("Program binary cache: {}", mCacheDir);
+    return true;
+}
+
+std::string ProgramCache::makeKey(const std::string& name, std::initializer_list<const std::string*> sources) const
+{
+    uint64_t hash = hashString(mDriverSignature);
+    for (const std::string* source : sources) {
+        // Append separator to distinguish sources like ("ab", "c") and ("a", "bc").
+        hash = hashString(*source + '\0', hash);
+    }
+
+    return fmt::format("{}_{:016x}", name, hash);
+}
+
+std::string ProgramCache::getFilePath(const std::string& key) const
+{
+    return mCacheDir + "/" + key + ".bin";
+}
+
+bool ProgramCache::load(GLuint program, const std::string& key)
+{
+    if (!mEnabled) {
+        return false;
+    }
+
+    std::ifstream file(getFilePath(key), std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        ++mMissCount;
+        return false;
+    }
+
+    const std::streamoff fileSize = file.tellg();
+    file.seekg(0);
+
+    uint32_t header[3] = { 0, 0, 0 };  // magic, format, size
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+    // The size in header is only trusted when it matches the file, thus truncated
+    // or corrupted files never request huge allocations.
+    const std::streamoff binarySize = fileSize - static_cast<std::streamoff>(sizeof(header));
+    if (!file || header[0] != kCacheFileMagic || header[2] == 0 || binarySize != header[2]) {
+        LOGW("Corrupted program cache {}", key);
+        ++mMissCount;
+        return false;
+    }
+
+    std::vector<char> binary(header[2]);
+    if (!file.read(binary.data(), binary.size())) {
+        LOGW("Corrupted program cache {}", key);
+        ++mMissCount;
+        return false;
+    }
+
+    glProgramBinary(program, header[1], binary.data(), static_cast<GLsizei>(binary.size()));
+
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status != GL_TRUE) {
+        // Driver might reject binaries from previous versions even though the
+        // signature is the same, then we just compile shaders again.
+        LOGD("Program binary {} is rejected by driver", key);
+        ++mMissCount;
+        return false;
+    }
+
+    ++mHitCount;
+    return true;
+}
+
+void ProgramCache::save(GLuint program, const std::string& key)
+{
+    if (!mEnabled) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    // Write to a temporary file and rename it, thus a crash while writing never leaves
+    // a partial file with the cache key. Process ID avoids clashes between instances.
+    const std::string filePath = getFilePath(key);
+    const std::string tempPath = fmt::format("{}.{}.tmp", filePath, getProcessId());
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            LOGW("Failed to write program cache {}", key);
+            return;
+        }
+
+        const uint32_t header[3] = { kCacheFileMagic, static_cast<uint32_t>(format), static_cast<uint32_t>(length) };
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(binary.data(), length);
+        if (!file.flush()) {
+            LOGW("Failed to write program cache {}", key);
+            file.close();
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+
+    if (!replaceFile(tempPath, filePath)) {
+        LOGW("Failed to write program cache {}", key);
+        std::remove(tempPath.c_str());
+    }
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,65 @@
+#ifndef BAKTSIU_PROGRAM_CACHE_H_
+#define BAKTSIU_PROGRAM_CACHE_H_
+
+#include "common.h"
+
+#include <GL/gl3w.h>
+
+#include <initializer_list>
+#include <string>
+
+namespace baktsiu
+{
+
+/**
+ * Disk cache of linked program binaries.
+ *
+ * Each binary is keyed by the driver signature (vendor, renderer and version)
+ * and the hash of shader sources. When the driver rejects a cached binary, the
+ * shader falls back to compile from sources and the binary is refreshed.
+ */
+class ProgramCache
+{
+public:
+    // Setup cache directory and query driver signature. This should be
+    // executed in the thread with GL context.
+    // @return False if program binary retrieval is not supported.
+    bool    initialize(const std::string& cacheDir);
+
+    bool    isEnabled() const { return mEnabled; }
+
+    // Return the cache key of program with given sources.
+    std::string makeKey(const std::string& name, std::initializer_list<const std::string*> sources) const;
+
+    /**
+     * Load cached binary to given program.
+     *
+     * @param program The program object which has no shaders attached.
+     * @param key Cache key from makeKey().
+     * @return True if the program is linked successfully from cached binary.
+     */
+    bool    load(GLuint program, const std::string& key);
+
+    // Store binary of a linked program to disk.
+    void    save(GLuint program, const std::string& key);
+
+    // Return the default cache location of current platform.
+    static std::string getDefaultCacheDir();
+
+    int     hitCount() const { return mHitCount; }
+
+    int     missCount() const { return mMissCount; }
+
+private:
+    std::string getFilePath(const std::string& key) const;
+
+private:
+    std::string mCacheDir;
+    std::string mDriverSignature;
+    int         mHitCount = 0;
+    int         mMissCount = 0;
+    bool        mEnabled = false;
+};
+
+}  // namespace baktsiu
+#endif
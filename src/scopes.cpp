@@ -0,0 +1,201 @@
+#include "scopes.h"
+#include "image_statistics.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+namespace
+{
+
+using namespace baktsiu;
+
+// AP1_2_BT709_MAT@color_transform.glsl in row-major order.
+const float kAP1ToBT709[9] = {
+     1.7050515f, -0.6217907f, -0.0832587f,
+    -0.1302571f,  1.1408029f, -0.0105482f,
+    -0.0240033f, -0.1289688f,  1.1529717f
+};
+
+const float kBT709Luma[3] = { 0.2126f, 0.7152f, 0.0722f };
+
+// Trace colors of waveforms, vectorscope is colored by hue of each cell.
+const float kWaveformColors[Scopes::Vectorscope][3] = {
+    { 0.7f, 1.0f, 0.7f },
+    { 1.0f, 0.3f, 0.3f },
+    { 0.3f, 1.0f, 0.3f },
+    { 0.4f, 0.5f, 1.0f }
+};
+
+inline int toLevel(float value)
+{
+    return static_cast<int>(value * (Scopes::kSize - 1) + 0.5f);
+}
+
+// Scatter graded AP1 color to density plots, it must be the same as scopes.comp.
+void scatterSample(const float* color, float invGamma, int column, int* density)
+{
+    float encoded[3];
+    for (int r = 0; r < 3; ++r) {
+        const float* row = kAP1ToBT709 + r * 3;
+        float value = row[0] * color[0] + row[1] * color[1] + row[2] * color[2];
+        // Negative and NaN values are treated as black.
+        value = value > 0.0f ? std::min(value, 1.0f) : 0.0f;
+        encoded[r] = std::pow(value, invGamma);
+    }
+
+    const float luma = kBT709Luma[0] * encoded[0] + kBT709Luma[1] * encoded[1] + kBT709Luma[2] * encoded[2];
+    const int size = Scopes::kSize;
+    density[toLevel(luma) * Scopes::kDensityWidth + column]++;
+    for (int c = 0; c < 3; ++c) {
+        density[toLevel(encoded[c]) * Scopes::kDensityWidth + column + size * (c + 1)]++;
+    }
+
+    const float cb = (encoded[2] - luma) / 1.8556f;
+    const float cr = (encoded[0] - luma) / 1.5748f;
+    const int x = std::min(std::max(static_cast<int>(std::floor((cb + 0.5f) * size)), 0), size - 1);
+    const int y = std::min(std::max(static_cast<int>(std::floor((cr + 0.5f) * size)), 0), size - 1);
+    density[y * Scopes::kDensityWidth + x + size * Scopes::Vectorscope]++;
+}
+
+inline uint32_t packColor(float r, float g, float b)
+{
+    auto toByte = [](float v) { return static_cast<uint32_t>(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f); };
+    return toByte(r) | (toByte(g) << 8) | (toByte(b) << 16) | 0xFF000000;
+}
+
+// Return hue color of vectorscope cell, i.e. the encoded color with Cb and Cr of cell.
+void getChromaColor(int x, int y, float* color)
+{
+    const float cb = (x + 0.5f) / Scopes::kSize - 0.5f;
+    const float cr = (y + 0.5f) / Scopes::kSize - 0.5f;
+    const float luma = 0.6f;
+    const float r = luma + 1.5748f * cr;
+    const float b = luma + 1.8556f * cb;
+    const float g = (luma - kBT709Luma[0] * r - kBT709Luma[2] * b) / kBT709Luma[1];
+
+    // Desaturate toward white to keep faint traces visible.
+    color[0] = 0.5f + 0.5f * std::min(std::max(r, 0.0f), 1.0f);
+    color[1] = 0.5f + 0.5f * std::min(std::max(g, 0.0f), 1.0f);
+    color[2] = 0.5f + 0.5f * std::min(std::max(b, 0.0f), 1.0f);
+}
+
+}  // namespace
+
+namespace baktsiu
+{
+
+void Scopes::computeDensity(const GradingTransform& xform, const Vec2i& size, int stride,
+    float displayGamma, ThreadPool* pool, std::vector<int>& density)
+{
+    // Sampled grid has the same size as mip level of scopes.comp.
+    const Vec2i gridSize = glm::max(size / stride, Vec2i(1));
+    const size_t offset = static_cast<size_t>(std::min(stride / 2, std::min(size.x, size.y) - 1));
+    const float invGamma = 1.0f / displayGamma;
+
+    density.assign(kDensityWidth * kSize, 0);
+    std::mutex mergeMutex;
+
+    auto accumulate = [&](size_t beginRow, size_t endRow) {
+        std::vector<int> partial(density.size(), 0);
+        std::vector<float> values((size.x + stride - 1) / stride * 4);
+
+        for (size_t row = beginRow; row < endRow; ++row) {
+            const size_t y = row * stride + offset;
+            const size_t rowBegin = y * size.x;
+            xform.grade(rowBegin + offset, rowBegin + size.x, values.data(), stride);
+
+            for (int x = 0; x < gridSize.x; ++x) {
+                scatterSample(&values[x * 4], invGamma, x * kSize / gridSize.x, partial.data());
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        for (size_t i = 0; i < density.size(); ++i) {
+            density[i] += partial[i];
+        }
+    };
+
+    const size_t rowNum = static_cast<size_t>(gridSize.y);
+    if (pool) {
+        // Each task allocates partial densities, thus rows are split into a few chunks per thread.
+        const size_t taskNum = static_cast<size_t>(pool->workerNum() + 1) * 2;
+        pool->parallelFor(rowNum, std::max<size_t>((rowNum + taskNum - 1) / taskNum, 1), accumulate);
+    } else {
+        accumulate(0, rowNum);
+    }
+}
+
+bool Scopes::initialize()
+{
+    if (mTexId == 0) {
+        glGenTextures(1, &mTexId);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, mTexId);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, kDensityWidth, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    mPixels.assign(kDensityWidth * kSize, 0);
+    mSampleCount = 0;
+    return true;
+}
+
+void Scopes::release()
+{
+    glDeleteTextures(1, &mTexId);
+    mTexId = 0;
+    mPixels.clear();
+    mSampleCount = 0;
+}
+
+void Scopes::updateTexture(const int* density, float intensity)
+{
+    if (mTexId == 0) {
+        return;
+    }
+
+    // Every sample hits one cell of each plot, thus the luma waveform holds the sample count.
+    mSampleCount = 0;
+    for (int i = 0; i < kDensityWidth * kSize; i += kDensityWidth) {
+        for (int x = 0; x < kSize; ++x) {
+            mSampleCount += density[i + x];
+        }
+    }
+
+    // Brightness follows 1 - exp(-density), where uniformly spread samples give 63% with unit intensity.
+    const float scale = intensity * kSize * kSize / std::max(mSampleCount, 1);
+    for (int y = 0; y < kSize; ++y) {
+        for (int x = 0; x < kDensityWidth; ++x) {
+            const int idx = y * kDensityWidth + x;
+            const int plot = x / kSize;
+            const float value = 1.0f - std::exp(-density[idx] * scale);
+
+            float color[3];
+            if (plot == Vectorscope) {
+                getChromaColor(x - kSize * plot, y, color);
+            } else {
+                std::copy(kWaveformColors[plot], kWaveformColors[plot] + 3, color);
+            }
+
+            mPixels[idx] = packColor(color[0] * value, color[1] * value, color[2] * value);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, mTexId);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kDensityWidth, kSize, GL_RGBA, GL_UNSIGNED_BYTE, mPixels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Scopes::getPlotUv(Plot plot, Vec2f& uv0, Vec2f& uv1) const
+{
+    uv0 = Vec2f(static_cast<float>(plot) / PlotNum, 1.0f);
+    uv1 = Vec2f(static_cast<float>(plot + 1) / PlotNum, 0.0f);
+}
+
+}  // namespace baktsiu
@@ -0,0 +1,78 @@
+#ifndef BAKTSIU_SCOPES_H_
+#define BAKTSIU_SCOPES_H_
+
+#include "common.h"
+
+#include <GL/gl3w.h>
+
+namespace baktsiu
+{
+
+class GradingTransform;
+class ThreadPool;
+
+/**
+ * Waveform monitor and vectorscope of graded image.
+ *
+ * Graded values are converted to BT.709 and encoded with display gamma, then
+ * each sample is scattered to density plots of kSize x kSize cells: the luma
+ * waveform, the RGB parade and the vectorscope of Cb and Cr. Densities are
+ * accumulated by scopes.comp or on CPU, and they are colorized to a display
+ * texture only when they are updated.
+ */
+class Scopes
+{
+public:
+    enum Plot
+    {
+        LumaWaveform = 0,
+        RedWaveform,
+        GreenWaveform,
+        BlueWaveform,
+        Vectorscope,
+        PlotNum
+    };
+
+    // Number of columns and levels of waveforms, and edge length of vectorscope.
+    static const int kSize = 256;
+
+    // Plots are placed side by side in density data, the layout of scopes.comp.
+    static const int kDensityWidth = kSize * PlotNum;
+
+    /**
+     * Accumulate densities on CPU.
+     *
+     * @param xform Grading transform of source pixels.
+     * @param size Width and height of image.
+     * @param stride Pixels are sampled at the center of each stride x stride block,
+     *      which approximates the mip level used by scopes.comp.
+     * @param displayGamma Encoding gamma of signal.
+     * @param pool Optional thread pool to process rows in parallel.
+     * @param density Output densities with kDensityWidth x kSize integers.
+     */
+    static void computeDensity(const GradingTransform& xform, const Vec2i& size, int stride,
+                    float displayGamma, ThreadPool* pool, std::vector<int>& density);
+
+public:
+    bool    initialize();
+
+    void    release();
+
+    // Colorize densities to display texture, intensity scales brightness of traces.
+    void    updateTexture(const int* density, float intensity);
+
+    // Return top-left and bottom-right UV of plot in display texture, v is flipped to put level 0 at bottom.
+    void    getPlotUv(Plot plot, Vec2f& uv0, Vec2f& uv1) const;
+
+    GLuint  textureId() const { return mTexId; }
+
+    bool    isEmpty() const { return mSampleCount == 0; }
+
+private:
+    GLuint                  mTexId = 0;
+    std::vector<uint32_t>   mPixels;
+    int                     mSampleCount = 0;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_SCOPES_H_
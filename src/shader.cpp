@@ -1,5 +1,8 @@
 #include "shader.h"
+#include "program_cache.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 
@@ -49,33 +52,54 @@ namespace baktsiu
 
 bool Shader::init(const std::string& name,
     const std::string& vtxShaderStr,
-    const std::string& fragShaderStr)
+    const std::string& fragShaderStr,
+    ProgramCache* cache)
 {
-    mVertexShader = createShader(GL_VERTEX_SHADER, name, vtxShaderStr);
-    mFragmentShader = createShader(GL_FRAGMENT_SHADER, name, fragShaderStr);
+    mName = name;
+    mProgram = glCreateProgram();
 
-    if (!mVertexShader || !mFragmentShader) {
-        return false;
+    std::string cacheKey;
+    if (cache && cache->isEnabled()) {
+        cacheKey = cache->makeKey(name, { &vtxShaderStr, &fragShaderStr });
     }
 
-    mName = name;
-    mProgram= glCreateProgram();
+    if (!cacheKey.empty() && cache->load(mProgram, cacheKey)) {
+        LOGD("Load program \"{}\" from cache", mName);
+    } else {
+        mVertexShader = createShader(GL_VERTEX_SHADER, name, vtxShaderStr);
+        mFragmentShader = createShader(GL_FRAGMENT_SHADER, name, fragShaderStr);
 
-    glAttachShader(mProgram, mVertexShader);
-    glAttachShader(mProgram, mFragmentShader);
-    glLinkProgram(mProgram);
+        if (!mVertexShader || !mFragmentShader) {
+            return false;
+        }
 
-    GLint status;
-    glGetProgramiv(mProgram, GL_LINK_STATUS, &status);
+        glAttachShader(mProgram, mVertexShader);
+        glAttachShader(mProgram, mFragmentShader);
 
-    if (status != GL_TRUE) {
-        char buffer[512];
-        glGetProgramInfoLog(mProgram, 512, nullptr, buffer);
-        LOGE("Linker error in \"{}\":\n{}", mName, buffer);
-        mProgram= 0;
-        throw std::runtime_error("Shader linking failed!");
+        if (!cacheKey.empty()) {
+            glProgramParameteri(mProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+
+        glLinkProgram(mProgram);
+
+        GLint status;
+        glGetProgramiv(mProgram, GL_LINK_STATUS, &status);
+
+        if (status != GL_TRUE) {
+            char buffer[512];
+            glGetProgramInfoLog(mProgram, 512, nullptr, buffer);
+            LOGE("Linker error in \"{}\":\n{}", mName, buffer);
+            mProgram= 0;
+            throw std::runtime_error("Shader linking failed!");
+        }
+
+        if (!cacheKey.empty()) {
+            cache->save(mProgram, cacheKey);
+        }
     }
 
+    cacheUniformLocations();
+
     if (mVaoId == 0) {
         glGenVertexArrays(1, &mVaoId);
     }
@@ -87,7 +111,9 @@ bool Shader::init(const std::string& name,
 bool Shader::initFromFiles(
     const std::string& name,
     const std::string& vertexFileName,
-    const std::string& fragmentFileName) 
+    const std::string& fragmentFileName,
+    ProgramCache* cache,
+    const std::string& libraryPath)
 {
     auto loadStrFromFile = [](const std::string& filename) -> std::string {
         if (filename.empty()) {
@@ -98,21 +124,54 @@ bool Shader::initFromFiles(
         return std::string((std::istreambuf_iterator<char>(t)), std::istreambuf_iterator<char>());
     };
 
-    return init(name, loadStrFromFile(vertexFileName), loadStrFromFile(fragmentFileName));
+    std::string fragShaderStr = loadStrFromFile(fragmentFileName);
+    if (!libraryPath.empty()) {
+        fragShaderStr = injectLibrary(fragShaderStr, loadStrFromFile(libraryPath));
+    }
+
+    return init(name, loadStrFromFile(vertexFileName), fragShaderStr, cache);
 }
 
-bool Shader::initCompute(const std::string& name, const std::string& compShaderCode)
+std::string Shader::injectLibrary(const std::string& source, const std::string& library)
 {
+    // GLSL requires #version to be the first statement.
+    size_t pos = source.find('\n');
+    if (pos == std::string::npos || source.compare(0, 8, "#version") != 0) {
+        return library + "\n" + source;
+    }
+
+    pos += 1;
+    return source.substr(0, pos) + library + "\n#line 2\n" + source.substr(pos);
+}
+
+bool Shader::initCompute(const std::string& name, const std::string& compShaderCode, ProgramCache* cache)
+{
+    mName = name;
+    mProgram = glCreateProgram();
+
+    std::string cacheKey;
+    if (cache && cache->isEnabled()) {
+        cacheKey = cache->makeKey(name, { &compShaderCode });
+    }
+
+    if (!cacheKey.empty() && cache->load(mProgram, cacheKey)) {
+        LOGD("Load program \"{}\" from cache", mName);
+        cacheUniformLocations();
+        return true;
+    }
+
     GLuint computeShader = createShader(GL_COMPUTE_SHADER, name, compShaderCode);
 
     if (!computeShader) {
         return false;
     }
 
-    mName = name;
-    mProgram = glCreateProgram();
-
     glAttachShader(mProgram, computeShader);
+
+    if (!cacheKey.empty()) {
+        glProgramParameteri(mProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     glLinkProgram(mProgram);
 
     GLint status;
@@ -128,6 +187,12 @@ bool Shader::initCompute(const std::string& name, const std::string& compShaderC
 
     glDeleteShader(computeShader);
 
+    if (!cacheKey.empty()) {
+        cache->save(mProgram, cacheKey);
+    }
+
+    cacheUniformLocations();
+
     return true;
 }
 
@@ -143,18 +208,72 @@ void Shader::release()
     glDeleteShader(mVertexShader);      mVertexShader = 0;
     glDeleteShader(mFragmentShader);    mFragmentShader = 0;
     glDeleteVertexArrays(1, &mVaoId);   mVaoId = 0;
+    mUniformLocations.clear();
 }
 
-GLint Shader::uniform(const std::string& name) const {
-    GLint id = glGetUniformLocation(mProgram, name.c_str());
+void Shader::cacheUniformLocations()
+{
+    mUniformLocations.clear();
+
+    GLint uniformNum = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(mProgram, GL_ACTIVE_UNIFORMS, &uniformNum);
+    glGetProgramiv(mProgram, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::vector<GLchar> nameBuffer(std::max(maxNameLength, 1));
+    for (GLint i = 0; i < uniformNum; ++i) {
+        GLint arraySize = 0;
+        GLenum type = 0;
+        GLsizei nameLength = 0;
+        glGetActiveUniform(mProgram, static_cast<GLuint>(i), static_cast<GLsizei>(nameBuffer.size()),
+            &nameLength, &arraySize, &type, nameBuffer.data());
+
+        std::string name(nameBuffer.data(), nameLength);
+        const GLint location = glGetUniformLocation(mProgram, name.c_str());
+        if (location == -1) {
+            continue;   // Members of uniform blocks have no location.
+        }
+
+        // Array uniforms are reported as "name[0]", we also register its base name.
+        const auto bracketPos = name.find('[');
+        if (bracketPos != std::string::npos) {
+            mUniformLocations[name.substr(0, bracketPos)] = location;
+        }
+
+        mUniformLocations[name] = location;
+    }
+}
+
+GLint Shader::uniform(const char* name) const {
+    auto iter = mUniformLocations.find(name);
+    if (iter != mUniformLocations.end()) {
+        return iter->second;
+    }
+
+    // Uniforms not found in cache might be optimized out by compiler. We
+    // record it with invalid location to avoid reporting it every frame.
+    GLint id = glGetUniformLocation(mProgram, name);
     
     if (id == -1) {
         LOGW("Can not find uniform: {}", name);
     }
-    
+
+    mUniformLocations[name] = id;
     return id;
 }
 
+bool Shader::bindUniformBlock(const std::string& blockName, GLuint bindingPoint)
+{
+    GLuint blockIndex = glGetUniformBlockIndex(mProgram, blockName.c_str());
+    if (blockIndex == GL_INVALID_INDEX) {
+        LOGW("Can not find uniform block: {}", blockName);
+        return false;
+    }
+
+    glUniformBlockBinding(mProgram, blockIndex, bindingPoint);
+    return true;
+}
+
 void Shader::drawTriangle()
 {
     // Even though we populate vertices' positions and uv coordinates from vertex ID directly,
@@ -164,9 +283,60 @@ void Shader::drawTriangle()
     glBindVertexArray(0);
 }
 
+void Shader::drawInstanced(GLsizei vertexNum, GLsizei instanceNum)
+{
+    glBindVertexArray(mVaoId);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, vertexNum, instanceNum);
+    glBindVertexArray(0);
+}
+
 void Shader::compute(GLuint numGroupX, GLuint numGroupY, GLuint numGroupZ)
 {
     glDispatchCompute(numGroupX, numGroupY, numGroupZ);
 }
 
+//-----------------------------------------------------------------------------
+
+bool UniformBuffer::initialize(GLsizeiptr size)
+{
+    if (mId == 0) {
+        glGenBuffers(1, &mId);
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, mId);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    mContents.clear();
+    return mId > 0;
+}
+
+void UniformBuffer::release()
+{
+    glDeleteBuffers(1, &mId);
+    mId = 0;
+    mContents.clear();
+}
+
+bool UniformBuffer::update(const void* data, GLsizeiptr size)
+{
+    const size_t byteSize = static_cast<size_t>(size);
+    if (mContents.size() == byteSize && std::memcmp(mContents.data(), data, byteSize) == 0) {
+        return false;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    mContents.assign(bytes, bytes + byteSize);
+
+    glBindBuffer(GL_UNIFORM_BUFFER, mId);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, size, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    return true;
+}
+
+void UniformBuffer::bind(GLuint bindingPoint)
+{
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, mId);
+}
+
 }  // namespace baktsiu
\ No newline at end of file
@@ -6,110 +6,169 @@
 
 #include <GL/gl3w.h>
 
+#include <functional>
+#include <map>
 #include <string>
 
 namespace baktsiu
 {
 
+class ProgramCache;
+
 // Helper class for compling and linking OpenGL shader.
 class Shader
 {
 public:
     //! Initialize graphics shader form string contents.
+    //! @param cache Optional program binary cache to skip compilation.
     bool    init(const std::string& name,
                  const std::string& vertShaderCode,
-                 const std::string& fragShaderCode);
+                 const std::string& fragShaderCode,
+                 ProgramCache* cache = nullptr);
 
+    //! @param libraryPath Optional shader library injected into fragment shader.
     bool    initFromFiles(const std::string& name, 
                           const std::string& vertShderPath,
-                          const std::string& fragShaderPath);
+                          const std::string& fragShaderPath,
+                          ProgramCache* cache = nullptr,
+                          const std::string& libraryPath = "");
 
-    bool    initCompute(const std::string& name, const std::string& compShaderCode);
+    bool    initCompute(const std::string& name, const std::string& compShaderCode,
+                        ProgramCache* cache = nullptr);
 
     const   std::string& name() const { return mName; }
 
+    // Return shader source with library code inserted right after #version directive.
+    // A #line directive is appended to keep line numbers of compiler errors intact.
+    static std::string injectLibrary(const std::string& source, const std::string& library);
+
     void    bind();
 
     //! Release internal graphics resources.
     void    release();
 
     // Return location of uniform.
-    GLint   uniform(const std::string& name) const;
+    // Locations are queried once after linking, missing names are only reported once.
+    // Names are looked up without constructing strings, thus it's cheap to call per draw.
+    GLint   uniform(const char* name) const;
+
+    // Assign uniform block of given name to the binding point of a uniform buffer.
+    bool    bindUniformBlock(const std::string& blockName, GLuint bindingPoint);
 
     /// Initialize a uniform parameter with a 4x4 matrix (float)
     template <typename T>
-    void setUniform(const std::string& name, const Mat4f& mat) {
+    void setUniform(const char* name, const Mat4f& mat) {
         glUniformMatrix4fv(uniform(name), 1, GL_FALSE, &mat[0][0]);
     }
 
-    void setUniform(const std::string& name, const std::vector<Vec4f>& values)
+    void setUniform(const char* name, const std::vector<Vec3f>& values)
+    {
+        glUniform3fv(uniform(name), static_cast<GLsizei>(values.size()), static_cast<const float*>(&values[0].x));
+    }
+
+    void setUniform(const char* name, const std::vector<Vec4f>& values)
     {
         glUniform4fv(uniform(name), static_cast<GLsizei>(values.size()), static_cast<const float*>(&values[0].x));
     }
 
     /// Initialize a uniform parameter with a 3x3 matrix (float)
     template <typename T>
-    void setUniform(const std::string& name, const Mat3f& mat) {
+    void setUniform(const char* name, const Mat3f& mat) {
         glUniformMatrix3fv(uniform(name), 1, GL_FALSE, &mat[0][0]);
     }
 
     /// Initialize a uniform parameter with a boolean value
-    void setUniform(const std::string& name, bool value) {
+    void setUniform(const char* name, bool value) {
         glUniform1i(uniform(name), (int)value);
     }
 
     /// Initialize a uniform parameter with an integer value
-    void setUniform(const std::string& name, int value) {
+    void setUniform(const char* name, int value) {
         glUniform1i(uniform(name), value);
     }
 
     /// Initialize a uniform parameter with a floating point value
-    void setUniform(const std::string& name, float value) {
+    void setUniform(const char* name, float value) {
         glUniform1f(uniform(name), value);
     }
 
     /// Initialize a uniform parameter with a 2D vector (int)
-    void setUniform(const std::string& name, const Vec2i& v) {
+    void setUniform(const char* name, const Vec2i& v) {
         glUniform2i(uniform(name), v.x, v.y);
     }
 
    /// Initialize a uniform parameter with a 2D vector (float)
-    void setUniform(const std::string& name, const Vec2f& v) {
+    void setUniform(const char* name, const Vec2f& v) {
         glUniform2f(uniform(name), v.x, v.y);
     }
 
     /// Initialize a uniform parameter with a 3D vector (int)
-    void setUniform(const std::string& name, const Vec3i& v) {
+    void setUniform(const char* name, const Vec3i& v) {
         glUniform3i(uniform(name), v.x, v.y, v.z);
     }
 
-    void setUniform(const std::string& name, const Vec3f& v) {
+    void setUniform(const char* name, const Vec3f& v) {
         glUniform3f(uniform(name), v.x, v.y, v.z);
     }
 
-    void setUniform(const std::string& name, const Vec4i& v) {
+    void setUniform(const char* name, const Vec4i& v) {
         glUniform4i(uniform(name), v.x, v.y, v.z, v.w);
     }
 
-    void setUniform(const std::string& name, const Vec4f& v) {
+    void setUniform(const char* name, const Vec4f& v) {
         glUniform4f(uniform(name), v.x, v.y, v.z, v.w);
     }
 
-    /// Initialize a uniform buffer with a uniform buffer object
-    //void setUniform(const std::string& name, const GLUniformBuffer& buf, bool warn = true);
-
     // Draw 
     void drawTriangle();
 
+    // Draw instances of triangles whose vertices are populated from vertex and instance IDs.
+    void drawInstanced(GLsizei vertexNum, GLsizei instanceNum);
+
     // Dispatch compute
     void compute(GLuint numGroupX, GLuint numGroupY= 1, GLuint numGroupZ = 1);
 
 private:
+    // Cache locations of all active uniforms of linked program.
+    void    cacheUniformLocations();
+
+private:
+    // Transparent comparator allows find() by C strings.
+    using UniformLocationMap = std::map<std::string, GLint, std::less<>>;
+
     std::string     mName;
     GLuint          mVaoId = 0u;
     GLuint          mVertexShader = 0u;
     GLuint          mFragmentShader = 0u;
     GLuint          mProgram = 0u;
+
+    mutable UniformLocationMap  mUniformLocations;
+};
+
+
+// Wrapper of uniform buffer object.
+//
+// It keeps a copy of the latest uploaded contents, thus we could call update()
+// every frame and only transfer data to GPU when any parameter is changed.
+class UniformBuffer
+{
+public:
+    bool    initialize(GLsizeiptr size);
+
+    void    release();
+
+    // Upload contents if they differ from previous ones.
+    // @return True if the buffer contents are updated.
+    bool    update(const void* data, GLsizeiptr size);
+
+    template <typename T>
+    bool    update(const T& data) { return update(&data, sizeof(T)); }
+
+    void    bind(GLuint bindingPoint);
+
+private:
+    std::vector<uint8_t>    mContents;
+    GLuint  mId = 0;
 };
 
 }  // namespace baktsiu
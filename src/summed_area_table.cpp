@@ -0,0 +1,358 @@
+#include "summed_area_table.h"
+#include "colour.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace baktsiu
+{
+
+SummedAreaTable::Moments& SummedAreaTable::Moments::operator+=(const Moments& other)
+{
+    for (int c = 0; c < kChannelNum; ++c) {
+        sum[c] += other.sum[c];
+        sumSq[c] += other.sumSq[c];
+    }
+
+    return *this;
+}
+
+SummedAreaTable::Moments& SummedAreaTable::Moments::operator-=(const Moments& other)
+{
+    for (int c = 0; c < kChannelNum; ++c) {
+        sum[c] -= other.sum[c];
+        sumSq[c] -= other.sumSq[c];
+    }
+
+    return *this;
+}
+
+bool SummedAreaTable::build(const uint16_t* pixels, const Vec2i& size, ThreadPool* pool)
+{
+    clear();
+    if (!pixels || size.x <= 0 || size.y <= 0) {
+        return false;
+    }
+
+    const int tileSize = kTileSize;
+    const size_t tilePixelNum = static_cast<size_t>(tileSize) * tileSize;
+    mSize = size;
+    mTileNum = (size + tileSize - 1) / tileSize;
+
+    const size_t tileNum = static_cast<size_t>(mTileNum.x) * mTileNum.y;
+    const size_t tileSumStride = static_cast<size_t>(mTileNum.x) + 1;
+    const size_t columnBandStride = static_cast<size_t>(mTileNum.y) + 1;
+    mValues.assign(tileNum * tilePixelNum * kChannelNum, 0);
+    mTileMinValues.resize(tileNum);
+    mTileMaxValues.resize(tileNum);
+    mBlockMinValues.assign(tileNum * kBlockNum * kBlockNum, Vec3f(std::numeric_limits<float>::infinity()));
+    mBlockMaxValues.assign(tileNum * kBlockNum * kBlockNum, Vec3f(-std::numeric_limits<float>::infinity()));
+    mTileSums.assign(tileSumStride * columnBandStride, Moments());
+    mRowBandSums.assign(static_cast<size_t>(mTileNum.y) * tileSize * tileSumStride, Moments());
+    mColumnBandSums.assign(static_cast<size_t>(mTileNum.x) * tileSize * columnBandStride, Moments());
+
+    const std::vector<float>& halfTable = getHalfTable();
+
+    // Copy values to tiles and sum them per row and column of tile. Row bands are
+    // accumulated along tiles of the band, other sums are accumulated later.
+    auto processBands = [&](size_t beginBand, size_t endBand) {
+        float rowSums[kTileSize][kChannelNum * 2];
+        float columnSums[kChannelNum * 2][kTileSize];
+        float values[kChannelNum][kTileSize];
+
+        for (size_t ty = beginBand; ty < endBand; ++ty) {
+            const int beginY = static_cast<int>(ty) * tileSize;
+            const int height = std::min(tileSize, size.y - beginY);
+
+            for (int tx = 0; tx < mTileNum.x; ++tx) {
+                const int beginX = tx * tileSize;
+                const int width = std::min(tileSize, size.x - beginX);
+                const size_t tileIdx = ty * mTileNum.x + tx;
+                uint16_t* tileValues = &mValues[tileIdx * tilePixelNum * kChannelNum];
+
+                std::fill(&rowSums[0][0], &rowSums[0][0] + kTileSize * kChannelNum * 2, 0.0f);
+                std::fill(&columnSums[0][0], &columnSums[0][0] + kTileSize * kChannelNum * 2, 0.0f);
+
+                for (int ly = 0; ly < height; ++ly) {
+                    const uint16_t* src = pixels + (static_cast<size_t>(beginY + ly) * size.x + beginX) * 4;
+                    uint16_t* dst = tileValues + static_cast<size_t>(ly) * tileSize * kChannelNum;
+
+                    // Decode row to planar values first, thus sums of channels are vectorized.
+                    for (int lx = 0; lx < width; ++lx) {
+                        for (int c = 0; c < kChannelNum; ++c) {
+                            const uint16_t bits = src[lx * 4 + c];
+                            dst[lx * kChannelNum + c] = bits;
+                            values[c][lx] = halfTable[bits];
+                        }
+                    }
+
+                    const size_t blockIdx = (tileIdx * kBlockNum + ly / kBlockSize) * kBlockNum;
+                    Vec3f* blockMinValues = &mBlockMinValues[blockIdx];
+                    Vec3f* blockMaxValues = &mBlockMaxValues[blockIdx];
+
+                    for (int c = 0; c < kChannelNum; ++c) {
+                        float sum = 0.0f;
+                        float sumSq = 0.0f;
+                        for (int lx = 0; lx < width; ++lx) {
+                            const float value = values[c][lx];
+                            sum += value;
+                            sumSq += value * value;
+                            columnSums[c][lx] += value;
+                            columnSums[kChannelNum + c][lx] += value * value;
+                        }
+
+                        rowSums[ly][c] = sum;
+                        rowSums[ly][kChannelNum + c] = sumSq;
+
+                        for (int bx = 0; bx * kBlockSize < width; ++bx) {
+                            const int endX = std::min((bx + 1) * kBlockSize, width);
+                            float minValue = blockMinValues[bx][c];
+                            float maxValue = blockMaxValues[bx][c];
+                            for (int lx = bx * kBlockSize; lx < endX; ++lx) {
+                                // NaN values are excluded by comparisons.
+                                const float value = values[c][lx];
+                                minValue = value < minValue ? value : minValue;
+                                maxValue = value > maxValue ? value : maxValue;
+                            }
+
+                            blockMinValues[bx][c] = minValue;
+                            blockMaxValues[bx][c] = maxValue;
+                        }
+                    }
+                }
+
+                const size_t blockIdx = tileIdx * kBlockNum * kBlockNum;
+                Vec3f& tileMinValue = mTileMinValues[tileIdx];
+                Vec3f& tileMaxValue = mTileMaxValues[tileIdx];
+                tileMinValue = mBlockMinValues[blockIdx];
+                tileMaxValue = mBlockMaxValues[blockIdx];
+                for (int i = 1; i < kBlockNum * kBlockNum; ++i) {
+                    tileMinValue = glm::min(tileMinValue, mBlockMinValues[blockIdx + i]);
+                    tileMaxValue = glm::max(tileMaxValue, mBlockMaxValues[blockIdx + i]);
+                }
+
+                // Sums of first rows of tile are added to sums of band over previous tiles.
+                Moments prefix;
+                for (int ly = 0; ly < tileSize; ++ly) {
+                    const size_t idx = (ty * tileSize + ly) * tileSumStride + tx;
+                    Moments& bandSum = mRowBandSums[idx + 1];
+                    bandSum = mRowBandSums[idx];
+                    bandSum += prefix;
+
+                    for (int c = 0; c < kChannelNum; ++c) {
+                        prefix.sum[c] += rowSums[ly][c];
+                        prefix.sumSq[c] += rowSums[ly][kChannelNum + c];
+                    }
+                }
+
+                mTileSums[(ty + 1) * tileSumStride + tx + 1] = prefix;
+
+                // Sums of first columns of tile, they are accumulated over tiles in the next pass.
+                prefix = Moments();
+                for (int lx = 0; lx < tileSize; ++lx) {
+                    mColumnBandSums[(static_cast<size_t>(tx) * tileSize + lx) * columnBandStride + ty + 1] = prefix;
+
+                    for (int c = 0; c < kChannelNum; ++c) {
+                        prefix.sum[c] += columnSums[c][lx];
+                        prefix.sumSq[c] += columnSums[kChannelNum + c][lx];
+                    }
+                }
+            }
+        }
+    };
+
+    auto accumulateColumnBands = [&](size_t beginColumn, size_t endColumn) {
+        for (size_t column = beginColumn; column < endColumn; ++column) {
+            Moments* sums = &mColumnBandSums[column * columnBandStride];
+            for (int ty = 1; ty <= mTileNum.y; ++ty) {
+                sums[ty] += sums[ty - 1];
+            }
+        }
+    };
+
+    const size_t columnNum = static_cast<size_t>(mTileNum.x) * tileSize;
+    if (pool) {
+        pool->parallelFor(mTileNum.y, 1, processBands);
+        pool->parallelFor(columnNum, 64, accumulateColumnBands);
+    } else {
+        processBands(0, mTileNum.y);
+        accumulateColumnBands(0, columnNum);
+    }
+
+    // Tables of whole tiles are small, thus they are accumulated serially.
+    for (int ty = 1; ty <= mTileNum.y; ++ty) {
+        for (int tx = 1; tx <= mTileNum.x; ++tx) {
+            Moments& sums = mTileSums[ty * tileSumStride + tx];
+            sums += mTileSums[(ty - 1) * tileSumStride + tx];
+            sums += mTileSums[ty * tileSumStride + tx - 1];
+            sums -= mTileSums[(ty - 1) * tileSumStride + tx - 1];
+        }
+    }
+
+    return true;
+}
+
+void SummedAreaTable::clear()
+{
+    mSize = Vec2i(0);
+    mTileNum = Vec2i(0);
+    mValues.clear();
+    mTileMinValues.clear();
+    mTileMaxValues.clear();
+    mBlockMinValues.clear();
+    mBlockMaxValues.clear();
+    mTileSums.clear();
+    mRowBandSums.clear();
+    mColumnBandSums.clear();
+}
+
+SummedAreaTable::RegionStatistics SummedAreaTable::query(Vec2i regionMin, Vec2i regionMax) const
+{
+    RegionStatistics stats;
+    regionMin = glm::clamp(regionMin, Vec2i(0), mSize);
+    regionMax = glm::clamp(regionMax, Vec2i(0), mSize);
+    if (isEmpty() || regionMin.x >= regionMax.x || regionMin.y >= regionMax.y) {
+        return stats;
+    }
+
+    Moments moments = getPrefixMoments(regionMax.x, regionMax.y);
+    moments -= getPrefixMoments(regionMin.x, regionMax.y);
+    moments -= getPrefixMoments(regionMax.x, regionMin.y);
+    moments += getPrefixMoments(regionMin.x, regionMin.y);
+
+    const Vec2i regionSize = regionMax - regionMin;
+    stats.pixelCount = static_cast<size_t>(regionSize.x) * regionSize.y;
+    for (int c = 0; c < kChannelNum; ++c) {
+        const double mean = moments.sum[c] / stats.pixelCount;
+        const double variance = moments.sumSq[c] / stats.pixelCount - mean * mean;
+        stats.mean[c] = static_cast<float>(mean);
+        stats.stddev[c] = static_cast<float>(std::sqrt(std::max(variance, 0.0)));
+    }
+
+    // Whole tiles and blocks within region use their min/max, others are scanned per pixel.
+    const Vec2i beginTile = regionMin / kTileSize;
+    const Vec2i endTile = (regionMax + kTileSize - 1) / kTileSize;
+    stats.minValue = Vec3f(std::numeric_limits<float>::infinity());
+    stats.maxValue = Vec3f(-std::numeric_limits<float>::infinity());
+
+    for (int ty = beginTile.y; ty < endTile.y; ++ty) {
+        for (int tx = beginTile.x; tx < endTile.x; ++tx) {
+            const Vec2i tile(tx, ty);
+            const Vec2i tileMin = tile * kTileSize;
+            const Vec2i tileSize = glm::min(mSize - tileMin, Vec2i(kTileSize));
+            const Vec2i localMin = glm::max(regionMin - tileMin, Vec2i(0));
+            const Vec2i localMax = glm::min(regionMax - tileMin, tileSize);
+
+            if (localMin == Vec2i(0) && localMax == tileSize) {
+                const size_t tileIdx = static_cast<size_t>(ty) * mTileNum.x + tx;
+                stats.minValue = glm::min(stats.minValue, mTileMinValues[tileIdx]);
+                stats.maxValue = glm::max(stats.maxValue, mTileMaxValues[tileIdx]);
+            } else {
+                gatherLocalExtrema(tile, localMin, localMax, stats.minValue, stats.maxValue);
+            }
+        }
+    }
+
+    return stats;
+}
+
+SummedAreaTable::Moments SummedAreaTable::getPrefixMoments(int x, int y) const
+{
+    const Vec2i tile(x / kTileSize, y / kTileSize);
+    const Vec2i local(x % kTileSize, y % kTileSize);
+    const size_t tileSumStride = static_cast<size_t>(mTileNum.x) + 1;
+
+    // Whole tiles before tile, then partial rows and columns of tile band,
+    // and the remaining part within tile.
+    Moments moments = mTileSums[tile.y * tileSumStride + tile.x];
+    if (local.y > 0) {
+        moments += mRowBandSums[(static_cast<size_t>(tile.y) * kTileSize + local.y) * tileSumStride + tile.x];
+    }
+
+    if (local.x > 0) {
+        const size_t columnBandStride = static_cast<size_t>(mTileNum.y) + 1;
+        moments += mColumnBandSums[(static_cast<size_t>(tile.x) * kTileSize + local.x) * columnBandStride + tile.y];
+    }
+
+    if (local.x > 0 && local.y > 0) {
+        moments += getLocalMoments(tile, local);
+    }
+
+    return moments;
+}
+
+SummedAreaTable::Moments SummedAreaTable::getLocalMoments(const Vec2i& tile, const Vec2i& localSize) const
+{
+    const std::vector<float>& halfTable = getHalfTable();
+    const uint16_t* tileValues = getTileValues(tile);
+    Moments moments;
+
+    for (int ly = 0; ly < localSize.y; ++ly) {
+        const uint16_t* row = tileValues + static_cast<size_t>(ly) * kTileSize * kChannelNum;
+        float sum[kChannelNum] = {};
+        float sumSq[kChannelNum] = {};
+
+        for (int lx = 0; lx < localSize.x; ++lx) {
+            for (int c = 0; c < kChannelNum; ++c) {
+                const float value = halfTable[row[lx * kChannelNum + c]];
+                sum[c] += value;
+                sumSq[c] += value * value;
+            }
+        }
+
+        for (int c = 0; c < kChannelNum; ++c) {
+            moments.sum[c] += sum[c];
+            moments.sumSq[c] += sumSq[c];
+        }
+    }
+
+    return moments;
+}
+
+void SummedAreaTable::gatherLocalExtrema(const Vec2i& tile, const Vec2i& localMin, const Vec2i& localMax,
+    Vec3f& minValue, Vec3f& maxValue) const
+{
+    const std::vector<float>& halfTable = getHalfTable();
+    const uint16_t* tileValues = getTileValues(tile);
+    const size_t tileBlockIdx = (static_cast<size_t>(tile.y) * mTileNum.x + tile.x) * kBlockNum * kBlockNum;
+    const Vec2i tileSize = glm::min(mSize - tile * kTileSize, Vec2i(kTileSize));
+    const Vec2i beginBlock = localMin / kBlockSize;
+    const Vec2i endBlock = (localMax + kBlockSize - 1) / kBlockSize;
+
+    for (int by = beginBlock.y; by < endBlock.y; ++by) {
+        for (int bx = beginBlock.x; bx < endBlock.x; ++bx) {
+            const Vec2i blockMin = Vec2i(bx, by) * kBlockSize;
+            const Vec2i blockMax = glm::min(blockMin + kBlockSize, tileSize);
+            const Vec2i scanMin = glm::max(localMin, blockMin);
+            const Vec2i scanMax = glm::min(localMax, blockMax);
+
+            if (scanMin == blockMin && scanMax == blockMax) {
+                const size_t blockIdx = tileBlockIdx + by * kBlockNum + bx;
+                minValue = glm::min(minValue, mBlockMinValues[blockIdx]);
+                maxValue = glm::max(maxValue, mBlockMaxValues[blockIdx]);
+                continue;
+            }
+
+            for (int ly = scanMin.y; ly < scanMax.y; ++ly) {
+                const uint16_t* row = tileValues + static_cast<size_t>(ly) * kTileSize * kChannelNum;
+                for (int lx = scanMin.x; lx < scanMax.x; ++lx) {
+                    for (int c = 0; c < kChannelNum; ++c) {
+                        const float value = halfTable[row[lx * kChannelNum + c]];
+                        minValue[c] = value < minValue[c] ? value : minValue[c];
+                        maxValue[c] = value > maxValue[c] ? value : maxValue[c];
+                    }
+                }
+            }
+        }
+    }
+}
+
+const uint16_t* SummedAreaTable::getTileValues(const Vec2i& tile) const
+{
+    const size_t tileIdx = static_cast<size_t>(tile.y) * mTileNum.x + tile.x;
+    return &mValues[tileIdx * kTileSize * kTileSize * kChannelNum];
+}
+
+}  // namespace baktsiu
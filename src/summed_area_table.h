@@ -0,0 +1,113 @@
+#ifndef BAKTSIU_SUMMED_AREA_TABLE_H_
+#define BAKTSIU_SUMMED_AREA_TABLE_H_
+
+#include "common.h"
+
+#include <vector>
+
+namespace baktsiu
+{
+
+class ThreadPool;
+
+/**
+ * Summed-area tables of graded RGB values for region statistics.
+ *
+ * Pixels are split into tiles of kTileSize x kTileSize. Prefix sums of values
+ * and squared values are stored in doubles at three levels: whole tiles, tile
+ * rows within each band of tiles, and tile columns within each column of
+ * tiles. The remaining part is summed within one tile, thus the sum over any
+ * rectangle takes constant time without doubles per pixel. Values are kept
+ * as half floats in tile-major order, which keeps local scans within few
+ * cache lines even for huge images.
+ */
+class SummedAreaTable
+{
+public:
+    static const int kTileSize = 64;
+    static const int kChannelNum = 3;
+
+    // Min/max values are also kept per block of kBlockSize x kBlockSize within tile.
+    static const int kBlockSize = 8;
+    static const int kBlockNum = kTileSize / kBlockSize;
+
+    struct RegionStatistics
+    {
+        Vec3f   mean = Vec3f(0.0f);
+        Vec3f   stddev = Vec3f(0.0f);
+        Vec3f   minValue = Vec3f(0.0f);
+        Vec3f   maxValue = Vec3f(0.0f);
+        size_t  pixelCount = 0;
+    };
+
+public:
+    /**
+     * Build tables from graded pixels.
+     *
+     * @param pixels RGBA half float pixels, e.g. the readback of graded texture.
+     * @param size Width and height of image.
+     * @param pool Optional thread pool to process bands of tiles in parallel.
+     */
+    bool    build(const uint16_t* pixels, const Vec2i& size, ThreadPool* pool = nullptr);
+
+    void    clear();
+
+    /**
+     * Return statistics of pixels within [regionMin, regionMax).
+     *
+     * Mean and standard deviation take constant time. Min and max values are
+     * gathered from whole tiles and blocks, only pixels of blocks on the border
+     * are scanned.
+     * Coordinates are in the order of input pixels and clamped to image.
+     */
+    RegionStatistics query(Vec2i regionMin, Vec2i regionMax) const;
+
+    const Vec2i& size() const { return mSize; }
+
+    bool    isEmpty() const { return mValues.empty(); }
+
+private:
+    struct Moments
+    {
+        double  sum[kChannelNum] = {};
+        double  sumSq[kChannelNum] = {};
+
+        Moments& operator+=(const Moments& other);
+        Moments& operator-=(const Moments& other);
+    };
+
+    // Return moments of pixels within [0, x) x [0, y).
+    Moments getPrefixMoments(int x, int y) const;
+
+    // Return moments of pixels within [0, localSize) of tile.
+    Moments getLocalMoments(const Vec2i& tile, const Vec2i& localSize) const;
+
+    // Merge min/max of pixels within [localMin, localMax) of tile.
+    void    gatherLocalExtrema(const Vec2i& tile, const Vec2i& localMin, const Vec2i& localMax,
+                Vec3f& minValue, Vec3f& maxValue) const;
+
+    const uint16_t* getTileValues(const Vec2i& tile) const;
+
+private:
+    Vec2i                   mSize = Vec2i(0);
+    Vec2i                   mTileNum = Vec2i(0);
+    std::vector<uint16_t>   mValues;            // RGB of each tile, padded to kTileSize x kTileSize.
+    std::vector<Vec3f>      mTileMinValues;
+    std::vector<Vec3f>      mTileMaxValues;
+    std::vector<Vec3f>      mBlockMinValues;    // kBlockNum x kBlockNum blocks of each tile.
+    std::vector<Vec3f>      mBlockMaxValues;
+
+    // Sums of whole tiles, (mTileNum.x + 1) x (mTileNum.y + 1) entries.
+    std::vector<Moments>    mTileSums;
+
+    // Sums of first rows of band of tiles over first tile columns,
+    // indexed by (ty * kTileSize + localRow) * (mTileNum.x + 1) + tx.
+    std::vector<Moments>    mRowBandSums;
+
+    // Sums of first columns of column of tiles over first tile rows,
+    // indexed by (tx * kTileSize + localColumn) * (mTileNum.y + 1) + ty.
+    std::vector<Moments>    mColumnBandSums;
+};
+
+}  // namespace baktsiu
+#endif // BAKTSIU_SUMMED_AREA_TABLE_H_
@@ -1,5 +1,6 @@
 ﻿#include "texture.h"
 
+#include <cstring>
 #include <fstream>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -16,6 +17,18 @@
 namespace baktsiu
 {
 
+namespace
+{
+
+// Return a new id of uploaded content, 0 is reserved for textures without content.
+uint32_t acquireContentId()
+{
+    static uint32_t sNextContentId = 0;
+    return ++sNextContentId;
+}
+
+}  // namespace
+
 bool Texture::isSupported(const std::string& filepath)
 {
     return getImageType(filepath) != ImageType::Unknown;
@@ -116,6 +129,52 @@ bool Texture::loadFromFile(const std::string& filepath)
     mFilePath = filepath;
     mFileName = filepath.substr(filepath.find_last_of("/") + 1);
 
+    // Scan decoded pixels on the loading thread, thus renderer bugs are reported on import.
+    mValidation.compute(mBuffer, mPixelDataType, Vec2i(mWidth, mHeight));
+    if (mValidation.hasIssues()) {
+        unsigned int counts[PixelValidation::IssueNum] = {};
+        for (int issue = 0; issue < PixelValidation::IssueNum; ++issue) {
+            for (int c = 0; c < PixelValidation::kChannelNum; ++c) {
+                counts[issue] += mValidation.count(static_cast<PixelValidation::Issue>(issue), c);
+            }
+        }
+
+        LOGW("{} has {} bad pixels: {} NaN, {} Inf and {} negative values", mFileName,
+            mValidation.badPixelCount(), counts[PixelValidation::NaN], counts[PixelValidation::Inf],
+            counts[PixelValidation::Negative]);
+    }
+
+    return true;
+}
+
+bool Texture::loadFromPixels(const std::string& name, const Vec2i& size, const float* pixels)
+{
+    if (!pixels || size.x <= 0 || size.y <= 0) {
+        return false;
+    }
+
+    // The buffer is released by stbi_image_free() as decoded ones, which is free() by default.
+    const size_t bufferSize = static_cast<size_t>(size.x) * size.y * 4 * sizeof(float);
+    uint8_t* buffer = reinterpret_cast<uint8_t*>(malloc(bufferSize));
+    if (!buffer) {
+        return false;
+    }
+
+    std::memcpy(buffer, pixels, bufferSize);
+    if (mBuffer) {
+        stbi_image_free(mBuffer);
+    }
+
+    mBuffer = buffer;
+    mWidth = size.x;
+    mHeight = size.y;
+    mChannelNum = 4;
+    mPixelDataType = GL_FLOAT;
+    mImageFormat = GL_RGBA32F;
+    mFilePath.clear();
+    mFileName = name;
+
+    mValidation.compute(mBuffer, mPixelDataType, size);
     return true;
 }
 
@@ -148,9 +207,12 @@ bool Texture::upload()
 
     glTexStorage2D(GL_TEXTURE_2D, 1, mImageFormat, mWidth, mHeight);
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, mWidth, mHeight, GL_RGBA, mPixelDataType, mBuffer);
+    mContentId = acquireContentId();
 
-    stbi_image_free(mBuffer);
-    mBuffer = nullptr;
+    if (!mRetainPixels) {
+        stbi_image_free(mBuffer);
+        mBuffer = nullptr;
+    }
 
     return true;
 }
@@ -166,6 +228,8 @@ void Texture::release()
         glDeleteTextures(1, &mTexId);
         mTexId = 0;
     }
+
+    mContentId = 0;
 }
 
 void    Texture::bind()
@@ -198,6 +262,7 @@ bool    RenderTexture::bindAsOutput(const Vec2i& size, GLenum imageFormat)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexImage2D(GL_TEXTURE_2D, 0, imageFormat, size.x, size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
     glBindTexture(GL_TEXTURE_2D, 0);
+    mUseLinearFilter = true;
 
     if (mFboId == 0) {
         glGenFramebuffers(1, &mFboId);
@@ -243,6 +308,13 @@ void    RenderTexture::bindAsInput(bool useLinearFilter)
     mUseLinearFilter = useLinearFilter;
 }
 
+void    RenderTexture::generateMipmaps()
+{
+    glBindTexture(GL_TEXTURE_2D, mTexId);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 void    RenderTexture::unbind()
 {
     glBindTexture(GL_TEXTURE_2D, 0);
@@ -251,6 +323,226 @@ void    RenderTexture::unbind()
 
 //-----------------------------------------------------------------------------
 
+bool    MipRenderTexture::initialize(const Vec2i& size, GLenum imageFormat)
+{
+    if (mSize == size && mImageFormat == imageFormat) {
+        return true;
+    }
+
+    if (mTexId == 0) {
+        glGenTextures(1, &mTexId);
+    }
+
+    mSize = size;
+    mImageFormat = imageFormat;
+    mLevelNum = 1;
+    while ((std::max(size.x, size.y) >> mLevelNum) > 0) {
+        mLevelNum++;
+    }
+
+    // Levels are only fetched by texelFetch(), all of them are allocated to keep texture complete.
+    glBindTexture(GL_TEXTURE_2D, mTexId);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mLevelNum - 1);
+    for (int level = 0; level < mLevelNum; ++level) {
+        const Vec2i levelSize = this->levelSize(level);
+        glTexImage2D(GL_TEXTURE_2D, level, imageFormat, levelSize.x, levelSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return mTexId != 0;
+}
+
+bool    MipRenderTexture::bindAsOutput(int level)
+{
+    if (mFboId == 0) {
+        glGenFramebuffers(1, &mFboId);
+    }
+
+    // Sampling a level other than the attached one avoids feedback loop.
+    if (level > 0) {
+        glBindTexture(GL_TEXTURE_2D, mTexId);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level - 1);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mFboId);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexId, level);
+
+#ifdef _DEBUG
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        return false;
+    }
+#endif
+
+    const Vec2i size = levelSize(level);
+    glViewport(0, 0, size.x, size.y);
+    return true;
+}
+
+void    MipRenderTexture::bindAsInput()
+{
+    glBindTexture(GL_TEXTURE_2D, mTexId);
+}
+
+void    MipRenderTexture::release()
+{
+    glDeleteTextures(1, &mTexId);
+    glDeleteFramebuffers(1, &mFboId);
+
+    mTexId = 0;
+    mFboId = 0;
+    mSize = Vec2i(0);
+    mLevelNum = 0;
+}
+
+void    MipRenderTexture::unbind()
+{
+    glBindTexture(GL_TEXTURE_2D, mTexId);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mLevelNum - 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+bool    Texture3D::initialize(int size, GLenum imageFormat, const float* data)
+{
+    if (mSize == size && mImageFormat == imageFormat && !data) {
+        return true;
+    }
+
+    if (mTexId == 0) {
+        glGenTextures(1, &mTexId);
+    }
+
+    glBindTexture(GL_TEXTURE_3D, mTexId);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexImage3D(GL_TEXTURE_3D, 0, imageFormat, size, size, size, 0, GL_RGBA, GL_FLOAT, data);
+    glBindTexture(GL_TEXTURE_3D, 0);
+
+    mSize = size;
+    mImageFormat = imageFormat;
+    return mTexId != 0;
+}
+
+bool    Texture3D::bindAsOutput(int slice)
+{
+    if (mFboId == 0) {
+        glGenFramebuffers(1, &mFboId);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mFboId);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, mTexId, 0, slice);
+
+#ifdef _DEBUG
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        return false;
+    }
+#endif
+
+    glViewport(0, 0, mSize, mSize);
+    return true;
+}
+
+void    Texture3D::bindAsInput()
+{
+    glBindTexture(GL_TEXTURE_3D, mTexId);
+}
+
+void    Texture3D::release()
+{
+    glDeleteTextures(1, &mTexId);
+    glDeleteFramebuffers(1, &mFboId);
+
+    mTexId = 0;
+    mFboId = 0;
+    mSize = 0;
+}
+
+void    Texture3D::unbind()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+//-----------------------------------------------------------------------------
+
+bool    RenderTextureArray::initialize(const Vec2i& size, int layerNum, GLenum imageFormat)
+{
+    if (mSize == size && mLayerNum == layerNum && mImageFormat == imageFormat) {
+        return true;
+    }
+
+    if (mTexId == 0) {
+        glGenTextures(1, &mTexId);
+    }
+
+    // Slices are only fetched by texelFetch().
+    glBindTexture(GL_TEXTURE_2D_ARRAY, mTexId);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, imageFormat, size.x, size.y, layerNum, 0, GL_RGBA, GL_FLOAT, nullptr);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    mSize = size;
+    mLayerNum = layerNum;
+    mImageFormat = imageFormat;
+    return mTexId != 0;
+}
+
+bool    RenderTextureArray::bindAsOutput(int layer)
+{
+    if (mFboId == 0) {
+        glGenFramebuffers(1, &mFboId);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, mFboId);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, mTexId, 0, layer);
+
+#ifdef _DEBUG
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        return false;
+    }
+#endif
+
+    glViewport(0, 0, mSize.x, mSize.y);
+    return true;
+}
+
+void    RenderTextureArray::bindAsInput()
+{
+    glBindTexture(GL_TEXTURE_2D_ARRAY, mTexId);
+}
+
+void    RenderTextureArray::release()
+{
+    glDeleteTextures(1, &mTexId);
+    glDeleteFramebuffers(1, &mFboId);
+
+    mTexId = 0;
+    mFboId = 0;
+    mSize = Vec2i(0);
+    mLayerNum = 0;
+}
+
+void    RenderTextureArray::unbind()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+//-----------------------------------------------------------------------------
+
 bool    Sampler::initialize(GLenum minFilter, GLenum magFilter)
 {
     if (mId == 0) {
@@ -9,6 +9,7 @@
 
 #include "common.h"
 #include "colour.h"
+#include "pixel_validation.h"
 
 namespace baktsiu
 {
@@ -45,6 +46,10 @@ public:
     // Load pixel data from file.
     bool    loadFromFile(const std::string& filepath);
 
+    // Copy RGBA float pixels in rows from top, e.g. images computed from other layers.
+    // Such textures have no file path, thus they can't be reloaded.
+    bool    loadFromPixels(const std::string& name, const Vec2i& size, const float* pixels);
+
     // Reload file from previous path.
     bool    reloadFile();
 
@@ -57,8 +62,23 @@ public:
     // Return GL texture id.
     GLuint  id() const { return mTexId; }
 
+    // Return id of uploaded content, which is unique among textures and 0 before uploading.
+    // Unlike id(), it's never reused by GL after the texture is deleted, e.g. reloaded files.
+    uint32_t contentId() const { return mContentId; }
+
     Vec2f   size() const { return Vec2f(mWidth, mHeight); }
 
+    // Keep decoded pixels in memory after uploading, e.g. for CPU statistics.
+    void    setRetainPixels(bool enable) { mRetainPixels = enable; }
+
+    // Return decoded RGBA pixels, it's null if they are released after uploading.
+    const void* pixels() const { return mBuffer; }
+
+    GLenum  pixelDataType() const { return mPixelDataType; }
+
+    // Return NaN, Inf and negative values found when the file is loaded.
+    const PixelValidation& validation() const { return mValidation; }
+
     void    bind();
 
     void    unbind();
@@ -72,6 +92,7 @@ private:
     std::string     mFileName;
 
     uint8_t*        mBuffer = nullptr;
+    PixelValidation mValidation;
     GLuint          mTexId = 0;
     GLenum          mImageFormat = GL_RGBA8;
     GLenum          mPixelDataType = GL_UNSIGNED_BYTE;
@@ -80,6 +101,8 @@ private:
     int             mHeight = 0;
     int             mChannelNum = 0;
     bool            mUseLinearFilter = true;
+    bool            mRetainPixels = false;
+    uint32_t        mContentId = 0;
 };
 
 
@@ -102,6 +125,9 @@ public:
 
     Vec2i   size() const { return mSize; }
 
+    // Generate mip levels of output texture for image loads, sampling still uses level 0.
+    void    generateMipmaps();
+
     void    unbind();
 
 private:
@@ -115,6 +141,102 @@ private:
 };
 
 
+// 2D texture whose mip levels are rendered one by one, e.g. max-reduction pyramids.
+// Each level is reduced from the previous one, which is the only level sampled meanwhile.
+class MipRenderTexture
+{
+public:
+    // Allocate all levels down to 1x1, the storage is kept if size and format are unchanged.
+    bool    initialize(const Vec2i& size, GLenum imageFormat);
+
+    // Bind framebuffer with given level as color attachment, and restrict sampling to the previous level.
+    bool    bindAsOutput(int level);
+
+    void    bindAsInput();
+
+    void    release();
+
+    GLuint  id() const { return mTexId; }
+
+    // Return size of level 0.
+    Vec2i   size() const { return mSize; }
+
+    Vec2i   levelSize(int level) const { return glm::max(mSize >> level, Vec2i(1)); }
+
+    int     levelNum() const { return mLevelNum; }
+
+    // Unbind framebuffer and restore sampling of all levels.
+    void    unbind();
+
+private:
+    Vec2i   mSize = Vec2i(0);
+    int     mLevelNum = 0;
+    GLuint  mFboId = 0;
+    GLuint  mTexId = 0;
+    GLenum  mImageFormat = GL_RGBA8;
+};
+
+
+// 3D texture which could be rendered slice by slice, e.g. baked LUT.
+class Texture3D
+{
+public:
+    // Allocate texture storage, optional RGBA data with red changing fastest is uploaded.
+    bool    initialize(int size, GLenum imageFormat, const float* data = nullptr);
+
+    // Bind framebuffer with given slice as color attachment.
+    bool    bindAsOutput(int slice);
+
+    void    bindAsInput();
+
+    void    release();
+
+    GLuint  id() const { return mTexId; }
+
+    // Return edge length of the cube.
+    int     size() const { return mSize; }
+
+    void    unbind();
+
+private:
+    int     mSize = 0;
+    GLuint  mFboId = 0;
+    GLuint  mTexId = 0;
+    GLenum  mImageFormat = GL_RGBA16F;
+};
+
+
+// 2D texture array which could be rendered slice by slice, e.g. tiles of mosaic view.
+class RenderTextureArray
+{
+public:
+    // Allocate texture storage, it's kept if size, slice number and format are unchanged.
+    bool    initialize(const Vec2i& size, int layerNum, GLenum imageFormat);
+
+    // Bind framebuffer with given slice as color attachment.
+    bool    bindAsOutput(int layer);
+
+    void    bindAsInput();
+
+    void    release();
+
+    GLuint  id() const { return mTexId; }
+
+    Vec2i   size() const { return mSize; }
+
+    int     layerNum() const { return mLayerNum; }
+
+    void    unbind();
+
+private:
+    Vec2i   mSize = Vec2i(0);
+    int     mLayerNum = 0;
+    GLuint  mFboId = 0;
+    GLuint  mTexId = 0;
+    GLenum  mImageFormat = GL_RGBA16F;
+};
+
+
 // Wrapper of texture sampler.
 class Sampler
 {
@@ -68,6 +68,7 @@ TextureSPtr TexturePool::acquireTexture(const std::string& filepath)
     }
 
     TextureSPtr newTexture = std::make_shared<Texture>();
+    newTexture->setRetainPixels(mRetainPixels);
 
     {
         // Create a load request and append to queue.
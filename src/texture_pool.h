@@ -50,6 +50,9 @@ public:
     // Whether there are textures waiting for uploading.
     bool    hasNoPendingTasks() const;
 
+    // Keep decoded pixels of newly acquired textures after uploading.
+    void    setRetainPixels(bool enable) { mRetainPixels = enable; }
+
 private:
     // The handling function for each worker thread.
     void    processImportTasks();
@@ -68,6 +71,7 @@ private:
     std::vector<std::thread>    mWorkers;
 
     bool    mAboutToTerminate = false;
+    bool    mRetainPixels = false;
 };
 
 }  // namespace baktsiu
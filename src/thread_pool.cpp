@@ -0,0 +1,126 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace baktsiu
+{
+
+ThreadPool::~ThreadPool()
+{
+    release();
+}
+
+void    ThreadPool::initialize(int workerNum)
+{
+    release();
+
+    if (workerNum < 0) {
+        workerNum = std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0);
+    }
+
+    mAboutToTerminate = false;
+    for (int i = 0; i < workerNum; ++i) {
+        mWorkers.push_back(std::thread(&ThreadPool::processTasks, this));
+    }
+}
+
+void    ThreadPool::release()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        mAboutToTerminate = true;
+        mConditionVar.notify_all();
+    }
+
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+
+    mWorkers.clear();
+}
+
+void    ThreadPool::parallelFor(size_t count, size_t grainSize, const RangeFunc& func)
+{
+    if (count == 0) {
+        return;
+    }
+
+    grainSize = std::max<size_t>(grainSize, 1);
+    const size_t chunkNum = (count + grainSize - 1) / grainSize;
+    if (chunkNum == 1 || mWorkers.empty()) {
+        func(0, count);
+        return;
+    }
+
+    // Queued tasks claim the next chunk of the group, or do nothing if all chunks are
+    // claimed. Thus they could outlive the calling thread, but never access func then.
+    auto group = std::make_shared<TaskGroup>();
+    group->func = &func;
+    group->count = count;
+    group->grainSize = grainSize;
+    group->chunkNum = chunkNum;
+
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        for (size_t i = 1; i < chunkNum; ++i) {
+            mTaskQueue.push_back([group]() { group->executeNextChunk(); });
+        }
+    }
+    mConditionVar.notify_all();
+
+    // The calling thread also processes chunks of its group instead of waiting idly.
+    while (group->executeNextChunk()) {
+    }
+
+    std::unique_lock<std::mutex> lock(group->doneMutex);
+    group->doneCondVar.wait(lock, [&group]() { return group->doneNum == group->chunkNum; });
+}
+
+bool    ThreadPool::TaskGroup::executeNextChunk()
+{
+    const size_t index = nextChunk++;
+    if (index >= chunkNum) {
+        return false;
+    }
+
+    const size_t begin = index * grainSize;
+    (*func)(begin, std::min(begin + grainSize, count));
+
+    const std::lock_guard<std::mutex> lock(doneMutex);
+    if (++doneNum == chunkNum) {
+        doneCondVar.notify_all();
+    }
+
+    return true;
+}
+
+void    ThreadPool::processTasks()
+{
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mConditionVar.wait(lock, [this]() { return mAboutToTerminate || !mTaskQueue.empty(); });
+            if (mAboutToTerminate && mTaskQueue.empty()) {
+                return;
+            }
+
+            task = std::move(mTaskQueue.front());
+            mTaskQueue.pop_front();
+        }
+
+        task();
+    }
+}
+
+void    parallelFor(ThreadPool* pool, size_t count, const ThreadPool::RangeFunc& func, size_t grainSize)
+{
+    if (pool) {
+        pool->parallelFor(count, grainSize, func);
+    } else {
+        func(0, count);
+    }
+}
+
+}  // namespace baktsiu
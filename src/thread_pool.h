@@ -0,0 +1,82 @@
+#ifndef BAKTSIU_THREAD_POOL_H_
+#define BAKTSIU_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace baktsiu
+{
+
+/**
+ * Pool of worker threads for data parallel tasks on CPU.
+ *
+ * parallelFor() splits a range into chunks of a task group, the calling thread
+ * also processes chunks of its own group and returns after all of them are done.
+ * It never runs chunks of other groups, thus a thread calling it every frame is
+ * not stalled by heavy work queued from background threads. It's safe to call it
+ * from any thread, even from chunks of another group or when the pool has no worker.
+ */
+class ThreadPool
+{
+public:
+    // Function to process elements in [begin, end).
+    using RangeFunc = std::function<void(size_t begin, size_t end)>;
+
+public:
+    ThreadPool() = default;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool();
+
+    // Spawn worker threads. The default number is hardware concurrency minus one,
+    // since the calling thread of parallelFor() also shares the workload.
+    void    initialize(int workerNum = -1);
+
+    void    release();
+
+    int     workerNum() const { return static_cast<int>(mWorkers.size()); }
+
+    // Invoke func over [0, count) with chunks of given grain size in parallel.
+    void    parallelFor(size_t count, size_t grainSize, const RangeFunc& func);
+
+private:
+    using Task = std::function<void()>;
+
+    // Chunks of one parallelFor() call.
+    struct TaskGroup
+    {
+        const RangeFunc*        func = nullptr;
+        size_t                  count = 0;
+        size_t                  grainSize = 1;
+        size_t                  chunkNum = 0;
+        std::atomic<size_t>     nextChunk{ 0 };
+        size_t                  doneNum = 0;        // Guarded by doneMutex.
+        std::mutex              doneMutex;
+        std::condition_variable doneCondVar;
+
+        // Claim and process the next chunk, return false if all chunks are claimed.
+        bool    executeNextChunk();
+    };
+
+    void    processTasks();
+
+private:
+    std::deque<Task>            mTaskQueue;
+    std::mutex                  mMutex;
+    std::condition_variable     mConditionVar;
+    std::vector<std::thread>    mWorkers;
+
+    bool    mAboutToTerminate = false;
+};
+
+// Invoke func over [0, count) with chunks of given grain size, on the calling thread if pool is null.
+void    parallelFor(ThreadPool* pool, size_t count, const ThreadPool::RangeFunc& func, size_t grainSize = 1);
+
+}  // namespace baktsiu
+#endif // BAKTSIU_THREAD_POOL_H_
@@ -98,6 +98,15 @@ void    View::translate(const Vec2f& value, bool localSpace)
     restrictTranslation();
 }
 
+void    View::centerOn(const Vec2f& imgCoords)
+{
+    Vec2f center = getVisibleSize() * 0.5f;
+    center.x += mViewPadding.w;
+    center.y += mViewPadding.z;
+
+    translate(center - (imgCoords * mImageScale + getImageOffset()));
+}
+
 void    View::resize(const Vec2f& size)
 {
     mViewSize = size;
@@ -26,6 +26,9 @@ public:
     //! Return image scale factor.
     float   getImageScale() const;
 
+    //! Return viewport size excluding padding.
+    Vec2f   getVisibleSize() const;
+
     Vec2f   getImageScalePivot() const;
 
     void    setLocalOffset(const Vec2f& offset);
@@ -44,6 +47,9 @@ public:
     //! @param localSpace Offset is specified in local coordinates (before transformation).
     void    translate(const Vec2f& offset, bool localSpace = false);
 
+    //! Translate image to put given image coordinates at center of visible region.
+    void    centerOn(const Vec2f& imgCoords);
+
     //! Reset image to viewport center.
     void    reset(bool fitViewport);
 
@@ -56,8 +62,6 @@ private:
     //! in the viewport.
     Vec2f   getConstrainedPivot(Vec2f pivot) const;
 
-    Vec2f   getVisibleSize() const;
-
     void    restrictTranslation();
 
 private:
@@ -0,0 +1,195 @@
+// Conformance of CPU color pipeline.
+//
+// Kernels of all SIMD levels supported by CPU must be bit-exact to the scalar ones,
+// and they must match reference values captured from color_grading.frag and
+// present.frag within tolerances, see present_reference.cpp.
+
+#include "conformance_cases.h"
+#include "present_reference.h"
+#include "test_utils.h"
+
+#include "color_pipeline.h"
+#include "image_statistics.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using namespace baktsiu;
+using namespace baktsiu::test;
+
+// Graded values are rounded to half floats, thus CPU and GPU could differ by one ULP.
+const float kGradingTolerance = 1.0f / 1024.0f;
+
+// Difference allowed between display values of CPU and GPU. Transcendental functions
+// of GLSL are less precise than libm ones, and results pass through pow() of display gamma.
+const float kPresentTolerance = 5e-4f;
+
+const ColorPipeline::SimdLevel kSimdLevels[] = {
+    ColorPipeline::SimdLevel::SSE2, ColorPipeline::SimdLevel::NEON, ColorPipeline::SimdLevel::AVX2 };
+
+// Identical bits, or both are NaN since kernels don't preserve NaN payloads.
+bool isSameValue(float a, float b)
+{
+    return std::memcmp(&a, &b, sizeof(float)) == 0 || (std::isnan(a) && std::isnan(b));
+}
+
+bool isClose(float value, float reference, float tolerance)
+{
+    return std::fabs(value - reference) <= tolerance * std::max(1.0f, std::fabs(reference));
+}
+
+// Random RGBA half pixels in [-1/16, 16), alpha is in [0, 1].
+std::vector<uint16_t> makeRandomHalfPixels(size_t pixelNum)
+{
+    std::vector<float> pixels(pixelNum * 4);
+    uint32_t state = 20200202u;
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        state = state * 1664525u + 1013904223u;
+        const float t = static_cast<float>(state >> 8) / 16777216.0f;
+        pixels[i] = (i % 4 == 3) ? t : std::exp2(t * 12.0f - 8.0f) * ((state & 0xF) == 0 ? -1.0f : 1.0f);
+    }
+
+    return toHalfPixels(pixels);
+}
+
+// Compare process() and computeGradedDistances() of all SIMD levels with scalar kernels.
+void testSimdConformance(ThreadPool& pool)
+{
+    // Odd size covers partial packets, and pixels span more than one tile.
+    const Vec2i size(131, 127);
+    const size_t pixelNum = static_cast<size_t>(size.x) * size.y;
+    const std::vector<uint16_t> pixels = makeRandomHalfPixels(pixelNum);
+
+    ColorPipeline scalarPipeline;
+    scalarPipeline.setSimdLevel(ColorPipeline::SimdLevel::Scalar);
+
+    std::vector<float> expected(pixelNum * 4), output(pixelNum * 4);
+    for (ColorPipeline::SimdLevel level : kSimdLevels) {
+        ColorPipeline pipeline;
+        if (!pipeline.setSimdLevel(level)) {
+            fmt::print("Skip unsupported SIMD level {}\n", ColorPipeline::getSimdLevelName(level));
+            continue;
+        }
+
+        const char* levelName = ColorPipeline::getSimdLevelName(level);
+        for (int i = 0; i < kGradingCaseNum; ++i) {
+            const GradingCase gradingCase = getGradingCase(i);
+            const PresentCase presentCase = getPresentCase(i % kPresentCaseNum);
+
+            ColorPipeline::Settings settings;
+            settings.encodingType = static_cast<ColorEncodingType>(gradingCase.encodingType);
+            settings.primaryType = static_cast<ColorPrimaryType>(gradingCase.primaryType);
+            settings.exposureValue = kGradingExposure;
+            settings.presentMode = presentCase.presentMode;
+            settings.applyToneMapping = presentCase.applyToneMapping;
+            settings.outTransformType = presentCase.outTransformType;
+
+            scalarPipeline.process(pixels.data(), GL_HALF_FLOAT, size, settings, expected.data(), &pool);
+            pipeline.process(pixels.data(), GL_HALF_FLOAT, size, settings, output.data(), &pool);
+
+            size_t mismatchNum = 0;
+            for (size_t j = 0; j < output.size(); ++j) {
+                mismatchNum += isSameValue(output[j], expected[j]) ? 0 : 1;
+            }
+
+            TEST_CHECK(mismatchNum == 0, "{} process() case {}: {} values differ from scalar ones",
+                levelName, i, mismatchNum);
+        }
+
+        // Graded values of the latest case are used as the pair of distances.
+        std::vector<float> distances(pixelNum), expectedDistances(pixelNum);
+        scalarPipeline.computeGradedDistances(expected.data(), output.data() + 4, pixelNum - 1, expectedDistances.data());
+        pipeline.computeGradedDistances(expected.data(), output.data() + 4, pixelNum - 1, distances.data());
+
+        size_t mismatchNum = 0;
+        for (size_t j = 0; j + 1 < pixelNum; ++j) {
+            mismatchNum += isSameValue(distances[j], expectedDistances[j]) ? 0 : 1;
+        }
+
+        TEST_CHECK(mismatchNum == 0, "{} computeGradedDistances(): {} values differ from scalar ones",
+            levelName, mismatchNum);
+    }
+}
+
+// Compare GradingTransform with color_grading.frag.
+void testGrading()
+{
+    const std::vector<uint16_t> pixels = toHalfPixels(makeTestPixels());
+    std::vector<float> graded(kTestPixelNum * 4);
+
+    for (int i = 0; i < kGradingCaseNum; ++i) {
+        const GradingCase gradingCase = getGradingCase(i);
+        GradingTransform transform;
+        transform.initialize(pixels.data(), GL_HALF_FLOAT, static_cast<ColorEncodingType>(gradingCase.encodingType),
+            static_cast<ColorPrimaryType>(gradingCase.primaryType), kGradingExposure);
+        transform.grade(0, kTestPixelNum, graded.data());
+
+        for (int j = 0; j < kTestPixelNum * 3; ++j) {
+            const float value = graded[j / 3 * 4 + j % 3];
+            const float reference = kGradingReference[i][j];
+            if (std::isnan(reference)) {
+                continue;
+            }
+
+            TEST_CHECK(isClose(value, reference, kGradingTolerance), "Grading case {} pixel {}: {} vs shader {}",
+                i, j / 3, value, reference);
+        }
+    }
+}
+
+// Compare stages after grading of all SIMD levels with present.frag.
+void testPresent()
+{
+    const std::vector<float> pixels = makeTestPixels();
+    std::vector<float> values;
+
+    for (ColorPipeline::SimdLevel level : { ColorPipeline::SimdLevel::Scalar,
+        ColorPipeline::SimdLevel::SSE2, ColorPipeline::SimdLevel::NEON, ColorPipeline::SimdLevel::AVX2 }) {
+        ColorPipeline pipeline;
+        if (!pipeline.setSimdLevel(level)) {
+            continue;
+        }
+
+        float maxError = 0.0f;
+        for (int i = 0; i < kPresentCaseNum; ++i) {
+            const PresentCase presentCase = getPresentCase(i);
+            ColorPipeline::Settings settings;
+            settings.presentMode = presentCase.presentMode;
+            settings.applyToneMapping = presentCase.applyToneMapping;
+            settings.outTransformType = presentCase.outTransformType;
+            settings.displayGamma = kDisplayGamma;
+
+            values = pixels;
+            pipeline.transformGradedValues(values.data(), kTestPixelNum, settings);
+
+            for (int j = 0; j < kTestPixelNum * 3; ++j) {
+                const float value = values[j / 3 * 4 + j % 3];
+                const float reference = kPresentReference[i][j];
+                TEST_CHECK(isClose(value, reference, kPresentTolerance), "{} present case {} pixel {}: {} vs shader {}",
+                    ColorPipeline::getSimdLevelName(level), i, j / 3, value, reference);
+                maxError = std::max(maxError, std::fabs(value - reference));
+            }
+        }
+
+        fmt::print("{} max error of display values: {}\n", ColorPipeline::getSimdLevelName(level), maxError);
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    ThreadPool pool;
+    pool.initialize();
+
+    testSimdConformance(pool);
+    testGrading();
+    testPresent();
+    return getTestResult();
+}
@@ -0,0 +1,100 @@
+#ifndef BAKTSIU_CONFORMANCE_CASES_H_
+#define BAKTSIU_CONFORMANCE_CASES_H_
+
+#include <glm/gtc/packing.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace baktsiu
+{
+namespace test
+{
+
+// Inputs and settings of the CPU color pipeline compared with shaders, they are shared by
+// color_pipeline_test and present_reference, which captures reference values from shaders.
+
+const int   kTestPixelNum = 64;
+
+const int   kEncodingNum = 6;       // See ColorEncodingType.
+const int   kPrimaryNum = 5;        // See ColorPrimaryType.
+const int   kGradingCaseNum = kEncodingNum * kPrimaryNum;
+const float kGradingExposure = 0.5f;
+
+const int   kPresentModeNum = 8;    // See presentModes@App::initToolbar.
+const int   kOutTransformNum = 3;
+const int   kPresentCaseNum = kPresentModeNum * 2 * kOutTransformNum;
+const float kDisplayGamma = 2.2f;
+
+struct GradingCase
+{
+    int     encodingType;
+    int     primaryType;
+};
+
+struct PresentCase
+{
+    int     presentMode;
+    bool    applyToneMapping;
+    int     outTransformType;
+};
+
+inline GradingCase getGradingCase(int index)
+{
+    return { index / kPrimaryNum, index % kPrimaryNum };
+}
+
+inline PresentCase getPresentCase(int index)
+{
+    return { index % kPresentModeNum, (index / kPresentModeNum) % 2 != 0, index / (kPresentModeNum * 2) };
+}
+
+/**
+ * Return RGBA values of test pixels, alpha is 1.
+ *
+ * Values are exactly representable in half float, thus graded textures and CPU
+ * grading read the same inputs. Leading pixels are black, white, mid gray,
+ * primaries, a negative component and a highlight, the others are random
+ * values in [2^-8, 2^5) from a fixed LCG.
+ */
+inline std::vector<float> makeTestPixels()
+{
+    std::vector<float> pixels = {
+        0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 1.0f, 1.0f, 1.0f,
+        0.1875f, 0.1875f, 0.1875f, 1.0f,
+        1.0f, 0.0f, 0.0f, 1.0f,
+        0.0f, 1.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f, 1.0f,
+        0.5f, -0.015625f, 0.25f, 1.0f,
+        96.0f, 48.0f, 24.0f, 1.0f,
+    };
+
+    uint32_t state = 20200101u;
+    while (pixels.size() < static_cast<size_t>(kTestPixelNum) * 4) {
+        for (int c = 0; c < 3; ++c) {
+            state = state * 1664525u + 1013904223u;
+            const int mantissa = static_cast<int>((state >> 16) & 63);
+            const int exponent = static_cast<int>((state >> 24) % 13) - 8;
+            pixels.push_back(std::ldexp(1.0f + mantissa / 64.0f, exponent));
+        }
+        pixels.push_back(1.0f);
+    }
+
+    return pixels;
+}
+
+inline std::vector<uint16_t> toHalfPixels(const std::vector<float>& pixels)
+{
+    std::vector<uint16_t> halfPixels(pixels.size());
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        halfPixels[i] = glm::packHalf1x16(pixels[i]);
+    }
+
+    return halfPixels;
+}
+
+}  // namespace test
+}  // namespace baktsiu
+#endif // BAKTSIU_CONFORMANCE_CASES_H_
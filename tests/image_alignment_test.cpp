@@ -0,0 +1,126 @@
+// Known-shift tests of image alignment.
+//
+// Synthetic images are translated copies of the same anti-aliased discs over waves,
+// thus the second one is exactly the first one shifted by sub-pixel offsets.
+
+#include "test_utils.h"
+
+#include "image_alignment.h"
+#include "thread_pool.h"
+
+#include <glm/gtc/packing.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using namespace baktsiu;
+using namespace baktsiu::test;
+
+// In pixels. Offsets are on grid of 1/20 pixels, the margin is for rounding errors of floats.
+const float kTolerance = 0.1f + 1e-4f;
+
+struct Disc
+{
+    Vec2f   center;
+    float   radius;
+    float   value;
+};
+
+// Uniform random numbers in [0, 1) of a linear congruential generator, thus they're the same on all platforms.
+class Random
+{
+public:
+    float   next()
+    {
+        mState = mState * 1664525u + 1013904223u;
+        return static_cast<float>(mState >> 8) / 16777216.0f;
+    }
+
+private:
+    uint32_t    mState = 20200618u;
+};
+
+std::vector<Disc> makeDiscs(const Vec2i& size)
+{
+    Random random;
+    std::vector<Disc> discs(size.x * size.y / 1500);
+    for (Disc& disc : discs) {
+        disc.center = Vec2f(random.next() * size.x, random.next() * size.y);
+        disc.radius = 3.0f + random.next() * 30.0f;
+        disc.value = random.next() - 0.3f;
+    }
+
+    return discs;
+}
+
+// Return RGBA half pixels of discs translated by offset, i.e. pixel (x, y) + offset matches (x, y) of offset 0.
+std::vector<uint16_t> renderImage(const std::vector<Disc>& discs, const Vec2i& size, const Vec2f& offset)
+{
+    std::vector<float> values(static_cast<size_t>(size.x) * size.y);
+    for (int y = 0; y < size.y; ++y) {
+        for (int x = 0; x < size.x; ++x) {
+            const Vec2f p = Vec2f(x, y) - offset;
+            values[static_cast<size_t>(y) * size.x + x] = 0.3f + 0.03f * std::sin(0.11f * p.x + 0.05f * p.y) +
+                0.03f * std::sin(-0.04f * p.x + 0.13f * p.y + 1.0f);
+        }
+    }
+
+    // Coverage of disc edges is one pixel wide, pixels out of bounding boxes are skipped.
+    for (const Disc& disc : discs) {
+        const Vec2f center = disc.center + offset;
+        const Vec2i minPixel = glm::max(Vec2i(glm::floor(center - disc.radius - 1.0f)), Vec2i(0));
+        const Vec2i maxPixel = glm::min(Vec2i(glm::ceil(center + disc.radius + 1.0f)), size - 1);
+        for (int y = minPixel.y; y <= maxPixel.y; ++y) {
+            for (int x = minPixel.x; x <= maxPixel.x; ++x) {
+                const float distance = glm::length(Vec2f(x, y) - center);
+                values[static_cast<size_t>(y) * size.x + x] += disc.value * glm::clamp(disc.radius - distance + 0.5f, 0.0f, 1.0f);
+            }
+        }
+    }
+
+    std::vector<uint16_t> pixels(values.size() * 4);
+    for (size_t i = 0; i < values.size(); ++i) {
+        const uint16_t value = glm::packHalf1x16(std::max(values[i], 0.0f));
+        pixels[i * 4] = pixels[i * 4 + 1] = pixels[i * 4 + 2] = value;
+        pixels[i * 4 + 3] = glm::packHalf1x16(1.0f);
+    }
+
+    return pixels;
+}
+
+void testKnownShifts(const Vec2i& size, const std::vector<Vec2f>& offsets, ThreadPool& pool)
+{
+    const std::vector<Disc> discs = makeDiscs(size);
+    const std::vector<uint16_t> pixels1 = renderImage(discs, size, Vec2f(0.0f));
+
+    for (const Vec2f& offset : offsets) {
+        const std::vector<uint16_t> pixels2 = renderImage(discs, size, offset);
+        ImageAlignment alignment;
+        TEST_CHECK(alignment.estimate(pixels1.data(), pixels2.data(), size, &pool),
+            "Failed to align {}x{} images", size.x, size.y);
+
+        const Vec2f error = glm::abs(alignment.offset() - offset);
+        TEST_CHECK(error.x <= kTolerance && error.y <= kTolerance, "{}x{} images shifted by ({}, {}): ({}, {})",
+            size.x, size.y, offset.x, offset.y, alignment.offset().x, alignment.offset().y);
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    ThreadPool pool;
+    pool.initialize();
+
+    // Images within kCoarseSize are only aligned at coarse level.
+    testKnownShifts(Vec2i(320, 240), { Vec2f(0.0f), Vec2f(3.0f, -2.0f), Vec2f(0.4f, -0.7f), Vec2f(-12.25f, 5.5f) }, pool);
+
+    // Larger images are downsampled by 2, and shifts larger than that are compensated in the refine pass.
+    testKnownShifts(Vec2i(1024, 768), { Vec2f(0.0f), Vec2f(3.0f, -2.0f), Vec2f(0.4f, -0.7f), Vec2f(9.25f, -6.5f),
+        Vec2f(-37.6f, 21.3f) }, pool);
+    return getTestResult();
+}
@@ -0,0 +1,174 @@
+"""Reference values of ImageMetrics for the fixture of image_metrics_test.cpp.
+
+Metrics are computed in float64 by straightforward 2D convolutions, independent of
+separable filters and ring buffers of image_metrics.cpp. FLIP follows flip.py of the
+reference implementation (Andersson et al. 2020).
+
+Usage: python image_metrics_reference.py  (needs NumPy and SciPy)
+"""
+
+import numpy as np
+from scipy.signal import convolve2d
+
+WIDTH, HEIGHT = 64, 48
+PIXELS_PER_DEGREE = 67.0
+DISPLAY_GAMMA = 2.2
+
+# kAP1ToBT709@color_pipeline_kernels.h.
+AP1_TO_BT709 = np.array([
+    [1.7050515, -0.6217907, -0.0832587],
+    [-0.1302571, 1.1408029, -0.0105482],
+    [-0.0240033, -0.1289688, 1.1529717]])
+
+
+def quantize(value):
+    """Values are multiples of 1/1024, thus they are exact in half floats."""
+    return np.floor(np.clip(value, 0.0, 1.0) * 1024.0 + 0.5) / 1024.0
+
+
+def make_fixture():
+    """The same as makeFixture@image_metrics_test.cpp, linear ACES AP1 colors."""
+    y, x = np.mgrid[0:HEIGHT, 0:WIDTH].astype(np.float64)
+
+    def pattern(x, y):
+        return np.stack([
+            0.5 + 0.5 * np.sin(0.15 * x) * np.cos(0.07 * y),
+            np.mod(np.floor(x / 8.0) + np.floor(y / 8.0), 2.0) * 0.7 + 0.1,
+            np.minimum(np.hypot(x - WIDTH / 2, y - HEIGHT / 2) / WIDTH, 1.0)], -1)
+
+    first = pattern(x, y)
+    second = 0.5 * (pattern(x, y) + pattern(np.maximum(x - 1.0, 0.0), y))
+    second[..., 0] += 0.03 * np.sin(1.7 * x + 2.3 * y)
+    second[..., 2] += np.where((x >= 16) & (x < 32) & (y >= 16) & (y < 24), 0.2, 0.0)
+    return quantize(first), quantize(second)
+
+
+def to_display(colors):
+    """Output transform of sRGB display, values are clamped to [0, 1] as ImageMetrics."""
+    values = np.clip(colors, 0.0, 1.0) @ AP1_TO_BT709.T
+    return np.clip(np.maximum(values, 0.0) ** (1.0 / DISPLAY_GAMMA), 0.0, 1.0)
+
+
+def conv(plane, kernel):
+    return convolve2d(plane, kernel, mode='same', boundary='symm')
+
+
+def compute_ssim(x, y):
+    g = np.exp(-0.5 * np.arange(-5, 6) ** 2 / 1.5 ** 2)
+    window = np.outer(g, g) / g.sum() ** 2
+    mx, my = conv(x, window), conv(y, window)
+    sxx = conv(x * x, window) - mx * mx
+    syy = conv(y * y, window) - my * my
+    sxy = conv(x * y, window) - mx * my
+    c1, c2 = 1e-4, 9e-4
+    cs = (2 * sxy + c2) / (sxx + syy + c2)
+    luminance = (2 * mx * my + c1) / (mx * mx + my * my + c1)
+    return (luminance * cs).mean(), cs.mean()
+
+
+def compute_msssim(x, y):
+    weights = [0.0448, 0.2856, 0.3001, 0.2363, 0.1333]
+    scale_num, size = 1, min(x.shape)
+    while scale_num < 5 and size // 2 >= 11:
+        size //= 2
+        scale_num += 1
+
+    weights = np.array(weights[:scale_num]) / sum(weights[:scale_num])
+    result = 1.0
+    for scale in range(scale_num):
+        ssim, cs = compute_ssim(x, y)
+        result *= max(cs if scale + 1 < scale_num else ssim, 0.0) ** weights[scale]
+        if scale + 1 < scale_num:
+            h, w = x.shape[0] // 2 * 2, x.shape[1] // 2 * 2
+            x = x[:h, :w].reshape(h // 2, 2, w // 2, 2).mean(axis=(1, 3))
+            y = y[:h, :w].reshape(h // 2, 2, w // 2, 2).mean(axis=(1, 3))
+    return result
+
+
+def compute_flip(a, b):
+    xyz_matrix = np.array([
+        [0.4124564, 0.3575761, 0.1804375],
+        [0.2126729, 0.7151522, 0.0721750],
+        [0.0193339, 0.1191920, 0.9503041]])
+    white = xyz_matrix @ np.ones(3)
+
+    def srgb_to_linear(c):
+        return np.where(c <= 0.04045, c / 12.92, ((c + 0.055) / 1.055) ** 2.4)
+
+    def linear_to_ycxcz(c):
+        xyz = (c @ xyz_matrix.T) / white
+        return np.stack([116 * xyz[..., 1] - 16, 500 * (xyz[..., 0] - xyz[..., 1]),
+                         200 * (xyz[..., 1] - xyz[..., 2])], -1)
+
+    def ycxcz_to_linear(o):
+        y = (o[..., 0] + 16) / 116
+        xyz = np.stack([o[..., 1] / 500 + y, y, y - o[..., 2] / 200], -1) * white
+        return xyz @ np.linalg.inv(xyz_matrix).T
+
+    def linear_to_lab(c):
+        xyz = (c @ xyz_matrix.T) / np.array([0.95047, 1.0, 1.08883])
+        f = np.where(xyz > 0.008856451679, np.cbrt(xyz), 7.787037037 * xyz + 16 / 116)
+        return np.stack([116 * f[..., 1] - 16, 500 * (f[..., 0] - f[..., 1]), 200 * (f[..., 1] - f[..., 2])], -1)
+
+    def hunt(lab):
+        return np.stack([lab[..., 0], 0.01 * lab[..., 0] * lab[..., 1], 0.01 * lab[..., 0] * lab[..., 2]], -1)
+
+    def hyab(p, q):
+        return np.abs(p[..., 0] - q[..., 0]) + np.hypot(p[..., 1] - q[..., 1], p[..., 2] - q[..., 2])
+
+    # Contrast sensitivity filters of achromatic and two chromatic channels.
+    radius = int(np.ceil(3 * np.sqrt(0.04 / (2 * np.pi ** 2)) * PIXELS_PER_DEGREE))
+    xx, yy = np.meshgrid(range(-radius, radius + 1), range(-radius, radius + 1))
+    z = (xx ** 2 + yy ** 2) / PIXELS_PER_DEGREE ** 2
+    csf_filters = []
+    for a1, b1, a2, b2 in [(1, 0.0047, 0, 1e-5), (1, 0.0053, 0, 1e-5), (34.1, 0.04, 13.5, 0.025)]:
+        kernel = a1 * np.sqrt(np.pi / b1) * np.exp(-np.pi ** 2 * z / b1) + \
+            a2 * np.sqrt(np.pi / b2) * np.exp(-np.pi ** 2 * z / b2)
+        csf_filters.append(kernel / kernel.sum())
+
+    def spatial_filter(o):
+        filtered = np.stack([conv(o[..., i], csf_filters[i]) for i in range(3)], -1)
+        return np.clip(ycxcz_to_linear(filtered), 0.0, 1.0)
+
+    oa, ob = linear_to_ycxcz(srgb_to_linear(a)), linear_to_ycxcz(srgb_to_linear(b))
+    color_error = hyab(hunt(linear_to_lab(spatial_filter(oa))), hunt(linear_to_lab(spatial_filter(ob)))) ** 0.7
+    max_error = hyab(hunt(linear_to_lab(np.array([0.0, 1.0, 0.0]))),
+                     hunt(linear_to_lab(np.array([0.0, 0.0, 1.0])))) ** 0.7
+    pc, pt = 0.4, 0.95
+    color_error = np.where(color_error < pc * max_error, pt / (pc * max_error) * color_error,
+                           pt + (color_error - pc * max_error) / (max_error - pc * max_error) * (1 - pt))
+
+    # Edge and point detectors of luminance.
+    sd = 0.5 * 0.082 * PIXELS_PER_DEGREE
+    radius = int(np.ceil(3 * sd))
+    xx, yy = np.meshgrid(range(-radius, radius + 1), range(-radius, radius + 1))
+    gaussian = np.exp(-(xx ** 2 + yy ** 2) / (2 * sd * sd))
+
+    def normalize(kernel):
+        return np.where(kernel < 0, kernel / -kernel[kernel < 0].sum(), kernel / kernel[kernel > 0].sum())
+
+    edge_filter = normalize(-xx * gaussian)
+    point_filter = normalize((xx ** 2 / (sd * sd) - 1) * gaussian)
+
+    def feature(plane, kernel):
+        return np.hypot(conv(plane, kernel), conv(plane, kernel.T))
+
+    ya, yb = (oa[..., 0] + 16) / 116, (ob[..., 0] + 16) / 116
+    edge_diff = np.abs(feature(ya, edge_filter) - feature(yb, edge_filter))
+    point_diff = np.abs(feature(ya, point_filter) - feature(yb, point_filter))
+    feature_error = (np.maximum(edge_diff, point_diff) / np.sqrt(2)) ** 0.5
+    return (color_error ** (1 - feature_error)).mean()
+
+
+def main():
+    first, second = make_fixture()
+    a, b = to_display(first), to_display(second)
+    luma = np.array([0.2126, 0.7152, 0.0722])
+    print('psnr   {:.9g}'.format(-10 * np.log10(((a - b) ** 2).mean())))
+    print('ssim   {:.9g}'.format(compute_ssim(a @ luma, b @ luma)[0]))
+    print('msssim {:.9g}'.format(compute_msssim(a @ luma, b @ luma)))
+    print('flip   {:.9g}'.format(compute_flip(a, b)))
+
+
+if __name__ == '__main__':
+    main()
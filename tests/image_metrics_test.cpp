@@ -0,0 +1,162 @@
+// Known-value tests of image metrics.
+//
+// Reference values of the fixture are computed by image_metrics_reference.py.
+
+#include "test_utils.h"
+
+#include "image_metrics.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using namespace baktsiu;
+using namespace baktsiu::test;
+
+const Vec2i kFixtureSize(64, 48);
+
+// Metrics of fixture by NumPy with default settings.
+const float kReferencePsnr = 20.7164744f;
+const float kReferenceSsim = 0.888266669f;
+const float kReferenceMsssim = 0.966832319f;
+const float kReferenceFlip = 0.243348154f;
+
+const float kPsnrTolerance = 1e-3f;     // In dB.
+const float kTolerance = 1e-5f;
+
+const ColorPipeline::SimdLevel kSimdLevels[] = { ColorPipeline::SimdLevel::Scalar,
+    ColorPipeline::SimdLevel::SSE2, ColorPipeline::SimdLevel::NEON, ColorPipeline::SimdLevel::AVX2 };
+
+// Values are multiples of 1/1024, thus they are exact in half floats of graded values.
+float quantize(double value)
+{
+    return static_cast<float>(std::floor(std::min(std::max(value, 0.0), 1.0) * 1024.0 + 0.5) / 1024.0);
+}
+
+void getPattern(double x, double y, double color[3])
+{
+    color[0] = 0.5 + 0.5 * std::sin(0.15 * x) * std::cos(0.07 * y);
+    color[1] = std::fmod(std::floor(x / 8.0) + std::floor(y / 8.0), 2.0) * 0.7 + 0.1;
+    color[2] = std::min(std::hypot(x - kFixtureSize.x / 2, y - kFixtureSize.y / 2) / kFixtureSize.x, 1.0);
+}
+
+// RGBA floats of linear ACES AP1 colors, the second image is blurred with noise and a brighter block.
+std::vector<float> makeFixture(bool isSecond)
+{
+    std::vector<float> pixels;
+    for (int y = 0; y < kFixtureSize.y; ++y) {
+        for (int x = 0; x < kFixtureSize.x; ++x) {
+            double color[3], left[3];
+            getPattern(x, y, color);
+            if (isSecond) {
+                getPattern(std::max(x - 1, 0), y, left);
+                for (int c = 0; c < 3; ++c) {
+                    color[c] = 0.5 * (color[c] + left[c]);
+                }
+                color[0] += 0.03 * std::sin(1.7 * x + 2.3 * y);
+                color[2] += (x >= 16 && x < 32 && y >= 16 && y < 24) ? 0.2 : 0.0;
+            }
+
+            pixels.insert(pixels.end(), { quantize(color[0]), quantize(color[1]), quantize(color[2]), 1.0f });
+        }
+    }
+
+    return pixels;
+}
+
+ColorPipeline::Source getSource(const std::vector<float>& pixels)
+{
+    ColorPipeline::Source source;
+    source.pixels = pixels.data();
+    source.pixelDataType = GL_FLOAT;
+    source.encodingType = ColorEncodingType::Linear;
+    source.primaryType = ColorPrimaryType::ACES_AP1;
+    return source;
+}
+
+void testIdenticalImages(ThreadPool& pool)
+{
+    const std::vector<float> pixels = makeFixture(false);
+    ImageMetrics metrics;
+    TEST_CHECK(metrics.compute(getSource(pixels), getSource(pixels), kFixtureSize, ImageMetrics::Settings(), &pool),
+        "Failed to compute metrics of identical images");
+
+    const float psnr = metrics.value(ImageMetrics::PSNR);
+    TEST_CHECK(std::isinf(psnr) && psnr > 0.0f, "PSNR of identical images: {}", psnr);
+    TEST_CHECK(std::fabs(metrics.value(ImageMetrics::SSIM) - 1.0f) <= kTolerance,
+        "SSIM of identical images: {}", metrics.value(ImageMetrics::SSIM));
+    TEST_CHECK(std::fabs(metrics.value(ImageMetrics::MSSSIM) - 1.0f) <= kTolerance,
+        "MS-SSIM of identical images: {}", metrics.value(ImageMetrics::MSSSIM));
+    TEST_CHECK(metrics.value(ImageMetrics::FLIP) == 0.0f,
+        "FLIP of identical images: {}", metrics.value(ImageMetrics::FLIP));
+}
+
+// Gray pixels are kept by output transform to sRGB up to 3e-6, thus with display gamma 1
+// a constant offset of graded values is the RMSE of display values.
+void testConstantOffset(ThreadPool& pool)
+{
+    const float offset = 64.0f / 1024.0f;
+    std::vector<float> pixels1, pixels2;
+    for (int y = 0; y < kFixtureSize.y; ++y) {
+        for (int x = 0; x < kFixtureSize.x; ++x) {
+            const float value = static_cast<float>((x * 7 + y * 5) % 768) / 1024.0f;
+            pixels1.insert(pixels1.end(), { value, value, value, 1.0f });
+            pixels2.insert(pixels2.end(), { value + offset, value + offset, value + offset, 1.0f });
+        }
+    }
+
+    ImageMetrics::Settings settings;
+    settings.displayGamma = 1.0f;
+    ImageMetrics metrics;
+    TEST_CHECK(metrics.compute(getSource(pixels1), getSource(pixels2), kFixtureSize, settings, &pool),
+        "Failed to compute metrics of offset images");
+
+    const float expected = -20.0f * std::log10(offset);
+    const float psnr = metrics.value(ImageMetrics::PSNR);
+    TEST_CHECK(std::fabs(psnr - expected) <= kPsnrTolerance, "PSNR of constant offset: {} vs {}", psnr, expected);
+}
+
+void testReferenceFixture(ThreadPool& pool)
+{
+    const std::vector<float> pixels1 = makeFixture(false);
+    const std::vector<float> pixels2 = makeFixture(true);
+
+    for (ColorPipeline::SimdLevel level : kSimdLevels) {
+        ImageMetrics metrics;
+        if (!metrics.setSimdLevel(level)) {
+            continue;
+        }
+
+        const char* levelName = ColorPipeline::getSimdLevelName(level);
+        TEST_CHECK(metrics.compute(getSource(pixels1), getSource(pixels2), kFixtureSize, ImageMetrics::Settings(), &pool),
+            "{} failed to compute metrics of fixture", levelName);
+        TEST_CHECK(metrics.scaleNum() == 3, "{} scales of MS-SSIM: {}", levelName, metrics.scaleNum());
+
+        const float psnr = metrics.value(ImageMetrics::PSNR);
+        const float ssim = metrics.value(ImageMetrics::SSIM);
+        const float msssim = metrics.value(ImageMetrics::MSSSIM);
+        const float flip = metrics.value(ImageMetrics::FLIP);
+        TEST_CHECK(std::fabs(psnr - kReferencePsnr) <= kPsnrTolerance, "{} PSNR: {} vs {}", levelName, psnr, kReferencePsnr);
+        TEST_CHECK(std::fabs(ssim - kReferenceSsim) <= kTolerance, "{} SSIM: {} vs {}", levelName, ssim, kReferenceSsim);
+        TEST_CHECK(std::fabs(msssim - kReferenceMsssim) <= kTolerance, "{} MS-SSIM: {} vs {}",
+            levelName, msssim, kReferenceMsssim);
+        TEST_CHECK(std::fabs(flip - kReferenceFlip) <= kTolerance, "{} FLIP: {} vs {}", levelName, flip, kReferenceFlip);
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    ThreadPool pool;
+    pool.initialize();
+
+    testIdenticalImages(pool);
+    testConstantOffset(pool);
+    testReferenceFixture(pool);
+    return getTestResult();
+}
@@ -0,0 +1,76 @@
+// Regression tests of LUT parsing and evaluation with invalid inputs.
+
+#include "test_utils.h"
+
+#include "lut.h"
+
+#include <limits>
+#include <string>
+
+namespace
+{
+
+using namespace baktsiu;
+using namespace baktsiu::test;
+
+const float kNaN = std::numeric_limits<float>::quiet_NaN();
+const float kInf = std::numeric_limits<float>::infinity();
+
+// Identity LUT of given type on lattice of 2 entries per axis.
+const char* kCube1D =
+    "LUT_1D_SIZE 2\n"
+    "0 0 0\n"
+    "1 1 1\n";
+
+const char* kCube3D =
+    "LUT_3D_SIZE 2\n"
+    "0 0 0\n1 0 0\n0 1 0\n1 1 0\n"
+    "0 0 1\n1 0 1\n0 1 1\n1 1 1\n";
+
+// Non-finite values are mapped to the domain edges, i.e. NaN and -Inf to the lower
+// edge and +Inf to the upper edge.
+void testNonFiniteInputs(const char* name, const char* contents)
+{
+    Lut lut;
+    TEST_CHECK(lut.parseCube(contents), "Failed to parse {} LUT", name);
+
+    float pixels[] = {
+        kNaN, kNaN, kNaN, 1.0f,
+        kInf, kInf, kInf, 1.0f,
+        -kInf, -kInf, -kInf, 1.0f,
+        kNaN, 0.5f, kInf, 1.0f,
+    };
+    const Vec3f expected[] = { Vec3f(0.0f), Vec3f(1.0f), Vec3f(0.0f), Vec3f(0.0f, 0.5f, 1.0f) };
+
+    lut.apply(pixels, 4, 4);
+    for (int i = 0; i < 4; ++i) {
+        const Vec3f result(pixels[i * 4], pixels[i * 4 + 1], pixels[i * 4 + 2]);
+        TEST_CHECK(result == expected[i], "{} LUT pixel {}: ({}, {}, {})", name, i, result.r, result.g, result.b);
+    }
+
+    const Vec3f result = lut.apply(Vec3f(kNaN, 0.5f, kInf));
+    TEST_CHECK(result == expected[3], "{} LUT single color: ({}, {}, {})", name, result.r, result.g, result.b);
+}
+
+void testInvalidSizes()
+{
+    // Negative 1D size cancels out the extra entries of 3D lattice.
+    const std::string negativeSize1D = std::string("LUT_1D_SIZE -1\n") + kCube3D + "0 0 0\n";
+    TEST_CHECK(!Lut().parseCube(negativeSize1D), "Negative LUT_1D_SIZE is accepted");
+
+    const std::string negativeSize3D = std::string("LUT_3D_SIZE -2\n") + "0 0 0\n";
+    TEST_CHECK(!Lut().parseCube(negativeSize3D), "Negative LUT_3D_SIZE is accepted");
+
+    const std::string missingEntry = std::string(kCube3D).substr(0, std::string(kCube3D).rfind("1 1 1"));
+    TEST_CHECK(!Lut().parseCube(missingEntry), "LUT with missing entry is accepted");
+}
+
+}  // namespace
+
+int main()
+{
+    testNonFiniteInputs("1D", kCube1D);
+    testNonFiniteInputs("3D", kCube3D);
+    testInvalidSizes();
+    return getTestResult();
+}
@@ -0,0 +1,379 @@
+// Capture reference values of color_grading.frag and present.frag for color_pipeline_test,
+// or verify the committed ones against shaders of current tree.
+//
+// Usage:
+//   present_reference --verify         Compare shaders with present_reference.h.
+//   present_reference <header path>    Regenerate present_reference.h.
+//
+// It needs a GL 3.3 context, the verification is skipped if there is none.
+
+#include "conformance_cases.h"
+#include "present_reference.h"
+#include "test_utils.h"
+
+#include "colour.h"
+#include "shader.h"
+
+#include <GL/gl3w.h>
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace baktsiu;
+using namespace baktsiu::test;
+
+const int   kSkipReturnCode = 77;   // SKIP_RETURN_CODE of CTest.
+const float kTolerance = 1e-5f;     // Relative difference allowed between drivers.
+
+std::string getShaderPath(const char* filename)
+{
+    return std::string(BAKTSIU_SHADER_DIR) + "/" + filename;
+}
+
+// Float render target of one row of test pixels.
+class RenderTarget
+{
+public:
+    bool    initialize(GLenum internalFormat)
+    {
+        glGenTextures(1, &mTexId);
+        glBindTexture(GL_TEXTURE_2D, mTexId);
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, kTestPixelNum, 1, 0, GL_RGBA, GL_FLOAT, nullptr);
+
+        glGenFramebuffers(1, &mFboId);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFboId);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexId, 0);
+        return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    void    bind()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, mFboId);
+        glViewport(0, 0, kTestPixelNum, 1);
+    }
+
+    // Return RGB values of pixels.
+    std::vector<float> read()
+    {
+        std::vector<float> rgba(kTestPixelNum * 4);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFboId);
+        glReadPixels(0, 0, kTestPixelNum, 1, GL_RGBA, GL_FLOAT, rgba.data());
+
+        std::vector<float> rgb;
+        for (int i = 0; i < kTestPixelNum; ++i) {
+            rgb.insert(rgb.end(), rgba.begin() + i * 4, rgba.begin() + i * 4 + 3);
+        }
+
+        return rgb;
+    }
+
+private:
+    GLuint  mTexId = 0;
+    GLuint  mFboId = 0;
+};
+
+GLuint createTexture(GLenum format, GLenum type, const void* pixels)
+{
+    GLuint texId = 0;
+    glGenTextures(1, &texId);
+    glBindTexture(GL_TEXTURE_2D, texId);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, kTestPixelNum, 1, 0, GL_RGBA, type, pixels);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    return texId;
+}
+
+// Contents of PresentParams@present.frag, members are located by names thus it
+// doesn't depend on the layout of PresentParams@app.h.
+class PresentParamWriter
+{
+public:
+    bool    initialize(GLuint program)
+    {
+        mProgram = program;
+        const GLuint blockIndex = glGetUniformBlockIndex(program, "PresentParams");
+        if (blockIndex == GL_INVALID_INDEX) {
+            return false;
+        }
+
+        GLint dataSize = 0;
+        glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+        mData.assign(dataSize, 0);
+        glGenBuffers(1, &mBufferId);
+        return dataSize > 0;
+    }
+
+    template <typename T>
+    void    set(const char* name, const T& value)
+    {
+        GLuint index = GL_INVALID_INDEX;
+        glGetUniformIndices(mProgram, 1, &name, &index);
+        TEST_CHECK(index != GL_INVALID_INDEX, "Missing {} in PresentParams", name);
+        if (index == GL_INVALID_INDEX) {
+            return;
+        }
+
+        GLint offset = 0;
+        glGetActiveUniformsiv(mProgram, 1, &index, GL_UNIFORM_OFFSET, &offset);
+        std::memcpy(mData.data() + offset, &value, sizeof(T));
+    }
+
+    void    upload(GLuint bindingPoint)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, mBufferId);
+        glBufferData(GL_UNIFORM_BUFFER, mData.size(), mData.data(), GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, mBufferId);
+    }
+
+private:
+    GLuint              mProgram = 0;
+    GLuint              mBufferId = 0;
+    std::vector<char>   mData;
+};
+
+// Mark graded values which are undefined in shaders as NaN. Decoding PQ signals out of
+// [0, 1] takes pow() of negative values, and conversion of values over the range of
+// half floats is implementation-defined.
+void markUndefinedValues(const GradingCase& gradingCase, const std::vector<float>& pixels, std::vector<float>& rgb)
+{
+    const float kHalfMax = 65504.0f;
+    const bool isPqSignal = gradingCase.encodingType == static_cast<int>(ColorEncodingType::BT_2100_PQ);
+
+    for (int i = 0; i < kTestPixelNum; ++i) {
+        bool isUndefined = false;
+        for (int c = 0; c < 3; ++c) {
+            const float value = pixels[i * 4 + c];
+            isUndefined |= isPqSignal && (value < 0.0f || value > 1.0f);
+            isUndefined |= std::fabs(rgb[i * 3 + c]) >= kHalfMax;
+        }
+
+        if (isUndefined) {
+            std::fill_n(rgb.begin() + i * 3, 3, std::numeric_limits<float>::quiet_NaN());
+        }
+    }
+}
+
+struct ReferenceValues
+{
+    std::vector<std::vector<float>> grading;
+    std::vector<std::vector<float>> present;
+};
+
+bool captureReferenceValues(ReferenceValues& values)
+{
+    const std::string quadShader = getShaderPath("quad.vert");
+    const std::string colorTransformLib = getShaderPath("color_transform.glsl");
+
+    Shader gradingShader, presentShader;
+    if (!gradingShader.initFromFiles("color_grading", quadShader, getShaderPath("color_grading.frag")) ||
+        !presentShader.initFromFiles("present", quadShader, getShaderPath("present.frag"), nullptr, colorTransformLib)) {
+        fmt::print(stderr, "Failed to initialize shaders\n");
+        return false;
+    }
+
+    // Graded values are stored in half floats as render textures of App.
+    RenderTarget gradingTarget, presentTarget;
+    if (!gradingTarget.initialize(GL_RGBA16F) || !presentTarget.initialize(GL_RGBA32F)) {
+        fmt::print(stderr, "Failed to initialize render target\n");
+        return false;
+    }
+
+    const std::vector<float> pixels = makeTestPixels();
+    const std::vector<uint16_t> halfPixels = toHalfPixels(pixels);
+    const GLuint sourceTexId = createTexture(GL_RGBA16F, GL_HALF_FLOAT, halfPixels.data());
+    const GLuint gradedTexId = createTexture(GL_RGBA32F, GL_FLOAT, pixels.data());
+
+    // Grade the whole source image without alignment offset, as gradingTexImage@app.cpp.
+    gradingShader.bind();
+    gradingShader.setUniform("uImage", 0);
+    gradingShader.setUniform("uEV", kGradingExposure);
+    gradingShader.setUniform("uOffset", Vec2f(0.0f));
+    gradingShader.setUniform("uViewXform", Vec3f(0.0f));
+    gradingShader.setUniform("uLinearFilter", false);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, sourceTexId);
+    gradingTarget.bind();
+
+    for (int i = 0; i < kGradingCaseNum; ++i) {
+        const GradingCase gradingCase = getGradingCase(i);
+        gradingShader.setUniform("uInImageProp", Vec2i(gradingCase.encodingType, gradingCase.primaryType));
+        gradingShader.drawTriangle();
+        values.grading.push_back(gradingTarget.read());
+        markUndefinedValues(gradingCase, pixels, values.grading.back());
+    }
+
+    // Test pixels are used as graded values of one image at scale 1, without markers,
+    // thus each fragment of present pass is the display value of one pixel.
+    const GLuint bindingPoint = 0;
+    presentShader.bindUniformBlock("PresentParams", bindingPoint);
+    presentShader.bind();
+    GLint program = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+
+    PresentParamWriter params;
+    if (!params.initialize(static_cast<GLuint>(program))) {
+        fmt::print(stderr, "Failed to locate PresentParams\n");
+        return false;
+    }
+
+    const Vec2f imageSize(kTestPixelNum, 1.0f);
+    params.set("uImageSize", imageSize);
+    params.set("uWindowSize", imageSize);
+    params.set("uCursorPos", Vec2f(-1.0f));
+    params.set("uSplitPos", 1.0f);
+    params.set("uImageScale", 1.0f);
+    params.set("uDisplayGamma", kDisplayGamma);
+
+    const char* samplerNames[] = { "uImage1", "uImage2", nullptr, "uToneMappingLut", "uDisplayLut1D",
+        "uDisplayLut3D", "uDiffImage", "uMarkerPyramid1", "uMarkerPyramid2", "uDiffPyramid", "uMosaicImages" };
+    for (int unit = 0; unit < static_cast<int>(sizeof(samplerNames) / sizeof(samplerNames[0])); ++unit) {
+        if (samplerNames[unit]) {
+            presentShader.setUniform(samplerNames[unit], unit);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, gradedTexId);
+    presentTarget.bind();
+
+    for (int i = 0; i < kPresentCaseNum; ++i) {
+        const PresentCase presentCase = getPresentCase(i);
+        params.set("uPresentMode", presentCase.presentMode);
+        params.set("uApplyToneMapping", static_cast<int>(presentCase.applyToneMapping));
+        params.set("uOutTransformType", presentCase.outTransformType);
+        params.upload(bindingPoint);
+        presentShader.drawTriangle();
+        values.present.push_back(presentTarget.read());
+    }
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+// Return C++ literal of value, undefined results of shaders are written as kUndefined.
+std::string getLiteral(float value)
+{
+    if (!std::isfinite(value)) {
+        return "kUndefined";
+    }
+
+    std::string literal = fmt::format("{:.9g}", value);
+    if (literal.find_first_of(".e") == std::string::npos) {
+        literal += ".0";
+    }
+
+    return literal + "f";
+}
+
+void writeArray(std::ofstream& file, const char* name, const char* sizeName,
+    const std::vector<std::vector<float>>& cases)
+{
+    file << "const float " << name << "[" << sizeName << "][kTestPixelNum * 3] = {\n";
+    for (const std::vector<float>& values : cases) {
+        file << "    {";
+        for (size_t i = 0; i < values.size(); ++i) {
+            file << (i % 6 == 0 ? "\n        " : " ") << getLiteral(values[i]) << ",";
+        }
+        file << "\n    },\n";
+    }
+    file << "};\n";
+}
+
+bool writeHeader(const std::string& filepath, const ReferenceValues& values)
+{
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        fmt::print(stderr, "Failed to write {}\n", filepath);
+        return false;
+    }
+
+    file << "#ifndef BAKTSIU_PRESENT_REFERENCE_H_\n"
+        "#define BAKTSIU_PRESENT_REFERENCE_H_\n\n"
+        "#include \"conformance_cases.h\"\n\n"
+        "#include <limits>\n\n"
+        "namespace baktsiu\n{\nnamespace test\n{\n\n"
+        "// Generated by present_reference from shaders, do not edit. Regenerate it when\n"
+        "// shaders or cases in conformance_cases.h are changed.\n\n"
+        "// Results of undefined operations in shaders, e.g. decoding PQ signals out of [0, 1],\n"
+        "// or graded values over the range of half floats. They are not compared.\n"
+        "const float kUndefined = std::numeric_limits<float>::quiet_NaN();\n\n"
+        "// Graded RGB values of test pixels in cases of getGradingCase().\n";
+    writeArray(file, "kGradingReference", "kGradingCaseNum", values.grading);
+    file << "\n// Display RGB values of test pixels as graded values in cases of getPresentCase().\n";
+    writeArray(file, "kPresentReference", "kPresentCaseNum", values.present);
+    file << "\n}  // namespace test\n}  // namespace baktsiu\n#endif // BAKTSIU_PRESENT_REFERENCE_H_\n";
+    return true;
+}
+
+bool isClose(float value, float reference)
+{
+    return std::fabs(value - reference) <= kTolerance * std::max(1.0f, std::fabs(reference));
+}
+
+void verifyCases(const char* stageName, const std::vector<std::vector<float>>& cases, const float (*references)[kTestPixelNum * 3])
+{
+    for (size_t i = 0; i < cases.size(); ++i) {
+        for (int j = 0; j < kTestPixelNum * 3; ++j) {
+            const float value = cases[i][j];
+            const float reference = references[i][j];
+            if (std::isnan(reference)) {
+                continue;
+            }
+
+            TEST_CHECK(isClose(value, reference), "{} case {} pixel {}: shader {} vs reference {}",
+                stageName, i, j / 3, value, reference);
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2) {
+        fmt::print(stderr, "Usage: present_reference --verify | <header path>\n");
+        return 1;
+    }
+
+    const bool verify = std::strcmp(argv[1], "--verify") == 0;
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+
+    GLFWwindow* window = glfwInit() ? glfwCreateWindow(16, 16, "present_reference", nullptr, nullptr) : nullptr;
+    if (!window) {
+        fmt::print("No GL 3.3 context, skip\n");
+        glfwTerminate();
+        return verify ? kSkipReturnCode : 1;
+    }
+
+    glfwMakeContextCurrent(window);
+    ReferenceValues values;
+    const bool status = gl3wInit() == 0 && captureReferenceValues(values);
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+
+    if (!status) {
+        fmt::print(stderr, "Failed to capture reference values\n");
+        return 1;
+    }
+
+    if (!verify) {
+        return writeHeader(argv[1], values) ? 0 : 1;
+    }
+
+    verifyCases("Grading", values.grading, kGradingReference);
+    verifyCases("Present", values.present, kPresentReference);
+    return getTestResult();
+}
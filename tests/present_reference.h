@@ -0,0 +1,2682 @@
+#ifndef BAKTSIU_PRESENT_REFERENCE_H_
+#define BAKTSIU_PRESENT_REFERENCE_H_
+
+#include "conformance_cases.h"
+
+#include <limits>
+
+namespace baktsiu
+{
+namespace test
+{
+
+// Generated by present_reference from shaders, do not edit. Regenerate it when
+// shaders or cases in conformance_cases.h are changed.
+
+// Results of undefined operations in shaders, e.g. decoding PQ signals out of [0, 1],
+// or graded values over the range of half floats. They are not compared.
+const float kUndefined = std::numeric_limits<float>::quiet_NaN();
+
+// Graded RGB values of test pixels in cases of getGradingCase().
+const float kGradingReference[kGradingCaseNum][kTestPixelNum * 3] = {
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 0.866699219f, 0.0992431641f, 0.0291442871f,
+        0.479980469f, 1.29589844f, 0.154907227f, 0.0669555664f, 0.0190124512f, 1.22949219f,
+        0.442626953f, 0.0341186523f, 0.319580078f, 107.875f, 72.1875f, 39.75f,
+        1.92480469f, 4.796875f, 0.931152344f, 2.39648438f, 0.416748047f, 14.65625f,
+        0.858886719f, 1.984375f, 0.848144531f, 5.875f, 0.710449219f, 0.388671875f,
+        0.875976562f, 1.30957031f, 0.931152344f, 0.292724609f, 0.103942871f, 3.92578125f,
+        14.234375f, 36.65625f, 4.4140625f, 2.33984375f, 0.366210938f, 0.0952148438f,
+        0.662597656f, 1.19042969f, 0.168212891f, 0.5703125f, 1.23144531f, 1.54785156f,
+        10.703125f, 24.484375f, 36.0625f, 9.3984375f, 25.265625f, 3.02734375f,
+        1.35058594f, 2.55859375f, 0.332763672f, 3.32226562f, 8.90625f, 1.07128906f,
+        2.953125f, 1.81640625f, 0.762695312f, 1.08105469f, 2.83984375f, 0.574707031f,
+        4.94140625f, 13.28125f, 1.59765625f, 0.155517578f, 0.05859375f, 2.61523438f,
+        1.21386719f, 0.352783203f, 20.296875f, 15.46875f, 1.80078125f, 1.86425781f,
+        1.16113281f, 2.44335938f, 4.8203125f, 9.078125f, 2.37695312f, 0.502929688f,
+        0.388427734f, 0.561035156f, 2.50390625f, 6.01953125f, 2.9375f, 0.521484375f,
+        0.377929688f, 0.8671875f, 0.121032715f, 2.86523438f, 7.07421875f, 0.88671875f,
+        11.9140625f, 12.84375f, 1.71679688f, 0.0803833008f, 0.0302429199f, 1.2890625f,
+        5.73046875f, 0.850097656f, 4.8515625f, 0.534667969f, 0.159179688f, 9.609375f,
+        0.0807495117f, 0.167480469f, 0.0964355469f, 12.703125f, 26.578125f, 3.28125f,
+        1.87792969f, 0.372802734f, 0.112792969f, 15.171875f, 27.796875f, 3.43554688f,
+        3.83398438f, 1.07128906f, 0.455810547f, 0.0595092773f, 0.0643920898f, 0.207275391f,
+        6.40234375f, 17.171875f, 2.08789062f, 3.86523438f, 2.72265625f, 18.46875f,
+        2.23242188f, 0.59765625f, 20.03125f, 0.586425781f, 1.50195312f, 0.196166992f,
+        11.40625f, 30.765625f, 3.6875f, 0.203491211f, 0.452392578f, 0.349365234f,
+        1.62109375f, 1.52636719f, 0.578125f, 0.709960938f, 0.177124023f, 9.0f,
+        22.78125f, 2.84570312f, 25.015625f, 0.292236328f, 0.733398438f, 0.305908203f,
+        9.734375f, 3.28710938f, 4.9765625f, 0.249389648f, 0.639160156f, 0.0934448242f,
+        0.981445312f, 0.265136719f, 15.53125f, 16.1875f, 6.05078125f, 2.05859375f,
+        0.0885009766f, 0.0502929688f, 0.159545898f, 3.49804688f, 6.49609375f, 22.875f,
+        8.2890625f, 1.91894531f, 0.442138672f, 1.47558594f, 3.25976562f, 3.53710938f,
+        4.7734375f, 5.04296875f, 0.669921875f, 4.4765625f, 10.765625f, 3.06054688f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.04003906f, 0.0667114258f, 0.00503921509f,
+        0.299804688f, 1.32617188f, 0.0581665039f, 0.0735473633f, 0.0208892822f, 1.35058594f,
+        0.533691406f, 0.0178527832f, 0.339355469f, 116.0625f, 70.5625f, 35.6875f,
+        1.29003906f, 4.90625f, 0.60546875f, 2.79296875f, 0.379150391f, 16.046875f,
+        0.608886719f, 2.02734375f, 0.758789062f, 7.04296875f, 0.491943359f, 0.241455078f,
+        0.779296875f, 1.32617188f, 0.902832031f, 0.322021484f, 0.108276367f, 4.3046875f,
+        9.28125f, 37.5f, 1.66699219f, 2.78710938f, 0.282226562f, 0.0240783691f,
+        0.546875f, 1.20898438f, 0.0770263672f, 0.420166016f, 1.26074219f, 1.59472656f,
+        7.55859375f, 25.09375f, 37.53125f, 5.8984375f, 25.859375f, 1.13964844f,
+        1.0859375f, 2.6015625f, 0.135620117f, 2.08984375f, 9.1171875f, 0.406738281f,
+        3.21484375f, 1.76464844f, 0.631347656f, 0.691894531f, 2.90625f, 0.385742188f,
+        3.1015625f, 13.59375f, 0.605957031f, 0.168457031f, 0.0626831055f, 2.87109375f,
+        1.33789062f, 0.380615234f, 22.28125f, 18.546875f, 1.22558594f, 1.56738281f,
+        0.863769531f, 2.50390625f, 5.0859375f, 10.6015625f, 2.08984375f, 0.165161133f,
+        0.342773438f, 0.574707031f, 2.703125f, 6.72265625f, 2.80078125f, 0.209838867f,
+        0.270263672f, 0.885253906f, 0.0567626953f, 1.93847656f, 7.23046875f, 0.357421875f,
+        11.75f, 12.84375f, 0.6171875f, 0.0872802734f, 0.0321655273f, 1.4140625f,
+        6.81640625f, 0.657714844f, 5.14453125f, 0.586425781f, 0.173706055f, 10.5546875f,
+        0.0614318848f, 0.170898438f, 0.0912475586f, 9.6484375f, 27.09375f, 1.24414062f,
+        2.21679688f, 0.30859375f, 0.0532226562f, 12.4140625f, 28.25f, 1.26464844f,
+        4.45703125f, 0.953125f, 0.332519531f, 0.0579223633f, 0.0650634766f, 0.221679688f,
+        4.02734375f, 17.578125f, 0.809570312f, 4.06640625f, 2.72460938f, 20.03125f,
+        2.53320312f, 0.591308594f, 21.953125f, 0.384277344f, 1.53613281f, 0.0850830078f,
+        7.13671875f, 31.5f, 1.390625f, 0.147705078f, 0.462646484f, 0.344482422f,
+        1.64648438f, 1.51953125f, 0.48046875f, 0.799316406f, 0.182983398f, 9.875f,
+        27.203125f, 2.078125f, 26.796875f, 0.194213867f, 0.750488281f, 0.272705078f,
+        11.1796875f, 3.02148438f, 5.00390625f, 0.163208008f, 0.653808594f, 0.0471496582f,
+        1.08984375f, 0.283935547f, 17.046875f, 18.5f, 5.609375f, 1.43066406f,
+        0.0967407227f, 0.049041748f, 0.169677734f, 2.76367188f, 6.67578125f, 24.59375f,
+        9.7265625f, 1.64550781f, 0.152099609f, 1.07128906f, 3.3359375f, 3.60546875f,
+        4.7265625f, 5.0390625f, 0.235473633f, 3.08398438f, 11.0f, 2.42382812f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.37792969f, 0.00308227539f, 0.00678253174f,
+        0.0277099609f, 1.40722656f, 0.0346679688f, 0.00778579712f, 0.00323104858f, 1.37207031f,
+        0.690429688f, -0.0196380615f, 0.345947266f, 133.75f, 67.9375f, 35.25f,
+        0.319824219f, 5.19140625f, 0.525390625f, 2.6328125f, 0.0526428223f, 16.3125f,
+        0.202026367f, 2.13476562f, 0.733886719f, 9.3046875f, 0.0621948242f, 0.255859375f,
+        0.618652344f, 1.3671875f, 0.894042969f, 0.130493164f, 0.0493469238f, 4.375f,
+        1.84863281f, 39.75f, 1.00488281f, 3.6640625f, 0.119567871f, 0.0269622803f,
+        0.391113281f, 1.265625f, 0.0567626953f, 0.110717773f, 1.3125f, 1.59765625f,
+        0.752441406f, 26.125f, 37.6875f, 0.607421875f, 27.453125f, 0.682617188f,
+        0.721191406f, 2.72851562f, 0.0912475586f, 0.225830078f, 9.671875f, 0.245361328f,
+        3.78320312f, 1.68066406f, 0.6171875f, 0.0910644531f, 3.08007812f, 0.338623047f,
+        0.318359375f, 14.4296875f, 0.365722656f, 0.0276794434f, 0.0257873535f, 2.91601562f,
+        0.28515625f, 0.0838623047f, 22.640625f, 24.46875f, 0.0783691406f, 1.62207031f,
+        0.137939453f, 2.58398438f, 5.125f, 13.640625f, 1.54785156f, 0.157958984f,
+        0.12878418f, 0.567382812f, 2.73828125f, 8.234375f, 2.56835938f, 0.178833008f,
+        0.11138916f, 0.935058594f, 0.0415649414f, 0.5546875f, 7.65625f, 0.230834961f,
+        12.140625f, 13.046875f, 0.415771484f, 0.0190429688f, 0.0138015747f, 1.43652344f,
+        8.6484375f, 0.20324707f, 5.234375f, 0.0737915039f, 0.0358276367f, 10.71875f,
+        0.0289001465f, 0.178955078f, 0.0895996094f, 5.30078125f, 28.515625f, 0.775878906f,
+        2.88867188f, 0.185180664f, 0.0544433594f, 8.6796875f, 29.578125f, 0.781738281f,
+        5.69921875f, 0.728027344f, 0.332275391f, 0.0455627441f, 0.0638427734f, 0.224243164f,
+        0.434082031f, 18.640625f, 0.499023438f, 3.43554688f, 2.45117188f, 20.3125f,
+        1.85253906f, 0.234985352f, 22.3125f, 0.0805664062f, 1.62792969f, 0.0582580566f,
+        0.672851562f, 33.4375f, 0.833007812f, 0.0470581055f, 0.484619141f, 0.341796875f,
+        1.75488281f, 1.52246094f, 0.464111328f, 0.399169922f, 0.0390014648f, 10.0390625f,
+        34.25f, 0.155029297f, 27.265625f, 0.0334472656f, 0.792480469f, 0.263427734f,
+        13.859375f, 2.4609375f, 5.05859375f, 0.0330810547f, 0.692871094f, 0.0359191895f,
+        0.308349609f, 0.0520019531f, 17.328125f, 23.1875f, 4.8046875f, 1.39941406f,
+        0.10546875f, 0.0446166992f, 0.17175293f, 0.291259766f, 6.7421875f, 24.859375f,
+        12.6015625f, 1.12792969f, 0.150634766f, 0.276855469f, 3.484375f, 3.60351562f,
+        4.92578125f, 5.11328125f, 0.156494141f, 0.907226562f, 11.6171875f, 2.26171875f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.70703125f, -0.0220947266f, 0.353515625f, 135.75f, 67.875f, 33.9375f,
+        0.220947266f, 5.21484375f, 0.408691406f, 2.60742188f, 0.00862884521f, 16.78125f,
+        0.16015625f, 2.14257812f, 0.701171875f, 9.5390625f, 0.0410766602f, 0.215332031f,
+        0.602050781f, 1.36914062f, 0.883789062f, 0.107666016f, 0.0390014648f, 4.50390625f,
+        1.09375f, 39.9375f, 0.0203704834f, 3.75585938f, 0.111816406f, 0.00638580322f,
+        0.375488281f, 1.27050781f, 0.0245056152f, 0.0780029297f, 1.31445312f, 1.61230469f,
+        0.030380249f, 26.15625f, 38.15625f, 0.0690307617f, 27.5625f, 0.00603866577f,
+        0.684570312f, 2.73828125f, 0.0213928223f, 0.0362243652f, 9.71875f, 0.00698852539f,
+        3.84375f, 1.67871094f, 0.57421875f, 0.0296783447f, 3.09179688f, 0.270507812f,
+        0.0351867676f, 14.4921875f, 0.010269165f, 0.0110473633f, 0.0189819336f, 3.00390625f,
+        0.16015625f, 0.030380249f, 23.328125f, 25.09375f, 0.0201873779f, 1.54589844f,
+        0.0600585938f, 2.58398438f, 5.21484375f, 13.9609375f, 1.52441406f, 0.0552368164f,
+        0.104919434f, 0.562988281f, 2.8046875f, 8.390625f, 2.5625f, 0.0780029297f,
+        0.0952758789f, 0.938964844f, 0.0186309814f, 0.414306641f, 7.6875f, 0.0414123535f,
+        12.1953125f, 13.078125f, 0.0376281738f, 0.0109558105f, 0.0104370117f, 1.48046875f,
+        8.8359375f, 0.172607422f, 5.34375f, 0.0131149292f, 0.0106124878f, 11.046875f,
+        0.0255432129f, 0.179443359f, 0.0876464844f, 4.859375f, 28.625f, 0.0517883301f,
+        2.9609375f, 0.179443359f, 0.0369262695f, 8.3046875f, 29.6875f, 0.0138092041f,
+        5.83203125f, 0.717773438f, 0.295410156f, 0.0441894531f, 0.0634765625f, 0.229248047f,
+        0.068359375f, 18.734375f, 0.0403747559f, 3.35742188f, 2.40820312f, 20.859375f,
+        1.76757812f, 0.179443359f, 22.96875f, 0.0497131348f, 1.63476562f, 0.0184631348f,
+        0.0151901245f, 33.5625f, 0.00957489014f, 0.0365905762f, 0.486083984f, 0.339599609f,
+        1.76757812f, 1.52441406f, 0.430664062f, 0.350585938f, 0.0146713257f, 10.3359375f,
+        35.0f, 0.0150146484f, 27.921875f, 0.0169067383f, 0.795410156f, 0.251220703f,
+        14.140625f, 2.4296875f, 5.08203125f, 0.0198516846f, 0.695800781f, 0.0193328857f,
+        0.215332031f, 0.0107879639f, 17.84375f, 23.6875f, 4.76953125f, 1.20410156f,
+        0.106323242f, 0.0441894531f, 0.175292969f, 0.0200195312f, 6.71484375f, 25.453125f,
+        12.8984375f, 1.10449219f, 0.0634765625f, 0.193237305f, 3.49023438f, 3.62304688f,
+        4.94921875f, 5.125f, 0.0072479248f, 0.684570312f, 11.6640625f, 2.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.70703125f, -0.0220947266f, 0.353515625f, 135.75f, 67.875f, 33.9375f,
+        0.220947266f, 5.21484375f, 0.408691406f, 2.60742188f, 0.00862884521f, 16.78125f,
+        0.16015625f, 2.14257812f, 0.701171875f, 9.5390625f, 0.0410766602f, 0.215332031f,
+        0.602050781f, 1.36914062f, 0.883789062f, 0.107666016f, 0.0390014648f, 4.50390625f,
+        1.09375f, 39.9375f, 0.0203704834f, 3.75585938f, 0.111816406f, 0.00638580322f,
+        0.375488281f, 1.27050781f, 0.0245056152f, 0.0780029297f, 1.31445312f, 1.61230469f,
+        0.030380249f, 26.15625f, 38.15625f, 0.0690307617f, 27.5625f, 0.00603866577f,
+        0.684570312f, 2.73828125f, 0.0213928223f, 0.0362243652f, 9.71875f, 0.00698852539f,
+        3.84375f, 1.67871094f, 0.57421875f, 0.0296783447f, 3.09179688f, 0.270507812f,
+        0.0351867676f, 14.4921875f, 0.010269165f, 0.0110473633f, 0.0189819336f, 3.00390625f,
+        0.16015625f, 0.030380249f, 23.328125f, 25.09375f, 0.0201873779f, 1.54589844f,
+        0.0600585938f, 2.58398438f, 5.21484375f, 13.9609375f, 1.52441406f, 0.0552368164f,
+        0.104919434f, 0.562988281f, 2.8046875f, 8.390625f, 2.5625f, 0.0780029297f,
+        0.0952758789f, 0.938964844f, 0.0186309814f, 0.414306641f, 7.6875f, 0.0414123535f,
+        12.1953125f, 13.078125f, 0.0376281738f, 0.0109558105f, 0.0104370117f, 1.48046875f,
+        8.8359375f, 0.172607422f, 5.34375f, 0.0131149292f, 0.0106124878f, 11.046875f,
+        0.0255432129f, 0.179443359f, 0.0876464844f, 4.859375f, 28.625f, 0.0517883301f,
+        2.9609375f, 0.179443359f, 0.0369262695f, 8.3046875f, 29.6875f, 0.0138092041f,
+        5.83203125f, 0.717773438f, 0.295410156f, 0.0441894531f, 0.0634765625f, 0.229248047f,
+        0.068359375f, 18.734375f, 0.0403747559f, 3.35742188f, 2.40820312f, 20.859375f,
+        1.76757812f, 0.179443359f, 22.96875f, 0.0497131348f, 1.63476562f, 0.0184631348f,
+        0.0151901245f, 33.5625f, 0.00957489014f, 0.0365905762f, 0.486083984f, 0.339599609f,
+        1.76757812f, 1.52441406f, 0.430664062f, 0.350585938f, 0.0146713257f, 10.3359375f,
+        35.0f, 0.0150146484f, 27.921875f, 0.0169067383f, 0.795410156f, 0.251220703f,
+        14.140625f, 2.4296875f, 5.08203125f, 0.0198516846f, 0.695800781f, 0.0193328857f,
+        0.215332031f, 0.0107879639f, 17.84375f, 23.6875f, 4.76953125f, 1.20410156f,
+        0.106323242f, 0.0441894531f, 0.175292969f, 0.0200195312f, 6.71484375f, 25.453125f,
+        12.8984375f, 1.10449219f, 0.0634765625f, 0.193237305f, 3.49023438f, 3.62304688f,
+        4.94921875f, 5.125f, 0.0072479248f, 0.684570312f, 11.6640625f, 2.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 0.866699219f, 0.0992431641f, 0.0291442871f,
+        0.479980469f, 1.29589844f, 0.154907227f, 0.0669555664f, 0.0190124512f, 1.22949219f,
+        0.442626953f, 0.0341186523f, 0.319580078f, 107.875f, 72.1875f, 39.75f,
+        1.92480469f, 4.796875f, 0.931152344f, 2.39648438f, 0.416748047f, 14.65625f,
+        0.858886719f, 1.984375f, 0.848144531f, 5.875f, 0.710449219f, 0.388671875f,
+        0.875976562f, 1.30957031f, 0.931152344f, 0.292724609f, 0.103942871f, 3.92578125f,
+        14.234375f, 36.65625f, 4.4140625f, 2.33984375f, 0.366210938f, 0.0952148438f,
+        0.662597656f, 1.19042969f, 0.168212891f, 0.5703125f, 1.23144531f, 1.54785156f,
+        10.703125f, 24.484375f, 36.0625f, 9.3984375f, 25.265625f, 3.02734375f,
+        1.35058594f, 2.55859375f, 0.332763672f, 3.32226562f, 8.90625f, 1.07128906f,
+        2.953125f, 1.81640625f, 0.762695312f, 1.08105469f, 2.83984375f, 0.574707031f,
+        4.94140625f, 13.28125f, 1.59765625f, 0.155517578f, 0.05859375f, 2.61523438f,
+        1.21386719f, 0.352783203f, 20.296875f, 15.46875f, 1.80078125f, 1.86425781f,
+        1.16113281f, 2.44335938f, 4.8203125f, 9.078125f, 2.37695312f, 0.502929688f,
+        0.388427734f, 0.561035156f, 2.50390625f, 6.01953125f, 2.9375f, 0.521484375f,
+        0.377929688f, 0.8671875f, 0.121032715f, 2.86523438f, 7.07421875f, 0.88671875f,
+        11.9140625f, 12.84375f, 1.71679688f, 0.0803833008f, 0.0302429199f, 1.2890625f,
+        5.73046875f, 0.850097656f, 4.8515625f, 0.534667969f, 0.159179688f, 9.609375f,
+        0.0807495117f, 0.167480469f, 0.0964355469f, 12.703125f, 26.578125f, 3.28125f,
+        1.87792969f, 0.372802734f, 0.112792969f, 15.171875f, 27.796875f, 3.43554688f,
+        3.83398438f, 1.07128906f, 0.455810547f, 0.0595092773f, 0.0643920898f, 0.207275391f,
+        6.40234375f, 17.171875f, 2.08789062f, 3.86523438f, 2.72265625f, 18.46875f,
+        2.23242188f, 0.59765625f, 20.03125f, 0.586425781f, 1.50195312f, 0.196166992f,
+        11.40625f, 30.765625f, 3.6875f, 0.203491211f, 0.452392578f, 0.349365234f,
+        1.62109375f, 1.52636719f, 0.578125f, 0.709960938f, 0.177124023f, 9.0f,
+        22.78125f, 2.84570312f, 25.015625f, 0.292236328f, 0.733398438f, 0.305908203f,
+        9.734375f, 3.28710938f, 4.9765625f, 0.249389648f, 0.639160156f, 0.0934448242f,
+        0.981445312f, 0.265136719f, 15.53125f, 16.1875f, 6.05078125f, 2.05859375f,
+        0.0885009766f, 0.0502929688f, 0.159545898f, 3.49804688f, 6.49609375f, 22.875f,
+        8.2890625f, 1.91894531f, 0.442138672f, 1.47558594f, 3.25976562f, 3.53710938f,
+        4.7734375f, 5.04296875f, 0.669921875f, 4.4765625f, 10.765625f, 3.06054688f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.04003906f, 0.0667114258f, 0.00503921509f,
+        0.299804688f, 1.32617188f, 0.0581665039f, 0.0735473633f, 0.0208892822f, 1.35058594f,
+        0.533691406f, 0.0178527832f, 0.339355469f, 116.0625f, 70.5625f, 35.6875f,
+        1.29003906f, 4.90625f, 0.60546875f, 2.79296875f, 0.379150391f, 16.046875f,
+        0.608886719f, 2.02734375f, 0.758789062f, 7.04296875f, 0.491943359f, 0.241455078f,
+        0.779296875f, 1.32617188f, 0.902832031f, 0.322021484f, 0.108276367f, 4.3046875f,
+        9.28125f, 37.5f, 1.66699219f, 2.78710938f, 0.282226562f, 0.0240783691f,
+        0.546875f, 1.20898438f, 0.0770263672f, 0.420166016f, 1.26074219f, 1.59472656f,
+        7.55859375f, 25.09375f, 37.53125f, 5.8984375f, 25.859375f, 1.13964844f,
+        1.0859375f, 2.6015625f, 0.135620117f, 2.08984375f, 9.1171875f, 0.406738281f,
+        3.21484375f, 1.76464844f, 0.631347656f, 0.691894531f, 2.90625f, 0.385742188f,
+        3.1015625f, 13.59375f, 0.605957031f, 0.168457031f, 0.0626831055f, 2.87109375f,
+        1.33789062f, 0.380615234f, 22.28125f, 18.546875f, 1.22558594f, 1.56738281f,
+        0.863769531f, 2.50390625f, 5.0859375f, 10.6015625f, 2.08984375f, 0.165161133f,
+        0.342773438f, 0.574707031f, 2.703125f, 6.72265625f, 2.80078125f, 0.209838867f,
+        0.270263672f, 0.885253906f, 0.0567626953f, 1.93847656f, 7.23046875f, 0.357421875f,
+        11.75f, 12.84375f, 0.6171875f, 0.0872802734f, 0.0321655273f, 1.4140625f,
+        6.81640625f, 0.657714844f, 5.14453125f, 0.586425781f, 0.173706055f, 10.5546875f,
+        0.0614318848f, 0.170898438f, 0.0912475586f, 9.6484375f, 27.09375f, 1.24414062f,
+        2.21679688f, 0.30859375f, 0.0532226562f, 12.4140625f, 28.25f, 1.26464844f,
+        4.45703125f, 0.953125f, 0.332519531f, 0.0579223633f, 0.0650634766f, 0.221679688f,
+        4.02734375f, 17.578125f, 0.809570312f, 4.06640625f, 2.72460938f, 20.03125f,
+        2.53320312f, 0.591308594f, 21.953125f, 0.384277344f, 1.53613281f, 0.0850830078f,
+        7.13671875f, 31.5f, 1.390625f, 0.147705078f, 0.462646484f, 0.344482422f,
+        1.64648438f, 1.51953125f, 0.48046875f, 0.799316406f, 0.182983398f, 9.875f,
+        27.203125f, 2.078125f, 26.796875f, 0.194213867f, 0.750488281f, 0.272705078f,
+        11.1796875f, 3.02148438f, 5.00390625f, 0.163208008f, 0.653808594f, 0.0471496582f,
+        1.08984375f, 0.283935547f, 17.046875f, 18.5f, 5.609375f, 1.43066406f,
+        0.0967407227f, 0.049041748f, 0.169677734f, 2.76367188f, 6.67578125f, 24.59375f,
+        9.7265625f, 1.64550781f, 0.152099609f, 1.07128906f, 3.3359375f, 3.60546875f,
+        4.7265625f, 5.0390625f, 0.235473633f, 3.08398438f, 11.0f, 2.42382812f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.37792969f, 0.00308227539f, 0.00678253174f,
+        0.0277099609f, 1.40722656f, 0.0346679688f, 0.00778579712f, 0.00323104858f, 1.37207031f,
+        0.690429688f, -0.0196380615f, 0.345947266f, 133.75f, 67.9375f, 35.25f,
+        0.319824219f, 5.19140625f, 0.525390625f, 2.6328125f, 0.0526428223f, 16.3125f,
+        0.202026367f, 2.13476562f, 0.733886719f, 9.3046875f, 0.0621948242f, 0.255859375f,
+        0.618652344f, 1.3671875f, 0.894042969f, 0.130493164f, 0.0493469238f, 4.375f,
+        1.84863281f, 39.75f, 1.00488281f, 3.6640625f, 0.119567871f, 0.0269622803f,
+        0.391113281f, 1.265625f, 0.0567626953f, 0.110717773f, 1.3125f, 1.59765625f,
+        0.752441406f, 26.125f, 37.6875f, 0.607421875f, 27.453125f, 0.682617188f,
+        0.721191406f, 2.72851562f, 0.0912475586f, 0.225830078f, 9.671875f, 0.245361328f,
+        3.78320312f, 1.68066406f, 0.6171875f, 0.0910644531f, 3.08007812f, 0.338623047f,
+        0.318359375f, 14.4296875f, 0.365722656f, 0.0276794434f, 0.0257873535f, 2.91601562f,
+        0.28515625f, 0.0838623047f, 22.640625f, 24.46875f, 0.0783691406f, 1.62207031f,
+        0.137939453f, 2.58398438f, 5.125f, 13.640625f, 1.54785156f, 0.157958984f,
+        0.12878418f, 0.567382812f, 2.73828125f, 8.234375f, 2.56835938f, 0.178833008f,
+        0.11138916f, 0.935058594f, 0.0415649414f, 0.5546875f, 7.65625f, 0.230834961f,
+        12.140625f, 13.046875f, 0.415771484f, 0.0190429688f, 0.0138015747f, 1.43652344f,
+        8.6484375f, 0.20324707f, 5.234375f, 0.0737915039f, 0.0358276367f, 10.71875f,
+        0.0289001465f, 0.178955078f, 0.0895996094f, 5.30078125f, 28.515625f, 0.775878906f,
+        2.88867188f, 0.185180664f, 0.0544433594f, 8.6796875f, 29.578125f, 0.781738281f,
+        5.69921875f, 0.728027344f, 0.332275391f, 0.0455627441f, 0.0638427734f, 0.224243164f,
+        0.434082031f, 18.640625f, 0.499023438f, 3.43554688f, 2.45117188f, 20.3125f,
+        1.85253906f, 0.234985352f, 22.3125f, 0.0805664062f, 1.62792969f, 0.0582580566f,
+        0.672851562f, 33.4375f, 0.833007812f, 0.0470581055f, 0.484619141f, 0.341796875f,
+        1.75488281f, 1.52246094f, 0.464111328f, 0.399169922f, 0.0390014648f, 10.0390625f,
+        34.25f, 0.155029297f, 27.265625f, 0.0334472656f, 0.792480469f, 0.263427734f,
+        13.859375f, 2.4609375f, 5.05859375f, 0.0330810547f, 0.692871094f, 0.0359191895f,
+        0.308349609f, 0.0520019531f, 17.328125f, 23.1875f, 4.8046875f, 1.39941406f,
+        0.10546875f, 0.0446166992f, 0.17175293f, 0.291259766f, 6.7421875f, 24.859375f,
+        12.6015625f, 1.12792969f, 0.150634766f, 0.276855469f, 3.484375f, 3.60351562f,
+        4.92578125f, 5.11328125f, 0.156494141f, 0.907226562f, 11.6171875f, 2.26171875f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.70703125f, -0.0220947266f, 0.353515625f, 135.75f, 67.875f, 33.9375f,
+        0.220947266f, 5.21484375f, 0.408691406f, 2.60742188f, 0.00862884521f, 16.78125f,
+        0.16015625f, 2.14257812f, 0.701171875f, 9.5390625f, 0.0410766602f, 0.215332031f,
+        0.602050781f, 1.36914062f, 0.883789062f, 0.107666016f, 0.0390014648f, 4.50390625f,
+        1.09375f, 39.9375f, 0.0203704834f, 3.75585938f, 0.111816406f, 0.00638580322f,
+        0.375488281f, 1.27050781f, 0.0245056152f, 0.0780029297f, 1.31445312f, 1.61230469f,
+        0.030380249f, 26.15625f, 38.15625f, 0.0690307617f, 27.5625f, 0.00603866577f,
+        0.684570312f, 2.73828125f, 0.0213928223f, 0.0362243652f, 9.71875f, 0.00698852539f,
+        3.84375f, 1.67871094f, 0.57421875f, 0.0296783447f, 3.09179688f, 0.270507812f,
+        0.0351867676f, 14.4921875f, 0.010269165f, 0.0110473633f, 0.0189819336f, 3.00390625f,
+        0.16015625f, 0.030380249f, 23.328125f, 25.09375f, 0.0201873779f, 1.54589844f,
+        0.0600585938f, 2.58398438f, 5.21484375f, 13.9609375f, 1.52441406f, 0.0552368164f,
+        0.104919434f, 0.562988281f, 2.8046875f, 8.390625f, 2.5625f, 0.0780029297f,
+        0.0952758789f, 0.938964844f, 0.0186309814f, 0.414306641f, 7.6875f, 0.0414123535f,
+        12.1953125f, 13.078125f, 0.0376281738f, 0.0109558105f, 0.0104370117f, 1.48046875f,
+        8.8359375f, 0.172607422f, 5.34375f, 0.0131149292f, 0.0106124878f, 11.046875f,
+        0.0255432129f, 0.179443359f, 0.0876464844f, 4.859375f, 28.625f, 0.0517883301f,
+        2.9609375f, 0.179443359f, 0.0369262695f, 8.3046875f, 29.6875f, 0.0138092041f,
+        5.83203125f, 0.717773438f, 0.295410156f, 0.0441894531f, 0.0634765625f, 0.229248047f,
+        0.068359375f, 18.734375f, 0.0403747559f, 3.35742188f, 2.40820312f, 20.859375f,
+        1.76757812f, 0.179443359f, 22.96875f, 0.0497131348f, 1.63476562f, 0.0184631348f,
+        0.0151901245f, 33.5625f, 0.00957489014f, 0.0365905762f, 0.486083984f, 0.339599609f,
+        1.76757812f, 1.52441406f, 0.430664062f, 0.350585938f, 0.0146713257f, 10.3359375f,
+        35.0f, 0.0150146484f, 27.921875f, 0.0169067383f, 0.795410156f, 0.251220703f,
+        14.140625f, 2.4296875f, 5.08203125f, 0.0198516846f, 0.695800781f, 0.0193328857f,
+        0.215332031f, 0.0107879639f, 17.84375f, 23.6875f, 4.76953125f, 1.20410156f,
+        0.106323242f, 0.0441894531f, 0.175292969f, 0.0200195312f, 6.71484375f, 25.453125f,
+        12.8984375f, 1.10449219f, 0.0634765625f, 0.193237305f, 3.49023438f, 3.62304688f,
+        4.94921875f, 5.125f, 0.0072479248f, 0.684570312f, 11.6640625f, 2.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.70703125f, -0.0220947266f, 0.353515625f, 135.75f, 67.875f, 33.9375f,
+        0.220947266f, 5.21484375f, 0.408691406f, 2.60742188f, 0.00862884521f, 16.78125f,
+        0.16015625f, 2.14257812f, 0.701171875f, 9.5390625f, 0.0410766602f, 0.215332031f,
+        0.602050781f, 1.36914062f, 0.883789062f, 0.107666016f, 0.0390014648f, 4.50390625f,
+        1.09375f, 39.9375f, 0.0203704834f, 3.75585938f, 0.111816406f, 0.00638580322f,
+        0.375488281f, 1.27050781f, 0.0245056152f, 0.0780029297f, 1.31445312f, 1.61230469f,
+        0.030380249f, 26.15625f, 38.15625f, 0.0690307617f, 27.5625f, 0.00603866577f,
+        0.684570312f, 2.73828125f, 0.0213928223f, 0.0362243652f, 9.71875f, 0.00698852539f,
+        3.84375f, 1.67871094f, 0.57421875f, 0.0296783447f, 3.09179688f, 0.270507812f,
+        0.0351867676f, 14.4921875f, 0.010269165f, 0.0110473633f, 0.0189819336f, 3.00390625f,
+        0.16015625f, 0.030380249f, 23.328125f, 25.09375f, 0.0201873779f, 1.54589844f,
+        0.0600585938f, 2.58398438f, 5.21484375f, 13.9609375f, 1.52441406f, 0.0552368164f,
+        0.104919434f, 0.562988281f, 2.8046875f, 8.390625f, 2.5625f, 0.0780029297f,
+        0.0952758789f, 0.938964844f, 0.0186309814f, 0.414306641f, 7.6875f, 0.0414123535f,
+        12.1953125f, 13.078125f, 0.0376281738f, 0.0109558105f, 0.0104370117f, 1.48046875f,
+        8.8359375f, 0.172607422f, 5.34375f, 0.0131149292f, 0.0106124878f, 11.046875f,
+        0.0255432129f, 0.179443359f, 0.0876464844f, 4.859375f, 28.625f, 0.0517883301f,
+        2.9609375f, 0.179443359f, 0.0369262695f, 8.3046875f, 29.6875f, 0.0138092041f,
+        5.83203125f, 0.717773438f, 0.295410156f, 0.0441894531f, 0.0634765625f, 0.229248047f,
+        0.068359375f, 18.734375f, 0.0403747559f, 3.35742188f, 2.40820312f, 20.859375f,
+        1.76757812f, 0.179443359f, 22.96875f, 0.0497131348f, 1.63476562f, 0.0184631348f,
+        0.0151901245f, 33.5625f, 0.00957489014f, 0.0365905762f, 0.486083984f, 0.339599609f,
+        1.76757812f, 1.52441406f, 0.430664062f, 0.350585938f, 0.0146713257f, 10.3359375f,
+        35.0f, 0.0150146484f, 27.921875f, 0.0169067383f, 0.795410156f, 0.251220703f,
+        14.140625f, 2.4296875f, 5.08203125f, 0.0198516846f, 0.695800781f, 0.0193328857f,
+        0.215332031f, 0.0107879639f, 17.84375f, 23.6875f, 4.76953125f, 1.20410156f,
+        0.106323242f, 0.0441894531f, 0.175292969f, 0.0200195312f, 6.71484375f, 25.453125f,
+        12.8984375f, 1.10449219f, 0.0634765625f, 0.193237305f, 3.49023438f, 3.62304688f,
+        4.94921875f, 5.125f, 0.0072479248f, 0.684570312f, 11.6640625f, 2.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 0.866699219f, 0.0992431641f, 0.0291442871f,
+        0.479980469f, 1.29589844f, 0.154907227f, 0.0669555664f, 0.0190124512f, 1.22949219f,
+        0.442626953f, 0.0341186523f, 0.319580078f, 107.875f, 72.1875f, 39.75f,
+        1.92480469f, 4.796875f, 0.931152344f, 2.39648438f, 0.416748047f, 14.65625f,
+        0.858886719f, 1.984375f, 0.848144531f, 5.875f, 0.710449219f, 0.388671875f,
+        0.875976562f, 1.30957031f, 0.931152344f, 0.292724609f, 0.103942871f, 3.92578125f,
+        14.234375f, 36.65625f, 4.4140625f, 2.33984375f, 0.366210938f, 0.0952148438f,
+        0.662597656f, 1.19042969f, 0.168212891f, 0.5703125f, 1.23144531f, 1.54785156f,
+        10.703125f, 24.484375f, 36.0625f, 9.3984375f, 25.265625f, 3.02734375f,
+        1.35058594f, 2.55859375f, 0.332763672f, 3.32226562f, 8.90625f, 1.07128906f,
+        2.953125f, 1.81640625f, 0.762695312f, 1.08105469f, 2.83984375f, 0.574707031f,
+        4.94140625f, 13.28125f, 1.59765625f, 0.155517578f, 0.05859375f, 2.61523438f,
+        1.21386719f, 0.352783203f, 20.296875f, 15.46875f, 1.80078125f, 1.86425781f,
+        1.16113281f, 2.44335938f, 4.8203125f, 9.078125f, 2.37695312f, 0.502929688f,
+        0.388427734f, 0.561035156f, 2.50390625f, 6.01953125f, 2.9375f, 0.521484375f,
+        0.377929688f, 0.8671875f, 0.121032715f, 2.86523438f, 7.07421875f, 0.88671875f,
+        11.9140625f, 12.84375f, 1.71679688f, 0.0803833008f, 0.0302429199f, 1.2890625f,
+        5.73046875f, 0.850097656f, 4.8515625f, 0.534667969f, 0.159179688f, 9.609375f,
+        0.0807495117f, 0.167480469f, 0.0964355469f, 12.703125f, 26.578125f, 3.28125f,
+        1.87792969f, 0.372802734f, 0.112792969f, 15.171875f, 27.796875f, 3.43554688f,
+        3.83398438f, 1.07128906f, 0.455810547f, 0.0595092773f, 0.0643920898f, 0.207275391f,
+        6.40234375f, 17.171875f, 2.08789062f, 3.86523438f, 2.72265625f, 18.46875f,
+        2.23242188f, 0.59765625f, 20.03125f, 0.586425781f, 1.50195312f, 0.196166992f,
+        11.40625f, 30.765625f, 3.6875f, 0.203491211f, 0.452392578f, 0.349365234f,
+        1.62109375f, 1.52636719f, 0.578125f, 0.709960938f, 0.177124023f, 9.0f,
+        22.78125f, 2.84570312f, 25.015625f, 0.292236328f, 0.733398438f, 0.305908203f,
+        9.734375f, 3.28710938f, 4.9765625f, 0.249389648f, 0.639160156f, 0.0934448242f,
+        0.981445312f, 0.265136719f, 15.53125f, 16.1875f, 6.05078125f, 2.05859375f,
+        0.0885009766f, 0.0502929688f, 0.159545898f, 3.49804688f, 6.49609375f, 22.875f,
+        8.2890625f, 1.91894531f, 0.442138672f, 1.47558594f, 3.25976562f, 3.53710938f,
+        4.7734375f, 5.04296875f, 0.669921875f, 4.4765625f, 10.765625f, 3.06054688f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.04003906f, 0.0667114258f, 0.00503921509f,
+        0.299804688f, 1.32617188f, 0.0581665039f, 0.0735473633f, 0.0208892822f, 1.35058594f,
+        0.533691406f, 0.0178527832f, 0.339355469f, 116.0625f, 70.5625f, 35.6875f,
+        1.29003906f, 4.90625f, 0.60546875f, 2.79296875f, 0.379150391f, 16.046875f,
+        0.608886719f, 2.02734375f, 0.758789062f, 7.04296875f, 0.491943359f, 0.241455078f,
+        0.779296875f, 1.32617188f, 0.902832031f, 0.322021484f, 0.108276367f, 4.3046875f,
+        9.28125f, 37.5f, 1.66699219f, 2.78710938f, 0.282226562f, 0.0240783691f,
+        0.546875f, 1.20898438f, 0.0770263672f, 0.420166016f, 1.26074219f, 1.59472656f,
+        7.55859375f, 25.09375f, 37.53125f, 5.8984375f, 25.859375f, 1.13964844f,
+        1.0859375f, 2.6015625f, 0.135620117f, 2.08984375f, 9.1171875f, 0.406738281f,
+        3.21484375f, 1.76464844f, 0.631347656f, 0.691894531f, 2.90625f, 0.385742188f,
+        3.1015625f, 13.59375f, 0.605957031f, 0.168457031f, 0.0626831055f, 2.87109375f,
+        1.33789062f, 0.380615234f, 22.28125f, 18.546875f, 1.22558594f, 1.56738281f,
+        0.863769531f, 2.50390625f, 5.0859375f, 10.6015625f, 2.08984375f, 0.165161133f,
+        0.342773438f, 0.574707031f, 2.703125f, 6.72265625f, 2.80078125f, 0.209838867f,
+        0.270263672f, 0.885253906f, 0.0567626953f, 1.93847656f, 7.23046875f, 0.357421875f,
+        11.75f, 12.84375f, 0.6171875f, 0.0872802734f, 0.0321655273f, 1.4140625f,
+        6.81640625f, 0.657714844f, 5.14453125f, 0.586425781f, 0.173706055f, 10.5546875f,
+        0.0614318848f, 0.170898438f, 0.0912475586f, 9.6484375f, 27.09375f, 1.24414062f,
+        2.21679688f, 0.30859375f, 0.0532226562f, 12.4140625f, 28.25f, 1.26464844f,
+        4.45703125f, 0.953125f, 0.332519531f, 0.0579223633f, 0.0650634766f, 0.221679688f,
+        4.02734375f, 17.578125f, 0.809570312f, 4.06640625f, 2.72460938f, 20.03125f,
+        2.53320312f, 0.591308594f, 21.953125f, 0.384277344f, 1.53613281f, 0.0850830078f,
+        7.13671875f, 31.5f, 1.390625f, 0.147705078f, 0.462646484f, 0.344482422f,
+        1.64648438f, 1.51953125f, 0.48046875f, 0.799316406f, 0.182983398f, 9.875f,
+        27.203125f, 2.078125f, 26.796875f, 0.194213867f, 0.750488281f, 0.272705078f,
+        11.1796875f, 3.02148438f, 5.00390625f, 0.163208008f, 0.653808594f, 0.0471496582f,
+        1.08984375f, 0.283935547f, 17.046875f, 18.5f, 5.609375f, 1.43066406f,
+        0.0967407227f, 0.049041748f, 0.169677734f, 2.76367188f, 6.67578125f, 24.59375f,
+        9.7265625f, 1.64550781f, 0.152099609f, 1.07128906f, 3.3359375f, 3.60546875f,
+        4.7265625f, 5.0390625f, 0.235473633f, 3.08398438f, 11.0f, 2.42382812f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.37792969f, 0.00308227539f, 0.00678253174f,
+        0.0277099609f, 1.40722656f, 0.0346679688f, 0.00778579712f, 0.00323104858f, 1.37207031f,
+        0.690429688f, -0.0196380615f, 0.345947266f, 133.75f, 67.9375f, 35.25f,
+        0.319824219f, 5.19140625f, 0.525390625f, 2.6328125f, 0.0526428223f, 16.3125f,
+        0.202026367f, 2.13476562f, 0.733886719f, 9.3046875f, 0.0621948242f, 0.255859375f,
+        0.618652344f, 1.3671875f, 0.894042969f, 0.130493164f, 0.0493469238f, 4.375f,
+        1.84863281f, 39.75f, 1.00488281f, 3.6640625f, 0.119567871f, 0.0269622803f,
+        0.391113281f, 1.265625f, 0.0567626953f, 0.110717773f, 1.3125f, 1.59765625f,
+        0.752441406f, 26.125f, 37.6875f, 0.607421875f, 27.453125f, 0.682617188f,
+        0.721191406f, 2.72851562f, 0.0912475586f, 0.225830078f, 9.671875f, 0.245361328f,
+        3.78320312f, 1.68066406f, 0.6171875f, 0.0910644531f, 3.08007812f, 0.338623047f,
+        0.318359375f, 14.4296875f, 0.365722656f, 0.0276794434f, 0.0257873535f, 2.91601562f,
+        0.28515625f, 0.0838623047f, 22.640625f, 24.46875f, 0.0783691406f, 1.62207031f,
+        0.137939453f, 2.58398438f, 5.125f, 13.640625f, 1.54785156f, 0.157958984f,
+        0.12878418f, 0.567382812f, 2.73828125f, 8.234375f, 2.56835938f, 0.178833008f,
+        0.11138916f, 0.935058594f, 0.0415649414f, 0.5546875f, 7.65625f, 0.230834961f,
+        12.140625f, 13.046875f, 0.415771484f, 0.0190429688f, 0.0138015747f, 1.43652344f,
+        8.6484375f, 0.20324707f, 5.234375f, 0.0737915039f, 0.0358276367f, 10.71875f,
+        0.0289001465f, 0.178955078f, 0.0895996094f, 5.30078125f, 28.515625f, 0.775878906f,
+        2.88867188f, 0.185180664f, 0.0544433594f, 8.6796875f, 29.578125f, 0.781738281f,
+        5.69921875f, 0.728027344f, 0.332275391f, 0.0455627441f, 0.0638427734f, 0.224243164f,
+        0.434082031f, 18.640625f, 0.499023438f, 3.43554688f, 2.45117188f, 20.3125f,
+        1.85253906f, 0.234985352f, 22.3125f, 0.0805664062f, 1.62792969f, 0.0582580566f,
+        0.672851562f, 33.4375f, 0.833007812f, 0.0470581055f, 0.484619141f, 0.341796875f,
+        1.75488281f, 1.52246094f, 0.464111328f, 0.399169922f, 0.0390014648f, 10.0390625f,
+        34.25f, 0.155029297f, 27.265625f, 0.0334472656f, 0.792480469f, 0.263427734f,
+        13.859375f, 2.4609375f, 5.05859375f, 0.0330810547f, 0.692871094f, 0.0359191895f,
+        0.308349609f, 0.0520019531f, 17.328125f, 23.1875f, 4.8046875f, 1.39941406f,
+        0.10546875f, 0.0446166992f, 0.17175293f, 0.291259766f, 6.7421875f, 24.859375f,
+        12.6015625f, 1.12792969f, 0.150634766f, 0.276855469f, 3.484375f, 3.60351562f,
+        4.92578125f, 5.11328125f, 0.156494141f, 0.907226562f, 11.6171875f, 2.26171875f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.70703125f, -0.0220947266f, 0.353515625f, 135.75f, 67.875f, 33.9375f,
+        0.220947266f, 5.21484375f, 0.408691406f, 2.60742188f, 0.00862884521f, 16.78125f,
+        0.16015625f, 2.14257812f, 0.701171875f, 9.5390625f, 0.0410766602f, 0.215332031f,
+        0.602050781f, 1.36914062f, 0.883789062f, 0.107666016f, 0.0390014648f, 4.50390625f,
+        1.09375f, 39.9375f, 0.0203704834f, 3.75585938f, 0.111816406f, 0.00638580322f,
+        0.375488281f, 1.27050781f, 0.0245056152f, 0.0780029297f, 1.31445312f, 1.61230469f,
+        0.030380249f, 26.15625f, 38.15625f, 0.0690307617f, 27.5625f, 0.00603866577f,
+        0.684570312f, 2.73828125f, 0.0213928223f, 0.0362243652f, 9.71875f, 0.00698852539f,
+        3.84375f, 1.67871094f, 0.57421875f, 0.0296783447f, 3.09179688f, 0.270507812f,
+        0.0351867676f, 14.4921875f, 0.010269165f, 0.0110473633f, 0.0189819336f, 3.00390625f,
+        0.16015625f, 0.030380249f, 23.328125f, 25.09375f, 0.0201873779f, 1.54589844f,
+        0.0600585938f, 2.58398438f, 5.21484375f, 13.9609375f, 1.52441406f, 0.0552368164f,
+        0.104919434f, 0.562988281f, 2.8046875f, 8.390625f, 2.5625f, 0.0780029297f,
+        0.0952758789f, 0.938964844f, 0.0186309814f, 0.414306641f, 7.6875f, 0.0414123535f,
+        12.1953125f, 13.078125f, 0.0376281738f, 0.0109558105f, 0.0104370117f, 1.48046875f,
+        8.8359375f, 0.172607422f, 5.34375f, 0.0131149292f, 0.0106124878f, 11.046875f,
+        0.0255432129f, 0.179443359f, 0.0876464844f, 4.859375f, 28.625f, 0.0517883301f,
+        2.9609375f, 0.179443359f, 0.0369262695f, 8.3046875f, 29.6875f, 0.0138092041f,
+        5.83203125f, 0.717773438f, 0.295410156f, 0.0441894531f, 0.0634765625f, 0.229248047f,
+        0.068359375f, 18.734375f, 0.0403747559f, 3.35742188f, 2.40820312f, 20.859375f,
+        1.76757812f, 0.179443359f, 22.96875f, 0.0497131348f, 1.63476562f, 0.0184631348f,
+        0.0151901245f, 33.5625f, 0.00957489014f, 0.0365905762f, 0.486083984f, 0.339599609f,
+        1.76757812f, 1.52441406f, 0.430664062f, 0.350585938f, 0.0146713257f, 10.3359375f,
+        35.0f, 0.0150146484f, 27.921875f, 0.0169067383f, 0.795410156f, 0.251220703f,
+        14.140625f, 2.4296875f, 5.08203125f, 0.0198516846f, 0.695800781f, 0.0193328857f,
+        0.215332031f, 0.0107879639f, 17.84375f, 23.6875f, 4.76953125f, 1.20410156f,
+        0.106323242f, 0.0441894531f, 0.175292969f, 0.0200195312f, 6.71484375f, 25.453125f,
+        12.8984375f, 1.10449219f, 0.0634765625f, 0.193237305f, 3.49023438f, 3.62304688f,
+        4.94921875f, 5.125f, 0.0072479248f, 0.684570312f, 11.6640625f, 2.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.265136719f, 0.265136719f, 0.265136719f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.70703125f, -0.0220947266f, 0.353515625f, 135.75f, 67.875f, 33.9375f,
+        0.220947266f, 5.21484375f, 0.408691406f, 2.60742188f, 0.00862884521f, 16.78125f,
+        0.16015625f, 2.14257812f, 0.701171875f, 9.5390625f, 0.0410766602f, 0.215332031f,
+        0.602050781f, 1.36914062f, 0.883789062f, 0.107666016f, 0.0390014648f, 4.50390625f,
+        1.09375f, 39.9375f, 0.0203704834f, 3.75585938f, 0.111816406f, 0.00638580322f,
+        0.375488281f, 1.27050781f, 0.0245056152f, 0.0780029297f, 1.31445312f, 1.61230469f,
+        0.030380249f, 26.15625f, 38.15625f, 0.0690307617f, 27.5625f, 0.00603866577f,
+        0.684570312f, 2.73828125f, 0.0213928223f, 0.0362243652f, 9.71875f, 0.00698852539f,
+        3.84375f, 1.67871094f, 0.57421875f, 0.0296783447f, 3.09179688f, 0.270507812f,
+        0.0351867676f, 14.4921875f, 0.010269165f, 0.0110473633f, 0.0189819336f, 3.00390625f,
+        0.16015625f, 0.030380249f, 23.328125f, 25.09375f, 0.0201873779f, 1.54589844f,
+        0.0600585938f, 2.58398438f, 5.21484375f, 13.9609375f, 1.52441406f, 0.0552368164f,
+        0.104919434f, 0.562988281f, 2.8046875f, 8.390625f, 2.5625f, 0.0780029297f,
+        0.0952758789f, 0.938964844f, 0.0186309814f, 0.414306641f, 7.6875f, 0.0414123535f,
+        12.1953125f, 13.078125f, 0.0376281738f, 0.0109558105f, 0.0104370117f, 1.48046875f,
+        8.8359375f, 0.172607422f, 5.34375f, 0.0131149292f, 0.0106124878f, 11.046875f,
+        0.0255432129f, 0.179443359f, 0.0876464844f, 4.859375f, 28.625f, 0.0517883301f,
+        2.9609375f, 0.179443359f, 0.0369262695f, 8.3046875f, 29.6875f, 0.0138092041f,
+        5.83203125f, 0.717773438f, 0.295410156f, 0.0441894531f, 0.0634765625f, 0.229248047f,
+        0.068359375f, 18.734375f, 0.0403747559f, 3.35742188f, 2.40820312f, 20.859375f,
+        1.76757812f, 0.179443359f, 22.96875f, 0.0497131348f, 1.63476562f, 0.0184631348f,
+        0.0151901245f, 33.5625f, 0.00957489014f, 0.0365905762f, 0.486083984f, 0.339599609f,
+        1.76757812f, 1.52441406f, 0.430664062f, 0.350585938f, 0.0146713257f, 10.3359375f,
+        35.0f, 0.0150146484f, 27.921875f, 0.0169067383f, 0.795410156f, 0.251220703f,
+        14.140625f, 2.4296875f, 5.08203125f, 0.0198516846f, 0.695800781f, 0.0193328857f,
+        0.215332031f, 0.0107879639f, 17.84375f, 23.6875f, 4.76953125f, 1.20410156f,
+        0.106323242f, 0.0441894531f, 0.175292969f, 0.0200195312f, 6.71484375f, 25.453125f,
+        12.8984375f, 1.10449219f, 0.0634765625f, 0.193237305f, 3.49023438f, 3.62304688f,
+        4.94921875f, 5.125f, 0.0072479248f, 0.684570312f, 11.6640625f, 2.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 14136.0f, 14136.0f, 14136.0f,
+        2.79492188f, 2.79492188f, 2.79492188f, 8664.0f, 992.5f, 291.5f,
+        4800.0f, 12952.0f, 1549.0f, 670.0f, 190.125f, 12296.0f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        3624.0f, 9640.0f, 1532.0f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        1853.0f, 4988.0f, 596.5f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        213.75f, 576.5f, 68.9375f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.310546875f, 0.806152344f, 0.217773438f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.125732422f, 0.0872192383f, 1.55957031f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 8.53125f, 22.28125f, 8.1640625f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 81.9375f, 220.875f, 28.453125f,
+        kUndefined, kUndefined, kUndefined, 40.9375f, 110.5f, 13.21875f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.185546875f, 0.0545349121f, 0.72265625f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 14136.0f, 14136.0f, 14136.0f,
+        2.79492188f, 2.79492188f, 2.79492188f, 10400.0f, 667.0f, 50.375f,
+        3000.0f, 13264.0f, 581.5f, 735.5f, 208.875f, 13504.0f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        2296.0f, 9864.0f, 850.0f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        1161.0f, 5104.0f, 224.0f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        133.625f, 590.5f, 25.890625f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.200683594f, 0.825195312f, 0.169555664f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.129272461f, 0.0903320312f, 1.70605469f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 5.484375f, 22.8125f, 7.0546875f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 51.25f, 226.125f, 12.171875f,
+        kUndefined, kUndefined, kUndefined, 25.578125f, 113.125f, 4.96484375f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.212768555f, 0.0511779785f, 0.786621094f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 14136.0f, 14136.0f, 14136.0f,
+        2.79492188f, 2.79492188f, 2.79492188f, 13784.0f, 30.828125f, 67.8125f,
+        277.0f, 14072.0f, 346.75f, 77.8125f, 32.3125f, 13720.0f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        267.25f, 10456.0f, 682.0f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        115.5f, 5416.0f, 133.5f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        12.5f, 626.5f, 15.4453125f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.0277404785f, 0.873046875f, 0.157104492f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.040802002f, 0.0704956055f, 1.73242188f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.529296875f, 24.125f, 6.75f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 4.73828125f, 239.875f, 8.203125f,
+        kUndefined, kUndefined, kUndefined, 2.36914062f, 120.0625f, 2.96289062f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.221801758f, 0.0326538086f, 0.799316406f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 14136.0f, 14136.0f, 14136.0f,
+        2.79492188f, 2.79492188f, 2.79492188f, 14136.0f, 0.0f, 0.0f,
+        0.0f, 14136.0f, 0.0f, 0.0f, 0.0f, 14136.0f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        60.625f, 10504.0f, 436.75f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        9.0390625f, 5440.0f, 0.00925445557f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.170166016f, 629.5f, 0.00547409058f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.0100326538f, 0.876953125f, 0.139648438f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.0304412842f, 0.0666503906f, 1.78320312f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.0205841064f, 24.21875f, 6.33984375f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.00455856323f, 241.0f, 2.36328125f,
+        kUndefined, kUndefined, kUndefined, 0.00616836548f, 120.5625f, 0.00586700439f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.222290039f, 0.0304412842f, 0.821289062f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 14136.0f, 14136.0f, 14136.0f,
+        2.79492188f, 2.79492188f, 2.79492188f, 14136.0f, 0.0f, 0.0f,
+        0.0f, 14136.0f, 0.0f, 0.0f, 0.0f, 14136.0f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        60.625f, 10504.0f, 436.75f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        9.0390625f, 5440.0f, 0.00925445557f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.170166016f, 629.5f, 0.00547409058f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.0100326538f, 0.876953125f, 0.139648438f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.0304412842f, 0.0666503906f, 1.78320312f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.0205841064f, 24.21875f, 6.33984375f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, 0.00455856323f, 241.0f, 2.36328125f,
+        kUndefined, kUndefined, kUndefined, 0.00616836548f, 120.5625f, 0.00586700439f,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        0.222290039f, 0.0304412842f, 0.821289062f, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+        kUndefined, kUndefined, kUndefined, kUndefined, kUndefined, kUndefined,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0712280273f, 0.0712280273f, 0.0712280273f, 0.866699219f, 0.0992431641f, 0.0291442871f,
+        0.479980469f, 1.29589844f, 0.154907227f, 0.0669555664f, 0.0190124512f, 1.22949219f,
+        0.228637695f, 0.0227508545f, 0.103149414f, 20096.0f, 7816.0f, 2464.0f,
+        7.54296875f, 20.25f, 2.54296875f, 16.59375f, 4.19140625f, 248.25f,
+        1.16796875f, 3.05273438f, 0.6796875f, 50.5625f, 5.796875f, 1.74707031f,
+        0.64453125f, 1.24121094f, 0.637207031f, 0.781738281f, 0.2265625f, 14.03125f,
+        658.0f, 1775.0f, 212.25f, 6.69140625f, 0.788085938f, 0.228637695f,
+        0.461914062f, 1.05273438f, 0.132080078f, 0.512695312f, 1.14453125f, 1.74121094f,
+        340.75f, 719.5f, 1607.0f, 289.5f, 781.5f, 93.4375f,
+        2.1015625f, 5.125f, 0.62109375f, 29.15625f, 78.625f, 9.40625f,
+        7.71875f, 2.64648438f, 0.674804688f, 2.453125f, 6.6015625f, 0.853027344f,
+        70.0625f, 189.125f, 22.609375f, 0.323730469f, 0.0951538086f, 5.890625f,
+        27.96875f, 7.94140625f, 513.0f, 424.75f, 48.65625f, 15.7578125f,
+        2.7265625f, 4.8125f, 19.75f, 117.125f, 14.8515625f, 4.109375f,
+        0.374267578f, 0.302978516f, 5.12109375f, 39.8125f, 8.8046875f, 1.82910156f,
+        0.2265625f, 0.577636719f, 0.0728759766f, 17.53125f, 47.09375f, 5.640625f,
+        142.375f, 160.75f, 20.953125f, 0.0757446289f, 0.0231628418f, 1.34960938f,
+        43.84375f, 5.2421875f, 21.734375f, 5.38671875f, 1.53027344f, 98.8125f,
+        0.0186767578f, 0.0391845703f, 0.0216674805f, 326.5f, 851.0f, 102.0f,
+        4.03515625f, 0.499267578f, 0.146972656f, 378.5f, 925.0f, 111.375f,
+        17.40625f, 2.32421875f, 0.694824219f, 0.0135574341f, 0.0144042969f, 0.0521850586f,
+        123.375f, 333.0f, 39.8125f, 28.515625f, 10.6796875f, 401.0f,
+        28.390625f, 7.86328125f, 496.0f, 0.651855469f, 1.74121094f, 0.211914062f,
+        448.0f, 1209.0f, 144.5f, 0.0735473633f, 0.173706055f, 0.110961914f,
+        1.93359375f, 1.66796875f, 0.359130859f, 4.72265625f, 1.33203125f, 85.5f,
+        927.5f, 113.25f, 793.0f, 0.160766602f, 0.420410156f, 0.10760498f,
+        122.3125f, 17.953125f, 22.671875f, 0.123962402f, 0.326904297f, 0.0428771973f,
+        15.5078125f, 4.3984375f, 284.0f, 380.0f, 59.53125f, 15.453125f,
+        0.019744873f, 0.0112075806f, 0.0370788574f, 46.84375f, 44.6875f, 625.5f,
+        98.25f, 12.0078125f, 3.40039062f, 3.66992188f, 8.6796875f, 9.796875f,
+        19.328125f, 20.890625f, 2.74023438f, 43.8125f, 117.375f, 16.625f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0712280273f, 0.0712280273f, 0.0712280273f, 1.04003906f, 0.0667114258f, 0.00503921509f,
+        0.299804688f, 1.32617188f, 0.0581665039f, 0.0735473633f, 0.0208892822f, 1.35058594f,
+        0.274658203f, 0.0143432617f, 0.106689453f, 22880.0f, 7280.0f, 1652.0f,
+        4.734375f, 20.734375f, 1.04296875f, 18.53125f, 4.453125f, 272.5f,
+        0.750976562f, 3.125f, 0.482421875f, 60.6875f, 3.90039062f, 0.345214844f,
+        0.51171875f, 1.26464844f, 0.58984375f, 0.858886719f, 0.247558594f, 15.40625f,
+        411.5f, 1817.0f, 79.6875f, 8.0234375f, 0.537597656f, 0.041229248f,
+        0.331787109f, 1.07519531f, 0.052520752f, 0.367919922f, 1.17285156f, 1.81542969f,
+        252.25f, 738.0f, 1705.0f, 181.0f, 800.0f, 35.09375f,
+        1.43652344f, 5.23828125f, 0.234863281f, 18.21875f, 80.5f, 3.53320312f,
+        8.8671875f, 2.42578125f, 0.363525391f, 1.53613281f, 6.7578125f, 0.366455078f,
+        43.78125f, 193.625f, 8.4921875f, 0.354980469f, 0.104125977f, 6.46875f,
+        30.703125f, 8.71875f, 563.0f, 510.0f, 32.71875f, 4.08984375f,
+        2.203125f, 4.9453125f, 21.3125f, 140.25f, 10.515625f, 0.756835938f,
+        0.373535156f, 0.315429688f, 5.60546875f, 46.84375f, 7.4765625f, 0.4375f,
+        0.149169922f, 0.590332031f, 0.0298919678f, 11.0078125f, 48.21875f, 2.12304688f,
+        138.75f, 161.125f, 7.28515625f, 0.0830078125f, 0.0252075195f, 1.48242188f,
+        52.5f, 3.66992188f, 22.53125f, 5.9140625f, 1.68066406f, 108.5f,
+        0.0141143799f, 0.0400085449f, 0.0203552246f, 210.625f, 870.5f, 38.21875f,
+        4.8359375f, 0.349121094f, 0.0329589844f, 258.0f, 945.5f, 41.5625f,
+        20.8125f, 1.68457031f, 0.195922852f, 0.0132369995f, 0.0145568848f, 0.0559997559f,
+        77.0625f, 340.75f, 14.953125f, 31.171875f, 11.1875f, 440.0f,
+        31.3125f, 8.5625f, 544.5f, 0.411376953f, 1.78222656f, 0.0820922852f,
+        279.75f, 1237.0f, 54.28125f, 0.0511474609f, 0.177734375f, 0.106872559f,
+        1.99804688f, 1.65234375f, 0.221557617f, 5.1953125f, 1.45996094f, 93.875f,
+        1109.0f, 81.125f, 843.0f, 0.103271484f, 0.430419922f, 0.0818481445f,
+        145.75f, 13.5859375f, 20.828125f, 0.0791015625f, 0.334716797f, 0.0187835693f,
+        17.03125f, 4.828125f, 312.0f, 452.5f, 45.875f, 3.90039062f,
+        0.0215911865f, 0.010925293f, 0.0395202637f, 45.3125f, 46.46875f, 684.0f,
+        117.75f, 8.34375f, 0.618164062f, 2.53710938f, 8.890625f, 10.0234375f,
+        19.03125f, 20.90625f, 0.947753906f, 27.578125f, 120.1875f, 8.109375f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0712280273f, 0.0712280273f, 0.0712280273f, 1.37792969f, 0.00308227539f, 0.00678253174f,
+        0.0277099609f, 1.40722656f, 0.0346679688f, 0.00778579712f, 0.00323104858f, 1.37207031f,
+        0.358398438f, -0.00383377075f, 0.108886719f, 28592.0f, 6308.0f, 1604.0f,
+        0.487548828f, 22.0f, 0.677734375f, 6.4609375f, 0.664550781f, 277.0f,
+        0.102844238f, 3.31054688f, 0.432861328f, 80.375f, 0.188964844f, 0.447509766f,
+        0.295654297f, 1.32226562f, 0.576660156f, 0.112304688f, 0.0455322266f, 15.65625f,
+        38.78125f, 1928.0f, 47.53125f, 10.625f, 0.0484924316f, 0.0542907715f,
+        0.141113281f, 1.13476562f, 0.0338134766f, 0.050994873f, 1.21972656f, 1.82324219f,
+        24.53125f, 760.0f, 1720.0f, 16.734375f, 849.0f, 20.921875f,
+        0.446533203f, 5.54296875f, 0.142822266f, 1.69042969f, 85.4375f, 2.10742188f,
+        11.2109375f, 2.0234375f, 0.348144531f, 0.147949219f, 7.171875f, 0.248046875f,
+        4.05078125f, 205.375f, 5.0625f, 0.0397644043f, 0.0196685791f, 6.57421875f,
+        3.28125f, 1.35351562f, 572.0f, 675.5f, 1.51855469f, 4.96875f,
+        0.231201172f, 4.953125f, 21.5625f, 185.375f, 2.05273438f, 0.964355469f,
+        0.059753418f, 0.255126953f, 5.69140625f, 60.8125f, 4.94921875f, 0.434326172f,
+        0.0329589844f, 0.625488281f, 0.01953125f, 1.14648438f, 51.15625f, 1.27050781f,
+        140.875f, 164.25f, 4.72265625f, 0.0109634399f, 0.005859375f, 1.50585938f,
+        68.0625f, 0.245117188f, 22.984375f, 0.628417969f, 0.261962891f, 110.25f,
+        0.00646591187f, 0.0419311523f, 0.0199737549f, 36.65625f, 923.0f, 22.84375f,
+        6.3984375f, 0.0561828613f, 0.0404663086f, 79.0f, 1000.5f, 24.9375f,
+        27.46875f, 0.437744141f, 0.225585938f, 0.0101699829f, 0.0142059326f, 0.0566711426f,
+        7.13671875f, 361.75f, 8.921875f, 10.984375f, 5.29296875f, 447.0f,
+        5.3125f, 1.34960938f, 553.5f, 0.048034668f, 1.89160156f, 0.0506286621f,
+        25.859375f, 1313.0f, 32.375f, 0.0121688843f, 0.186889648f, 0.10534668f,
+        2.20703125f, 1.64453125f, 0.19934082f, 0.647460938f, 0.228027344f, 95.375f,
+        1414.0f, 5.16015625f, 858.5f, 0.0129928589f, 0.455810547f, 0.0752563477f,
+        190.75f, 4.78125f, 21.328125f, 0.0113067627f, 0.354980469f, 0.0129318237f,
+        1.85058594f, 0.748535156f, 317.0f, 594.5f, 19.484375f, 4.36328125f,
+        0.0234527588f, 0.00991821289f, 0.0400085449f, 4.6875f, 39.75f, 694.5f,
+        155.75f, 1.20800781f, 0.801269531f, 0.283203125f, 9.296875f, 10.0234375f,
+        19.65625f, 21.234375f, 0.618652344f, 2.86328125f, 127.5f, 6.03125f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0712280273f, 0.0712280273f, 0.0712280273f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.366943359f, -0.00490951538f, 0.110473633f, 29200.0f, 6272.0f, 1350.0f,
+        0.0551452637f, 22.09375f, 0.139892578f, 5.015625f, 0.00191783905f, 285.25f,
+        0.0365905762f, 3.32421875f, 0.361572266f, 82.4375f, 0.00912475586f, 0.0532836914f,
+        0.2734375f, 1.32617188f, 0.559082031f, 0.0239257812f, 0.00866699219f, 16.125f,
+        0.846191406f, 1937.0f, 0.00452423096f, 10.8984375f, 0.0248565674f, 0.00141906738f,
+        0.121765137f, 1.13964844f, 0.0054473877f, 0.0173339844f, 1.22070312f, 1.84765625f,
+        0.00674819946f, 759.0f, 1752.0f, 0.0153427124f, 853.0f, 0.00134181976f,
+        0.345947266f, 5.56640625f, 0.00475692749f, 0.00804901123f, 85.8125f, 0.00155353546f,
+        11.453125f, 2.00585938f, 0.251464844f, 0.00659561157f, 7.203125f, 0.073425293f,
+        0.00782012939f, 206.375f, 0.00228118896f, 0.00245475769f, 0.00421905518f, 6.7734375f,
+        0.0365905762f, 0.00674819946f, 589.5f, 693.0f, 0.00448608398f, 1.69628906f,
+        0.013343811f, 4.92578125f, 22.09375f, 190.125f, 1.64648438f, 0.0122756958f,
+        0.0233154297f, 0.242919922f, 5.85546875f, 62.28125f, 4.8359375f, 0.0173339844f,
+        0.0211639404f, 0.628417969f, 0.00414276123f, 0.142944336f, 51.40625f, 0.0092010498f,
+        141.125f, 164.625f, 0.00836181641f, 0.0024356842f, 0.00231933594f, 1.55175781f,
+        69.6875f, 0.0400390625f, 23.328125f, 0.00291442871f, 0.00235748291f, 113.625f,
+        0.00567626953f, 0.0420532227f, 0.0194854736f, 18.984375f, 927.0f, 0.011505127f,
+        6.5625f, 0.0420532227f, 0.00820922852f, 60.875f, 1005.0f, 0.00306892395f,
+        28.171875f, 0.377685547f, 0.0836791992f, 0.00981903076f, 0.0141143799f, 0.0579833984f,
+        0.0151901245f, 363.25f, 0.00897216797f, 8.578125f, 4.2421875f, 460.25f,
+        2.22851562f, 0.0420532227f, 570.0f, 0.0110473633f, 1.89941406f, 0.00410461426f,
+        0.00337409973f, 1319.0f, 0.00212860107f, 0.00813293457f, 0.1875f, 0.103759766f,
+        2.22851562f, 1.64648438f, 0.152709961f, 0.109130859f, 0.00325965881f, 98.25f,
+        1445.0f, 0.00333595276f, 877.5f, 0.00375938416f, 0.457519531f, 0.0659790039f,
+        195.375f, 4.32421875f, 20.890625f, 0.00440979004f, 0.356445312f, 0.00429534912f,
+        0.0532836914f, 0.00239753723f, 326.5f, 609.5f, 18.234375f, 1.02441406f,
+        0.0236206055f, 0.00981903076f, 0.0408325195f, 0.00444793701f, 38.28125f, 714.5f,
+        159.75f, 0.86328125f, 0.0141143799f, 0.0462036133f, 9.3203125f, 10.09375f,
+        19.734375f, 21.296875f, 0.00161075592f, 0.345947266f, 128.0f, 2.9765625f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0712280273f, 0.0712280273f, 0.0712280273f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.366943359f, -0.00490951538f, 0.110473633f, 29200.0f, 6272.0f, 1350.0f,
+        0.0551452637f, 22.09375f, 0.139892578f, 5.015625f, 0.00191783905f, 285.25f,
+        0.0365905762f, 3.32421875f, 0.361572266f, 82.4375f, 0.00912475586f, 0.0532836914f,
+        0.2734375f, 1.32617188f, 0.559082031f, 0.0239257812f, 0.00866699219f, 16.125f,
+        0.846191406f, 1937.0f, 0.00452423096f, 10.8984375f, 0.0248565674f, 0.00141906738f,
+        0.121765137f, 1.13964844f, 0.0054473877f, 0.0173339844f, 1.22070312f, 1.84765625f,
+        0.00674819946f, 759.0f, 1752.0f, 0.0153427124f, 853.0f, 0.00134181976f,
+        0.345947266f, 5.56640625f, 0.00475692749f, 0.00804901123f, 85.8125f, 0.00155353546f,
+        11.453125f, 2.00585938f, 0.251464844f, 0.00659561157f, 7.203125f, 0.073425293f,
+        0.00782012939f, 206.375f, 0.00228118896f, 0.00245475769f, 0.00421905518f, 6.7734375f,
+        0.0365905762f, 0.00674819946f, 589.5f, 693.0f, 0.00448608398f, 1.69628906f,
+        0.013343811f, 4.92578125f, 22.09375f, 190.125f, 1.64648438f, 0.0122756958f,
+        0.0233154297f, 0.242919922f, 5.85546875f, 62.28125f, 4.8359375f, 0.0173339844f,
+        0.0211639404f, 0.628417969f, 0.00414276123f, 0.142944336f, 51.40625f, 0.0092010498f,
+        141.125f, 164.625f, 0.00836181641f, 0.0024356842f, 0.00231933594f, 1.55175781f,
+        69.6875f, 0.0400390625f, 23.328125f, 0.00291442871f, 0.00235748291f, 113.625f,
+        0.00567626953f, 0.0420532227f, 0.0194854736f, 18.984375f, 927.0f, 0.011505127f,
+        6.5625f, 0.0420532227f, 0.00820922852f, 60.875f, 1005.0f, 0.00306892395f,
+        28.171875f, 0.377685547f, 0.0836791992f, 0.00981903076f, 0.0141143799f, 0.0579833984f,
+        0.0151901245f, 363.25f, 0.00897216797f, 8.578125f, 4.2421875f, 460.25f,
+        2.22851562f, 0.0420532227f, 570.0f, 0.0110473633f, 1.89941406f, 0.00410461426f,
+        0.00337409973f, 1319.0f, 0.00212860107f, 0.00813293457f, 0.1875f, 0.103759766f,
+        2.22851562f, 1.64648438f, 0.152709961f, 0.109130859f, 0.00325965881f, 98.25f,
+        1445.0f, 0.00333595276f, 877.5f, 0.00375938416f, 0.457519531f, 0.0659790039f,
+        195.375f, 4.32421875f, 20.890625f, 0.00440979004f, 0.356445312f, 0.00429534912f,
+        0.0532836914f, 0.00239753723f, 326.5f, 609.5f, 18.234375f, 1.02441406f,
+        0.0236206055f, 0.00981903076f, 0.0408325195f, 0.00444793701f, 38.28125f, 714.5f,
+        159.75f, 0.86328125f, 0.0141143799f, 0.0462036133f, 9.3203125f, 10.09375f,
+        19.734375f, 21.296875f, 0.00161075592f, 0.345947266f, 128.0f, 2.9765625f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0414733887f, 0.0414733887f, 0.0414733887f, 0.866699219f, 0.0992431641f, 0.0291442871f,
+        0.479980469f, 1.29589844f, 0.154907227f, 0.0669555664f, 0.0190124512f, 1.22949219f,
+        0.188354492f, 0.0206451416f, 0.0686035156f, 48384.0f, 17408.0f, 5180.0f,
+        10.046875f, 27.0625f, 3.31835938f, 26.15625f, 6.82421875f, 415.0f,
+        1.27246094f, 3.37109375f, 0.661621094f, 76.0f, 8.703125f, 2.58007812f,
+        0.6015625f, 1.2265625f, 0.577148438f, 0.998535156f, 0.284912109f, 18.203125f,
+        1288.0f, 3476.0f, 415.75f, 8.3515625f, 0.965332031f, 0.282226562f,
+        0.426269531f, 1.02148438f, 0.124816895f, 0.500976562f, 1.12402344f, 1.79199219f,
+        628.5f, 1307.0f, 3112.0f, 530.0f, 1431.0f, 171.125f,
+        2.38085938f, 5.98046875f, 0.719726562f, 43.96875f, 118.6875f, 14.1953125f,
+        9.5390625f, 2.93164062f, 0.694824219f, 2.93554688f, 7.9140625f, 0.983886719f,
+        113.9375f, 307.5f, 36.78125f, 0.383300781f, 0.109985352f, 7.01953125f,
+        49.625f, 14.09375f, 911.0f, 764.5f, 87.5625f, 27.21875f,
+        3.33007812f, 5.6015625f, 26.296875f, 188.875f, 23.09375f, 6.51953125f,
+        0.394775391f, 0.263916016f, 6.0f, 57.90625f, 11.515625f, 2.49804688f,
+        0.196289062f, 0.516601562f, 0.0631103516f, 25.234375f, 67.9375f, 8.125f,
+        225.5f, 256.25f, 33.375f, 0.0751342773f, 0.0219116211f, 1.36523438f,
+        64.75f, 7.6875f, 29.375f, 8.3203125f, 2.36328125f, 152.75f,
+        0.00862121582f, 0.019317627f, 0.00859832764f, 595.5f, 1568.0f, 187.75f,
+        4.78515625f, 0.56640625f, 0.165405273f, 687.5f, 1715.0f, 206.125f,
+        23.703125f, 2.99023438f, 0.872070312f, 0.00527954102f, 0.00519561768f, 0.0282897949f,
+        210.375f, 568.0f, 67.875f, 46.0f, 15.921875f, 697.5f,
+        49.28125f, 13.765625f, 878.0f, 0.670898438f, 1.8046875f, 0.217163086f,
+        850.0f, 2294.0f, 274.25f, 0.051361084f, 0.126464844f, 0.0729370117f,
+        2.01757812f, 1.70507812f, 0.325439453f, 7.15234375f, 2.0234375f, 130.5f,
+        1771.0f, 215.625f, 1457.0f, 0.135253906f, 0.358886719f, 0.0755615234f,
+        197.0f, 27.09375f, 31.234375f, 0.100341797f, 0.268066406f, 0.0333862305f,
+        26.171875f, 7.4296875f, 480.25f, 673.5f, 98.125f, 25.859375f,
+        0.00782775879f, 0.00405502319f, 0.0179748535f, 79.375f, 66.625f, 1127.0f,
+        156.25f, 18.59375f, 5.3359375f, 4.5f, 10.6796875f, 12.140625f,
+        25.625f, 27.8125f, 3.64453125f, 68.1875f, 183.25f, 24.75f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0414733887f, 0.0414733887f, 0.0414733887f, 1.04003906f, 0.0667114258f, 0.00503921509f,
+        0.299804688f, 1.32617188f, 0.0581665039f, 0.0735473633f, 0.0208892822f, 1.35058594f,
+        0.226074219f, 0.0137329102f, 0.0697021484f, 55392.0f, 16072.0f, 3262.0f,
+        6.2890625f, 27.703125f, 1.30664062f, 29.078125f, 7.3203125f, 455.75f,
+        0.807617188f, 3.45117188f, 0.435546875f, 91.25f, 5.8515625f, 0.469238281f,
+        0.462402344f, 1.25097656f, 0.525390625f, 1.09667969f, 0.3125f, 19.984375f,
+        805.5f, 3558.0f, 156.125f, 10.0234375f, 0.651855469f, 0.049407959f,
+        0.294921875f, 1.04394531f, 0.0477294922f, 0.358154297f, 1.15234375f, 1.87304688f,
+        469.25f, 1342.0f, 3308.0f, 331.25f, 1465.0f, 64.25f,
+        1.58789062f, 6.11328125f, 0.270019531f, 27.484375f, 121.5f, 5.328125f,
+        11.0390625f, 2.64453125f, 0.322753906f, 1.8359375f, 8.1015625f, 0.396484375f,
+        71.1875f, 314.75f, 13.8125f, 0.420898438f, 0.120666504f, 7.7109375f,
+        54.5f, 15.4765625f, 1000.5f, 917.5f, 58.875f, 6.1015625f,
+        2.74414062f, 5.76171875f, 28.4375f, 226.375f, 16.0625f, 1.16699219f,
+        0.404052734f, 0.276855469f, 6.578125f, 68.375f, 9.53125f, 0.560546875f,
+        0.125488281f, 0.528808594f, 0.0245819092f, 15.8046875f, 69.5625f, 3.05273438f,
+        219.375f, 257.0f, 11.6015625f, 0.0824584961f, 0.0239868164f, 1.49902344f,
+        77.5625f, 5.3515625f, 30.296875f, 9.140625f, 2.59570312f, 167.75f,
+        0.00624847412f, 0.0197296143f, 0.00775909424f, 381.0f, 1605.0f, 70.4375f,
+        5.73828125f, 0.387451172f, 0.0313720703f, 461.25f, 1753.0f, 77.0625f,
+        28.390625f, 2.109375f, 0.198608398f, 0.00521850586f, 0.00526428223f, 0.0306091309f,
+        131.5f, 581.5f, 25.5f, 50.40625f, 16.84375f, 765.5f,
+        54.28125f, 15.046875f, 964.5f, 0.420654297f, 1.84765625f, 0.0823974609f,
+        531.0f, 2348.0f, 103.0f, 0.034576416f, 0.129516602f, 0.069152832f,
+        2.09375f, 1.68652344f, 0.17956543f, 7.859375f, 2.22070312f, 143.25f,
+        2116.0f, 154.125f, 1548.0f, 0.0858764648f, 0.367431641f, 0.0520019531f,
+        235.375f, 19.953125f, 27.875f, 0.0632324219f, 0.274414062f, 0.0134658813f,
+        28.75f, 8.15625f, 527.5f, 804.0f, 73.6875f, 5.79296875f,
+        0.00862884521f, 0.00394439697f, 0.0193023682f, 78.5f, 69.5f, 1234.0f,
+        187.25f, 12.7578125f, 0.944335938f, 3.1015625f, 10.9453125f, 12.4296875f,
+        25.21875f, 27.828125f, 1.25976562f, 42.8125f, 187.625f, 11.3359375f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0414733887f, 0.0414733887f, 0.0414733887f, 1.37792969f, 0.00308227539f, 0.00678253174f,
+        0.0277099609f, 1.40722656f, 0.0346679688f, 0.00778579712f, 0.00323104858f, 1.37207031f,
+        0.295410156f, -0.000877857208f, 0.0712280273f, kUndefined, kUndefined, kUndefined,
+        0.607910156f, 29.390625f, 0.817871094f, 8.2734375f, 1.10351562f, 463.0f,
+        0.0904541016f, 3.65820312f, 0.37890625f, 120.875f, 0.2734375f, 0.622558594f,
+        0.237548828f, 1.31054688f, 0.51171875f, 0.124511719f, 0.0508422852f, 20.3125f,
+        75.125f, 3776.0f, 93.0625f, 13.28125f, 0.0396728516f, 0.0660400391f,
+        0.100769043f, 1.10351562f, 0.0294342041f, 0.0400695801f, 1.19726562f, 1.8828125f,
+        45.71875f, 1378.0f, 3338.0f, 30.609375f, 1555.0f, 38.3125f,
+        0.402832031f, 6.4765625f, 0.162475586f, 2.54101562f, 128.875f, 3.17773438f,
+        14.0703125f, 2.11523438f, 0.308837891f, 0.17175293f, 8.59375f, 0.253662109f,
+        6.58203125f, 334.25f, 8.234375f, 0.0452880859f, 0.0198974609f, 7.83203125f,
+        5.78125f, 2.39453125f, 1016.5f, 1216.0f, 2.72460938f, 7.66796875f,
+        0.278320312f, 5.72265625f, 28.796875f, 299.25f, 2.33984375f, 1.51855469f,
+        0.0504455566f, 0.201171875f, 6.6796875f, 89.1875f, 5.7421875f, 0.581054688f,
+        0.0188903809f, 0.561035156f, 0.0152587891f, 1.54882812f, 73.8125f, 1.82226562f,
+        221.875f, 262.0f, 7.515625f, 0.0094833374f, 0.00439071655f, 1.5234375f,
+        100.8125f, 0.316162109f, 30.90625f, 0.967773438f, 0.402099609f, 170.5f,
+        0.00237464905f, 0.0207519531f, 0.00752639771f, 57.875f, 1702.0f, 42.0625f,
+        7.6015625f, 0.0377197266f, 0.0406799316f, 123.4375f, 1857.0f, 46.1875f,
+        37.53125f, 0.395507812f, 0.241699219f, 0.00360488892f, 0.00499725342f, 0.0310211182f,
+        12.1484375f, 617.0f, 15.2109375f, 14.7109375f, 6.6484375f, 777.5f,
+        7.85546875f, 2.33203125f, 980.0f, 0.0423583984f, 1.9609375f, 0.0497131348f,
+        49.0625f, 2492.0f, 61.4375f, 0.00580978394f, 0.136352539f, 0.0679321289f,
+        2.33007812f, 1.67578125f, 0.15612793f, 0.895019531f, 0.343994141f, 145.625f,
+        2702.0f, 9.703125f, 1576.0f, 0.00914764404f, 0.389160156f, 0.046081543f,
+        308.75f, 5.65234375f, 28.609375f, 0.00724029541f, 0.291259766f, 0.00863647461f,
+        3.06835938f, 1.26269531f, 536.0f, 1059.0f, 26.203125f, 6.75f,
+        0.00926971436f, 0.00347137451f, 0.0195617676f, 8.15625f, 56.5f, 1253.0f,
+        248.0f, 1.36035156f, 1.24414062f, 0.316650391f, 11.4453125f, 12.4296875f,
+        26.0f, 28.28125f, 0.821289062f, 4.2109375f, 199.125f, 8.0625f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0414733887f, 0.0414733887f, 0.0414733887f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.302490234f, -0.00170993805f, 0.0718994141f, kUndefined, kUndefined, kUndefined,
+        0.0297851562f, 29.53125f, 0.0960693359f, 5.79296875f, 0.000668048859f, 477.0f,
+        0.0172576904f, 3.67382812f, 0.297607422f, 124.0f, 0.00317955017f, 0.0284881592f,
+        0.214477539f, 1.31542969f, 0.492675781f, 0.0094909668f, 0.00301933289f, 20.921875f,
+        0.791503906f, 3794.0f, 0.00157642365f, 13.6171875f, 0.0100097656f, 0.000494003296f,
+        0.0810546875f, 1.10839844f, 0.00189685822f, 0.00624465942f, 1.19824219f, 1.90917969f,
+        0.00234985352f, 1377.0f, 3404.0f, 0.00541687012f, 1562.0f, 0.000467538834f,
+        0.282470703f, 6.50390625f, 0.00165653229f, 0.00280570984f, 129.5f, 0.000540733337f,
+        14.3828125f, 2.09375f, 0.194091797f, 0.00229644775f, 8.6328125f, 0.0430908203f,
+        0.0027256012f, 335.75f, 0.000794887543f, 0.000854969025f, 0.00146961212f, 8.0703125f,
+        0.0172576904f, 0.00234985352f, 1047.0f, 1247.0f, 0.0015630722f, 1.734375f,
+        0.00465393066f, 5.6796875f, 29.53125f, 307.0f, 1.67773438f, 0.00427246094f,
+        0.00915527344f, 0.186279297f, 6.875f, 91.375f, 5.56640625f, 0.00624465942f,
+        0.00803375244f, 0.563476562f, 0.00144290924f, 0.0986938477f, 74.125f, 0.00320625305f,
+        222.375f, 262.75f, 0.00291252136f, 0.000848293304f, 0.000808238983f, 1.56933594f,
+        103.25f, 0.0195007324f, 31.328125f, 0.00101470947f, 0.000821590424f, 175.625f,
+        0.00197601318f, 0.0208129883f, 0.00721740723f, 25.015625f, 1709.0f, 0.00400543213f,
+        7.796875f, 0.0208129883f, 0.0028591156f, 89.125f, 1865.0f, 0.00106811523f,
+        38.5f, 0.312988281f, 0.0508728027f, 0.0034198761f, 0.00494003296f, 0.0317993164f,
+        0.00535583496f, 619.5f, 0.00312614441f, 10.46875f, 4.81640625f, 801.0f,
+        2.35546875f, 0.0208129883f, 1009.5f, 0.00384712219f, 1.96972656f, 0.0014295578f,
+        0.00117492676f, 2504.0f, 0.000741481781f, 0.00283241272f, 0.13684082f, 0.0665283203f,
+        2.35546875f, 1.67773438f, 0.106872559f, 0.0708007812f, 0.00113487244f, 150.0f,
+        2764.0f, 0.00116157532f, 1610.0f, 0.00130939484f, 0.390869141f, 0.0375976562f,
+        316.5f, 4.91796875f, 27.78125f, 0.00153636932f, 0.292480469f, 0.001496315f,
+        0.0284881592f, 0.000834941864f, 552.0f, 1085.0f, 23.953125f, 0.982421875f,
+        0.00932312012f, 0.0034198761f, 0.0200195312f, 0.00154972076f, 53.78125f, 1289.0f,
+        254.375f, 0.809570312f, 0.00494003296f, 0.0236053467f, 11.46875f, 12.515625f,
+        26.09375f, 28.359375f, 0.000560760498f, 0.282470703f, 200.0f, 3.25f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.4140625f, 1.4140625f, 1.4140625f,
+        0.0414733887f, 0.0414733887f, 0.0414733887f, 1.4140625f, 0.0f, 0.0f,
+        0.0f, 1.4140625f, 0.0f, 0.0f, 0.0f, 1.4140625f,
+        0.302490234f, -0.00170993805f, 0.0718994141f, kUndefined, kUndefined, kUndefined,
+        0.0297851562f, 29.53125f, 0.0960693359f, 5.79296875f, 0.000668048859f, 477.0f,
+        0.0172576904f, 3.67382812f, 0.297607422f, 124.0f, 0.00317955017f, 0.0284881592f,
+        0.214477539f, 1.31542969f, 0.492675781f, 0.0094909668f, 0.00301933289f, 20.921875f,
+        0.791503906f, 3794.0f, 0.00157642365f, 13.6171875f, 0.0100097656f, 0.000494003296f,
+        0.0810546875f, 1.10839844f, 0.00189685822f, 0.00624465942f, 1.19824219f, 1.90917969f,
+        0.00234985352f, 1377.0f, 3404.0f, 0.00541687012f, 1562.0f, 0.000467538834f,
+        0.282470703f, 6.50390625f, 0.00165653229f, 0.00280570984f, 129.5f, 0.000540733337f,
+        14.3828125f, 2.09375f, 0.194091797f, 0.00229644775f, 8.6328125f, 0.0430908203f,
+        0.0027256012f, 335.75f, 0.000794887543f, 0.000854969025f, 0.00146961212f, 8.0703125f,
+        0.0172576904f, 0.00234985352f, 1047.0f, 1247.0f, 0.0015630722f, 1.734375f,
+        0.00465393066f, 5.6796875f, 29.53125f, 307.0f, 1.67773438f, 0.00427246094f,
+        0.00915527344f, 0.186279297f, 6.875f, 91.375f, 5.56640625f, 0.00624465942f,
+        0.00803375244f, 0.563476562f, 0.00144290924f, 0.0986938477f, 74.125f, 0.00320625305f,
+        222.375f, 262.75f, 0.00291252136f, 0.000848293304f, 0.000808238983f, 1.56933594f,
+        103.25f, 0.0195007324f, 31.328125f, 0.00101470947f, 0.000821590424f, 175.625f,
+        0.00197601318f, 0.0208129883f, 0.00721740723f, 25.015625f, 1709.0f, 0.00400543213f,
+        7.796875f, 0.0208129883f, 0.0028591156f, 89.125f, 1865.0f, 0.00106811523f,
+        38.5f, 0.312988281f, 0.0508728027f, 0.0034198761f, 0.00494003296f, 0.0317993164f,
+        0.00535583496f, 619.5f, 0.00312614441f, 10.46875f, 4.81640625f, 801.0f,
+        2.35546875f, 0.0208129883f, 1009.5f, 0.00384712219f, 1.96972656f, 0.0014295578f,
+        0.00117492676f, 2504.0f, 0.000741481781f, 0.00283241272f, 0.13684082f, 0.0665283203f,
+        2.35546875f, 1.67773438f, 0.106872559f, 0.0708007812f, 0.00113487244f, 150.0f,
+        2764.0f, 0.00116157532f, 1610.0f, 0.00130939484f, 0.390869141f, 0.0375976562f,
+        316.5f, 4.91796875f, 27.78125f, 0.00153636932f, 0.292480469f, 0.001496315f,
+        0.0284881592f, 0.000834941864f, 552.0f, 1085.0f, 23.953125f, 0.982421875f,
+        0.00932312012f, 0.0034198761f, 0.0200195312f, 0.00154972076f, 53.78125f, 1289.0f,
+        254.375f, 0.809570312f, 0.00494003296f, 0.0236053467f, 11.46875f, 12.515625f,
+        26.09375f, 28.359375f, 0.000560760498f, 0.282470703f, 200.0f, 3.25f,
+    },
+};
+
+// Display RGB values of test pixels as graded values in cases of getPresentCase().
+const float kPresentReference[kPresentCaseNum][kTestPixelNum * 3] = {
+    {
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.467246979f, 0.467246026f, 0.467246473f, 1.27448654f, 0.0f, 0.0f,
+        0.0f, 1.0617075f, 0.0f, 0.0f, 0.0f, 1.06684041f,
+        0.91965282f, 0.0f, 0.557237387f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.0f, 1.05175173f, 0.481770188f, 1.24448586f, 0.0f, 1.05635202f,
+        0.0f, 1.05321085f, 0.688755393f, 1.26398742f, 0.0f, 0.419478714f,
+        0.301618308f, 1.01936531f, 0.783994615f, 0.201477259f, 0.128754899f, 1.06457198f,
+        0.847990334f, 1.01794529f, 0.0f, 1.25751209f, 0.0f, 0.0f,
+        0.0f, 0.995514154f, 0.0f, 0.0f, 1.01925683f, 1.01430738f,
+        0.0f, 1.05604339f, 1.01060855f, 0.0f, 1.05899382f, 0.0f,
+        0.484243035f, 1.0345329f, 0.0f, 0.0f, 1.06027174f, 0.0f,
+        1.02217603f, 1.00284088f, 0.59186691f, 0.0f, 1.05969405f, 0.336743385f,
+        0.0f, 1.06030178f, 0.0f, 0.0f, 0.0789626762f, 1.06603277f,
+        0.345532447f, 0.0f, 1.06452847f, 1.24270642f, 0.0f, 1.05590296f,
+        0.0f, 1.05487823f, 1.01038218f, 1.03560519f, 1.00459361f, 0.0f,
+        0.0f, 0.684493721f, 1.04419065f, 1.03502023f, 1.00451672f, 0.0f,
+        0.0f, 0.87670517f, 0.0f, 0.0f, 1.04528105f, 0.0f,
+        1.036057f, 1.00465286f, 0.0f, 0.0f, 0.0f, 1.06636143f,
+        1.21896255f, 0.0f, 1.04996347f, 0.0f, 0.0f, 1.06633937f,
+        0.0f, 0.411554754f, 0.266886055f, 1.03569388f, 1.00460529f, 0.0f,
+        1.24656069f, 0.145030349f, 0.0f, 1.0366677f, 1.0047332f, 0.0f,
+        1.15456688f, 0.693399847f, 0.424038529f, 0.133193016f, 0.245391667f, 0.459077716f,
+        0.0f, 1.0589118f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.21787369f, 0.0815019459f, 1.04969335f, 0.0f, 1.05970979f, 0.0f,
+        0.0f, 1.0610851f, 0.0f, 0.0f, 0.648949623f, 0.514766574f,
+        1.02591157f, 1.00332606f, 0.479319572f, 0.606821477f, 0.0f, 1.06376815f,
+        1.24350357f, 0.0f, 1.05610406f, 0.0f, 0.815389633f, 0.39847061f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.768014431f, 0.0f,
+        0.448980391f, 0.0f, 1.06488645f, 1.00559986f, 1.00071025f, 0.918216169f,
+        0.348642796f, 0.185430974f, 0.405350894f, 0.0f, 1.05644941f, 1.01068747f,
+        1.09277582f, 0.88299799f, 0.0f, 0.0f, 1.04962933f, 1.00936604f,
+        1.03683579f, 1.00475538f, 0.0f, 0.382661551f, 1.02998745f, 1.00560677f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.467246979f, 0.467246026f, 0.467246473f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.729740858f, 0.729739308f, 0.729740024f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.430085689f, 0.430084795f, 0.430085182f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.371597081f, 0.371596307f, 0.371596664f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.678342283f, 0.678340912f, 0.678341508f, 0.31025964f, 0.310258955f, 0.310259283f,
+        0.889784098f, 0.88978219f, 0.889783025f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.54739964f, 0.547398508f, 0.547399044f, 0.26795876f, 0.267958194f, 0.267958492f,
+        0.174531773f, 0.1745314f, 0.174531579f, 0.253478706f, 0.25347814f, 0.253478378f,
+        0.719285429f, 0.719283879f, 0.719284594f, 0.189121604f, 0.189121187f, 0.189121366f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.172717407f, 0.172717094f, 0.172717243f,
+        0.186646059f, 0.186645642f, 0.186645836f, 0.110199012f, 0.110198773f, 0.1101989f,
+        0.371597081f, 0.371596307f, 0.371596664f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.237930506f, 0.23793003f, 0.237930268f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.306617945f, 0.30661729f, 0.306617618f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.293442339f, 0.293441743f, 0.293442011f, 0.572329938f, 0.572328746f, 0.572329283f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.109806858f, 0.109806634f, 0.109806724f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.119152233f, 0.119151972f, 0.119152091f,
+        0.161313057f, 0.161312699f, 0.161312848f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.20693852f, 0.206938073f, 0.206938282f,
+        0.252323329f, 0.252322823f, 0.252323031f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.218319491f, 0.218319044f, 0.218319222f,
+        0.127362818f, 0.127362564f, 0.127362669f, 0.189938158f, 0.18993777f, 0.189937949f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.530626059f, 0.530624926f, 0.530625463f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.133748725f, 0.133748472f, 0.133748576f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.143836036f, 0.143835723f, 0.143835858f,
+        0.42516458f, 0.425163686f, 0.425164104f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.308445245f, 0.308444589f, 0.308444887f, 0.144403219f, 0.144402891f, 0.14440307f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.404757589f, 0.404756784f, 0.404757142f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.719285429f, 0.719283879f, 0.719284594f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.467246979f, 0.467246026f, 0.467246473f, 0.0f, 0.0f, 0.0f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0985022038f, 0.0985019952f, 0.0985020921f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.200193092f, 0.20019266f, 0.200192854f,
+        0.985673428f, 0.985671341f, 0.985672295f, 0.195540234f, 0.195539817f, 0.195540011f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.315627992f, 0.315627307f, 0.315627635f,
+        0.952485979f, 0.952483952f, 0.952484906f, 0.967404723f, 0.967402637f, 0.96740365f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.140958935f, 0.140958652f, 0.140958756f,
+        0.174531773f, 0.1745314f, 0.174531579f, 0.14496772f, 0.144967422f, 0.144967571f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.658182025f, 0.658180654f, 0.65818131f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.830206811f, 0.830205083f, 0.830205917f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.107417643f, 0.107417412f, 0.107417539f,
+        0.384435266f, 0.384434432f, 0.384434819f, 0.108221099f, 0.108220868f, 0.108220957f,
+        0.39135021f, 0.391349405f, 0.391349792f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.39135021f, 0.391349405f, 0.391349792f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.734901726f, 0.734900177f, 0.734900892f, 0.244051427f, 0.24405095f, 0.244051144f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.39135021f, 0.391349405f, 0.391349792f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.615462601f, 0.615461409f, 0.615461886f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.125370547f, 0.125370279f, 0.125370383f,
+        0.12670289f, 0.126702607f, 0.126702771f, 0.769874215f, 0.769872665f, 0.769873321f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.724535763f, 0.724534214f, 0.724534929f,
+        0.109017424f, 0.109017208f, 0.109017298f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.20693852f, 0.206938073f, 0.206938282f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.893858194f, 0.893856347f, 0.893857181f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.467246979f, 0.467246026f, 0.467246473f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.532521188f, 0.532520056f, 0.532520533f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.56884855f, 0.568847418f, 0.568847895f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.727143884f, 0.727142394f, 0.727143109f, 0.42516458f, 0.425163686f, 0.425164104f,
+        0.807641447f, 0.807639778f, 0.807640493f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.145529613f, 0.1455293f, 0.145529449f, 0.0859025121f, 0.0859023333f, 0.0859024152f,
+        0.158306882f, 0.158306539f, 0.158306703f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0837598816f, 0.0837597027f, 0.0837597772f,
+        0.148847684f, 0.148847386f, 0.14884752f, 0.0895052105f, 0.0895050168f, 0.0895050988f,
+        0.664017141f, 0.66401577f, 0.664016366f, 0.471646786f, 0.471645862f, 0.471646279f,
+        0.10660693f, 0.1066067f, 0.106606819f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.229029506f, 0.229029015f, 0.229029253f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.26795876f, 0.267958194f, 0.267958492f,
+        0.139788151f, 0.139787853f, 0.139787987f, 0.200956032f, 0.200955585f, 0.200955793f,
+        0.192362994f, 0.192362666f, 0.192362815f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.282569259f, 0.282568693f, 0.282568932f, 0.222408324f, 0.222407877f, 0.222408056f,
+        0.190750554f, 0.190750182f, 0.190750375f, 0.121962912f, 0.121962667f, 0.121962763f,
+        0.490864128f, 0.490863085f, 0.490863562f, 0.437343121f, 0.437342197f, 0.437342674f,
+        0.198656648f, 0.198656261f, 0.198656425f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.139198318f, 0.139198065f, 0.139198184f,
+        0.103287384f, 0.10328716f, 0.103287265f, 0.522963107f, 0.522962034f, 0.522962451f,
+        0.582624674f, 0.582623541f, 0.582624018f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.456023753f, 0.456022829f, 0.456023216f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.142118171f, 0.142117873f, 0.142117992f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.929567039f, 0.929565132f, 0.929565966f,
+        0.387219042f, 0.387218207f, 0.387218595f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.244051427f, 0.24405095f, 0.244051144f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.0909970924f, 0.0909968913f, 0.0909969807f, 1.00000095f, 0.999998748f, 0.999999821f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.467246979f, 0.467246026f, 0.467246473f, 0.553544104f, 0.553543031f, 0.553543508f,
+        0.83587718f, 0.835875511f, 0.835876226f, 0.264653474f, 0.264652908f, 0.264653116f,
+        0.407819211f, 0.407818347f, 0.407818735f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.904819727f, 0.904817879f, 0.904818714f, 0.492445022f, 0.492444009f, 0.492444456f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.891472936f, 0.891471148f, 0.891471982f,
+        0.838566244f, 0.838564515f, 0.83856529f, 0.851960301f, 0.851958513f, 0.851959288f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.388980985f, 0.38898024f, 0.388980567f,
+        0.968118548f, 0.968116641f, 0.968117535f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.655839264f, 0.655837893f, 0.65583849f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.707222819f, 0.707221329f, 0.707221985f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.285211653f, 0.285211027f, 0.285211325f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.679249883f, 0.679248512f, 0.679249108f,
+        0.341091752f, 0.341091067f, 0.341091365f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.826157808f, 0.82615608f, 0.826156855f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.250301361f, 0.250300854f, 0.250301063f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.898228943f, 0.898227036f, 0.89822787f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.534124136f, 0.534123063f, 0.5341236f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.707526147f, 0.707524717f, 0.707525373f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.653304219f, 0.653302789f, 0.653303504f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.609388232f, 0.609386861f, 0.609387517f,
+        0.863707364f, 0.863705516f, 0.86370641f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.251977295f, 0.251976818f, 0.251977026f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.732345283f, 0.732343793f, 0.732344449f, 0.787850499f, 0.78784883f, 0.787849605f,
+        0.932308078f, 0.93230617f, 0.932307065f, 0.558491826f, 0.558490694f, 0.55849123f,
+        0.689185202f, 0.689183712f, 0.689184427f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.961839259f, 0.961837113f, 0.961838126f, 0.749331176f, 0.749329627f, 0.749330342f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.956255198f, 0.956253231f, 0.956254125f,
+        0.933493018f, 0.933491111f, 0.933492005f, 0.939353764f, 0.939351797f, 0.939352691f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.674442649f, 0.674441218f, 0.674441934f,
+        0.987526715f, 0.987524748f, 0.987525642f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.845544219f, 0.84554255f, 0.845543325f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.871965528f, 0.871963739f, 0.871964574f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.580535531f, 0.580534339f, 0.580534935f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.857769251f, 0.857767403f, 0.857768238f,
+        0.634128809f, 0.634127498f, 0.634128034f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.928001285f, 0.927999377f, 0.928000271f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.542174459f, 0.542173326f, 0.542173862f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.959089339f, 0.959087372f, 0.959088326f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.775983453f, 0.775981784f, 0.775982559f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.872117221f, 0.872115433f, 0.872116148f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.84420079f, 0.844199061f, 0.844199836f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.82027024f, 0.820268571f, 0.820269406f,
+        0.94443804f, 0.944436073f, 0.944436967f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.544123054f, 0.544121861f, 0.544122398f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+    },
+    {
+        0.729740858f, 0.729739308f, 0.729740024f, 0.73072809f, 0.73072654f, 0.730727255f,
+        0.730306089f, 0.730304539f, 0.730305254f, 0.984334826f, 0.98433274f, 0.984333694f,
+        0.0f, 0.0f, 0.0f, 0.920288682f, 0.920286775f, 0.920287669f,
+        0.959001184f, 0.958999217f, 0.95900017f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.552955389f, 0.552954197f, 0.552954674f, 0.985213578f, 0.985211432f, 0.985212445f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.369501233f, 0.369500458f, 0.369500816f, 0.420743287f, 0.420742452f, 0.420742869f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.875438571f, 0.875436664f, 0.875437498f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.956925273f, 0.956923306f, 0.95692414f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.452276289f, 0.452275425f, 0.452275813f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.759075105f, 0.759073555f, 0.759074211f, 0.969877243f, 0.969875157f, 0.969876111f,
+        0.0962250009f, 0.0962247923f, 0.0962248743f, 0.0f, 0.0f, 0.0f,
+        0.572432995f, 0.572431803f, 0.572432339f, 0.914393425f, 0.914391518f, 0.914392352f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.56450361f, 0.564502478f, 0.564502954f, 0.0f, 0.0f, 0.0f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.752116978f, 0.752115369f, 0.752116084f,
+        0.0f, 0.0f, 0.0f, 0.999885976f, 0.999883831f, 0.999884784f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.471382946f, 0.471381903f, 0.47138235f,
+        0.725578785f, 0.725577235f, 0.725577891f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.188598305f, 0.188597932f, 0.188598096f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.80520308f, 0.805201471f, 0.805202246f, 0.628115892f, 0.628114581f, 0.628115177f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        0.632984579f, 0.632983267f, 0.632983863f, 0.0f, 0.0f, 0.0f,
+    },
+    {
+        0.729740858f, 0.729739308f, 0.729740024f, 0.742622554f, 0.742620945f, 0.74262166f,
+        0.737146854f, 0.737145364f, 0.73714608f, 0.967420042f, 0.967418015f, 0.967418969f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.211306959f, 0.211306497f, 0.211306706f,
+        0.678846598f, 0.678845167f, 0.678845823f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        0.848069191f, 0.848067462f, 0.848068237f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.776961148f, 0.776959538f, 0.776960313f, 0.0f, 0.0f, 0.0f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.991590917f, 0.991588891f, 0.991589785f, 0.657610714f, 0.657609344f, 0.657609999f,
+        0.337198555f, 0.33719784f, 0.337198168f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.927278817f, 0.927276909f, 0.927277744f, 0.975430071f, 0.975428164f, 0.975429058f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.486144811f, 0.486143798f, 0.486144245f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.375071138f, 0.375070363f, 0.375070751f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.960939944f, 0.960938036f, 0.960938931f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.225141913f, 0.225141466f, 0.225141689f,
+        0.577263474f, 0.577262282f, 0.577262878f, 0.0f, 0.0f, 0.0f,
+        0.763762534f, 0.763760984f, 0.763761699f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.995850444f, 0.995848358f, 0.995849252f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.978298187f, 0.978296101f, 0.978297055f, 0.634377599f, 0.634376287f, 0.634376943f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.742041171f, 0.74203968f, 0.742040336f,
+        0.898950517f, 0.898948669f, 0.898949504f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.817300737f, 0.817299008f, 0.817299724f,
+        0.784207702f, 0.784206092f, 0.784206748f, 0.930289149f, 0.930287242f, 0.930288076f,
+        0.0f, 0.0f, 0.0f, 1.00000095f, 0.999998748f, 0.999999821f,
+        0.66278553f, 0.662784219f, 0.662784874f, 0.0f, 0.0f, 0.0f,
+        1.00000095f, 0.999998748f, 0.999999821f, 0.669123769f, 0.669122398f, 0.669123054f,
+        1.00000095f, 0.999998748f, 0.999999821f, 1.00000095f, 0.999998748f, 0.999999821f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527244f, 0.807525635f, 0.80752635f,
+        0.366292924f, 0.366292298f, 0.366292804f, 0.956145644f, 0.0f, 0.023452092f,
+        0.0f, 0.846067309f, 0.0f, 0.0f, 0.0f, 0.848368943f,
+        0.776124418f, 0.0f, 0.452090949f, 0.97561717f, 0.973539114f, 0.971107185f,
+        0.0f, 0.976707101f, 0.517275214f, 1.08300126f, 0.0f, 1.006917f,
+        0.0f, 0.908148944f, 0.632563889f, 1.17230201f, 0.0f, 0.384177536f,
+        0.445854038f, 0.818819821f, 0.697783053f, 0.0f, 0.0299956501f, 0.983155251f,
+        0.816473722f, 0.983436465f, 0.735323429f, 1.12122309f, 0.0f, 0.0674899817f,
+        0.0f, 0.812836528f, 0.0f, 0.0f, 0.827665508f, 0.834454954f,
+        0.377185762f, 0.994961381f, 0.973871708f, 0.425275177f, 0.997297525f, 0.624560118f,
+        0.487929314f, 0.920625865f, 0.0f, 0.0f, 0.999478042f, 0.256004781f,
+        0.974216223f, 0.832230091f, 0.585867524f, 0.0f, 0.950787127f, 0.364764243f,
+        0.0f, 1.00221634f, 0.40711996f, 0.0f, 0.0f, 0.955409765f,
+        0.229587212f, 0.0944084898f, 1.02178657f, 1.14043331f, 0.441131681f, 0.858928859f,
+        0.0f, 0.930844784f, 0.945340693f, 1.04607201f, 0.831394076f, 0.22409682f,
+        0.0f, 0.598521888f, 0.924837649f, 1.00874949f, 0.890012145f, 0.196242422f,
+        0.0f, 0.749949872f, 0.0f, 0.198960498f, 0.983740151f, 0.228143051f,
+        0.983665645f, 0.964715838f, 0.499713778f, 0.0f, 0.0f, 0.85723865f,
+        1.14386082f, 0.209915236f, 0.972158074f, 0.0f, 0.0f, 1.01581597f,
+        0.0f, 0.292502165f, 0.159128487f, 0.939406455f, 0.974803865f, 0.669933319f,
+        1.08625662f, 0.156094313f, 0.0804406554f, 0.962695539f, 0.973460436f, 0.679515243f,
+        1.06850767f, 0.646654606f, 0.409776419f, 0.0f, 0.134806991f, 0.340033799f,
+        0.0f, 1.0005523f, 0.517430007f, 0.924604118f, 0.882561564f, 0.974719226f,
+        1.00189459f, 0.19971326f, 1.0066793f, 0.0f, 0.871946514f, 0.0f,
+        0.50441426f, 0.995945156f, 0.684606254f, 0.0f, 0.555664957f, 0.423135698f,
+        0.874306321f, 0.820122302f, 0.490135103f, 0.487592071f, 0.0f, 1.00887549f,
+        1.13967478f, 0.424108475f, 0.999842882f, 0.0f, 0.705368102f, 0.324768394f,
+        0.998614788f, 0.884956002f, 0.940879464f, 0.0f, 0.666661024f, 0.0f,
+        0.323850334f, 0.0f, 1.01929474f, 0.993511796f, 0.935005069f, 0.805118561f,
+        0.21662423f, 0.0903629735f, 0.28263396f, 0.0f, 0.987953365f, 0.974657714f,
+        1.06445837f, 0.776040435f, 0.198015109f, 0.0f, 0.953239501f, 0.921616673f,
+        0.964066327f, 0.940540195f, 0.104176193f, 0.535399973f, 0.982383132f, 0.871456504f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527244f, 0.807525635f, 0.80752635f,
+        0.366292983f, 0.366292268f, 0.366292566f, 0.753820121f, 0.753818512f, 0.753819227f,
+        0.216700599f, 0.216700137f, 0.21670039f, 0.067969732f, 0.067969583f, 0.06796965f,
+        0.617810369f, 0.617809057f, 0.617809594f, 0.974699616f, 0.97469759f, 0.974698544f,
+        0.477983832f, 0.477982849f, 0.477983266f, 0.879928648f, 0.879926741f, 0.879927635f,
+        0.365779638f, 0.365778863f, 0.365779191f, 0.939988673f, 0.939986646f, 0.9399876f,
+        0.615567148f, 0.615565896f, 0.615566432f, 0.209392473f, 0.209392026f, 0.209392235f,
+        0.874136746f, 0.874134958f, 0.874135792f, 0.894162774f, 0.894160926f, 0.89416182f,
+        0.492283136f, 0.492282122f, 0.492282629f, 0.273890823f, 0.273890257f, 0.273890555f,
+        0.697188556f, 0.697187066f, 0.697187781f, 0.694057047f, 0.694055617f, 0.694056332f,
+        0.665248096f, 0.665246665f, 0.665247262f, 0.438381195f, 0.438380331f, 0.438380718f,
+        0.913818538f, 0.913816631f, 0.913817465f, 0.288811952f, 0.288811386f, 0.288811654f,
+        0.524015069f, 0.524013996f, 0.524014473f, 0.0915346071f, 0.0915344134f, 0.0915345103f,
+        0.309282601f, 0.309281975f, 0.309282243f, 0.957379401f, 0.957377434f, 0.957378328f,
+        0.311248124f, 0.311247468f, 0.311247766f, 0.955595016f, 0.95559299f, 0.955593884f,
+        0.250874221f, 0.250873685f, 0.250873953f, 0.947937965f, 0.947935939f, 0.947936833f,
+        0.258916765f, 0.258916199f, 0.258916467f, 0.618022025f, 0.618020713f, 0.618021309f,
+        0.960572302f, 0.960570335f, 0.96057117f, 0.0811553076f, 0.0811551362f, 0.0811552033f,
+        0.943316102f, 0.943314135f, 0.943315089f, 0.116547316f, 0.116547085f, 0.116547182f,
+        0.103151768f, 0.103151552f, 0.103151649f, 0.941081226f, 0.941079319f, 0.941080153f,
+        0.872830987f, 0.872829139f, 0.872829974f, 0.955242693f, 0.955240726f, 0.955241621f,
+        0.92684859f, 0.926846623f, 0.926847458f, 0.110045202f, 0.110044986f, 0.11004509f,
+        0.60244f, 0.602438748f, 0.602439284f, 0.913084567f, 0.913082659f, 0.913083553f,
+        0.835575342f, 0.835573614f, 0.835574389f, 0.258093238f, 0.258092701f, 0.25809294f,
+        0.725162923f, 0.725161433f, 0.725162148f, 0.168314442f, 0.168314084f, 0.168314278f,
+        0.842333078f, 0.84233129f, 0.842332125f, 0.44550541f, 0.445504546f, 0.445504904f,
+        0.961013675f, 0.961011708f, 0.961012602f, 0.188205168f, 0.188204765f, 0.188204944f,
+        0.959062278f, 0.959060192f, 0.959061146f, 0.178591043f, 0.178590655f, 0.178590789f,
+        0.348683327f, 0.348682612f, 0.34868294f, 0.965966165f, 0.965964139f, 0.965965033f,
+        0.189813197f, 0.189812779f, 0.189812988f, 0.409908533f, 0.409907669f, 0.409908056f,
+        0.952816486f, 0.952814519f, 0.952815413f, 0.431197494f, 0.43119657f, 0.431196958f,
+        0.935066938f, 0.935064971f, 0.935065925f, 0.740662634f, 0.740661025f, 0.7406618f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527363f, 0.807525635f, 0.80752635f,
+        0.366293073f, 0.366292328f, 0.366292655f, 0.142210692f, 0.142210394f, 0.142210558f,
+        0.799437106f, 0.799435377f, 0.799436152f, 0.0679698065f, 0.0679696724f, 0.067969732f,
+        0.11340379f, 0.113403551f, 0.113403663f, 0.97365433f, 0.973652303f, 0.973653197f,
+        0.932554185f, 0.932552278f, 0.932553172f, 0.210422114f, 0.210421622f, 0.210421875f,
+        0.864190519f, 0.864188731f, 0.864189565f, 0.34055686f, 0.340556145f, 0.340556473f,
+        0.797744751f, 0.797743142f, 0.797743917f, 0.132901043f, 0.13290076f, 0.132900923f,
+        0.969946086f, 0.96994406f, 0.969945014f, 0.301940292f, 0.301939666f, 0.301939934f,
+        0.780696571f, 0.780694902f, 0.780695677f, 0.787249506f, 0.787247896f, 0.787248671f,
+        0.966197431f, 0.966195345f, 0.966196299f, 0.965844452f, 0.965842426f, 0.965843379f,
+        0.892138064f, 0.892136157f, 0.892136991f, 0.951085448f, 0.951083481f, 0.951084316f,
+        0.840443254f, 0.840441465f, 0.8404423f, 0.900252402f, 0.900250494f, 0.900251389f,
+        0.958280325f, 0.958278298f, 0.958279252f, 0.0998490527f, 0.099848859f, 0.0998489559f,
+        0.176265076f, 0.176264718f, 0.176264882f, 0.537094712f, 0.537093639f, 0.537094176f,
+        0.885553956f, 0.885552108f, 0.885552943f, 0.843924761f, 0.843923032f, 0.843923867f,
+        0.574921966f, 0.574920774f, 0.57492137f, 0.89376539f, 0.893763542f, 0.893764377f,
+        0.710565984f, 0.710564435f, 0.71056515f, 0.946677566f, 0.946675658f, 0.946676552f,
+        0.961546004f, 0.961544037f, 0.961544931f, 0.0805973113f, 0.0805971399f, 0.0805971995f,
+        0.404514343f, 0.404513478f, 0.404513896f, 0.113847829f, 0.113847584f, 0.113847718f,
+        0.277574182f, 0.277573645f, 0.277573884f, 0.969005525f, 0.969003558f, 0.969004512f,
+        0.350576818f, 0.350576043f, 0.350576401f, 0.969448388f, 0.969446361f, 0.969447374f,
+        0.684471548f, 0.684470057f, 0.684470773f, 0.135552213f, 0.135551915f, 0.135552064f,
+        0.961848617f, 0.96184665f, 0.961847484f, 0.88690418f, 0.886902273f, 0.886903167f,
+        0.367603958f, 0.367603213f, 0.36760357f, 0.824824274f, 0.824822545f, 0.82482332f,
+        0.967373252f, 0.967371225f, 0.967372179f, 0.52704221f, 0.527041078f, 0.527041614f,
+        0.820679545f, 0.820677757f, 0.820678532f, 0.137521341f, 0.137521043f, 0.137521163f,
+        0.52850914f, 0.528508008f, 0.528508604f, 0.667334914f, 0.667333543f, 0.667334139f,
+        0.894277871f, 0.894275963f, 0.894276857f, 0.630125523f, 0.630124152f, 0.630124807f,
+        0.142827034f, 0.142826706f, 0.142826855f, 0.937660992f, 0.937659085f, 0.93765986f,
+        0.110674389f, 0.11067415f, 0.110674255f, 0.942613184f, 0.942611277f, 0.942612112f,
+        0.796085f, 0.796083272f, 0.796083987f, 0.910922229f, 0.910920322f, 0.910921156f,
+        0.936502039f, 0.936500132f, 0.936500967f, 0.957517564f, 0.957515597f, 0.957516432f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527363f, 0.807525635f, 0.80752635f,
+        0.366293222f, 0.366292417f, 0.366292775f, 0.1385919f, 0.138591617f, 0.138591737f,
+        0.216700494f, 0.216700062f, 0.216700241f, 0.795431495f, 0.795429885f, 0.795430541f,
+        0.433994681f, 0.433993787f, 0.433994174f, 0.971468329f, 0.971466362f, 0.971467316f,
+        0.58153969f, 0.581538498f, 0.581539035f, 0.953197896f, 0.95319587f, 0.953196824f,
+        0.659418046f, 0.659416676f, 0.659417272f, 0.401549429f, 0.401548624f, 0.401548982f,
+        0.708249331f, 0.7082479f, 0.708248615f, 0.922554672f, 0.922552824f, 0.922553658f,
+        0.768987298f, 0.768985689f, 0.768986344f, 0.192347988f, 0.192347586f, 0.192347735f,
+        0.235796168f, 0.235795707f, 0.23579593f, 0.822027385f, 0.822025716f, 0.822026551f,
+        0.968200445f, 0.968198419f, 0.968199313f, 0.674775302f, 0.674773932f, 0.674774528f,
+        0.291760743f, 0.291760117f, 0.291760385f, 0.418124139f, 0.418123305f, 0.418123692f,
+        0.629230499f, 0.629229248f, 0.629229844f, 0.463771701f, 0.463770688f, 0.463771164f,
+        0.509642959f, 0.509641886f, 0.509642363f, 0.895972669f, 0.895970821f, 0.895971656f,
+        0.959697187f, 0.959695101f, 0.959696054f, 0.832508504f, 0.832506716f, 0.83250761f,
+        0.93059957f, 0.930597723f, 0.930598557f, 0.393011451f, 0.393010646f, 0.393011034f,
+        0.885060012f, 0.885058165f, 0.885059059f, 0.395584136f, 0.395583272f, 0.39558363f,
+        0.201642469f, 0.201642051f, 0.20164226f, 0.409102023f, 0.409101188f, 0.409101546f,
+        0.587386072f, 0.58738482f, 0.587385356f, 0.803839684f, 0.803838074f, 0.803838849f,
+        0.928129137f, 0.928127289f, 0.928128064f, 0.952714503f, 0.952712536f, 0.95271349f,
+        0.176484033f, 0.176483646f, 0.17648387f, 0.717599869f, 0.717598438f, 0.717599094f,
+        0.203049943f, 0.203049511f, 0.203049704f, 0.725745738f, 0.725744188f, 0.725744903f,
+        0.467848957f, 0.467847914f, 0.46784842f, 0.321476936f, 0.321476281f, 0.321476638f,
+        0.589842319f, 0.589841068f, 0.589841604f, 0.964121401f, 0.964119434f, 0.964120269f,
+        0.95636946f, 0.956367373f, 0.956368327f, 0.237322107f, 0.237321585f, 0.237321824f,
+        0.723798573f, 0.723797023f, 0.723797798f, 0.432885826f, 0.432884961f, 0.432885379f,
+        0.549019158f, 0.549018025f, 0.549018502f, 0.948064208f, 0.948062241f, 0.948063135f,
+        0.959760308f, 0.959758282f, 0.959759176f, 0.380770892f, 0.380770117f, 0.380770475f,
+        0.936190963f, 0.936188996f, 0.93618989f, 0.178258464f, 0.178258136f, 0.178258285f,
+        0.957159042f, 0.957157075f, 0.95715791f, 0.824888587f, 0.824886858f, 0.824887753f,
+        0.268082082f, 0.268081516f, 0.268081784f, 0.963213027f, 0.963211f, 0.963211834f,
+        0.368247211f, 0.368246436f, 0.368246764f, 0.913303435f, 0.913301528f, 0.913302362f,
+        0.382571399f, 0.382570595f, 0.382570982f, 0.879137158f, 0.87913537f, 0.879136145f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527363f, 0.807525635f, 0.80752635f,
+        0.366293073f, 0.366292298f, 0.366292655f, 0.429916948f, 0.429916054f, 0.429916441f,
+        0.67648077f, 0.67647934f, 0.676479995f, 0.21788767f, 0.217887208f, 0.217887431f,
+        0.364433736f, 0.364432961f, 0.364433289f, 0.973821819f, 0.973819852f, 0.973820686f,
+        0.82104063f, 0.821038902f, 0.821039617f, 0.556671977f, 0.556670845f, 0.556671381f,
+        0.755849898f, 0.755848289f, 0.755849063f, 0.585336626f, 0.585335493f, 0.58533597f,
+        0.748540163f, 0.748538613f, 0.748539329f, 0.281813145f, 0.281812578f, 0.281812847f,
+        0.935186386f, 0.93518436f, 0.935185313f, 0.544587731f, 0.544586599f, 0.544587135f,
+        0.695957959f, 0.695956528f, 0.695957184f, 0.694842756f, 0.694841206f, 0.694841981f,
+        0.902561903f, 0.902560055f, 0.90256089f, 0.887438893f, 0.887437165f, 0.887437999f,
+        0.81582433f, 0.815822721f, 0.815823495f, 0.825557768f, 0.82555598f, 0.825556755f,
+        0.85171932f, 0.851717532f, 0.851718307f, 0.769914865f, 0.769913256f, 0.769913912f,
+        0.845698953f, 0.845697224f, 0.845697999f, 0.25107792f, 0.251077384f, 0.251077652f,
+        0.325133026f, 0.325132281f, 0.325132608f, 0.699080944f, 0.699079514f, 0.699080169f,
+        0.78228128f, 0.78227967f, 0.782280385f, 0.859817088f, 0.859815359f, 0.859816134f,
+        0.535890996f, 0.535889864f, 0.5358904f, 0.890863955f, 0.890862048f, 0.890862882f,
+        0.606949806f, 0.606948495f, 0.606949091f, 0.850046813f, 0.850045025f, 0.85004586f,
+        0.945591331f, 0.945589364f, 0.945590198f, 0.223288238f, 0.223287761f, 0.223287985f,
+        0.641867518f, 0.641866148f, 0.641866744f, 0.270482123f, 0.270481586f, 0.270481825f,
+        0.239788324f, 0.239787817f, 0.239788055f, 0.949873507f, 0.9498716f, 0.949872434f,
+        0.552050531f, 0.552049458f, 0.552049994f, 0.95432812f, 0.954326153f, 0.954327047f,
+        0.751363099f, 0.751361668f, 0.751362264f, 0.147547603f, 0.14754729f, 0.147547424f,
+        0.863942742f, 0.863940954f, 0.863941669f, 0.898431361f, 0.898429453f, 0.898430288f,
+        0.584280908f, 0.584279776f, 0.584280312f, 0.700772643f, 0.700771153f, 0.700771809f,
+        0.896971822f, 0.896970034f, 0.896970868f, 0.457077503f, 0.45707655f, 0.457076967f,
+        0.814885855f, 0.814884245f, 0.81488502f, 0.354738265f, 0.35473755f, 0.354737848f,
+        0.705519497f, 0.705518007f, 0.705518723f, 0.569852948f, 0.569851816f, 0.569852352f,
+        0.914717257f, 0.914715409f, 0.914716244f, 0.533869624f, 0.533868551f, 0.533869028f,
+        0.32591635f, 0.325915664f, 0.325915992f, 0.939881742f, 0.939879775f, 0.939880729f,
+        0.1496488f, 0.149648488f, 0.149648607f, 0.838983238f, 0.83898139f, 0.838982165f,
+        0.827256382f, 0.827254713f, 0.827255487f, 0.813928843f, 0.813927114f, 0.813927889f,
+        0.916181564f, 0.916179717f, 0.916180551f, 0.900334835f, 0.900332928f, 0.900333762f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.919639766f, 0.919637799f, 0.919638634f,
+        0.655889571f, 0.655888259f, 0.655888855f, 0.705790043f, 0.705788612f, 0.705789268f,
+        0.856339991f, 0.856338203f, 0.856339097f, 0.501895308f, 0.501894295f, 0.501894712f,
+        0.654327452f, 0.654326022f, 0.654326677f, 0.989780009f, 0.989777982f, 0.989778876f,
+        0.925718725f, 0.925716817f, 0.925717711f, 0.789731562f, 0.789729893f, 0.789730608f,
+        0.895668864f, 0.895667017f, 0.895667851f, 0.806600153f, 0.806598604f, 0.806599319f,
+        0.892180264f, 0.892178357f, 0.892179251f, 0.576990664f, 0.576989472f, 0.576990008f,
+        0.974321723f, 0.974319637f, 0.97432059f, 0.782418251f, 0.782416582f, 0.782417357f,
+        0.866300523f, 0.866298676f, 0.86629951f, 0.865735948f, 0.8657341f, 0.865734994f,
+        0.960898876f, 0.96089685f, 0.960897744f, 0.954555273f, 0.954553306f, 0.9545542f,
+        0.92338109f, 0.923379183f, 0.923380017f, 0.927734196f, 0.927732289f, 0.927733183f,
+        0.939248979f, 0.939246953f, 0.939247906f, 0.902311146f, 0.902309299f, 0.902310073f,
+        0.93662262f, 0.936620712f, 0.936621547f, 0.543078721f, 0.543077648f, 0.543078125f,
+        0.619639933f, 0.619638622f, 0.619639218f, 0.86787796f, 0.867876053f, 0.867876887f,
+        0.908076763f, 0.908074915f, 0.908075809f, 0.942759991f, 0.942758024f, 0.942758918f,
+        0.777076781f, 0.777075171f, 0.777075887f, 0.955998957f, 0.955996931f, 0.955997825f,
+        0.818903446f, 0.818901777f, 0.818902493f, 0.93852067f, 0.938518822f, 0.938519657f,
+        0.978530228f, 0.978528142f, 0.978529155f, 0.508981645f, 0.508980632f, 0.508981049f,
+        0.838089764f, 0.838087976f, 0.83808881f, 0.564892113f, 0.564890981f, 0.564891517f,
+        0.529671252f, 0.529670179f, 0.529670715f, 0.980252385f, 0.980250239f, 0.980251312f,
+        0.786949396f, 0.786947668f, 0.786948442f, 0.982037842f, 0.982035875f, 0.98203671f,
+        0.893530488f, 0.89352864f, 0.893529534f, 0.388753176f, 0.388752311f, 0.388752669f,
+        0.944539309f, 0.944537342f, 0.944538236f, 0.959174037f, 0.95917201f, 0.959172964f,
+        0.805990458f, 0.805988729f, 0.805989504f, 0.868730128f, 0.86872834f, 0.868729174f,
+        0.958563328f, 0.958561301f, 0.958562195f, 0.72528398f, 0.725282431f, 0.725283206f,
+        0.922959268f, 0.922957301f, 0.922958255f, 0.646072626f, 0.646071255f, 0.646071911f,
+        0.8711133f, 0.871111512f, 0.871112406f, 0.797569513f, 0.797567904f, 0.797568679f,
+        0.965941072f, 0.965939105f, 0.965940058f, 0.775825679f, 0.77582407f, 0.775824785f,
+        0.620365024f, 0.620363772f, 0.620364368f, 0.976225078f, 0.976223111f, 0.976223946f,
+        0.392923743f, 0.392922968f, 0.392923325f, 0.933676481f, 0.933674514f, 0.933675408f,
+        0.928489983f, 0.928488016f, 0.92848891f, 0.922528744f, 0.922526836f, 0.92252773f,
+        0.966545165f, 0.966543257f, 0.966544151f, 0.95996958f, 0.959967613f, 0.959968507f,
+    },
+    {
+        0.729740858f, 0.729739308f, 0.729740024f, 0.730584979f, 0.730583489f, 0.730584145f,
+        0.730213702f, 0.730212271f, 0.730212927f, 0.934212625f, 0.934210658f, 0.934211552f,
+        0.0f, 0.0f, 0.0f, 0.889246583f, 0.889244676f, 0.88924557f,
+        0.918343544f, 0.918341637f, 0.918342412f, 0.730902076f, 0.730900526f, 0.730901241f,
+        0.394283742f, 0.394282907f, 0.394283295f, 0.974686444f, 0.974684358f, 0.974685311f,
+        0.395920694f, 0.395919889f, 0.395920247f, 0.937426686f, 0.937424779f, 0.937425673f,
+        0.630521417f, 0.630520105f, 0.630520701f, 0.899619043f, 0.899617195f, 0.89961803f,
+        0.666131794f, 0.666130424f, 0.66613102f, 0.933018446f, 0.933016539f, 0.933017433f,
+        0.490231007f, 0.490229964f, 0.490230471f, 0.483251393f, 0.48325032f, 0.483250827f,
+        0.608051181f, 0.608049929f, 0.608050466f, 0.554257095f, 0.554255962f, 0.554256439f,
+        0.544611692f, 0.54461056f, 0.544611096f, 0.269566566f, 0.269566f, 0.269566268f,
+        0.742889643f, 0.742888093f, 0.742888808f, 0.0950626507f, 0.0950624868f, 0.0950625613f,
+        0.39235276f, 0.392351925f, 0.392352313f, 0.898108959f, 0.898107111f, 0.898107886f,
+        0.901752532f, 0.901750624f, 0.901751518f, 0.90094918f, 0.900947392f, 0.900948226f,
+        0.457023203f, 0.45702219f, 0.457022667f, 0.746265888f, 0.746264338f, 0.746265113f,
+        0.664753616f, 0.664752245f, 0.664752841f, 0.71699357f, 0.71699208f, 0.716992795f,
+        0.304197222f, 0.304196566f, 0.304196864f, 0.473351002f, 0.473350018f, 0.473350495f,
+        0.697152674f, 0.697151184f, 0.697151899f, 0.888443053f, 0.888441265f, 0.888442099f,
+        0.94379735f, 0.943795383f, 0.943796337f, 0.903856754f, 0.903854847f, 0.903855741f,
+        0.590796709f, 0.590795517f, 0.590796113f, 0.693981767f, 0.693980336f, 0.693981051f,
+        0.915226877f, 0.91522491f, 0.915225804f, 0.701050997f, 0.701049507f, 0.701050103f,
+        0.813667893f, 0.813666165f, 0.81366694f, 0.765961409f, 0.76595974f, 0.765960574f,
+        0.476552933f, 0.47655195f, 0.476552397f, 0.749519169f, 0.74951762f, 0.749518275f,
+        0.934177101f, 0.934175193f, 0.934176087f, 0.0f, 0.0f, 0.0f,
+        0.580351055f, 0.580349863f, 0.580350399f, 0.503699005f, 0.503697932f, 0.503698409f,
+        0.715182006f, 0.715180457f, 0.715181172f, 0.924844205f, 0.924842238f, 0.924843192f,
+        0.912894785f, 0.912892818f, 0.912893713f, 0.349239439f, 0.349238724f, 0.349239051f,
+        0.76070559f, 0.760704041f, 0.760704696f, 0.306465805f, 0.306465149f, 0.306465447f,
+        0.913936138f, 0.91393429f, 0.913935244f, 0.731309593f, 0.731308103f, 0.731308758f,
+        0.798437774f, 0.798436165f, 0.79843694f, 0.46880722f, 0.468806237f, 0.468806714f,
+        0.767879069f, 0.7678774f, 0.767878175f, 0.490497649f, 0.490496665f, 0.490497142f,
+        0.686721623f, 0.686720133f, 0.686720788f, 0.62038964f, 0.620388329f, 0.620388925f,
+    },
+    {
+        0.729740858f, 0.729739308f, 0.729740024f, 0.740770042f, 0.740768492f, 0.740769207f,
+        0.735942125f, 0.735940576f, 0.735941231f, 0.88078934f, 0.880787492f, 0.880788386f,
+        0.92029202f, 0.920290112f, 0.920291007f, 0.368617654f, 0.368616849f, 0.368617207f,
+        0.70338589f, 0.703384459f, 0.703385055f, 0.743240178f, 0.743238568f, 0.743239284f,
+        0.829425931f, 0.829424202f, 0.829424977f, 0.55503267f, 0.555031478f, 0.555032015f,
+        0.776804805f, 0.776803195f, 0.776803851f, 0.817306459f, 0.81730479f, 0.817305565f,
+        0.755613208f, 0.755611718f, 0.755612373f, 0.335362464f, 0.335361749f, 0.335362047f,
+        0.801993191f, 0.801991582f, 0.801992297f, 0.89576906f, 0.895767212f, 0.895767927f,
+        0.919955492f, 0.919953585f, 0.919954419f, 0.686764896f, 0.686763406f, 0.686764121f,
+        0.716447473f, 0.716446042f, 0.716446698f, 0.818783641f, 0.818781972f, 0.818782747f,
+        0.935117662f, 0.935115814f, 0.935116649f, 0.890247047f, 0.890245199f, 0.890246093f,
+        0.823818862f, 0.823817134f, 0.823817849f, 0.855269253f, 0.855267525f, 0.8552683f,
+        0.863733172f, 0.863731265f, 0.863732159f, 0.318209797f, 0.318209141f, 0.318209469f,
+        0.356604755f, 0.35660404f, 0.356604367f, 0.685719788f, 0.685718358f, 0.685718954f,
+        0.680603087f, 0.680601597f, 0.680602312f, 0.912430227f, 0.912428379f, 0.912429273f,
+        0.576262236f, 0.576261103f, 0.57626158f, 0.920558989f, 0.920557022f, 0.920557916f,
+        0.904573083f, 0.904571176f, 0.90457201f, 0.901651204f, 0.901649356f, 0.90165019f,
+        0.869285047f, 0.869283259f, 0.869284093f, 0.368080318f, 0.368079573f, 0.368079901f,
+        0.615803242f, 0.61580193f, 0.615802526f, 0.286782503f, 0.286781877f, 0.286782175f,
+        0.768274486f, 0.768272936f, 0.768273652f, 0.825249791f, 0.825248063f, 0.825248897f,
+        0.892567337f, 0.892565548f, 0.892566323f, 0.823918819f, 0.82391715f, 0.823917925f,
+        0.84990555f, 0.849903762f, 0.849904597f, 0.628892958f, 0.628891647f, 0.628892183f,
+        0.841086149f, 0.84108448f, 0.841085255f, 0.716839433f, 0.716837943f, 0.716838658f,
+        0.569871247f, 0.569870114f, 0.569870591f, 0.919654548f, 0.9196527f, 0.919653535f,
+        0.804562807f, 0.804561079f, 0.804561853f, 0.747305095f, 0.747303545f, 0.747304201f,
+        0.840424359f, 0.84042263f, 0.840423465f, 0.3994748f, 0.399473995f, 0.399474353f,
+        0.633747458f, 0.633746147f, 0.633746803f, 0.816566586f, 0.816564858f, 0.816565573f,
+        0.733908772f, 0.733907223f, 0.733907878f, 0.88995713f, 0.889955282f, 0.889956117f,
+        0.359850496f, 0.359849721f, 0.359850109f, 0.783959806f, 0.783958137f, 0.783958912f,
+        0.662357032f, 0.662355661f, 0.662356257f, 0.691941023f, 0.691939592f, 0.691940129f,
+        0.911895752f, 0.911893845f, 0.911894679f, 0.701274991f, 0.701273561f, 0.701274157f,
+        0.932433188f, 0.932431281f, 0.932432175f, 0.749192595f, 0.749190986f, 0.749191642f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.46724683f, 0.467246026f, 0.467246413f, 1.15736151f, 0.0f, 0.0f,
+        0.0f, 1.03660119f, 0.0f, 0.0f, 0.0f, 1.02137017f,
+        0.834713221f, 0.0f, 0.542880416f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.0f, 1.03023005f, 0.539276183f, 1.12940431f, 0.0f, 1.02028966f,
+        0.0f, 1.03035975f, 0.7122491f, 1.1498214f, 0.0f, 0.429920435f,
+        0.526735365f, 1.0049175f, 0.798654497f, 0.190961435f, 0.131966501f, 1.02074122f,
+        0.881062984f, 1.01284707f, 0.0f, 1.14787471f, 0.153586283f, 0.0f,
+        0.33068186f, 0.978697479f, 0.0f, 0.0f, 0.995171726f, 1.00237656f,
+        0.0f, 1.03028667f, 1.00095952f, 0.0f, 1.03510189f, 0.0f,
+        0.627033293f, 1.02176738f, 0.0f, 0.0f, 1.03579915f, 0.0f,
+        1.01877546f, 1.00348985f, 0.642596841f, 0.0f, 1.03488564f, 0.428538054f,
+        0.0f, 1.03580809f, 0.0f, 0.0f, 0.0438593179f, 1.02109206f,
+        0.315903306f, 0.0648849308f, 1.02082872f, 1.12841165f, 0.0f, 1.02012479f,
+        0.0f, 1.02964807f, 1.00093901f, 1.03018129f, 1.00564158f, 0.0f,
+        0.0f, 0.669096589f, 1.01323354f, 1.02968395f, 1.00554717f, 0.124315806f,
+        0.0f, 0.857951701f, 0.0f, 0.339962244f, 1.02754498f, 0.0f,
+        1.03056526f, 1.0057143f, 0.0f, 0.0f, 0.0f, 1.02121401f,
+        1.11522889f, 0.255803227f, 1.01794732f, 0.0f, 0.0f, 1.02120996f,
+        0.0f, 0.402902544f, 0.276574612f, 1.03025663f, 1.00565565f, 0.0f,
+        1.1415751f, 0.294121712f, 0.166763872f, 1.03108466f, 1.00581288f, 0.0f,
+        1.08955443f, 0.714665949f, 0.474198192f, 0.160314679f, 0.242635906f, 0.444157988f,
+        0.0f, 1.03497934f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.11462724f, 0.267798752f, 1.01784849f, 0.0f, 1.03546548f, 0.0f,
+        0.0f, 1.03623867f, 0.0f, 0.0f, 0.634148955f, 0.518743634f,
+        1.0219456f, 1.00408554f, 0.552941561f, 0.550135791f, 0.0f, 1.02092361f,
+        1.1288563f, 0.0f, 1.02019858f, 0.0f, 0.796182036f, 0.435488343f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.750315964f, 0.0f,
+        0.405684143f, 0.0f, 1.0210706f, 1.00473392f, 1.00087297f, 0.926050663f,
+        0.326697052f, 0.193636298f, 0.393296033f, 0.0f, 1.03050935f, 1.00096679f,
+        1.05914521f, 0.890926301f, 0.119789951f, 0.0f, 1.02677548f, 1.00084651f,
+        1.03122771f, 1.00584006f, 0.0f, 0.568652511f, 1.01609397f, 1.00050557f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.46724683f, 0.467246026f, 0.467246413f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.72974062f, 0.729739308f, 0.729739964f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.43008551f, 0.430084795f, 0.430085152f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.371596992f, 0.371596336f, 0.371596634f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.678342044f, 0.678340912f, 0.678341448f, 0.310259551f, 0.310259014f, 0.310259283f,
+        0.88978374f, 0.88978231f, 0.889783025f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.547399521f, 0.547398508f, 0.547398984f, 0.267958671f, 0.267958224f, 0.267958432f,
+        0.174531683f, 0.1745314f, 0.174531549f, 0.253478557f, 0.25347814f, 0.253478378f,
+        0.719285131f, 0.719283998f, 0.719284534f, 0.1891215f, 0.189121187f, 0.189121366f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.172717392f, 0.172717094f, 0.172717214f,
+        0.186645985f, 0.186645642f, 0.186645836f, 0.110198975f, 0.110198796f, 0.1101989f,
+        0.371596992f, 0.371596336f, 0.371596634f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.237930462f, 0.237930074f, 0.237930238f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.306617826f, 0.30661729f, 0.306617558f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.293442249f, 0.293441743f, 0.293441981f, 0.57232976f, 0.572328746f, 0.572329223f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.109806821f, 0.109806634f, 0.109806709f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.119152188f, 0.119151972f, 0.119152069f,
+        0.161312997f, 0.161312699f, 0.161312848f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.20693846f, 0.206938118f, 0.206938282f,
+        0.25232327f, 0.252322823f, 0.252323031f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.218319446f, 0.218319044f, 0.218319222f,
+        0.127362773f, 0.127362564f, 0.127362654f, 0.189938113f, 0.189937785f, 0.189937919f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.53062588f, 0.530624986f, 0.530625463f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.133748695f, 0.133748472f, 0.133748576f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.143835977f, 0.143835738f, 0.143835858f,
+        0.425164431f, 0.425163746f, 0.425164104f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.308445126f, 0.308444589f, 0.308444858f, 0.14440316f, 0.144402891f, 0.14440304f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.40475744f, 0.404756784f, 0.404757082f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.719285131f, 0.719283998f, 0.719284534f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.46724683f, 0.467246026f, 0.467246413f, 0.0f, 0.0f, 0.0f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0985021517f, 0.0985019952f, 0.0985020921f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.200193033f, 0.20019266f, 0.200192824f,
+        0.98567313f, 0.985671401f, 0.985672176f, 0.195540175f, 0.195539832f, 0.195539981f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.315627873f, 0.315627366f, 0.315627575f,
+        0.952485621f, 0.952484071f, 0.952484846f, 0.967404425f, 0.967402637f, 0.967403531f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.140958875f, 0.140958652f, 0.140958756f,
+        0.174531683f, 0.1745314f, 0.174531549f, 0.14496766f, 0.144967422f, 0.144967571f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.658181846f, 0.658180654f, 0.65818125f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.830206513f, 0.830205202f, 0.830205798f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.107417613f, 0.107417434f, 0.107417524f,
+        0.384435087f, 0.384434462f, 0.384434789f, 0.108221062f, 0.108220868f, 0.108220957f,
+        0.39135012f, 0.391349494f, 0.391349792f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.39135012f, 0.391349494f, 0.391349792f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.734901488f, 0.734900296f, 0.734900832f, 0.244051337f, 0.24405095f, 0.244051144f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.39135012f, 0.391349494f, 0.391349792f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.615462422f, 0.615461409f, 0.615461826f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.125370488f, 0.125370279f, 0.125370368f,
+        0.12670286f, 0.126702636f, 0.126702756f, 0.769873977f, 0.769872665f, 0.769873261f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.724535584f, 0.724534214f, 0.724534869f,
+        0.109017394f, 0.109017208f, 0.109017298f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.20693846f, 0.206938118f, 0.206938282f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.893857896f, 0.893856347f, 0.893857181f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.46724683f, 0.467246026f, 0.467246413f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.53252095f, 0.532520056f, 0.532520473f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.568848431f, 0.568847418f, 0.568847895f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.727143645f, 0.727142394f, 0.72714299f, 0.425164431f, 0.425163746f, 0.425164104f,
+        0.807641208f, 0.807639837f, 0.807640493f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.145529568f, 0.1455293f, 0.145529449f, 0.0859024823f, 0.0859023333f, 0.0859024152f,
+        0.158306822f, 0.158306539f, 0.158306658f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0837598443f, 0.0837597027f, 0.0837597623f,
+        0.148847669f, 0.148847431f, 0.14884752f, 0.0895051584f, 0.0895050168f, 0.0895050913f,
+        0.664016902f, 0.66401577f, 0.664016366f, 0.471646637f, 0.471645862f, 0.471646279f,
+        0.106606893f, 0.1066067f, 0.106606804f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.229029387f, 0.229029015f, 0.229029253f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.267958671f, 0.267958224f, 0.267958432f,
+        0.139788121f, 0.139787883f, 0.139787972f, 0.200955957f, 0.200955585f, 0.200955793f,
+        0.192362964f, 0.192362666f, 0.192362815f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.28256914f, 0.282568693f, 0.282568902f, 0.22240828f, 0.222407877f, 0.222408056f,
+        0.190750495f, 0.190750182f, 0.190750375f, 0.121962868f, 0.121962667f, 0.121962763f,
+        0.490863949f, 0.490863144f, 0.490863532f, 0.437343001f, 0.437342227f, 0.437342614f,
+        0.198656589f, 0.198656261f, 0.198656425f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.139198288f, 0.139198065f, 0.139198184f,
+        0.103287347f, 0.103287183f, 0.103287265f, 0.522962868f, 0.522962034f, 0.522962451f,
+        0.582624555f, 0.582623541f, 0.582624018f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.456023604f, 0.456022829f, 0.456023216f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.142118141f, 0.142117873f, 0.142117992f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.929566681f, 0.929565132f, 0.929565907f,
+        0.387218922f, 0.387218267f, 0.387218565f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.244051337f, 0.24405095f, 0.244051144f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.0909970626f, 0.0909968913f, 0.0909969807f, 1.0000006f, 0.999998927f, 0.999999762f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.46724683f, 0.467246026f, 0.467246413f, 0.553543925f, 0.553543031f, 0.553543508f,
+        0.835877001f, 0.835875511f, 0.835876226f, 0.264653325f, 0.264652908f, 0.264653087f,
+        0.407819062f, 0.407818347f, 0.407818675f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.904819489f, 0.904817939f, 0.904818654f, 0.492444873f, 0.492444068f, 0.492444456f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.891472697f, 0.891471148f, 0.891471863f,
+        0.838566005f, 0.838564575f, 0.83856523f, 0.851959944f, 0.851958513f, 0.851959169f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.388980895f, 0.38898024f, 0.388980567f,
+        0.96811837f, 0.968116641f, 0.968117476f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.655839026f, 0.655837893f, 0.65583843f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.707222521f, 0.707221329f, 0.707221985f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.285211563f, 0.285211056f, 0.285211295f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.679249644f, 0.679248512f, 0.679249048f,
+        0.341091633f, 0.341091067f, 0.341091365f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.82615757f, 0.826156199f, 0.826156855f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.250301272f, 0.250300854f, 0.250301033f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.898228586f, 0.898227096f, 0.898227811f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.534124017f, 0.534123063f, 0.53412354f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.707525909f, 0.707524717f, 0.707525313f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.653303981f, 0.653302789f, 0.653303385f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.609387994f, 0.609386921f, 0.609387457f,
+        0.863707125f, 0.863705516f, 0.863706291f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.251977235f, 0.251976818f, 0.251977026f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.732345045f, 0.732343793f, 0.732344389f, 0.787850261f, 0.78784883f, 0.787849545f,
+        0.93230778f, 0.93230617f, 0.932306945f, 0.558491647f, 0.558490694f, 0.55849117f,
+        0.689184964f, 0.689183831f, 0.689184368f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.961838901f, 0.961837232f, 0.961838067f, 0.749330938f, 0.749329627f, 0.749330282f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.9562549f, 0.956253231f, 0.956254005f,
+        0.93349272f, 0.93349117f, 0.933491945f, 0.939353466f, 0.939351797f, 0.939352632f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.67444247f, 0.674441278f, 0.674441814f,
+        0.987526536f, 0.987524748f, 0.987525582f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.84554404f, 0.84554261f, 0.845543325f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.871965289f, 0.871963799f, 0.871964514f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.580535412f, 0.580534339f, 0.580534875f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.857768893f, 0.857767403f, 0.857768118f,
+        0.634128571f, 0.634127498f, 0.634127975f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.928001046f, 0.927999437f, 0.928000212f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.54217422f, 0.542173326f, 0.542173803f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.9590891f, 0.959087491f, 0.959088206f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.775983155f, 0.775981784f, 0.775982499f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.872116983f, 0.872115433f, 0.872116148f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.844200552f, 0.844199121f, 0.844199836f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.820270061f, 0.820268631f, 0.820269287f,
+        0.944437742f, 0.944436133f, 0.944436848f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.544122815f, 0.544121921f, 0.544122338f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+    },
+    {
+        0.72974062f, 0.729739308f, 0.729739964f, 0.730727851f, 0.73072654f, 0.730727255f,
+        0.730305851f, 0.730304539f, 0.730305135f, 0.984334528f, 0.98433286f, 0.984333694f,
+        0.0f, 0.0f, 0.0f, 0.920288384f, 0.920286834f, 0.920287549f,
+        0.959000885f, 0.958999276f, 0.959000051f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.552955151f, 0.552954197f, 0.552954674f, 0.98521322f, 0.985211551f, 0.985212386f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.369501144f, 0.369500518f, 0.369500816f, 0.420743197f, 0.420742452f, 0.42074284f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.875438213f, 0.875436723f, 0.875437498f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.956924975f, 0.956923306f, 0.95692414f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.45227617f, 0.452275425f, 0.452275783f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.759074867f, 0.759073555f, 0.759074211f, 0.969876945f, 0.969875276f, 0.969875991f,
+        0.0962249488f, 0.0962247923f, 0.0962248743f, 0.0f, 0.0f, 0.0f,
+        0.572432816f, 0.572431803f, 0.57243228f, 0.914393127f, 0.914391518f, 0.914392292f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.564503431f, 0.564502478f, 0.564502954f, 0.0f, 0.0f, 0.0f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.75211668f, 0.752115369f, 0.752116084f,
+        0.0f, 0.0f, 0.0f, 0.999885619f, 0.99988389f, 0.999884665f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.471382707f, 0.471381903f, 0.47138235f,
+        0.725578547f, 0.725577235f, 0.725577831f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.188598275f, 0.188597977f, 0.188598096f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.805202842f, 0.80520153f, 0.805202127f, 0.628115594f, 0.628114581f, 0.628115118f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        0.63298434f, 0.632983267f, 0.632983744f, 0.0f, 0.0f, 0.0f,
+    },
+    {
+        0.72974062f, 0.729739308f, 0.729739964f, 0.742622197f, 0.742621005f, 0.742621541f,
+        0.737146616f, 0.737145364f, 0.73714596f, 0.967419684f, 0.967418015f, 0.96741879f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.211306885f, 0.211306497f, 0.211306706f,
+        0.678846359f, 0.678845167f, 0.678845763f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        0.848068893f, 0.848067462f, 0.848068118f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.776960969f, 0.776959658f, 0.776960254f, 0.0f, 0.0f, 0.0f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.991590559f, 0.99158895f, 0.991589785f, 0.657610536f, 0.657609403f, 0.65760994f,
+        0.337198436f, 0.33719784f, 0.337198108f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.927278578f, 0.927277029f, 0.927277744f, 0.975429893f, 0.975428164f, 0.975428939f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.486144632f, 0.486143798f, 0.486144215f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.375071019f, 0.375070393f, 0.375070661f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.960939646f, 0.960938036f, 0.960938811f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.225141883f, 0.22514151f, 0.225141644f,
+        0.577263355f, 0.577262282f, 0.577262759f, 0.0f, 0.0f, 0.0f,
+        0.763762295f, 0.763760984f, 0.76376164f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.995850086f, 0.995848358f, 0.995849252f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.97829783f, 0.978296101f, 0.978297055f, 0.63437736f, 0.634376287f, 0.634376884f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.742040992f, 0.74203974f, 0.742040336f,
+        0.898950219f, 0.898948669f, 0.898949504f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.817300379f, 0.817299008f, 0.817299724f,
+        0.784207404f, 0.784206092f, 0.784206748f, 0.930288851f, 0.930287242f, 0.930288017f,
+        0.0f, 0.0f, 0.0f, 1.0000006f, 0.999998927f, 0.999999762f,
+        0.662785351f, 0.662784278f, 0.662784815f, 0.0f, 0.0f, 0.0f,
+        1.0000006f, 0.999998927f, 0.999999762f, 0.66912365f, 0.669122398f, 0.669123054f,
+        1.0000006f, 0.999998927f, 0.999999762f, 1.0000006f, 0.999998927f, 0.999999762f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807526946f, 0.807525694f, 0.80752635f,
+        0.366292864f, 0.366292328f, 0.366292745f, 0.869684756f, 0.0f, 0.132768378f,
+        0.0f, 0.827073574f, 0.113746673f, 0.0f, 0.0f, 0.812354088f,
+        0.705584526f, 0.0f, 0.44190678f, 0.975248575f, 0.973608077f, 0.971360743f,
+        0.0f, 0.958310425f, 0.559284329f, 0.985137224f, 0.0f, 0.972108841f,
+        0.0f, 0.889165521f, 0.648706019f, 1.07201922f, 0.228714928f, 0.401905596f,
+        0.535870075f, 0.809647322f, 0.70403862f, 0.0f, 0.0f, 0.94197309f,
+        0.849020183f, 0.978436947f, 0.758055866f, 1.02432024f, 0.18038471f, 0.179753557f,
+        0.363599449f, 0.800350189f, 0.156102285f, 0.0f, 0.808809817f, 0.824298441f,
+        0.553199351f, 0.981618881f, 0.968778789f, 0.5801543f, 0.984458387f, 0.657726705f,
+        0.593749046f, 0.910099685f, 0.213463813f, 0.0f, 0.979768217f, 0.370847613f,
+        0.950855136f, 0.837411582f, 0.616718948f, 0.0f, 0.92978555f, 0.431036949f,
+        0.219604537f, 0.984289885f, 0.476619601f, 0.0f, 0.0f, 0.91496861f,
+        0.212963894f, 0.102615856f, 0.979663968f, 1.05606294f, 0.485564083f, 0.84278053f,
+        0.0f, 0.90966785f, 0.933413088f, 1.01191676f, 0.839593709f, 0.352701098f,
+        0.0f, 0.584654748f, 0.896986067f, 0.988912106f, 0.894259632f, 0.349130332f,
+        0.0f, 0.73398912f, 0.119727887f, 0.475453079f, 0.969209611f, 0.359904945f,
+        0.980333447f, 0.965351999f, 0.561839283f, 0.0f, 0.0f, 0.820909262f,
+        1.04908156f, 0.30955565f, 0.944024086f, 0.0f, 0.0f, 0.972884893f,
+        0.0f, 0.286200851f, 0.170242354f, 0.945807159f, 0.973653555f, 0.702962041f,
+        0.995278776f, 0.269921124f, 0.187889233f, 0.964617312f, 0.973105252f, 0.711631417f,
+        1.00885296f, 0.666003585f, 0.453310132f, 0.0459895656f, 0.132543221f, 0.327346891f,
+        0.418010354f, 0.984737694f, 0.565669775f, 0.917308569f, 0.883995712f, 0.96756202f,
+        0.919307828f, 0.281034291f, 0.973769486f, 0.0f, 0.852776706f, 0.145439819f,
+        0.627290368f, 0.984199405f, 0.710288048f, 0.0f, 0.543100178f, 0.428382248f,
+        0.864983201f, 0.821989954f, 0.531722903f, 0.442539543f, 0.0f, 0.967877865f,
+        1.05434155f, 0.470899642f, 0.974121749f, 0.0f, 0.689414978f, 0.361300558f,
+        0.979586184f, 0.889010847f, 0.937991917f, 0.0f, 0.651777923f, 0.105322897f,
+        0.294003069f, 0.0f, 0.977219701f, 0.983428836f, 0.937017798f, 0.81897521f,
+        0.201026112f, 0.0979480892f, 0.272917747f, 0.0f, 0.966915607f, 0.964935362f,
+        1.0203234f, 0.787693381f, 0.329354584f, 0.0f, 0.933716178f, 0.914134324f,
+        0.959940016f, 0.94133234f, 0.326657683f, 0.643232167f, 0.971386254f, 0.875643909f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527006f, 0.807525635f, 0.80752629f,
+        0.366292894f, 0.366292298f, 0.366292566f, 0.753819883f, 0.753818572f, 0.753819227f,
+        0.216700539f, 0.216700181f, 0.21670039f, 0.0679697096f, 0.067969583f, 0.06796965f,
+        0.61781013f, 0.617809117f, 0.617809594f, 0.974699259f, 0.97469759f, 0.974698424f,
+        0.477983624f, 0.477982849f, 0.477983236f, 0.87992835f, 0.87992686f, 0.879927576f,
+        0.365779519f, 0.365778863f, 0.365779191f, 0.939988434f, 0.939986765f, 0.9399876f,
+        0.615566969f, 0.615565896f, 0.615566432f, 0.209392399f, 0.209392056f, 0.209392205f,
+        0.874136448f, 0.874134958f, 0.874135733f, 0.894162536f, 0.894160926f, 0.894161642f,
+        0.492282957f, 0.492282122f, 0.492282569f, 0.273890734f, 0.273890287f, 0.273890525f,
+        0.697188318f, 0.697187066f, 0.697187722f, 0.694056869f, 0.694055617f, 0.694056273f,
+        0.665247858f, 0.665246725f, 0.665247202f, 0.438381076f, 0.438380361f, 0.438380718f,
+        0.9138183f, 0.91381669f, 0.913817465f, 0.288811892f, 0.288811386f, 0.288811624f,
+        0.52401489f, 0.524014056f, 0.524014473f, 0.0915345699f, 0.0915344134f, 0.0915344954f,
+        0.309282511f, 0.309281975f, 0.309282213f, 0.957379103f, 0.957377553f, 0.957378268f,
+        0.311248064f, 0.311247498f, 0.311247766f, 0.955594599f, 0.95559299f, 0.955593824f,
+        0.250874132f, 0.250873685f, 0.250873923f, 0.947937608f, 0.947935998f, 0.947936714f,
+        0.258916646f, 0.258916259f, 0.258916438f, 0.618021786f, 0.618020713f, 0.618021309f,
+        0.960572004f, 0.960570335f, 0.96057117f, 0.0811552852f, 0.0811551362f, 0.0811552033f,
+        0.943315864f, 0.943314254f, 0.943315029f, 0.116547294f, 0.116547085f, 0.116547182f,
+        0.103151739f, 0.103151552f, 0.103151649f, 0.941080928f, 0.941079319f, 0.941080153f,
+        0.872830629f, 0.872829199f, 0.872829914f, 0.955242455f, 0.955240726f, 0.955241501f,
+        0.926848233f, 0.926846623f, 0.926847398f, 0.11004518f, 0.110044986f, 0.110045075f,
+        0.602439761f, 0.602438748f, 0.602439284f, 0.913084209f, 0.913082719f, 0.913083434f,
+        0.835575044f, 0.835573673f, 0.835574329f, 0.258093148f, 0.258092701f, 0.25809294f,
+        0.725162685f, 0.725161493f, 0.725162148f, 0.168314382f, 0.168314084f, 0.168314248f,
+        0.84233278f, 0.84233129f, 0.842332065f, 0.445505261f, 0.445504546f, 0.445504904f,
+        0.961013317f, 0.961011708f, 0.961012483f, 0.188205108f, 0.188204765f, 0.188204944f,
+        0.959061921f, 0.959060311f, 0.959061027f, 0.178590968f, 0.178590655f, 0.178590789f,
+        0.348683238f, 0.348682612f, 0.34868294f, 0.965965807f, 0.965964139f, 0.965964973f,
+        0.189813137f, 0.189812779f, 0.189812973f, 0.409908384f, 0.409907669f, 0.409907997f,
+        0.952816248f, 0.952814579f, 0.952815354f, 0.431197315f, 0.4311966f, 0.431196928f,
+        0.935066581f, 0.935065091f, 0.935065746f, 0.740662396f, 0.740661025f, 0.74066174f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527006f, 0.807525694f, 0.80752635f,
+        0.366292983f, 0.366292328f, 0.366292655f, 0.142210647f, 0.142210394f, 0.142210528f,
+        0.799436808f, 0.799435437f, 0.799436152f, 0.0679697841f, 0.0679696724f, 0.067969732f,
+        0.113403752f, 0.113403574f, 0.113403641f, 0.973654032f, 0.973652303f, 0.973653197f,
+        0.932553887f, 0.932552338f, 0.932553053f, 0.210422039f, 0.210421652f, 0.21042183f,
+        0.864190221f, 0.86418879f, 0.864189506f, 0.340556711f, 0.340556175f, 0.340556443f,
+        0.797744513f, 0.797743142f, 0.797743917f, 0.132901013f, 0.132900789f, 0.132900894f,
+        0.969945788f, 0.96994406f, 0.969944894f, 0.301940233f, 0.301939666f, 0.301939934f,
+        0.780696213f, 0.780694902f, 0.780695617f, 0.787249327f, 0.787248015f, 0.787248671f,
+        0.966197073f, 0.966195345f, 0.96619612f, 0.965844095f, 0.965842426f, 0.96584326f,
+        0.892137706f, 0.892136276f, 0.892136991f, 0.95108515f, 0.951083541f, 0.951084316f,
+        0.840442896f, 0.840441465f, 0.840442181f, 0.900252163f, 0.900250614f, 0.900251329f,
+        0.958279967f, 0.958278358f, 0.958279252f, 0.0998490229f, 0.099848859f, 0.099848941f,
+        0.176265016f, 0.176264718f, 0.176264882f, 0.537094593f, 0.537093639f, 0.537094057f,
+        0.885553658f, 0.885552168f, 0.885552943f, 0.843924463f, 0.843923032f, 0.843923748f,
+        0.574921787f, 0.574920833f, 0.57492125f, 0.893765152f, 0.893763542f, 0.893764317f,
+        0.710565805f, 0.710564554f, 0.71056515f, 0.946677208f, 0.946675658f, 0.946676373f,
+        0.961545646f, 0.961544037f, 0.961544871f, 0.0805972889f, 0.0805971399f, 0.0805971995f,
+        0.404514223f, 0.404513478f, 0.404513866f, 0.113847792f, 0.113847606f, 0.113847703f,
+        0.277574092f, 0.277573645f, 0.277573854f, 0.969005227f, 0.969003558f, 0.969004333f,
+        0.350576699f, 0.350576073f, 0.350576341f, 0.96944803f, 0.96944648f, 0.969447196f,
+        0.684471309f, 0.684470117f, 0.684470654f, 0.135552183f, 0.135551959f, 0.135552034f,
+        0.961848319f, 0.96184665f, 0.961847425f, 0.886903822f, 0.886902273f, 0.886903107f,
+        0.367603898f, 0.367603213f, 0.36760357f, 0.824824035f, 0.824822545f, 0.82482332f,
+        0.967372894f, 0.967371225f, 0.967372179f, 0.527041972f, 0.527041137f, 0.527041554f,
+        0.820679307f, 0.820677876f, 0.820678532f, 0.137521267f, 0.137521043f, 0.137521163f,
+        0.528508961f, 0.528508127f, 0.528508544f, 0.667334735f, 0.667333543f, 0.66733408f,
+        0.894277513f, 0.894276023f, 0.894276798f, 0.630125284f, 0.630124211f, 0.630124748f,
+        0.142826945f, 0.142826706f, 0.142826855f, 0.937660694f, 0.937659085f, 0.93765986f,
+        0.110674351f, 0.110674165f, 0.110674247f, 0.942612946f, 0.942611277f, 0.942612052f,
+        0.796084642f, 0.796083272f, 0.796083987f, 0.910921931f, 0.910920322f, 0.910921097f,
+        0.936501741f, 0.936500132f, 0.936500907f, 0.957517266f, 0.957515597f, 0.957516372f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527006f, 0.807525694f, 0.80752635f,
+        0.366293073f, 0.366292447f, 0.366292745f, 0.138591856f, 0.138591617f, 0.138591737f,
+        0.216700464f, 0.216700062f, 0.216700241f, 0.795431137f, 0.795429885f, 0.795430541f,
+        0.433994532f, 0.433993816f, 0.433994174f, 0.971468091f, 0.971466422f, 0.971467257f,
+        0.581539452f, 0.581538498f, 0.581538975f, 0.953197598f, 0.95319587f, 0.953196704f,
+        0.659417808f, 0.659416676f, 0.659417212f, 0.40154925f, 0.401548624f, 0.401548952f,
+        0.708249092f, 0.7082479f, 0.708248436f, 0.922554314f, 0.922552824f, 0.92255348f,
+        0.768987f, 0.768985689f, 0.768986344f, 0.192347899f, 0.192347586f, 0.192347735f,
+        0.235796124f, 0.235795707f, 0.235795885f, 0.822027206f, 0.822025716f, 0.822026432f,
+        0.968200088f, 0.968198419f, 0.968199313f, 0.674775124f, 0.674773932f, 0.674774468f,
+        0.291760653f, 0.291760147f, 0.291760385f, 0.41812405f, 0.418123305f, 0.418123662f,
+        0.62923032f, 0.629229248f, 0.629229724f, 0.463771492f, 0.463770747f, 0.463771075f,
+        0.50964272f, 0.509641945f, 0.509642303f, 0.895972431f, 0.895970881f, 0.895971596f,
+        0.95969677f, 0.959695101f, 0.959695935f, 0.832508266f, 0.832506835f, 0.832507372f,
+        0.930599332f, 0.930597723f, 0.930598497f, 0.393011332f, 0.393010646f, 0.393010974f,
+        0.885059714f, 0.885058165f, 0.885058999f, 0.395583957f, 0.395583272f, 0.3955836f,
+        0.201642409f, 0.201642051f, 0.201642215f, 0.409101903f, 0.409101188f, 0.409101516f,
+        0.587385774f, 0.58738482f, 0.587385297f, 0.803839445f, 0.803838074f, 0.80383873f,
+        0.928128779f, 0.928127289f, 0.928128064f, 0.952714205f, 0.952712536f, 0.952713311f,
+        0.176483974f, 0.176483691f, 0.176483825f, 0.71759963f, 0.717598438f, 0.717599094f,
+        0.203049883f, 0.203049555f, 0.203049704f, 0.72574544f, 0.725744188f, 0.725744843f,
+        0.467848778f, 0.467848003f, 0.46784839f, 0.321476847f, 0.32147634f, 0.321476549f,
+        0.589842141f, 0.589841068f, 0.589841545f, 0.964121103f, 0.964119434f, 0.964120269f,
+        0.956369162f, 0.956367433f, 0.956368268f, 0.237322032f, 0.237321585f, 0.237321779f,
+        0.723798275f, 0.723797023f, 0.723797679f, 0.432885677f, 0.432884961f, 0.432885319f,
+        0.549018979f, 0.549018085f, 0.549018502f, 0.94806391f, 0.948062241f, 0.948063076f,
+        0.959759951f, 0.959758282f, 0.959759116f, 0.380770773f, 0.380770147f, 0.380770475f,
+        0.936190665f, 0.936188996f, 0.936189771f, 0.178258434f, 0.178258136f, 0.178258285f,
+        0.957158744f, 0.957157135f, 0.95715791f, 0.824888349f, 0.824886918f, 0.824887633f,
+        0.268082023f, 0.268081576f, 0.268081784f, 0.963212609f, 0.963211f, 0.963211834f,
+        0.368247032f, 0.368246436f, 0.368246764f, 0.913303077f, 0.913301587f, 0.913302362f,
+        0.38257128f, 0.382570595f, 0.382570982f, 0.87913686f, 0.87913537f, 0.879136145f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807527006f, 0.807525694f, 0.80752635f,
+        0.366292924f, 0.366292298f, 0.366292566f, 0.429916799f, 0.429916054f, 0.429916412f,
+        0.676480591f, 0.676479459f, 0.676479995f, 0.217887595f, 0.217887253f, 0.217887431f,
+        0.364433557f, 0.364432961f, 0.364433229f, 0.973821521f, 0.973819852f, 0.973820567f,
+        0.821040392f, 0.821038902f, 0.821039617f, 0.556671858f, 0.556670845f, 0.556671321f,
+        0.755849659f, 0.755848348f, 0.755848944f, 0.585336506f, 0.585335493f, 0.58533597f,
+        0.748539984f, 0.748538613f, 0.748539269f, 0.281813055f, 0.281812578f, 0.281812817f,
+        0.935186088f, 0.935184419f, 0.935185254f, 0.544587612f, 0.544586599f, 0.544587135f,
+        0.69595772f, 0.695956528f, 0.695957065f, 0.694842458f, 0.694841325f, 0.694841921f,
+        0.902561605f, 0.902560055f, 0.90256083f, 0.887438715f, 0.887437165f, 0.88743794f,
+        0.815824091f, 0.81582278f, 0.815823376f, 0.82555747f, 0.825556099f, 0.825556695f,
+        0.851718962f, 0.851717532f, 0.851718247f, 0.769914627f, 0.769913256f, 0.769913912f,
+        0.845698714f, 0.845697284f, 0.845697999f, 0.251077831f, 0.251077384f, 0.251077622f,
+        0.325132877f, 0.32513231f, 0.325132579f, 0.699080706f, 0.699079514f, 0.69908005f,
+        0.782280982f, 0.78227967f, 0.782280385f, 0.859816909f, 0.859815419f, 0.859816074f,
+        0.535890818f, 0.535889864f, 0.535890341f, 0.890863657f, 0.890862107f, 0.890862882f,
+        0.606949568f, 0.606948495f, 0.606949091f, 0.850046456f, 0.850045025f, 0.850045741f,
+        0.945591033f, 0.945589364f, 0.945590198f, 0.223288178f, 0.223287791f, 0.223287985f,
+        0.64186728f, 0.641866148f, 0.641866684f, 0.270482033f, 0.270481586f, 0.270481825f,
+        0.239788249f, 0.239787817f, 0.239788011f, 0.949873209f, 0.9498716f, 0.949872434f,
+        0.552050412f, 0.552049458f, 0.552049875f, 0.954327762f, 0.954326212f, 0.954327047f,
+        0.75136292f, 0.751361609f, 0.751362264f, 0.147547543f, 0.147547305f, 0.147547424f,
+        0.863942444f, 0.863940954f, 0.863941669f, 0.898431003f, 0.898429453f, 0.898430228f,
+        0.584280789f, 0.584279776f, 0.584280312f, 0.700772405f, 0.700771213f, 0.700771689f,
+        0.896971643f, 0.896970034f, 0.896970749f, 0.457077324f, 0.45707655f, 0.457076937f,
+        0.814885676f, 0.814884245f, 0.814884901f, 0.354738146f, 0.35473755f, 0.354737818f,
+        0.705519319f, 0.705518067f, 0.705518603f, 0.569852829f, 0.569851816f, 0.569852293f,
+        0.914716959f, 0.914715409f, 0.914716125f, 0.533869505f, 0.533868551f, 0.533869028f,
+        0.32591626f, 0.325915694f, 0.325915962f, 0.939881504f, 0.939879835f, 0.939880669f,
+        0.149648741f, 0.149648488f, 0.149648607f, 0.83898288f, 0.83898145f, 0.838982165f,
+        0.827256143f, 0.827254772f, 0.827255368f, 0.813928545f, 0.813927114f, 0.813927829f,
+        0.916181326f, 0.916179717f, 0.916180491f, 0.900334537f, 0.900332928f, 0.900333762f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.919639409f, 0.919637859f, 0.919638574f,
+        0.655889332f, 0.655888259f, 0.655888736f, 0.705789804f, 0.705788612f, 0.705789268f,
+        0.856339693f, 0.856338203f, 0.856338918f, 0.50189513f, 0.501894295f, 0.501894712f,
+        0.654327214f, 0.654326081f, 0.654326618f, 0.989779711f, 0.989777982f, 0.989778876f,
+        0.925718367f, 0.925716877f, 0.925717652f, 0.789731264f, 0.789729893f, 0.789730608f,
+        0.895668566f, 0.895667017f, 0.895667732f, 0.806599975f, 0.806598604f, 0.8065992f,
+        0.892179966f, 0.892178416f, 0.892179191f, 0.576990485f, 0.576989472f, 0.576990008f,
+        0.974321425f, 0.974319696f, 0.974320531f, 0.782418013f, 0.782416642f, 0.782417357f,
+        0.866300225f, 0.866298795f, 0.86629945f, 0.86573559f, 0.86573416f, 0.865734875f,
+        0.960898578f, 0.960896909f, 0.960897684f, 0.954554975f, 0.954553306f, 0.9545542f,
+        0.923380733f, 0.923379183f, 0.923379958f, 0.927733898f, 0.927732348f, 0.927733064f,
+        0.939248621f, 0.939247072f, 0.939247787f, 0.902310908f, 0.902309358f, 0.902310073f,
+        0.936622381f, 0.936620712f, 0.936621487f, 0.543078601f, 0.543077648f, 0.543078065f,
+        0.619639695f, 0.619638681f, 0.619639158f, 0.867877603f, 0.867876172f, 0.867876828f,
+        0.908076465f, 0.908074975f, 0.90807569f, 0.942759693f, 0.942758083f, 0.942758858f,
+        0.777076542f, 0.777075171f, 0.777075887f, 0.9559986f, 0.955996931f, 0.955997705f,
+        0.818903148f, 0.818901777f, 0.818902433f, 0.938520372f, 0.938518822f, 0.938519537f,
+        0.978529871f, 0.978528142f, 0.978529096f, 0.508981526f, 0.508980691f, 0.508981049f,
+        0.838089466f, 0.838088036f, 0.838088751f, 0.564891934f, 0.56489104f, 0.564891458f,
+        0.529671133f, 0.529670179f, 0.529670715f, 0.980252028f, 0.980250418f, 0.980251193f,
+        0.786949039f, 0.786947787f, 0.786948383f, 0.982037485f, 0.982035875f, 0.98203665f,
+        0.89353025f, 0.8935287f, 0.893529475f, 0.388752997f, 0.388752311f, 0.388752669f,
+        0.944539011f, 0.944537342f, 0.944538176f, 0.959173799f, 0.95917213f, 0.959172845f,
+        0.805990219f, 0.805988729f, 0.805989444f, 0.86872977f, 0.86872834f, 0.868728995f,
+        0.958562911f, 0.958561301f, 0.958562076f, 0.725283682f, 0.725282431f, 0.725283027f,
+        0.92295897f, 0.92295742f, 0.922958195f, 0.646072447f, 0.646071255f, 0.646071851f,
+        0.871113122f, 0.871111572f, 0.871112347f, 0.797569275f, 0.797567904f, 0.797568619f,
+        0.965940773f, 0.965939224f, 0.965939939f, 0.775825381f, 0.77582407f, 0.775824785f,
+        0.620364904f, 0.620363772f, 0.620364368f, 0.97622478f, 0.976223111f, 0.976223946f,
+        0.392923623f, 0.392922968f, 0.392923325f, 0.933676183f, 0.933674574f, 0.933675349f,
+        0.928489685f, 0.928488076f, 0.928488851f, 0.922528505f, 0.922526896f, 0.92252773f,
+        0.966544867f, 0.966543257f, 0.966544032f, 0.959969282f, 0.959967673f, 0.959968507f,
+    },
+    {
+        0.72974062f, 0.729739308f, 0.729739964f, 0.730584741f, 0.730583489f, 0.730584085f,
+        0.730213463f, 0.730212271f, 0.730212927f, 0.934212327f, 0.934210718f, 0.934211552f,
+        0.0f, 0.0f, 0.0f, 0.889246285f, 0.889244735f, 0.88924545f,
+        0.918343246f, 0.918341637f, 0.918342412f, 0.730901837f, 0.730900586f, 0.730901182f,
+        0.394283593f, 0.394282907f, 0.394283295f, 0.974686146f, 0.974684536f, 0.974685311f,
+        0.395920545f, 0.395919889f, 0.395920247f, 0.937426388f, 0.937424839f, 0.937425554f,
+        0.630521238f, 0.630520105f, 0.630520701f, 0.899618745f, 0.899617195f, 0.89961791f,
+        0.666131556f, 0.666130424f, 0.66613102f, 0.933018208f, 0.933016598f, 0.933017313f,
+        0.490230829f, 0.490230054f, 0.490230441f, 0.483251214f, 0.48325038f, 0.483250797f,
+        0.608051002f, 0.608049989f, 0.608050466f, 0.554256916f, 0.554255962f, 0.554256439f,
+        0.544611514f, 0.54461062f, 0.544610977f, 0.269566447f, 0.269566f, 0.269566238f,
+        0.742889404f, 0.742888212f, 0.742888689f, 0.0950626433f, 0.0950624868f, 0.0950625464f,
+        0.392352641f, 0.392351985f, 0.392352283f, 0.898108661f, 0.898107111f, 0.898107886f,
+        0.901752234f, 0.901750624f, 0.901751399f, 0.900949001f, 0.900947392f, 0.900948167f,
+        0.457023025f, 0.45702225f, 0.457022607f, 0.746265709f, 0.746264398f, 0.746265054f,
+        0.664753437f, 0.664752245f, 0.664752781f, 0.716993332f, 0.71699208f, 0.716992736f,
+        0.304197103f, 0.304196596f, 0.304196835f, 0.473350853f, 0.473350048f, 0.473350465f,
+        0.697152436f, 0.697151303f, 0.69715184f, 0.888442814f, 0.888441265f, 0.88844198f,
+        0.943797112f, 0.943795502f, 0.943796277f, 0.903856456f, 0.903854847f, 0.903855622f,
+        0.59079659f, 0.590795517f, 0.590796053f, 0.693981588f, 0.693980396f, 0.693980932f,
+        0.915226579f, 0.915224969f, 0.915225744f, 0.701050639f, 0.701049507f, 0.701050103f,
+        0.813667536f, 0.813666224f, 0.81366694f, 0.765961051f, 0.765959799f, 0.765960395f,
+        0.476552784f, 0.47655195f, 0.476552367f, 0.749518931f, 0.749517679f, 0.749518275f,
+        0.934176803f, 0.934175253f, 0.934175968f, 0.0f, 0.0f, 0.0f,
+        0.580350876f, 0.580349863f, 0.58035028f, 0.503698826f, 0.503697991f, 0.503698349f,
+        0.715181768f, 0.715180457f, 0.715181112f, 0.924843848f, 0.924842238f, 0.924843013f,
+        0.912894428f, 0.912892938f, 0.912893713f, 0.34923932f, 0.349238724f, 0.349239051f,
+        0.760705352f, 0.760704041f, 0.760704696f, 0.306465685f, 0.306465149f, 0.306465387f,
+        0.913935959f, 0.91393429f, 0.913935065f, 0.731309414f, 0.731308103f, 0.731308758f,
+        0.798437536f, 0.798436165f, 0.79843688f, 0.468807042f, 0.468806267f, 0.468806654f,
+        0.767878711f, 0.7678774f, 0.767878115f, 0.490497559f, 0.490496665f, 0.490497142f,
+        0.686721325f, 0.686720192f, 0.686720729f, 0.620389402f, 0.620388389f, 0.620388865f,
+    },
+    {
+        0.72974062f, 0.729739308f, 0.729739964f, 0.740769804f, 0.740768492f, 0.740769088f,
+        0.735941887f, 0.735940576f, 0.735941231f, 0.880789042f, 0.880787492f, 0.880788267f,
+        0.920291781f, 0.920290112f, 0.920290947f, 0.368617505f, 0.368616879f, 0.368617177f,
+        0.703385651f, 0.703384519f, 0.703385055f, 0.743239939f, 0.743238628f, 0.743239284f,
+        0.829425693f, 0.829424262f, 0.829424977f, 0.555032432f, 0.555031478f, 0.555032015f,
+        0.776804507f, 0.776803195f, 0.776803792f, 0.81730628f, 0.81730485f, 0.817305446f,
+        0.755612969f, 0.755611718f, 0.755612314f, 0.335362315f, 0.335361749f, 0.335362047f,
+        0.801992953f, 0.801991582f, 0.801992297f, 0.895768702f, 0.895767152f, 0.895767868f,
+        0.919955134f, 0.919953585f, 0.9199543f, 0.686764598f, 0.686763525f, 0.686764002f,
+        0.716447234f, 0.716446042f, 0.716446698f, 0.818783343f, 0.818781972f, 0.818782687f,
+        0.935117364f, 0.935115814f, 0.935116529f, 0.890246749f, 0.890245199f, 0.890245974f,
+        0.823818564f, 0.823817134f, 0.823817849f, 0.855269015f, 0.855267584f, 0.85526824f,
+        0.863732874f, 0.863731384f, 0.8637321f, 0.318209738f, 0.318209171f, 0.31820944f,
+        0.356604636f, 0.35660404f, 0.356604338f, 0.68571955f, 0.685718417f, 0.685718954f,
+        0.680602849f, 0.680601656f, 0.680602193f, 0.912429929f, 0.912428379f, 0.912429154f,
+        0.576262057f, 0.576261103f, 0.57626158f, 0.920558691f, 0.920557141f, 0.920557857f,
+        0.904572785f, 0.904571176f, 0.90457195f, 0.901650906f, 0.901649356f, 0.90165019f,
+        0.869284809f, 0.869283259f, 0.869284093f, 0.368080229f, 0.368079573f, 0.368079871f,
+        0.615803003f, 0.61580193f, 0.615802467f, 0.286782414f, 0.286781877f, 0.286782146f,
+        0.768274248f, 0.768272996f, 0.768273592f, 0.825249612f, 0.825248122f, 0.825248778f,
+        0.892567039f, 0.892565548f, 0.892566264f, 0.823918581f, 0.82391715f, 0.823917806f,
+        0.849905312f, 0.849903762f, 0.849904597f, 0.62889272f, 0.628891647f, 0.628892124f,
+        0.841085851f, 0.84108448f, 0.841085076f, 0.716839194f, 0.716838002f, 0.716838598f,
+        0.569871068f, 0.569870114f, 0.569870591f, 0.91965425f, 0.9196527f, 0.919653535f,
+        0.804562569f, 0.804561198f, 0.804561853f, 0.747304857f, 0.747303605f, 0.747304142f,
+        0.84042412f, 0.84042263f, 0.840423405f, 0.39947468f, 0.399473995f, 0.399474293f,
+        0.63374728f, 0.633746207f, 0.633746743f, 0.816566229f, 0.816564858f, 0.816565573f,
+        0.733908474f, 0.733907223f, 0.733907878f, 0.889956832f, 0.889955282f, 0.889956057f,
+        0.359850347f, 0.359849721f, 0.359850019f, 0.783959568f, 0.783958137f, 0.783958912f,
+        0.662356853f, 0.662355721f, 0.662356257f, 0.691940784f, 0.691939592f, 0.691940129f,
+        0.911895394f, 0.911893845f, 0.91189456f, 0.701274753f, 0.701273561f, 0.701274097f,
+        0.93243289f, 0.932431281f, 0.932432115f, 0.749192238f, 0.749190986f, 0.749191642f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.467246681f, 0.467246085f, 0.467246413f, 1.011657f, 0.0f, 0.0f,
+        0.0f, 1.00208139f, 0.0f, 0.0f, 0.0f, 1.01366198f,
+        0.737302005f, 0.0f, 0.537401736f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.407231182f, 1.00161481f, 0.553099573f, 1.00901079f, 0.0527443998f, 1.01134777f,
+        0.340208143f, 1.00143743f, 0.719887733f, 1.01100147f, 0.192301363f, 0.423725754f,
+        0.669556141f, 0.986606121f, 0.803105533f, 0.302062064f, 0.187630028f, 1.01317906f,
+        0.889698446f, 1.00128198f, 0.0f, 1.010934f, 0.312190086f, 0.0f,
+        0.53673023f, 0.954162598f, 0.0f, 0.209734082f, 0.968248606f, 1.00295591f,
+        0.0f, 1.00099254f, 1.00222659f, 0.203169435f, 1.00202739f, 0.0f,
+        0.714111328f, 1.00157428f, 0.0f, 0.0993184373f, 1.00205016f, 0.0f,
+        1.0015564f, 1.0006336f, 0.65048337f, 0.0279084817f, 1.00185597f, 0.44905141f,
+        0.0935647041f, 1.00204849f, 0.0f, 0.058961913f, 0.129378766f, 1.01349247f,
+        0.366671801f, 0.164961845f, 1.01316488f, 1.00893712f, 0.121934898f, 1.01125503f,
+        0.160035729f, 1.00097132f, 1.00217891f, 1.00251746f, 1.00102568f, 0.122964248f,
+        0.28331852f, 0.657662272f, 1.00897634f, 1.00247526f, 1.00100851f, 0.192142978f,
+        0.269179702f, 0.831831098f, 0.0f, 0.560955703f, 1.00175333f, 0.0757606402f,
+        1.00254989f, 1.00103903f, 0.0f, 0.0597507916f, 0.0903719068f, 1.01356113f,
+        1.00796461f, 0.378617018f, 1.01003158f, 0.0774378628f, 0.0913355425f, 1.01355624f,
+        0.151030079f, 0.391904026f, 0.279604852f, 1.00252378f, 1.0010283f, 0.107696496f,
+        1.0104475f, 0.388938814f, 0.163823158f, 1.00259399f, 1.00105703f, 0.0f,
+        1.00653613f, 0.734638989f, 0.478370696f, 0.203811541f, 0.24344486f, 0.441754639f,
+        0.201185107f, 1.002002f, 0.080336459f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00792038f, 0.38568911f, 1.00997615f, 0.152369529f, 1.00203192f, 0.0f,
+        0.0f, 1.00206339f, 0.0f, 0.162126794f, 0.616237164f, 0.521432698f,
+        1.00182235f, 1.00074208f, 0.56395185f, 0.531039894f, 0.108285427f, 1.01298821f,
+        1.00897014f, 0.0983427241f, 1.01129651f, 0.0f, 0.771199882f, 0.445498407f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0853410959f, 0.726000726f, 0.0531134009f,
+        0.422630519f, 0.0897355005f, 1.01323402f, 1.0003897f, 1.00015771f, 0.927330792f,
+        0.30956021f, 0.205983043f, 0.390874922f, 0.0f, 1.00099993f, 1.00224328f,
+        1.00448763f, 0.89450264f, 0.174633652f, 0.373297751f, 1.00087559f, 1.00196469f,
+        1.00260603f, 1.00106204f, 0.0f, 0.710228622f, 1.00052273f, 1.00117397f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.467246681f, 0.467246085f, 0.467246413f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.729740381f, 0.729739487f, 0.729739964f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.430085391f, 0.430084825f, 0.430085152f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.371596843f, 0.371596396f, 0.371596634f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.678341866f, 0.678340971f, 0.678341448f, 0.310259432f, 0.310259044f, 0.310259283f,
+        0.889783442f, 0.889782369f, 0.889783025f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.547399282f, 0.547398627f, 0.547398984f, 0.267958581f, 0.267958254f, 0.267958432f,
+        0.174531654f, 0.17453143f, 0.174531549f, 0.253478497f, 0.253478169f, 0.253478378f,
+        0.719284952f, 0.719283998f, 0.719284534f, 0.18912144f, 0.189121202f, 0.189121366f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.172717333f, 0.172717124f, 0.172717214f,
+        0.186645895f, 0.186645687f, 0.186645806f, 0.11019896f, 0.110198811f, 0.110198885f,
+        0.371596843f, 0.371596396f, 0.371596634f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.237930387f, 0.237930074f, 0.237930238f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.306617737f, 0.306617349f, 0.306617558f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.29344216f, 0.293441802f, 0.293441981f, 0.572329581f, 0.572328806f, 0.572329223f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.109806783f, 0.109806657f, 0.109806709f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.119152151f, 0.119151995f, 0.119152069f,
+        0.161312923f, 0.161312729f, 0.161312848f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.206938386f, 0.206938148f, 0.206938237f,
+        0.252323151f, 0.252322853f, 0.252323031f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.218319327f, 0.218319073f, 0.218319222f,
+        0.127362728f, 0.127362579f, 0.127362654f, 0.189938039f, 0.189937785f, 0.189937919f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.530625701f, 0.530625045f, 0.530625463f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.133748636f, 0.133748472f, 0.133748576f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.143835932f, 0.143835738f, 0.143835843f,
+        0.425164253f, 0.425163805f, 0.425164104f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.308445036f, 0.308444619f, 0.308444858f, 0.144403085f, 0.144402921f, 0.14440304f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.404757291f, 0.404756844f, 0.404757082f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.719284952f, 0.719283998f, 0.719284534f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.467246681f, 0.467246085f, 0.467246413f, 0.0f, 0.0f, 0.0f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0985021442f, 0.0985020027f, 0.0985020921f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.200192958f, 0.20019269f, 0.200192824f,
+        0.985672772f, 0.985671461f, 0.985672176f, 0.195540115f, 0.195539877f, 0.195539981f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.315627754f, 0.315627366f, 0.315627575f,
+        0.952485323f, 0.95248419f, 0.952484787f, 0.967404068f, 0.967402816f, 0.967403531f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.140958831f, 0.140958682f, 0.140958756f,
+        0.174531654f, 0.17453143f, 0.174531549f, 0.144967616f, 0.144967452f, 0.144967571f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.658181548f, 0.658180714f, 0.65818125f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.830206215f, 0.830205202f, 0.830205798f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.107417576f, 0.107417449f, 0.107417524f,
+        0.384434998f, 0.384434521f, 0.384434789f, 0.108221009f, 0.108220883f, 0.108220957f,
+        0.391349971f, 0.391349494f, 0.391349792f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.391349971f, 0.391349494f, 0.391349792f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.734901249f, 0.734900355f, 0.734900832f, 0.244051263f, 0.24405098f, 0.244051144f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.391349971f, 0.391349494f, 0.391349792f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.615462184f, 0.615461409f, 0.615461826f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.125370443f, 0.125370309f, 0.125370368f,
+        0.126702815f, 0.126702666f, 0.126702756f, 0.769873619f, 0.769872725f, 0.769873321f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.724535286f, 0.724534392f, 0.724534869f,
+        0.10901735f, 0.109017231f, 0.109017298f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.206938386f, 0.206938148f, 0.206938237f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.893857598f, 0.893856466f, 0.893857181f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.467246681f, 0.467246085f, 0.467246413f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.532520771f, 0.532520115f, 0.532520473f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.568848252f, 0.568847477f, 0.568847895f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.727143407f, 0.727142513f, 0.72714299f, 0.425164253f, 0.425163805f, 0.425164104f,
+        0.80764091f, 0.807639837f, 0.807640493f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.145529523f, 0.14552933f, 0.145529449f, 0.0859024599f, 0.0859023407f, 0.0859024152f,
+        0.158306748f, 0.158306569f, 0.158306658f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0837598145f, 0.0837597176f, 0.0837597623f,
+        0.148847625f, 0.148847431f, 0.14884752f, 0.0895051286f, 0.0895050317f, 0.0895050913f,
+        0.664016664f, 0.66401583f, 0.664016366f, 0.471646458f, 0.471645921f, 0.471646279f,
+        0.106606871f, 0.106606722f, 0.106606804f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.229029313f, 0.229029015f, 0.229029253f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.267958581f, 0.267958254f, 0.267958432f,
+        0.139788076f, 0.139787883f, 0.139787972f, 0.200955868f, 0.200955629f, 0.200955793f,
+        0.192362905f, 0.192362681f, 0.192362815f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.282569051f, 0.282568723f, 0.282568902f, 0.222408175f, 0.222407907f, 0.222408056f,
+        0.190750435f, 0.190750211f, 0.190750331f, 0.12196283f, 0.121962667f, 0.121962763f,
+        0.49086377f, 0.490863144f, 0.490863472f, 0.437342823f, 0.437342316f, 0.437342614f,
+        0.198656529f, 0.198656291f, 0.198656425f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.139198244f, 0.139198065f, 0.139198154f,
+        0.103287295f, 0.103287198f, 0.103287265f, 0.522962689f, 0.522962093f, 0.522962451f,
+        0.582624257f, 0.582623601f, 0.582624018f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.456023425f, 0.456022859f, 0.456023216f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.142118052f, 0.142117903f, 0.142117992f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.929566324f, 0.929565191f, 0.929565907f,
+        0.387218803f, 0.387218297f, 0.387218565f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.244051263f, 0.24405098f, 0.244051144f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.0909970105f, 0.0909969136f, 0.0909969807f, 1.00000024f, 0.999999046f, 0.999999702f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.467246681f, 0.467246085f, 0.467246413f, 0.553543746f, 0.553543091f, 0.553543448f,
+        0.835876644f, 0.835875571f, 0.835876226f, 0.264653265f, 0.264652938f, 0.264653087f,
+        0.407818943f, 0.407818437f, 0.407818675f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.904819131f, 0.904817998f, 0.904818654f, 0.492444694f, 0.492444068f, 0.492444456f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.89147234f, 0.891471267f, 0.891471863f,
+        0.838565648f, 0.838564634f, 0.83856523f, 0.851959646f, 0.851958632f, 0.851959229f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.388980746f, 0.388980299f, 0.388980567f,
+        0.968118012f, 0.96811682f, 0.968117535f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.655838788f, 0.655837953f, 0.65583843f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.707222283f, 0.707221389f, 0.707221925f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.285211444f, 0.285211086f, 0.285211295f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.679249346f, 0.679248571f, 0.679249048f,
+        0.341091484f, 0.341091096f, 0.341091365f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.826157272f, 0.826156259f, 0.826156855f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.250301182f, 0.250300884f, 0.250301033f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.898228288f, 0.898227215f, 0.898227811f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.534123838f, 0.534123123f, 0.53412354f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.707525671f, 0.707524836f, 0.707525313f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.653303683f, 0.653302968f, 0.653303385f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.609387815f, 0.60938704f, 0.609387457f,
+        0.863706768f, 0.863705635f, 0.863706291f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.251977146f, 0.251976848f, 0.251977026f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.732344806f, 0.732343912f, 0.732344389f, 0.787849903f, 0.787848949f, 0.787849486f,
+        0.932307422f, 0.932306349f, 0.932306886f, 0.558491468f, 0.558490753f, 0.55849117f,
+        0.689184725f, 0.689183891f, 0.689184368f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.961838543f, 0.961837292f, 0.961838067f, 0.74933064f, 0.749329746f, 0.749330282f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.956254542f, 0.95625335f, 0.956254005f,
+        0.933492362f, 0.93349117f, 0.933491945f, 0.939353049f, 0.939351976f, 0.939352632f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.674442232f, 0.674441338f, 0.674441814f,
+        0.987526119f, 0.987524867f, 0.987525582f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.845543742f, 0.845542729f, 0.845543325f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.871964931f, 0.871963918f, 0.871964455f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.580535173f, 0.580534458f, 0.580534816f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.857768655f, 0.857767582f, 0.857768118f,
+        0.634128332f, 0.634127557f, 0.634127975f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.928000629f, 0.927999437f, 0.928000212f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.542174041f, 0.542173386f, 0.542173803f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.959088683f, 0.959087491f, 0.959088206f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.775982857f, 0.775981963f, 0.775982499f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.872116566f, 0.872115433f, 0.872116148f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.844200253f, 0.844199181f, 0.844199836f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.820269763f, 0.82026875f, 0.820269287f,
+        0.944437385f, 0.944436133f, 0.944436848f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.544122577f, 0.544121981f, 0.544122338f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+    },
+    {
+        0.729740381f, 0.729739487f, 0.729739964f, 0.730727613f, 0.730726719f, 0.730727196f,
+        0.730305552f, 0.730304658f, 0.730305135f, 0.984334171f, 0.984332919f, 0.984333575f,
+        0.0f, 0.0f, 0.0f, 0.920288026f, 0.920286894f, 0.920287549f,
+        0.959000528f, 0.958999395f, 0.959000051f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.552954912f, 0.552954257f, 0.552954674f, 0.985212922f, 0.985211611f, 0.985212386f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.369500995f, 0.369500577f, 0.369500816f, 0.420743048f, 0.420742512f, 0.42074281f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+        0.875437856f, 0.875436902f, 0.875437498f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.956924617f, 0.956923425f, 0.95692414f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.452276021f, 0.452275455f, 0.452275783f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.759074628f, 0.759073675f, 0.759074211f, 0.969876468f, 0.969875336f, 0.969875991f,
+        0.096224919f, 0.0962248072f, 0.0962248743f, 0.0f, 0.0f, 0.0f,
+        0.572432637f, 0.572431862f, 0.57243228f, 0.914392769f, 0.914391696f, 0.914392292f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.564503193f, 0.564502537f, 0.564502954f, 0.0f, 0.0f, 0.0f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.752116442f, 0.752115428f, 0.752116024f,
+        0.0f, 0.0f, 0.0f, 0.999885261f, 0.999884009f, 0.999884725f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.471382529f, 0.471381962f, 0.47138229f,
+        0.725578308f, 0.725577295f, 0.725577891f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.188598186f, 0.188597977f, 0.188598096f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.805202544f, 0.80520159f, 0.805202127f, 0.628115416f, 0.628114641f, 0.628115118f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        0.632984161f, 0.632983327f, 0.632983804f, 0.0f, 0.0f, 0.0f,
+    },
+    {
+        0.729740381f, 0.729739487f, 0.729739964f, 0.742621958f, 0.742621064f, 0.742621601f,
+        0.737146318f, 0.737145424f, 0.73714596f, 0.967419326f, 0.967418134f, 0.96741879f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.211306781f, 0.211306542f, 0.211306706f,
+        0.678846061f, 0.678845286f, 0.678845763f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        0.848068595f, 0.848067522f, 0.848068118f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.776960671f, 0.776959658f, 0.776960135f, 0.0f, 0.0f, 0.0f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.991590202f, 0.99158901f, 0.991589785f, 0.657610238f, 0.657609463f, 0.65760994f,
+        0.337198347f, 0.33719787f, 0.337198108f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.927278161f, 0.927277029f, 0.927277744f, 0.975429416f, 0.975428224f, 0.975428939f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.486144453f, 0.486143887f, 0.486144215f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.3750709f, 0.375070423f, 0.375070661f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.960939348f, 0.960938156f, 0.960938811f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.225141808f, 0.22514151f, 0.225141644f,
+        0.577263117f, 0.577262402f, 0.577262759f, 0.0f, 0.0f, 0.0f,
+        0.763762057f, 0.763761163f, 0.76376164f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.995849729f, 0.995848477f, 0.995849252f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.978297532f, 0.97829628f, 0.978296936f, 0.634377182f, 0.634376407f, 0.634376884f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.742040694f, 0.7420398f, 0.742040277f,
+        0.898949862f, 0.898948789f, 0.898949385f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.817300141f, 0.817299128f, 0.817299724f,
+        0.784207106f, 0.784206152f, 0.784206748f, 0.930288494f, 0.930287302f, 0.930287957f,
+        0.0f, 0.0f, 0.0f, 1.00000024f, 0.999999046f, 0.999999702f,
+        0.662785172f, 0.662784338f, 0.662784815f, 0.0f, 0.0f, 0.0f,
+        1.00000024f, 0.999999046f, 0.999999702f, 0.669123411f, 0.669122517f, 0.669123054f,
+        1.00000024f, 0.999999046f, 0.999999702f, 1.00000024f, 0.999999046f, 0.999999702f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807526767f, 0.807525694f, 0.80752635f,
+        0.366292745f, 0.366292387f, 0.366292745f, 0.762386858f, 0.136562422f, 0.124898218f,
+        0.180110157f, 0.801006138f, 0.168961465f, 0.0f, 0.0484814085f, 0.806249678f,
+        0.624142587f, 0.106248602f, 0.437543422f, 0.974738479f, 0.973655224f, 0.971395552f,
+        0.462404072f, 0.933925092f, 0.56964922f, 0.887124538f, 0.199286953f, 0.964035928f,
+        0.343663275f, 0.865347683f, 0.654322922f, 0.949664533f, 0.337497443f, 0.397903472f,
+        0.610645413f, 0.798291743f, 0.706237257f, 0.19631575f, 0.122210667f, 0.934931457f,
+        0.87264955f, 0.970560193f, 0.762490332f, 0.903768361f, 0.299091011f, 0.175247937f,
+        0.485372186f, 0.781974077f, 0.194236755f, 0.241253212f, 0.787885249f, 0.824585199f,
+        0.688512444f, 0.966693401f, 0.969383955f, 0.687365592f, 0.96691227f, 0.66527909f,
+        0.661192596f, 0.893438458f, 0.248717502f, 0.420073897f, 0.952722371f, 0.392581582f,
+        0.916556239f, 0.840692103f, 0.620899022f, 0.25568381f, 0.901827395f, 0.44646132f,
+        0.51064539f, 0.959761739f, 0.491541535f, 0.036069531f, 0.0854007527f, 0.908118069f,
+        0.302199632f, 0.167940304f, 0.97236824f, 0.96429342f, 0.534755349f, 0.837725937f,
+        0.274993777f, 0.886252224f, 0.933628857f, 0.959818482f, 0.84438771f, 0.366782427f,
+        0.227842078f, 0.574437261f, 0.893141508f, 0.95110333f, 0.894434333f, 0.366245419f,
+        0.238887548f, 0.711918712f, 0.161974981f, 0.610167742f, 0.948112071f, 0.381533265f,
+        0.962216377f, 0.96222645f, 0.571293652f, 0.0298041478f, 0.065410614f, 0.814751565f,
+        0.950631738f, 0.399991453f, 0.936953485f, 0.0785438344f, 0.0999123901f, 0.965607882f,
+        0.0947759748f, 0.278010458f, 0.173261791f, 0.941619575f, 0.96956569f, 0.708471775f,
+        0.881857872f, 0.348537773f, 0.185762227f, 0.956090987f, 0.969966114f, 0.716875553f,
+        0.932827652f, 0.684225738f, 0.456920773f, 0.106634006f, 0.134776101f, 0.325255871f,
+        0.592534304f, 0.963151395f, 0.576494396f, 0.913295388f, 0.886651695f, 0.96622467f,
+        0.841159463f, 0.362838209f, 0.966516018f, 0.228184372f, 0.826418638f, 0.192692176f,
+        0.719291031f, 0.968320191f, 0.716314435f, 0.146121949f, 0.527730584f, 0.43104735f,
+        0.84410584f, 0.821143687f, 0.537956297f, 0.444270998f, 0.124991857f, 0.960458517f,
+        0.96740371f, 0.525499582f, 0.967776179f, 0.157294676f, 0.668474436f, 0.370628029f,
+        0.960437238f, 0.894023597f, 0.937104464f, 0.151747599f, 0.631354809f, 0.143283144f,
+        0.343854487f, 0.131524578f, 0.969837129f, 0.967265606f, 0.937841058f, 0.821007967f,
+        0.190447539f, 0.109702818f, 0.271029055f, 0.383306593f, 0.94336623f, 0.96558249f,
+        0.957827151f, 0.796386063f, 0.342355818f, 0.409328431f, 0.911661327f, 0.91504246f,
+        0.937144339f, 0.937364519f, 0.348257691f, 0.734615982f, 0.95811069f, 0.877675056f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807526767f, 0.807525694f, 0.80752629f,
+        0.366292745f, 0.366292298f, 0.366292566f, 0.753819525f, 0.753818631f, 0.753819168f,
+        0.216700494f, 0.216700181f, 0.21670036f, 0.0679696798f, 0.067969583f, 0.06796965f,
+        0.617809892f, 0.617809176f, 0.617809594f, 0.974698901f, 0.974697709f, 0.974698424f,
+        0.477983505f, 0.477982879f, 0.477983236f, 0.879927993f, 0.87992692f, 0.879927516f,
+        0.36577937f, 0.365778953f, 0.365779191f, 0.939988077f, 0.939986825f, 0.9399876f,
+        0.61556673f, 0.615566015f, 0.615566432f, 0.209392339f, 0.209392056f, 0.209392205f,
+        0.87413615f, 0.874135137f, 0.874135673f, 0.894162178f, 0.894160986f, 0.894161642f,
+        0.492282808f, 0.492282212f, 0.492282569f, 0.273890674f, 0.273890287f, 0.273890525f,
+        0.69718802f, 0.697187185f, 0.697187722f, 0.694056571f, 0.694055796f, 0.694056273f,
+        0.66524756f, 0.665246785f, 0.665247202f, 0.438380957f, 0.43838039f, 0.438380718f,
+        0.913817942f, 0.91381681f, 0.913817465f, 0.288811743f, 0.288811445f, 0.288811624f,
+        0.524014652f, 0.524014056f, 0.524014473f, 0.0915345475f, 0.0915344357f, 0.0915344954f,
+        0.309282392f, 0.309281975f, 0.309282213f, 0.957378745f, 0.957377553f, 0.957378268f,
+        0.311247915f, 0.311247557f, 0.311247766f, 0.955594242f, 0.955593109f, 0.955593765f,
+        0.250874043f, 0.250873715f, 0.250873923f, 0.94793731f, 0.947936118f, 0.947936833f,
+        0.258916527f, 0.258916259f, 0.258916438f, 0.618021607f, 0.618020833f, 0.618021309f,
+        0.960571647f, 0.960570395f, 0.96057117f, 0.0811552405f, 0.0811551437f, 0.0811552033f,
+        0.943315566f, 0.943314373f, 0.943315029f, 0.116547234f, 0.116547108f, 0.116547182f,
+        0.103151701f, 0.103151567f, 0.103151649f, 0.94108057f, 0.941079438f, 0.941080153f,
+        0.872830391f, 0.872829318f, 0.872829914f, 0.955242038f, 0.955240846f, 0.955241501f,
+        0.926847875f, 0.926846743f, 0.926847398f, 0.11004512f, 0.110044993f, 0.110045075f,
+        0.602439523f, 0.602438867f, 0.602439284f, 0.913083911f, 0.913082778f, 0.913083434f,
+        0.835574746f, 0.835573733f, 0.835574269f, 0.258093059f, 0.258092731f, 0.25809294f,
+        0.725162446f, 0.725161552f, 0.725162089f, 0.168314353f, 0.168314144f, 0.168314248f,
+        0.842332542f, 0.842331469f, 0.842332065f, 0.445505142f, 0.445504546f, 0.445504904f,
+        0.961013019f, 0.961011946f, 0.961012602f, 0.188205048f, 0.188204795f, 0.188204944f,
+        0.959061623f, 0.959060371f, 0.959061146f, 0.178590909f, 0.17859067f, 0.178590789f,
+        0.348683119f, 0.348682642f, 0.34868294f, 0.96596545f, 0.965964198f, 0.965964973f,
+        0.189813077f, 0.189812824f, 0.189812973f, 0.409908235f, 0.409907699f, 0.409907997f,
+        0.952815831f, 0.952814639f, 0.952815354f, 0.431197137f, 0.43119666f, 0.431196928f,
+        0.935066283f, 0.93506515f, 0.935065746f, 0.740662038f, 0.740661204f, 0.740661621f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807526767f, 0.807525694f, 0.80752635f,
+        0.366292834f, 0.366292387f, 0.366292626f, 0.142210618f, 0.142210409f, 0.142210528f,
+        0.79943651f, 0.799435496f, 0.799436152f, 0.0679697692f, 0.0679696798f, 0.067969732f,
+        0.1134037f, 0.113403589f, 0.113403641f, 0.973653674f, 0.973652422f, 0.973653078f,
+        0.932553589f, 0.932552397f, 0.932553053f, 0.210421979f, 0.210421696f, 0.21042183f,
+        0.864189982f, 0.86418891f, 0.864189506f, 0.340556592f, 0.340556204f, 0.340556443f,
+        0.797744215f, 0.79774332f, 0.797743797f, 0.132900968f, 0.132900789f, 0.132900894f,
+        0.969945371f, 0.969944239f, 0.969944894f, 0.301940113f, 0.301939726f, 0.301939934f,
+        0.780695975f, 0.780695081f, 0.780695558f, 0.787249029f, 0.787248075f, 0.787248671f,
+        0.966196656f, 0.966195464f, 0.966196179f, 0.965843797f, 0.965842605f, 0.96584326f,
+        0.892137408f, 0.892136335f, 0.892136991f, 0.951084793f, 0.951083601f, 0.951084316f,
+        0.840442538f, 0.840441585f, 0.840442181f, 0.900251746f, 0.900250673f, 0.900251329f,
+        0.95827961f, 0.958278477f, 0.958279133f, 0.099849008f, 0.0998488739f, 0.0998489559f,
+        0.176264957f, 0.176264718f, 0.176264882f, 0.537094414f, 0.537093699f, 0.537094116f,
+        0.8855533f, 0.885552227f, 0.885552883f, 0.843924224f, 0.843923092f, 0.843923748f,
+        0.574921608f, 0.574920893f, 0.57492125f, 0.893764794f, 0.893763721f, 0.893764317f,
+        0.710565507f, 0.710564613f, 0.71056515f, 0.94667691f, 0.946675777f, 0.946676373f,
+        0.961545348f, 0.961544216f, 0.961544871f, 0.0805972442f, 0.0805971548f, 0.0805971995f,
+        0.404514045f, 0.404513568f, 0.404513866f, 0.113847755f, 0.113847621f, 0.113847718f,
+        0.277574003f, 0.277573645f, 0.277573854f, 0.969004869f, 0.969003618f, 0.969004393f,
+        0.35057658f, 0.350576162f, 0.350576341f, 0.969447732f, 0.96944654f, 0.969447196f,
+        0.684471011f, 0.684470177f, 0.684470654f, 0.135552093f, 0.135551959f, 0.135552034f,
+        0.961847961f, 0.961846769f, 0.961847425f, 0.886903584f, 0.886902392f, 0.886903107f,
+        0.367603719f, 0.367603272f, 0.36760357f, 0.824823678f, 0.824822605f, 0.824823201f,
+        0.967372537f, 0.967371404f, 0.967372179f, 0.527041733f, 0.527041137f, 0.527041554f,
+        0.820678949f, 0.820677936f, 0.820678532f, 0.137521222f, 0.137521058f, 0.137521163f,
+        0.528508782f, 0.528508127f, 0.528508544f, 0.667334437f, 0.667333603f, 0.667334139f,
+        0.894277215f, 0.894276142f, 0.894276798f, 0.630125046f, 0.630124271f, 0.630124748f,
+        0.14282693f, 0.142826736f, 0.142826825f, 0.937660336f, 0.937659204f, 0.93765986f,
+        0.110674314f, 0.110674165f, 0.110674247f, 0.942612588f, 0.942611396f, 0.942612112f,
+        0.796084344f, 0.796083391f, 0.796083987f, 0.910921574f, 0.910920382f, 0.910921097f,
+        0.936501324f, 0.936500192f, 0.936500967f, 0.957516909f, 0.957515657f, 0.957516372f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807526767f, 0.807525694f, 0.80752635f,
+        0.366292924f, 0.366292477f, 0.366292745f, 0.138591826f, 0.138591617f, 0.138591737f,
+        0.21670036f, 0.216700107f, 0.216700241f, 0.795430899f, 0.795429945f, 0.795430541f,
+        0.433994412f, 0.433993816f, 0.433994174f, 0.971467674f, 0.971466482f, 0.971467197f,
+        0.581539273f, 0.581538558f, 0.581538975f, 0.953197181f, 0.953195989f, 0.953196704f,
+        0.65941757f, 0.659416735f, 0.659417212f, 0.401549131f, 0.401548654f, 0.401548952f,
+        0.708248854f, 0.70824796f, 0.708248436f, 0.922554016f, 0.922552824f, 0.922553539f,
+        0.768986762f, 0.768985808f, 0.768986344f, 0.192347839f, 0.192347616f, 0.192347735f,
+        0.235796005f, 0.235795736f, 0.235795885f, 0.822026849f, 0.822025836f, 0.822026432f,
+        0.96819979f, 0.968198538f, 0.968199193f, 0.674774826f, 0.674773991f, 0.674774468f,
+        0.291760534f, 0.291760206f, 0.291760385f, 0.418123871f, 0.418123364f, 0.418123692f,
+        0.629230082f, 0.629229307f, 0.629229724f, 0.463771403f, 0.463770777f, 0.463771105f,
+        0.509642541f, 0.509641945f, 0.509642303f, 0.895972073f, 0.895970941f, 0.895971596f,
+        0.959696412f, 0.95969528f, 0.959695935f, 0.832507968f, 0.832506835f, 0.832507491f,
+        0.930599034f, 0.930597842f, 0.930598557f, 0.393011183f, 0.393010676f, 0.393010974f,
+        0.885059416f, 0.885058284f, 0.885058939f, 0.395583868f, 0.395583361f, 0.3955836f,
+        0.201642349f, 0.201642126f, 0.201642215f, 0.409101754f, 0.409101248f, 0.409101546f,
+        0.587385595f, 0.58738488f, 0.587385297f, 0.803839207f, 0.803838193f, 0.803838789f,
+        0.928128541f, 0.928127348f, 0.928128064f, 0.952713907f, 0.952712715f, 0.952713311f,
+        0.176483914f, 0.176483706f, 0.176483825f, 0.717599392f, 0.717598498f, 0.717599094f,
+        0.203049809f, 0.20304957f, 0.203049675f, 0.725745261f, 0.725744367f, 0.725744843f,
+        0.467848629f, 0.467848033f, 0.46784839f, 0.321476728f, 0.32147634f, 0.321476549f,
+        0.589841843f, 0.589841127f, 0.589841545f, 0.964120746f, 0.964119554f, 0.96412015f,
+        0.956368744f, 0.956367552f, 0.956368268f, 0.237321898f, 0.237321615f, 0.237321779f,
+        0.723798037f, 0.723797143f, 0.723797679f, 0.432885557f, 0.432884991f, 0.432885379f,
+        0.5490188f, 0.549018145f, 0.549018502f, 0.948063552f, 0.94806242f, 0.948063076f,
+        0.959759593f, 0.959758401f, 0.959759116f, 0.380770653f, 0.380770177f, 0.380770475f,
+        0.936190307f, 0.936189115f, 0.936189771f, 0.178258374f, 0.178258166f, 0.178258285f,
+        0.957158387f, 0.957157254f, 0.95715791f, 0.824887991f, 0.824887037f, 0.824887633f,
+        0.268081903f, 0.268081576f, 0.268081784f, 0.963212311f, 0.963211119f, 0.963211834f,
+        0.368246913f, 0.368246466f, 0.368246764f, 0.913302839f, 0.913301706f, 0.913302362f,
+        0.382571101f, 0.382570684f, 0.382570922f, 0.879136503f, 0.87913543f, 0.879136145f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.807526767f, 0.807525694f, 0.80752635f,
+        0.366292804f, 0.366292328f, 0.366292566f, 0.42991665f, 0.429916114f, 0.429916412f,
+        0.676480353f, 0.676479518f, 0.676479995f, 0.217887521f, 0.217887282f, 0.217887387f,
+        0.364433438f, 0.364432991f, 0.364433229f, 0.973821163f, 0.973819911f, 0.973820567f,
+        0.821040034f, 0.821039021f, 0.821039617f, 0.556671679f, 0.556671023f, 0.556671321f,
+        0.755849361f, 0.755848467f, 0.755848944f, 0.585336208f, 0.585335553f, 0.58533597f,
+        0.748539686f, 0.748538733f, 0.748539269f, 0.281812966f, 0.281812578f, 0.281812817f,
+        0.935185671f, 0.935184598f, 0.935185254f, 0.544587374f, 0.544586658f, 0.544587076f,
+        0.695957482f, 0.695956647f, 0.695957065f, 0.694842219f, 0.694841385f, 0.694841921f,
+        0.902561307f, 0.902560174f, 0.90256083f, 0.887438357f, 0.887437224f, 0.88743788f,
+        0.815823793f, 0.81582278f, 0.815823376f, 0.825557113f, 0.825556099f, 0.825556695f,
+        0.851718664f, 0.851717651f, 0.851718247f, 0.769914329f, 0.769913316f, 0.769913912f,
+        0.845698416f, 0.845697343f, 0.845697999f, 0.251077771f, 0.251077443f, 0.251077622f,
+        0.325132728f, 0.32513234f, 0.325132608f, 0.699080467f, 0.699079573f, 0.69908005f,
+        0.782280803f, 0.782279789f, 0.782280385f, 0.859816611f, 0.859815478f, 0.859816074f,
+        0.535890639f, 0.535889983f, 0.535890341f, 0.890863299f, 0.890862167f, 0.890862823f,
+        0.60694927f, 0.606948555f, 0.606948972f, 0.850046217f, 0.850045145f, 0.850045741f,
+        0.945590615f, 0.945589542f, 0.945590198f, 0.223288104f, 0.223287791f, 0.223287985f,
+        0.641867042f, 0.641866267f, 0.641866684f, 0.270481944f, 0.270481616f, 0.270481795f,
+        0.23978813f, 0.239787847f, 0.239788011f, 0.949872792f, 0.949871659f, 0.949872315f,
+        0.552050173f, 0.552049518f, 0.552049875f, 0.954327464f, 0.954326272f, 0.954327047f,
+        0.751362622f, 0.751361787f, 0.751362264f, 0.147547469f, 0.147547305f, 0.147547424f,
+        0.863942087f, 0.863941014f, 0.863941669f, 0.898430645f, 0.898429573f, 0.898430228f,
+        0.58428055f, 0.584279835f, 0.584280312f, 0.700772107f, 0.700771213f, 0.700771689f,
+        0.896971285f, 0.896970153f, 0.896970749f, 0.457077205f, 0.457076639f, 0.457076937f,
+        0.814885318f, 0.814884305f, 0.814884961f, 0.354738027f, 0.35473758f, 0.354737848f,
+        0.705519021f, 0.705518126f, 0.705518603f, 0.569852591f, 0.569851875f, 0.569852293f,
+        0.914716661f, 0.914715469f, 0.914716125f, 0.533869326f, 0.53386867f, 0.533868968f,
+        0.325916141f, 0.325915724f, 0.325915962f, 0.939881086f, 0.939879954f, 0.93988061f,
+        0.149648681f, 0.149648502f, 0.149648607f, 0.838982522f, 0.838981569f, 0.838982165f,
+        0.827255845f, 0.827254891f, 0.827255368f, 0.813928187f, 0.813927233f, 0.813927829f,
+        0.916180909f, 0.916179836f, 0.916180491f, 0.90033412f, 0.900333047f, 0.900333703f,
+    },
+    {
+        0.0f, 0.0f, 0.0f, 0.919639051f, 0.919637918f, 0.919638574f,
+        0.655889153f, 0.655888379f, 0.655888736f, 0.705789566f, 0.705788791f, 0.705789268f,
+        0.856339455f, 0.856338322f, 0.856338978f, 0.501894951f, 0.501894355f, 0.501894712f,
+        0.654326975f, 0.654326141f, 0.654326618f, 0.989779353f, 0.989778101f, 0.989778876f,
+        0.925718069f, 0.925716996f, 0.925717652f, 0.789731026f, 0.789730012f, 0.789730608f,
+        0.895668209f, 0.895667136f, 0.895667732f, 0.806599617f, 0.806598663f, 0.8065992f,
+        0.892179608f, 0.892178535f, 0.892179191f, 0.576990306f, 0.576989591f, 0.576989949f,
+        0.974321067f, 0.974319816f, 0.974320531f, 0.782417774f, 0.782416761f, 0.782417357f,
+        0.866299868f, 0.866298854f, 0.86629945f, 0.865735352f, 0.865734279f, 0.865734875f,
+        0.960898221f, 0.960897088f, 0.960897684f, 0.954554617f, 0.954553425f, 0.954554141f,
+        0.923380375f, 0.923379242f, 0.923379958f, 0.9277336f, 0.927732408f, 0.927733064f,
+        0.939248264f, 0.939247131f, 0.939247787f, 0.90231055f, 0.902309477f, 0.902310073f,
+        0.936622024f, 0.936620831f, 0.936621487f, 0.543078363f, 0.543077707f, 0.543078065f,
+        0.619639516f, 0.619638801f, 0.619639158f, 0.867877245f, 0.867876232f, 0.867876828f,
+        0.908076167f, 0.908075035f, 0.90807569f, 0.942759395f, 0.942758203f, 0.942758858f,
+        0.777076244f, 0.777075291f, 0.777075887f, 0.955998302f, 0.95599705f, 0.955997705f,
+        0.81890291f, 0.818901896f, 0.818902493f, 0.938520014f, 0.938518882f, 0.938519537f,
+        0.978529572f, 0.978528321f, 0.978529096f, 0.508981287f, 0.508980691f, 0.508981049f,
+        0.838089168f, 0.838088155f, 0.838088751f, 0.564891696f, 0.56489104f, 0.564891458f,
+        0.529670894f, 0.529670298f, 0.529670656f, 0.98025167f, 0.980250537f, 0.980251193f,
+        0.7869488f, 0.786947787f, 0.786948383f, 0.982037127f, 0.982035995f, 0.98203665f,
+        0.893529892f, 0.893528759f, 0.893529475f, 0.388752848f, 0.388752401f, 0.388752669f,
+        0.944538653f, 0.944537461f, 0.944538176f, 0.959173381f, 0.959172189f, 0.959172845f,
+        0.805989861f, 0.805988848f, 0.805989444f, 0.868729532f, 0.868728459f, 0.868729055f,
+        0.958562553f, 0.95856142f, 0.958562076f, 0.725283444f, 0.72528249f, 0.725283086f,
+        0.922958612f, 0.92295748f, 0.922958136f, 0.646072149f, 0.646071315f, 0.646071851f,
+        0.871112764f, 0.871111691f, 0.871112347f, 0.797569036f, 0.797568023f, 0.797568619f,
+        0.965940416f, 0.965939283f, 0.965939939f, 0.775825083f, 0.775824249f, 0.775824785f,
+        0.620364666f, 0.620363891f, 0.620364368f, 0.976224422f, 0.976223171f, 0.976223946f,
+        0.392923474f, 0.392923027f, 0.392923325f, 0.933675766f, 0.933674693f, 0.933675349f,
+        0.928489387f, 0.928488195f, 0.928488851f, 0.922528207f, 0.922527015f, 0.922527611f,
+        0.966544509f, 0.966543376f, 0.966544032f, 0.959968925f, 0.959967792f, 0.959968448f,
+    },
+    {
+        0.729740381f, 0.729739487f, 0.729739964f, 0.730584502f, 0.730583608f, 0.730584085f,
+        0.730213225f, 0.730212331f, 0.730212927f, 0.934212029f, 0.934210837f, 0.934211493f,
+        0.0f, 0.0f, 0.0f, 0.889245927f, 0.889244854f, 0.88924545f,
+        0.918342829f, 0.918341696f, 0.918342412f, 0.730901539f, 0.730900705f, 0.730901182f,
+        0.394283473f, 0.394282997f, 0.394283235f, 0.974685729f, 0.974684596f, 0.974685311f,
+        0.395920426f, 0.395919979f, 0.395920247f, 0.937426031f, 0.937424958f, 0.937425613f,
+        0.63052094f, 0.630520225f, 0.630520701f, 0.899618387f, 0.899617314f, 0.89961791f,
+        0.666131318f, 0.666130602f, 0.66613102f, 0.93301785f, 0.933016717f, 0.933017313f,
+        0.49023068f, 0.490230054f, 0.490230441f, 0.483251065f, 0.483250469f, 0.483250797f,
+        0.608050764f, 0.608050048f, 0.608050466f, 0.554256737f, 0.554256082f, 0.554256439f,
+        0.544611335f, 0.54461062f, 0.544610977f, 0.269566387f, 0.269566089f, 0.269566238f,
+        0.742889106f, 0.742888212f, 0.742888689f, 0.095062606f, 0.0950624868f, 0.0950625464f,
+        0.392352462f, 0.392352015f, 0.392352283f, 0.898108304f, 0.898107171f, 0.898107886f,
+        0.901751876f, 0.901750803f, 0.901751399f, 0.900948644f, 0.900947511f, 0.900948167f,
+        0.457022846f, 0.457022339f, 0.457022607f, 0.746265352f, 0.746264517f, 0.746265054f,
+        0.664753199f, 0.664752364f, 0.664752781f, 0.716993093f, 0.716992199f, 0.716992736f,
+        0.304196954f, 0.304196626f, 0.304196835f, 0.473350704f, 0.473350108f, 0.473350465f,
+        0.697152197f, 0.697151363f, 0.69715184f, 0.888442457f, 0.888441384f, 0.88844198f,
+        0.943796694f, 0.943795562f, 0.943796277f, 0.903856099f, 0.903855026f, 0.903855622f,
+        0.590796292f, 0.590795636f, 0.590796053f, 0.69398129f, 0.693980396f, 0.693980932f,
+        0.915226161f, 0.915225029f, 0.915225744f, 0.70105046f, 0.701049566f, 0.701050103f,
+        0.813667297f, 0.813666284f, 0.81366688f, 0.765960813f, 0.765959918f, 0.765960395f,
+        0.476552576f, 0.47655201f, 0.476552337f, 0.749518692f, 0.749517739f, 0.749518275f,
+        0.934176445f, 0.934175372f, 0.934176028f, 0.0f, 0.0f, 0.0f,
+        0.580350637f, 0.580349982f, 0.58035028f, 0.503698647f, 0.503697991f, 0.503698349f,
+        0.71518141f, 0.715180576f, 0.715181112f, 0.92484355f, 0.924842358f, 0.924843073f,
+        0.912894189f, 0.912892997f, 0.912893713f, 0.3492392f, 0.349238783f, 0.349239022f,
+        0.760705113f, 0.760704219f, 0.760704696f, 0.306465566f, 0.306465179f, 0.306465387f,
+        0.913935602f, 0.91393441f, 0.913935125f, 0.731309116f, 0.731308281f, 0.731308699f,
+        0.798437297f, 0.798436284f, 0.79843688f, 0.468806893f, 0.468806297f, 0.468806654f,
+        0.767878473f, 0.767877519f, 0.767878115f, 0.490497321f, 0.490496725f, 0.490497082f,
+        0.686721087f, 0.686720252f, 0.686720729f, 0.620389223f, 0.620388448f, 0.620388865f,
+    },
+    {
+        0.729740381f, 0.729739487f, 0.729739964f, 0.740769565f, 0.740768552f, 0.740769088f,
+        0.735941529f, 0.735940635f, 0.735941231f, 0.880788743f, 0.880787611f, 0.880788267f,
+        0.920291424f, 0.920290291f, 0.920290947f, 0.368617415f, 0.368616939f, 0.368617177f,
+        0.703385413f, 0.703384519f, 0.703385055f, 0.743239582f, 0.743238747f, 0.743239284f,
+        0.829425335f, 0.829424322f, 0.829424977f, 0.555032253f, 0.555031538f, 0.555032015f,
+        0.776804209f, 0.776803255f, 0.776803792f, 0.817305923f, 0.817304909f, 0.817305446f,
+        0.755612731f, 0.755611837f, 0.755612314f, 0.335362256f, 0.335361779f, 0.335362047f,
+        0.801992655f, 0.801991701f, 0.801992178f, 0.895768404f, 0.895767212f, 0.895767868f,
+        0.919954777f, 0.919953644f, 0.9199543f, 0.686764419f, 0.686763585f, 0.686764002f,
+        0.716446996f, 0.716446102f, 0.716446698f, 0.818783104f, 0.818782151f, 0.818782687f,
+        0.935117006f, 0.935115933f, 0.935116529f, 0.890246451f, 0.890245318f, 0.890245974f,
+        0.823818266f, 0.823817253f, 0.823817849f, 0.855268657f, 0.855267584f, 0.85526824f,
+        0.863732517f, 0.863731503f, 0.8637321f, 0.318209589f, 0.318209231f, 0.31820944f,
+        0.356604546f, 0.356604099f, 0.356604338f, 0.685719252f, 0.685718477f, 0.685718954f,
+        0.68060261f, 0.680601776f, 0.680602193f, 0.912429631f, 0.912428498f, 0.912429154f,
+        0.576261818f, 0.576261163f, 0.57626158f, 0.920558333f, 0.920557261f, 0.920557857f,
+        0.904572427f, 0.904571354f, 0.904571891f, 0.901650608f, 0.901649475f, 0.90165019f,
+        0.869284451f, 0.869283438f, 0.869284034f, 0.36808008f, 0.368079633f, 0.368079871f,
+        0.615802824f, 0.61580205f, 0.615802467f, 0.286782295f, 0.286781937f, 0.286782146f,
+        0.768274009f, 0.768273056f, 0.768273592f, 0.825249195f, 0.825248182f, 0.825248778f,
+        0.892566681f, 0.892565608f, 0.892566264f, 0.823918283f, 0.82391727f, 0.823917866f,
+        0.849904954f, 0.849903882f, 0.849904478f, 0.628892541f, 0.628891706f, 0.628892124f,
+        0.841085553f, 0.84108454f, 0.841085076f, 0.716838896f, 0.716838121f, 0.716838598f,
+        0.569870889f, 0.569870174f, 0.569870591f, 0.919653952f, 0.919652879f, 0.919653535f,
+        0.804562271f, 0.804561257f, 0.804561853f, 0.747304499f, 0.747303605f, 0.747304142f,
+        0.840423822f, 0.84042275f, 0.840423405f, 0.399474502f, 0.399473995f, 0.399474293f,
+        0.633747101f, 0.633746266f, 0.633746684f, 0.81656599f, 0.816565037f, 0.816565573f,
+        0.733908236f, 0.733907282f, 0.733907819f, 0.889956474f, 0.889955401f, 0.889956057f,
+        0.359850258f, 0.359849781f, 0.359850049f, 0.78395921f, 0.783958316f, 0.783958793f,
+        0.662356615f, 0.662355781f, 0.662356257f, 0.691940546f, 0.691939652f, 0.691940129f,
+        0.911895096f, 0.911893904f, 0.91189456f, 0.701274514f, 0.70127362f, 0.701274097f,
+        0.932432532f, 0.9324314f, 0.932432055f, 0.749192059f, 0.749191105f, 0.749191642f,
+    },
+};
+
+}  // namespace test
+}  // namespace baktsiu
+#endif // BAKTSIU_PRESENT_REFERENCE_H_
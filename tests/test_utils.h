@@ -0,0 +1,45 @@
+#ifndef BAKTSIU_TEST_UTILS_H_
+#define BAKTSIU_TEST_UTILS_H_
+
+#include <spdlog/fmt/fmt.h>
+
+#include <cstdio>
+
+namespace baktsiu
+{
+namespace test
+{
+
+// Number of failed checks of current test executable.
+inline int& failureCount()
+{
+    static int count = 0;
+    return count;
+}
+
+// Return code of test executable, see TEST_CHECK.
+inline int getTestResult()
+{
+    if (failureCount() > 0) {
+        fmt::print(stderr, "{} check(s) failed\n", failureCount());
+        return 1;
+    }
+
+    fmt::print("All checks passed\n");
+    return 0;
+}
+
+}  // namespace test
+}  // namespace baktsiu
+
+// Record failure of condition with formatted message, the test keeps running.
+#define TEST_CHECK(cond, ...) do {\
+    if (!(cond)) {\
+        ++baktsiu::test::failureCount();\
+        fmt::print(stderr, "{}:{}: check failed: {}\n  ", __FILE__, __LINE__, #cond);\
+        fmt::print(stderr, __VA_ARGS__);\
+        fmt::print(stderr, "\n");\
+    }\
+} while (false)
+
+#endif // BAKTSIU_TEST_UTILS_H_